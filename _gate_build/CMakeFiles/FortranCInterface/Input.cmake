@@ -0,0 +1,3 @@
+set(CMAKE_Fortran_COMPILER_ID "GNU")
+set(FortranCInterface_GLOBAL_SYMBOLS "")
+set(FortranCInterface_MODULE_SYMBOLS "")
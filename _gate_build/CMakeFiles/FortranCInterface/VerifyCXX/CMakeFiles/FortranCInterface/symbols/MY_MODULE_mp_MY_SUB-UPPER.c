@@ -0,0 +1,4 @@
+const char* MY_MODULE_mp_MY_SUB(void)
+{
+  return "INFO:symbol[MY_MODULE_mp_MY_SUB]";
+}
@@ -0,0 +1,4 @@
+const char* __my_module__my_sub(void)
+{
+  return "INFO:symbol[__my_module__my_sub]";
+}
@@ -0,0 +1,4 @@
+const char* __mymodule__mysub(void)
+{
+  return "INFO:symbol[__mymodule__mysub]";
+}
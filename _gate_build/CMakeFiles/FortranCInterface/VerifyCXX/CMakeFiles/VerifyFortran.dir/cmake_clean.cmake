@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/VerifyFortran.dir/VerifyFortran.f.o"
+  "libVerifyFortran.a"
+  "libVerifyFortran.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/VerifyFortran.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,4 @@
+const char* MYMODULE_mp_MYSUB(void)
+{
+  return "INFO:symbol[MYMODULE_mp_MYSUB]";
+}
@@ -0,0 +1,4 @@
+const char* __my_module_NMOD_my_sub(void)
+{
+  return "INFO:symbol[__my_module_NMOD_my_sub]";
+}
@@ -0,0 +1,4 @@
+const char* __mymodule_NMOD_mysub(void)
+{
+  return "INFO:symbol[__mymodule_NMOD_mysub]";
+}
@@ -0,0 +1,4 @@
+const char* my_module_my_sub_(void)
+{
+  return "INFO:symbol[my_module_my_sub_]";
+}
@@ -0,0 +1,4 @@
+const char* mymodule_mysub_(void)
+{
+  return "INFO:symbol[mymodule_mysub_]";
+}
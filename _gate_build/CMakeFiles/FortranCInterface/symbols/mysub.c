@@ -0,0 +1,4 @@
+const char* mysub(void)
+{
+  return "INFO:symbol[mysub]";
+}
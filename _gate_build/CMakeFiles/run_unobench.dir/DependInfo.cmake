@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unobench/NormBenchmarks.cpp" "CMakeFiles/run_unobench.dir/unobench/NormBenchmarks.cpp.o" "gcc" "CMakeFiles/run_unobench.dir/unobench/NormBenchmarks.cpp.o.d"
+  "/root/repo/unobench/SparseStorageBenchmarks.cpp" "CMakeFiles/run_unobench.dir/unobench/SparseStorageBenchmarks.cpp.o" "gcc" "CMakeFiles/run_unobench.dir/unobench/SparseStorageBenchmarks.cpp.o.d"
+  "/root/repo/unobench/SparseVectorBenchmarks.cpp" "CMakeFiles/run_unobench.dir/unobench/SparseVectorBenchmarks.cpp.o" "gcc" "CMakeFiles/run_unobench.dir/unobench/SparseVectorBenchmarks.cpp.o.d"
+  "/root/repo/unobench/SymbolicBenchmarks.cpp" "CMakeFiles/run_unobench.dir/unobench/SymbolicBenchmarks.cpp.o" "gcc" "CMakeFiles/run_unobench.dir/unobench/SymbolicBenchmarks.cpp.o.d"
+  "/root/repo/unobench/unobench.cpp" "CMakeFiles/run_unobench.dir/unobench/unobench.cpp.o" "gcc" "CMakeFiles/run_unobench.dir/unobench/unobench.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/CMakeFiles/uno.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
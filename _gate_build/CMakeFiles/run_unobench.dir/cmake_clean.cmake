@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unobench.dir/unobench/NormBenchmarks.cpp.o"
+  "CMakeFiles/run_unobench.dir/unobench/NormBenchmarks.cpp.o.d"
+  "CMakeFiles/run_unobench.dir/unobench/SparseStorageBenchmarks.cpp.o"
+  "CMakeFiles/run_unobench.dir/unobench/SparseStorageBenchmarks.cpp.o.d"
+  "CMakeFiles/run_unobench.dir/unobench/SparseVectorBenchmarks.cpp.o"
+  "CMakeFiles/run_unobench.dir/unobench/SparseVectorBenchmarks.cpp.o.d"
+  "CMakeFiles/run_unobench.dir/unobench/SymbolicBenchmarks.cpp.o"
+  "CMakeFiles/run_unobench.dir/unobench/SymbolicBenchmarks.cpp.o.d"
+  "CMakeFiles/run_unobench.dir/unobench/unobench.cpp.o"
+  "CMakeFiles/run_unobench.dir/unobench/unobench.cpp.o.d"
+  "run_unobench"
+  "run_unobench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unobench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unotest/AllocationTrackerTests.cpp" "CMakeFiles/run_unotest.dir/unotest/AllocationTrackerTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/AllocationTrackerTests.cpp.o.d"
+  "/root/repo/unotest/BitmaskTests.cpp" "CMakeFiles/run_unotest.dir/unotest/BitmaskTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/BitmaskTests.cpp.o.d"
+  "/root/repo/unotest/BlockedCOOSparseStorageTests.cpp" "CMakeFiles/run_unotest.dir/unotest/BlockedCOOSparseStorageTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/BlockedCOOSparseStorageTests.cpp.o.d"
+  "/root/repo/unotest/COOSparseStorageTests.cpp" "CMakeFiles/run_unotest.dir/unotest/COOSparseStorageTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/COOSparseStorageTests.cpp.o.d"
+  "/root/repo/unotest/CSRSparseStorageTests.cpp" "CMakeFiles/run_unotest.dir/unotest/CSRSparseStorageTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/CSRSparseStorageTests.cpp.o.d"
+  "/root/repo/unotest/CollectionAdapterTests.cpp" "CMakeFiles/run_unotest.dir/unotest/CollectionAdapterTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/CollectionAdapterTests.cpp.o.d"
+  "/root/repo/unotest/ConcatenationTests.cpp" "CMakeFiles/run_unotest.dir/unotest/ConcatenationTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/ConcatenationTests.cpp.o.d"
+  "/root/repo/unotest/CopyOnWriteVectorTests.cpp" "CMakeFiles/run_unotest.dir/unotest/CopyOnWriteVectorTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/CopyOnWriteVectorTests.cpp.o.d"
+  "/root/repo/unotest/FilterTests.cpp" "CMakeFiles/run_unotest.dir/unotest/FilterTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/FilterTests.cpp.o.d"
+  "/root/repo/unotest/MINRESSolverTests.cpp" "CMakeFiles/run_unotest.dir/unotest/MINRESSolverTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/MINRESSolverTests.cpp.o.d"
+  "/root/repo/unotest/MatrixVectorProductTests.cpp" "CMakeFiles/run_unotest.dir/unotest/MatrixVectorProductTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/MatrixVectorProductTests.cpp.o.d"
+  "/root/repo/unotest/NormTests.cpp" "CMakeFiles/run_unotest.dir/unotest/NormTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/NormTests.cpp.o.d"
+  "/root/repo/unotest/RangeTests.cpp" "CMakeFiles/run_unotest.dir/unotest/RangeTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/RangeTests.cpp.o.d"
+  "/root/repo/unotest/RectangularMatrixTests.cpp" "CMakeFiles/run_unotest.dir/unotest/RectangularMatrixTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/RectangularMatrixTests.cpp.o.d"
+  "/root/repo/unotest/ScalarMultipleTests.cpp" "CMakeFiles/run_unotest.dir/unotest/ScalarMultipleTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/ScalarMultipleTests.cpp.o.d"
+  "/root/repo/unotest/SchurComplementSolverTests.cpp" "CMakeFiles/run_unotest.dir/unotest/SchurComplementSolverTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/SchurComplementSolverTests.cpp.o.d"
+  "/root/repo/unotest/SparseVectorTests.cpp" "CMakeFiles/run_unotest.dir/unotest/SparseVectorTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/SparseVectorTests.cpp.o.d"
+  "/root/repo/unotest/SumTests.cpp" "CMakeFiles/run_unotest.dir/unotest/SumTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/SumTests.cpp.o.d"
+  "/root/repo/unotest/TaskSchedulerTests.cpp" "CMakeFiles/run_unotest.dir/unotest/TaskSchedulerTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/TaskSchedulerTests.cpp.o.d"
+  "/root/repo/unotest/VectorTests.cpp" "CMakeFiles/run_unotest.dir/unotest/VectorTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/VectorTests.cpp.o.d"
+  "/root/repo/unotest/VectorViewTests.cpp" "CMakeFiles/run_unotest.dir/unotest/VectorViewTests.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/VectorViewTests.cpp.o.d"
+  "/root/repo/unotest/unotest.cpp" "CMakeFiles/run_unotest.dir/unotest/unotest.cpp.o" "gcc" "CMakeFiles/run_unotest.dir/unotest/unotest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/CMakeFiles/uno.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
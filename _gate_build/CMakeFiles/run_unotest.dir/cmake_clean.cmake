@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unotest.dir/unotest/AllocationTrackerTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/AllocationTrackerTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/BitmaskTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/BitmaskTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/BlockedCOOSparseStorageTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/BlockedCOOSparseStorageTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/COOSparseStorageTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/COOSparseStorageTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/CSRSparseStorageTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/CSRSparseStorageTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/CollectionAdapterTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/CollectionAdapterTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/ConcatenationTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/ConcatenationTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/CopyOnWriteVectorTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/CopyOnWriteVectorTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/FilterTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/FilterTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/MINRESSolverTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/MINRESSolverTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/MatrixVectorProductTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/MatrixVectorProductTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/NormTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/NormTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/RangeTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/RangeTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/RectangularMatrixTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/RectangularMatrixTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/ScalarMultipleTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/ScalarMultipleTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/SchurComplementSolverTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/SchurComplementSolverTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/SparseVectorTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/SparseVectorTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/SumTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/SumTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/TaskSchedulerTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/TaskSchedulerTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/VectorTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/VectorTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/VectorViewTests.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/VectorViewTests.cpp.o.d"
+  "CMakeFiles/run_unotest.dir/unotest/unotest.cpp.o"
+  "CMakeFiles/run_unotest.dir/unotest/unotest.cpp.o.d"
+  "run_unotest"
+  "run_unotest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unotest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,82 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/uno/Multistart.cpp" "CMakeFiles/uno.dir/uno/Multistart.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/Multistart.cpp.o.d"
+  "/root/repo/uno/ParametricSession.cpp" "CMakeFiles/uno.dir/uno/ParametricSession.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ParametricSession.cpp.o.d"
+  "/root/repo/uno/Uno.cpp" "CMakeFiles/uno.dir/uno/Uno.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/Uno.cpp.o.d"
+  "/root/repo/uno/ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.cpp" "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.cpp.o.d"
+  "/root/repo/uno/ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.cpp" "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.cpp.o.d"
+  "/root/repo/uno/ingredients/constraint_relaxation_strategies/FeasibilityRestoration.cpp" "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/FeasibilityRestoration.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/FeasibilityRestoration.cpp.o.d"
+  "/root/repo/uno/ingredients/constraint_relaxation_strategies/l1Relaxation.cpp" "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/l1Relaxation.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/l1Relaxation.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_mechanisms/BacktrackingLineSearch.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/BacktrackingLineSearch.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/BacktrackingLineSearch.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_mechanisms/GlobalizationMechanism.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/GlobalizationMechanism.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/GlobalizationMechanism.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_mechanisms/GlobalizationMechanismFactory.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/GlobalizationMechanismFactory.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/GlobalizationMechanismFactory.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_mechanisms/TrustRegionStrategy.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/TrustRegionStrategy.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/TrustRegionStrategy.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_mechanisms/WatchdogLineSearch.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/WatchdogLineSearch.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/WatchdogLineSearch.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/GlobalizationStrategy.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/GlobalizationStrategy.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/GlobalizationStrategy.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/GlobalizationStrategyFactory.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/GlobalizationStrategyFactory.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/GlobalizationStrategyFactory.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/l1MeritFunction.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/l1MeritFunction.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/l1MeritFunction.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/switching_methods/SwitchingMethod.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/SwitchingMethod.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/SwitchingMethod.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/switching_methods/filter_methods/FilterMethod.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/FilterMethod.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/FilterMethod.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/switching_methods/filter_methods/FletcherFilterMethod.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/FletcherFilterMethod.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/FletcherFilterMethod.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/switching_methods/filter_methods/WaechterFilterMethod.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/WaechterFilterMethod.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/WaechterFilterMethod.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/Filter.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/Filter.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/Filter.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/FilterFactory.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/FilterFactory.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/FilterFactory.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/NonmonotoneFilter.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/NonmonotoneFilter.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/NonmonotoneFilter.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/switching_methods/funnel_methods/Funnel.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/funnel_methods/Funnel.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/funnel_methods/Funnel.cpp.o.d"
+  "/root/repo/uno/ingredients/globalization_strategies/switching_methods/funnel_methods/FunnelMethod.cpp" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/funnel_methods/FunnelMethod.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/funnel_methods/FunnelMethod.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/Direction.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/Direction.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/Direction.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/HessianModel.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/HessianModel.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/HessianModel.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/Subproblem.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/Subproblem.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/Subproblem.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/SubproblemFactory.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/SubproblemFactory.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/SubproblemFactory.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/inequality_constrained_methods/InequalityConstrainedMethod.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/InequalityConstrainedMethod.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/InequalityConstrainedMethod.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/inequality_constrained_methods/LPSubproblem.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/LPSubproblem.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/LPSubproblem.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/inequality_constrained_methods/QPSubproblem.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/QPSubproblem.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/QPSubproblem.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/interior_point_methods/AdaptiveMehrotraBarrierParameterUpdateStrategy.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/AdaptiveMehrotraBarrierParameterUpdateStrategy.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/AdaptiveMehrotraBarrierParameterUpdateStrategy.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/interior_point_methods/BarrierParameterUpdateStrategy.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/BarrierParameterUpdateStrategy.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/BarrierParameterUpdateStrategy.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/interior_point_methods/BarrierParameterUpdateStrategyFactory.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/BarrierParameterUpdateStrategyFactory.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/BarrierParameterUpdateStrategyFactory.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/interior_point_methods/MonotoneBarrierParameterUpdateStrategy.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/MonotoneBarrierParameterUpdateStrategy.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/MonotoneBarrierParameterUpdateStrategy.cpp.o.d"
+  "/root/repo/uno/ingredients/subproblems/interior_point_methods/PrimalDualInteriorPointSubproblem.cpp" "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/PrimalDualInteriorPointSubproblem.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/PrimalDualInteriorPointSubproblem.cpp.o.d"
+  "/root/repo/uno/linear_algebra/CompensatedSum.cpp" "CMakeFiles/uno.dir/uno/linear_algebra/CompensatedSum.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/linear_algebra/CompensatedSum.cpp.o.d"
+  "/root/repo/uno/linear_algebra/FirstTouchAllocator.cpp" "CMakeFiles/uno.dir/uno/linear_algebra/FirstTouchAllocator.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/linear_algebra/FirstTouchAllocator.cpp.o.d"
+  "/root/repo/uno/linear_algebra/KKTCapture.cpp" "CMakeFiles/uno.dir/uno/linear_algebra/KKTCapture.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/linear_algebra/KKTCapture.cpp.o.d"
+  "/root/repo/uno/linear_algebra/Vector.cpp" "CMakeFiles/uno.dir/uno/linear_algebra/Vector.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/linear_algebra/Vector.cpp.o.d"
+  "/root/repo/uno/model/Model.cpp" "CMakeFiles/uno.dir/uno/model/Model.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/model/Model.cpp.o.d"
+  "/root/repo/uno/model/ModelFactory.cpp" "CMakeFiles/uno.dir/uno/model/ModelFactory.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/model/ModelFactory.cpp.o.d"
+  "/root/repo/uno/optimization/EvaluationCounters.cpp" "CMakeFiles/uno.dir/uno/optimization/EvaluationCounters.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/optimization/EvaluationCounters.cpp.o.d"
+  "/root/repo/uno/optimization/Iterate.cpp" "CMakeFiles/uno.dir/uno/optimization/Iterate.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/optimization/Iterate.cpp.o.d"
+  "/root/repo/uno/optimization/Result.cpp" "CMakeFiles/uno.dir/uno/optimization/Result.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/optimization/Result.cpp.o.d"
+  "/root/repo/uno/preprocessing/BoundTightening.cpp" "CMakeFiles/uno.dir/uno/preprocessing/BoundTightening.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/preprocessing/BoundTightening.cpp.o.d"
+  "/root/repo/uno/preprocessing/Preprocessing.cpp" "CMakeFiles/uno.dir/uno/preprocessing/Preprocessing.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/preprocessing/Preprocessing.cpp.o.d"
+  "/root/repo/uno/preprocessing/Scaling.cpp" "CMakeFiles/uno.dir/uno/preprocessing/Scaling.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/preprocessing/Scaling.cpp.o.d"
+  "/root/repo/uno/solvers/MINRES/MINRESSolver.cpp" "CMakeFiles/uno.dir/uno/solvers/MINRES/MINRESSolver.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/solvers/MINRES/MINRESSolver.cpp.o.d"
+  "/root/repo/uno/solvers/RacingLinearSolver.cpp" "CMakeFiles/uno.dir/uno/solvers/RacingLinearSolver.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/solvers/RacingLinearSolver.cpp.o.d"
+  "/root/repo/uno/solvers/SchurComplementSolver.cpp" "CMakeFiles/uno.dir/uno/solvers/SchurComplementSolver.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/solvers/SchurComplementSolver.cpp.o.d"
+  "/root/repo/uno/tools/AllocationTracker.cpp" "CMakeFiles/uno.dir/uno/tools/AllocationTracker.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/AllocationTracker.cpp.o.d"
+  "/root/repo/uno/tools/AsyncLogger.cpp" "CMakeFiles/uno.dir/uno/tools/AsyncLogger.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/AsyncLogger.cpp.o.d"
+  "/root/repo/uno/tools/AutoTuner.cpp" "CMakeFiles/uno.dir/uno/tools/AutoTuner.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/AutoTuner.cpp.o.d"
+  "/root/repo/uno/tools/Deadline.cpp" "CMakeFiles/uno.dir/uno/tools/Deadline.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/Deadline.cpp.o.d"
+  "/root/repo/uno/tools/MemoryUsage.cpp" "CMakeFiles/uno.dir/uno/tools/MemoryUsage.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/MemoryUsage.cpp.o.d"
+  "/root/repo/uno/tools/Options.cpp" "CMakeFiles/uno.dir/uno/tools/Options.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/Options.cpp.o.d"
+  "/root/repo/uno/tools/Profiler.cpp" "CMakeFiles/uno.dir/uno/tools/Profiler.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/Profiler.cpp.o.d"
+  "/root/repo/uno/tools/Statistics.cpp" "CMakeFiles/uno.dir/uno/tools/Statistics.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/Statistics.cpp.o.d"
+  "/root/repo/uno/tools/StatisticsStreamer.cpp" "CMakeFiles/uno.dir/uno/tools/StatisticsStreamer.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/StatisticsStreamer.cpp.o.d"
+  "/root/repo/uno/tools/TaskScheduler.cpp" "CMakeFiles/uno.dir/uno/tools/TaskScheduler.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/TaskScheduler.cpp.o.d"
+  "/root/repo/uno/tools/ThreadPool.cpp" "CMakeFiles/uno.dir/uno/tools/ThreadPool.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/ThreadPool.cpp.o.d"
+  "/root/repo/uno/tools/Timer.cpp" "CMakeFiles/uno.dir/uno/tools/Timer.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/Timer.cpp.o.d"
+  "/root/repo/uno/tools/TuningCache.cpp" "CMakeFiles/uno.dir/uno/tools/TuningCache.cpp.o" "gcc" "CMakeFiles/uno.dir/uno/tools/TuningCache.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,137 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uno.dir/uno/Multistart.cpp.o"
+  "CMakeFiles/uno.dir/uno/Multistart.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ParametricSession.cpp.o"
+  "CMakeFiles/uno.dir/uno/ParametricSession.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/Uno.cpp.o"
+  "CMakeFiles/uno.dir/uno/Uno.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/FeasibilityRestoration.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/FeasibilityRestoration.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/l1Relaxation.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/constraint_relaxation_strategies/l1Relaxation.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/BacktrackingLineSearch.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/BacktrackingLineSearch.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/GlobalizationMechanism.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/GlobalizationMechanism.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/GlobalizationMechanismFactory.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/GlobalizationMechanismFactory.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/TrustRegionStrategy.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/TrustRegionStrategy.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/WatchdogLineSearch.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_mechanisms/WatchdogLineSearch.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/GlobalizationStrategy.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/GlobalizationStrategy.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/GlobalizationStrategyFactory.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/GlobalizationStrategyFactory.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/l1MeritFunction.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/l1MeritFunction.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/SwitchingMethod.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/SwitchingMethod.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/FilterMethod.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/FilterMethod.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/FletcherFilterMethod.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/FletcherFilterMethod.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/WaechterFilterMethod.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/WaechterFilterMethod.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/Filter.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/Filter.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/FilterFactory.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/FilterFactory.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/NonmonotoneFilter.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/filter_methods/filters/NonmonotoneFilter.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/funnel_methods/Funnel.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/funnel_methods/Funnel.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/funnel_methods/FunnelMethod.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/globalization_strategies/switching_methods/funnel_methods/FunnelMethod.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/Direction.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/Direction.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/HessianModel.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/HessianModel.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/Subproblem.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/Subproblem.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/SubproblemFactory.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/SubproblemFactory.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/InequalityConstrainedMethod.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/InequalityConstrainedMethod.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/LPSubproblem.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/LPSubproblem.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/QPSubproblem.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/inequality_constrained_methods/QPSubproblem.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/AdaptiveMehrotraBarrierParameterUpdateStrategy.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/AdaptiveMehrotraBarrierParameterUpdateStrategy.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/BarrierParameterUpdateStrategy.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/BarrierParameterUpdateStrategy.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/BarrierParameterUpdateStrategyFactory.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/BarrierParameterUpdateStrategyFactory.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/MonotoneBarrierParameterUpdateStrategy.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/MonotoneBarrierParameterUpdateStrategy.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/PrimalDualInteriorPointSubproblem.cpp.o"
+  "CMakeFiles/uno.dir/uno/ingredients/subproblems/interior_point_methods/PrimalDualInteriorPointSubproblem.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/linear_algebra/CompensatedSum.cpp.o"
+  "CMakeFiles/uno.dir/uno/linear_algebra/CompensatedSum.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/linear_algebra/FirstTouchAllocator.cpp.o"
+  "CMakeFiles/uno.dir/uno/linear_algebra/FirstTouchAllocator.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/linear_algebra/KKTCapture.cpp.o"
+  "CMakeFiles/uno.dir/uno/linear_algebra/KKTCapture.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/linear_algebra/Vector.cpp.o"
+  "CMakeFiles/uno.dir/uno/linear_algebra/Vector.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/model/Model.cpp.o"
+  "CMakeFiles/uno.dir/uno/model/Model.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/model/ModelFactory.cpp.o"
+  "CMakeFiles/uno.dir/uno/model/ModelFactory.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/optimization/EvaluationCounters.cpp.o"
+  "CMakeFiles/uno.dir/uno/optimization/EvaluationCounters.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/optimization/Iterate.cpp.o"
+  "CMakeFiles/uno.dir/uno/optimization/Iterate.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/optimization/Result.cpp.o"
+  "CMakeFiles/uno.dir/uno/optimization/Result.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/preprocessing/BoundTightening.cpp.o"
+  "CMakeFiles/uno.dir/uno/preprocessing/BoundTightening.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/preprocessing/Preprocessing.cpp.o"
+  "CMakeFiles/uno.dir/uno/preprocessing/Preprocessing.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/preprocessing/Scaling.cpp.o"
+  "CMakeFiles/uno.dir/uno/preprocessing/Scaling.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/solvers/MINRES/MINRESSolver.cpp.o"
+  "CMakeFiles/uno.dir/uno/solvers/MINRES/MINRESSolver.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/solvers/RacingLinearSolver.cpp.o"
+  "CMakeFiles/uno.dir/uno/solvers/RacingLinearSolver.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/solvers/SchurComplementSolver.cpp.o"
+  "CMakeFiles/uno.dir/uno/solvers/SchurComplementSolver.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/AllocationTracker.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/AllocationTracker.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/AsyncLogger.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/AsyncLogger.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/AutoTuner.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/AutoTuner.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/Deadline.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/Deadline.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/MemoryUsage.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/MemoryUsage.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/Options.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/Options.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/Profiler.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/Profiler.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/Statistics.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/Statistics.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/StatisticsStreamer.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/StatisticsStreamer.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/TaskScheduler.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/TaskScheduler.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/ThreadPool.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/ThreadPool.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/Timer.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/Timer.cpp.o.d"
+  "CMakeFiles/uno.dir/uno/tools/TuningCache.cpp.o"
+  "CMakeFiles/uno.dir/uno/tools/TuningCache.cpp.o.d"
+  "libuno.a"
+  "libuno.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uno.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bindings/C/CallbackModel.cpp" "CMakeFiles/uno_c.dir/bindings/C/CallbackModel.cpp.o" "gcc" "CMakeFiles/uno_c.dir/bindings/C/CallbackModel.cpp.o.d"
+  "/root/repo/bindings/C/uno_c_api.cpp" "CMakeFiles/uno_c.dir/bindings/C/uno_c_api.cpp.o" "gcc" "CMakeFiles/uno_c.dir/bindings/C/uno_c_api.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/CMakeFiles/uno.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uno_c.dir/bindings/C/CallbackModel.cpp.o"
+  "CMakeFiles/uno_c.dir/bindings/C/CallbackModel.cpp.o.d"
+  "CMakeFiles/uno_c.dir/bindings/C/uno_c_api.cpp.o"
+  "CMakeFiles/uno_c.dir/bindings/C/uno_c_api.cpp.o.d"
+  "libuno_c.a"
+  "libuno_c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uno_c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uno_replay.dir/unoreplay/uno_replay.cpp.o"
+  "CMakeFiles/uno_replay.dir/unoreplay/uno_replay.cpp.o.d"
+  "uno_replay"
+  "uno_replay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uno_replay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -1,7 +1,21 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "AMPLModel.hpp"
 #include "linear_algebra/RectangularMatrix.hpp"
 #include "linear_algebra/SymmetricMatrix.hpp"
@@ -32,15 +46,116 @@ namespace uno {
       return asl;
    }
 
+   // binary sidecar cache ("file.nl.unostruct") of the model structure derived in generate_variables,
+   // generate_constraints and generate_gradient_sparsity_patterns. The cache is keyed by the size and
+   // modification time of the .nl file and silently ignored when stale or corrupt. The format is a raw
+   // memory dump: it is machine-dependent and only meant to be reused on the machine that wrote it
+   const uint32_t structure_cache_version = 2;
+
+   std::string structure_cache_name(const std::string& file_name) {
+      return file_name + ".unostruct";
+   }
+
+   bool nl_file_fingerprint(const std::string& file_name, uint64_t& nl_size, int64_t& nl_time) {
+      std::error_code error{};
+      nl_size = static_cast<uint64_t>(std::filesystem::file_size(file_name, error));
+      if (error) {
+         return false;
+      }
+      const auto write_time = std::filesystem::last_write_time(file_name, error);
+      if (error) {
+         return false;
+      }
+      nl_time = static_cast<int64_t>(write_time.time_since_epoch().count());
+      return true;
+   }
+
+   template <typename T>
+   void write_binary(std::ofstream& stream, const T& value) {
+      stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+   }
+
+   template <typename T>
+   void write_binary_vector(std::ofstream& stream, const std::vector<T>& vector) {
+      write_binary(stream, vector.size());
+      stream.write(reinterpret_cast<const char*>(vector.data()), static_cast<std::streamsize>(vector.size() * sizeof(T)));
+   }
+
+   template <typename T>
+   void read_binary(std::ifstream& stream, T& value) {
+      stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+   }
+
+   // fixed-size vectors (sized by the number of variables or constraints) are read in place: a size
+   // mismatch marks the stream as failed
+   template <typename T>
+   void read_binary_data(std::ifstream& stream, std::vector<T>& vector) {
+      size_t size = 0;
+      read_binary(stream, size);
+      if (not stream || size != vector.size()) {
+         stream.setstate(std::ios::failbit);
+         return;
+      }
+      stream.read(reinterpret_cast<char*>(vector.data()), static_cast<std::streamsize>(size * sizeof(T)));
+   }
+
+   // variable-size vectors (index lists, sparsity patterns) are resized to the recorded size, capped
+   // so that a corrupt size field cannot trigger a huge allocation
+   template <typename T>
+   void read_binary_list(std::ifstream& stream, std::vector<T>& vector, size_t maximum_size) {
+      size_t size = 0;
+      read_binary(stream, size);
+      if (not stream || maximum_size < size) {
+         stream.setstate(std::ios::failbit);
+         return;
+      }
+      vector.resize(size);
+      stream.read(reinterpret_cast<char*>(vector.data()), static_cast<std::streamsize>(size * sizeof(T)));
+   }
+
+#ifndef _WIN32
+   // layout of the shared memory segment that carries the flattened constraint gradient patterns:
+   // this header, then the (number_constraints + 1) offsets, then the pattern index arena. Like the
+   // sidecar cache, the layout is a raw memory dump and only meant for processes on the same machine
+   struct SharedStructureHeader {
+      uint32_t version;
+      uint32_t ready; // set to 1 once the creator has finished filling the segment
+      uint64_t nl_size;
+      int64_t nl_time;
+      uint64_t number_constraints;
+      uint64_t number_pattern_nonzeros;
+   };
+
+   // one segment per (.nl path, fingerprint): the name hashes the path so that unrelated instances
+   // never collide, and the fingerprint so that a rewritten .nl file gets a fresh segment
+   std::string shared_structure_name(const std::string& file_name, uint64_t nl_size, int64_t nl_time) {
+      uint64_t hash = 0xcbf29ce484222325;
+      const auto combine = [&hash](const char* data, size_t size) {
+         for (size_t index = 0; index < size; index++) {
+            hash = (hash ^ static_cast<uint64_t>(static_cast<unsigned char>(data[index]))) * 0x100000001b3;
+         }
+      };
+      combine(file_name.data(), file_name.size());
+      combine(reinterpret_cast<const char*>(&nl_size), sizeof(nl_size));
+      combine(reinterpret_cast<const char*>(&nl_time), sizeof(nl_time));
+      return "/uno_structure_" + std::to_string(hash);
+   }
+#endif // _WIN32
+
    // generate the ASL object and call the private constructor
-   AMPLModel::AMPLModel(const std::string& file_name) : AMPLModel(file_name, generate_asl(file_name)) {
+   AMPLModel::AMPLModel(const std::string& file_name, size_t number_evaluation_threads, bool use_structure_cache, bool use_shared_structure,
+         size_t constraint_profiling_interval, bool parallel_constraint_evaluation) :
+         AMPLModel(file_name, generate_asl(file_name), number_evaluation_threads, use_structure_cache, use_shared_structure,
+               constraint_profiling_interval, parallel_constraint_evaluation) {
    }
 
-   AMPLModel::AMPLModel(const std::string& file_name, ASL* asl) :
+   AMPLModel::AMPLModel(const std::string& file_name, ASL* asl, size_t number_evaluation_threads, bool use_structure_cache, bool use_shared_structure,
+         size_t constraint_profiling_interval, bool parallel_constraint_evaluation) :
          Model(file_name, static_cast<size_t>(asl->i.n_var_), static_cast<size_t>(asl->i.n_con_), (asl->i.objtype_[0] == 1) ? -1. : 1.),
          asl(asl),
+         constraint_profiling_interval(constraint_profiling_interval),
+         parallel_constraint_evaluation(parallel_constraint_evaluation && 1 < number_evaluation_threads),
          // allocate vectors
-         asl_gradient(this->number_variables),
          variable_lower_bounds(this->number_variables),
          variable_upper_bounds(this->number_variables),
          constraint_lower_bounds(this->number_constraints),
@@ -56,28 +171,117 @@ namespace uno {
          single_upper_bounded_variables_collection(this->single_upper_bounded_variables) {
       // evaluate the constraint Jacobian in sparse mode
       this->asl->i.congrd_mode = 1;
+      // no nonlinear objective: the objective gradient is constant and is cached once evaluated
+      this->objective_is_linear = (0 < this->asl->i.n_obj_ && this->asl->i.nlo_ == 0);
+
+      // derive the model structure (bounds, types, index lists, sparsity patterns) from the ASL data,
+      // or load it from the sidecar cache of a previous run of the same .nl file
+      if (not (use_structure_cache && this->load_structure_cache(file_name))) {
+         // variables
+         this->lower_bounded_variables.reserve(this->number_variables);
+         this->upper_bounded_variables.reserve(this->number_variables);
+         this->single_lower_bounded_variables.reserve(this->number_variables);
+         this->single_upper_bounded_variables.reserve(this->number_variables);
+         this->generate_variables();
+
+         // constraints
+         this->equality_constraints.reserve(this->number_constraints);
+         this->inequality_constraints.reserve(this->number_constraints);
+         this->linear_constraints.reserve(this->number_constraints);
+         this->generate_constraints();
+
+         // precompute the gradient sparsity patterns, so that the evaluations are written in place
+         this->generate_gradient_sparsity_patterns();
 
-      // variables
-      this->lower_bounded_variables.reserve(this->number_variables);
-      this->upper_bounded_variables.reserve(this->number_variables);
-      this->single_lower_bounded_variables.reserve(this->number_variables);
-      this->single_upper_bounded_variables.reserve(this->number_variables);
-      this->generate_variables();
+         if (use_structure_cache) {
+            this->write_structure_cache(file_name);
+         }
+      }
 
-      // constraints
-      this->equality_constraints.reserve(this->number_constraints);
-      this->inequality_constraints.reserve(this->number_constraints);
-      this->linear_constraints.reserve(this->number_constraints);
-      this->generate_constraints();
+      // the flattened constraint gradient patterns may be backed by a shared memory segment; the
+      // private arena then becomes redundant and is dropped
+      if (use_shared_structure) {
+         this->setup_shared_structure(file_name);
+      }
 
       // compute number of nonzeros in the Lagrangian Hessian
       this->set_number_hessian_nonzeros();
+
+      // context 0 wraps the main workspace; it belongs to the first caller thread
+      auto main_context = std::make_unique<EvaluationContext>();
+      main_context->asl = this->asl;
+      main_context->dense_gradient.resize(this->number_variables);
+      main_context->hessian_values.reserve(this->number_asl_hessian_nonzeros);
+      this->evaluation_contexts.emplace_back(std::move(main_context));
+
+      // create the additional ASL workspaces for concurrent Jacobian and Hessian evaluations
+      if (1 < number_evaluation_threads) {
+         this->asl_workers.reserve(number_evaluation_threads - 1);
+         this->worker_hessian_values.reserve(number_evaluation_threads - 1);
+         for ([[maybe_unused]] size_t worker_index: Range(number_evaluation_threads - 1)) {
+            ASL* worker = generate_asl(file_name);
+            worker->i.congrd_mode = 1;
+            // prepare the worker for block Hessian evaluations on the shared sparsity pattern
+            const int objective_number = -1;
+            const int upper_triangular = 1;
+            (*worker->p.Sphset)(worker, nullptr, objective_number, 1, 1, upper_triangular);
+            fint error_flag{};
+            lagscale_ASL(worker, -1., &error_flag);
+            this->asl_workers.emplace_back(worker);
+            this->worker_hessian_values.emplace_back(this->number_asl_hessian_nonzeros, 0.);
+         }
+         this->masked_multipliers.resize(number_evaluation_threads, std::vector<double>(this->number_constraints, 0.));
+      }
    }
 
    AMPLModel::~AMPLModel() {
+#ifndef _WIN32
+      // unmap, but do not unlink: the segment stays available for the sibling processes
+      if (this->shared_structure_mapping != nullptr) {
+         munmap(this->shared_structure_mapping, this->shared_structure_mapping_size);
+      }
+#endif
+      for (ASL*& worker: this->asl_workers) {
+         ASL_free(&worker);
+      }
+      // context 0 wraps this->asl, freed below
+      for (size_t context_index: Range(size_t(1), this->evaluation_contexts.size())) {
+         ASL_free(&this->evaluation_contexts[context_index]->asl);
+      }
       ASL_free(&this->asl);
    }
 
+   // clone an evaluation context for a new caller thread, by re-reading the .nl file into an
+   // independent ASL workspace prepared like the main one (sparse Jacobian mode, Hessian sparsity,
+   // Lagrangian sign convention)
+   std::unique_ptr<AMPLModel::EvaluationContext> AMPLModel::create_evaluation_context() const {
+      auto context = std::make_unique<EvaluationContext>();
+      context->asl = generate_asl(this->name);
+      context->asl->i.congrd_mode = 1;
+      const int objective_number = -1;
+      const int upper_triangular = 1;
+      (*(context->asl)->p.Sphset)(context->asl, nullptr, objective_number, 1, 1, upper_triangular);
+      fint error_flag{};
+      lagscale_ASL(context->asl, -1., &error_flag);
+      context->dense_gradient.resize(this->number_variables);
+      context->hessian_values.reserve(this->number_asl_hessian_nonzeros);
+      return context;
+   }
+
+   AMPLModel::EvaluationContext& AMPLModel::local_context() const {
+      const std::thread::id thread_id = std::this_thread::get_id();
+      const std::lock_guard<std::mutex> lock(this->context_assignment_mutex);
+      auto iterator = this->thread_context_indices.find(thread_id);
+      if (iterator == this->thread_context_indices.end()) {
+         const size_t context_index = this->thread_context_indices.size();
+         if (this->evaluation_contexts.size() <= context_index) {
+            this->evaluation_contexts.emplace_back(this->create_evaluation_context());
+         }
+         iterator = this->thread_context_indices.emplace(thread_id, context_index).first;
+      }
+      return *this->evaluation_contexts[iterator->second];
+   }
+
    void AMPLModel::generate_variables() {
       for (size_t variable_index: Range(this->number_variables)) {
          this->variable_lower_bounds[variable_index] = (this->asl->i.LUv_ != nullptr) ? this->asl->i.LUv_[2*variable_index] : -INF<double>;
@@ -105,39 +309,325 @@ namespace uno {
       }
    }
 
+   void AMPLModel::generate_gradient_sparsity_patterns() {
+      // objective gradient pattern
+      this->objective_gradient_pattern.reserve(static_cast<size_t>(this->asl->i.nzo_));
+      ograd* asl_objective_variable = this->asl->i.Ograd_[0];
+      while (asl_objective_variable != nullptr) {
+         this->objective_gradient_pattern.emplace_back(static_cast<size_t>(asl_objective_variable->varno));
+         asl_objective_variable = asl_objective_variable->next;
+      }
+
+      // one pattern per constraint gradient, in the order in which ASL writes the sparse values,
+      // flattened into a single arena delimited by the offsets
+      this->constraint_gradient_pattern_offsets.reserve(this->number_constraints + 1);
+      this->constraint_gradient_pattern_arena.reserve(static_cast<size_t>(this->asl->i.nzc_));
+      this->linear_constraint_gradients.resize(this->number_constraints);
+      this->constraint_gradient_pattern_offsets.emplace_back(0);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         cgrad* asl_constraint_variable = this->asl->i.Cgrad_[constraint_index];
+         while (asl_constraint_variable != nullptr) {
+            this->constraint_gradient_pattern_arena.emplace_back(static_cast<size_t>(asl_constraint_variable->varno));
+            asl_constraint_variable = asl_constraint_variable->next;
+         }
+         this->constraint_gradient_pattern_offsets.emplace_back(this->constraint_gradient_pattern_arena.size());
+      }
+      this->constraint_pattern_offsets = this->constraint_gradient_pattern_offsets.data();
+      this->constraint_pattern_indices = this->constraint_gradient_pattern_arena.data();
+   }
+
+   // load the derived model structure from the sidecar cache. Returns false (and leaves the model in
+   // a state from which the structure can be re-derived) if no up-to-date cache exists
+   bool AMPLModel::load_structure_cache(const std::string& file_name) {
+      std::ifstream stream(structure_cache_name(file_name), std::ios::binary);
+      if (not stream.is_open()) {
+         return false;
+      }
+      uint64_t nl_size = 0;
+      int64_t nl_time = 0;
+      if (not nl_file_fingerprint(file_name, nl_size, nl_time)) {
+         return false;
+      }
+      // validate the header: version, .nl fingerprint and dimensions must all match
+      uint32_t version = 0;
+      uint64_t cached_nl_size = 0;
+      int64_t cached_nl_time = 0;
+      uint64_t cached_number_variables = 0;
+      uint64_t cached_number_constraints = 0;
+      read_binary(stream, version);
+      read_binary(stream, cached_nl_size);
+      read_binary(stream, cached_nl_time);
+      read_binary(stream, cached_number_variables);
+      read_binary(stream, cached_number_constraints);
+      if (not stream || version != structure_cache_version || cached_nl_size != nl_size || cached_nl_time != nl_time ||
+            cached_number_variables != this->number_variables || cached_number_constraints != this->number_constraints) {
+         return false;
+      }
+
+      read_binary_data(stream, this->variable_lower_bounds);
+      read_binary_data(stream, this->variable_upper_bounds);
+      read_binary_data(stream, this->variable_status);
+      read_binary_list(stream, this->lower_bounded_variables, this->number_variables);
+      read_binary_list(stream, this->upper_bounded_variables, this->number_variables);
+      read_binary_list(stream, this->single_lower_bounded_variables, this->number_variables);
+      read_binary_list(stream, this->single_upper_bounded_variables, this->number_variables);
+      read_binary_data(stream, this->constraint_lower_bounds);
+      read_binary_data(stream, this->constraint_upper_bounds);
+      read_binary_data(stream, this->constraint_status);
+      read_binary_data(stream, this->constraint_type);
+      read_binary_list(stream, this->equality_constraints, this->number_constraints);
+      read_binary_list(stream, this->inequality_constraints, this->number_constraints);
+      read_binary_list(stream, this->linear_constraints, this->number_constraints);
+      read_binary_list(stream, this->objective_gradient_pattern, this->number_variables);
+      read_binary_list(stream, this->constraint_gradient_pattern_offsets, this->number_constraints + 1);
+      read_binary_list(stream, this->constraint_gradient_pattern_arena, static_cast<size_t>(this->asl->i.nzc_));
+      // consistency of the flattened patterns: the offsets delimit the whole arena
+      if (stream && (this->constraint_gradient_pattern_offsets.size() != this->number_constraints + 1 ||
+            this->constraint_gradient_pattern_offsets.front() != 0 ||
+            this->constraint_gradient_pattern_offsets.back() != this->constraint_gradient_pattern_arena.size())) {
+         stream.setstate(std::ios::failbit);
+      }
+      if (not stream) {
+         WARNING << "The structure cache of " << file_name << " is corrupt and is ignored\n";
+         // discard the partially filled lists, so that the re-derivation starts from a clean slate
+         this->lower_bounded_variables.clear();
+         this->upper_bounded_variables.clear();
+         this->single_lower_bounded_variables.clear();
+         this->single_upper_bounded_variables.clear();
+         this->equality_constraints.clear();
+         this->inequality_constraints.clear();
+         this->linear_constraints.clear();
+         this->objective_gradient_pattern.clear();
+         this->constraint_gradient_pattern_offsets.clear();
+         this->constraint_gradient_pattern_arena.clear();
+         return false;
+      }
+      this->constraint_pattern_offsets = this->constraint_gradient_pattern_offsets.data();
+      this->constraint_pattern_indices = this->constraint_gradient_pattern_arena.data();
+      this->linear_constraint_gradients.resize(this->number_constraints);
+      DEBUG << "Loaded the model structure from " << structure_cache_name(file_name) << '\n';
+      return true;
+   }
+
+   void AMPLModel::write_structure_cache(const std::string& file_name) const {
+      uint64_t nl_size = 0;
+      int64_t nl_time = 0;
+      if (not nl_file_fingerprint(file_name, nl_size, nl_time)) {
+         return;
+      }
+      std::ofstream stream(structure_cache_name(file_name), std::ios::binary);
+      if (not stream.is_open()) {
+         WARNING << "The structure cache " << structure_cache_name(file_name) << " could not be written\n";
+         return;
+      }
+      write_binary(stream, structure_cache_version);
+      write_binary(stream, nl_size);
+      write_binary(stream, nl_time);
+      write_binary(stream, static_cast<uint64_t>(this->number_variables));
+      write_binary(stream, static_cast<uint64_t>(this->number_constraints));
+
+      write_binary_vector(stream, this->variable_lower_bounds);
+      write_binary_vector(stream, this->variable_upper_bounds);
+      write_binary_vector(stream, this->variable_status);
+      write_binary_vector(stream, this->lower_bounded_variables);
+      write_binary_vector(stream, this->upper_bounded_variables);
+      write_binary_vector(stream, this->single_lower_bounded_variables);
+      write_binary_vector(stream, this->single_upper_bounded_variables);
+      write_binary_vector(stream, this->constraint_lower_bounds);
+      write_binary_vector(stream, this->constraint_upper_bounds);
+      write_binary_vector(stream, this->constraint_status);
+      write_binary_vector(stream, this->constraint_type);
+      write_binary_vector(stream, this->equality_constraints);
+      write_binary_vector(stream, this->inequality_constraints);
+      write_binary_vector(stream, this->linear_constraints);
+      write_binary_vector(stream, this->objective_gradient_pattern);
+      write_binary_vector(stream, this->constraint_gradient_pattern_offsets);
+      write_binary_vector(stream, this->constraint_gradient_pattern_arena);
+      DEBUG << "Wrote the model structure to " << structure_cache_name(file_name) << '\n';
+   }
+
+#ifndef _WIN32
+   void AMPLModel::setup_shared_structure(const std::string& file_name) {
+      if (this->attach_shared_structure(file_name)) {
+         // the patterns are served from the segment: the private copies are redundant
+         this->constraint_gradient_pattern_offsets.clear();
+         this->constraint_gradient_pattern_offsets.shrink_to_fit();
+         this->constraint_gradient_pattern_arena.clear();
+         this->constraint_gradient_pattern_arena.shrink_to_fit();
+      }
+      // the first loader publishes the segment instead; a second attachment attempt covers the race
+      // where a sibling process published between our two calls
+      else if (not this->publish_shared_structure(file_name) && not this->attach_shared_structure(file_name)) {
+         DEBUG << "No shared structure segment for " << file_name << ", keeping a private copy\n";
+      }
+   }
+
+   // attach (read-only) the segment published by another process solving the same .nl file. The
+   // patterns were already derived locally, so the header can be validated in full; any mismatch
+   // (stale segment, creator still filling it in) keeps the private copy
+   bool AMPLModel::attach_shared_structure(const std::string& file_name) {
+      uint64_t nl_size = 0;
+      int64_t nl_time = 0;
+      if (not nl_file_fingerprint(file_name, nl_size, nl_time)) {
+         return false;
+      }
+      const std::string segment_name = shared_structure_name(file_name, nl_size, nl_time);
+      const int descriptor = shm_open(segment_name.c_str(), O_RDONLY, 0);
+      if (descriptor < 0) {
+         return false;
+      }
+      const size_t expected_size = sizeof(SharedStructureHeader) +
+            (this->constraint_gradient_pattern_offsets.size() + this->constraint_gradient_pattern_arena.size()) * sizeof(size_t);
+      struct stat segment_status{};
+      if (fstat(descriptor, &segment_status) != 0 || static_cast<size_t>(segment_status.st_size) != expected_size) {
+         close(descriptor);
+         return false;
+      }
+      void* mapping = mmap(nullptr, expected_size, PROT_READ, MAP_SHARED, descriptor, 0);
+      close(descriptor);
+      if (mapping == MAP_FAILED) {
+         return false;
+      }
+      const auto* header = static_cast<const SharedStructureHeader*>(mapping);
+      if (header->version != structure_cache_version || header->ready != 1 || header->nl_size != nl_size || header->nl_time != nl_time ||
+            header->number_constraints != this->number_constraints ||
+            header->number_pattern_nonzeros != this->constraint_gradient_pattern_arena.size()) {
+         munmap(mapping, expected_size);
+         return false;
+      }
+      this->shared_structure_mapping = mapping;
+      this->shared_structure_mapping_size = expected_size;
+      this->constraint_pattern_offsets = reinterpret_cast<const size_t*>(header + 1);
+      this->constraint_pattern_indices = this->constraint_pattern_offsets + this->number_constraints + 1;
+      DEBUG << "Attached the shared structure segment " << segment_name << '\n';
+      return true;
+   }
+
+   // publish the locally derived patterns for the sibling processes. O_EXCL makes the creation
+   // atomic: exactly one process fills the segment and flips the ready flag, the others attach.
+   // The segment deliberately outlives this process (no shm_unlink): later loaders of the same
+   // .nl file reuse it, and a rewritten .nl file gets a different name. Stale segments live in
+   // /dev/shm until the machine is rebooted or they are removed by hand
+   bool AMPLModel::publish_shared_structure(const std::string& file_name) {
+      uint64_t nl_size = 0;
+      int64_t nl_time = 0;
+      if (not nl_file_fingerprint(file_name, nl_size, nl_time)) {
+         return false;
+      }
+      const std::string segment_name = shared_structure_name(file_name, nl_size, nl_time);
+      const int descriptor = shm_open(segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+      if (descriptor < 0) {
+         return false;
+      }
+      const size_t number_offsets = this->constraint_gradient_pattern_offsets.size();
+      const size_t number_pattern_nonzeros = this->constraint_gradient_pattern_arena.size();
+      const size_t segment_size = sizeof(SharedStructureHeader) + (number_offsets + number_pattern_nonzeros) * sizeof(size_t);
+      if (ftruncate(descriptor, static_cast<off_t>(segment_size)) != 0) {
+         close(descriptor);
+         shm_unlink(segment_name.c_str());
+         return false;
+      }
+      void* mapping = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+      close(descriptor);
+      if (mapping == MAP_FAILED) {
+         shm_unlink(segment_name.c_str());
+         return false;
+      }
+      auto* header = static_cast<SharedStructureHeader*>(mapping);
+      header->version = structure_cache_version;
+      header->ready = 0;
+      header->nl_size = nl_size;
+      header->nl_time = nl_time;
+      header->number_constraints = static_cast<uint64_t>(this->number_constraints);
+      header->number_pattern_nonzeros = static_cast<uint64_t>(number_pattern_nonzeros);
+      auto* segment_offsets = reinterpret_cast<size_t*>(header + 1);
+      std::memcpy(segment_offsets, this->constraint_gradient_pattern_offsets.data(), number_offsets * sizeof(size_t));
+      std::memcpy(segment_offsets + number_offsets, this->constraint_gradient_pattern_arena.data(), number_pattern_nonzeros * sizeof(size_t));
+      header->ready = 1;
+
+      // serve our own accesses from the segment too, so that the private copies can be dropped
+      this->shared_structure_mapping = mapping;
+      this->shared_structure_mapping_size = segment_size;
+      this->constraint_pattern_offsets = segment_offsets;
+      this->constraint_pattern_indices = segment_offsets + number_offsets;
+      this->constraint_gradient_pattern_offsets.clear();
+      this->constraint_gradient_pattern_offsets.shrink_to_fit();
+      this->constraint_gradient_pattern_arena.clear();
+      this->constraint_gradient_pattern_arena.shrink_to_fit();
+      DEBUG << "Published the shared structure segment " << segment_name << '\n';
+      return true;
+   }
+#else
+   // shared memory segments are POSIX-only: silently keep the private structure
+   void AMPLModel::setup_shared_structure(const std::string& /*file_name*/) {
+   }
+
+   bool AMPLModel::attach_shared_structure(const std::string& /*file_name*/) {
+      return false;
+   }
+
+   bool AMPLModel::publish_shared_structure(const std::string& /*file_name*/) {
+      return false;
+   }
+#endif // _WIN32
+
    double AMPLModel::evaluate_objective(const Vector<double>& x) const {
+      EvaluationContext& context = this->local_context();
       fint error_flag = 0;
-      double result = this->objective_sign * (*(this->asl)->p.Objval)(this->asl, 0, const_cast<double*>(x.data()), &error_flag);
+      double result = this->objective_sign * (*(context.asl)->p.Objval)(context.asl, 0, const_cast<double*>(x.data()), &error_flag);
       if (0 < error_flag) {
          throw FunctionEvaluationError();
       }
       return result;
    }
 
-   // sparse gradient
+   bool AMPLModel::try_evaluate_objective(const Vector<double>& x, double& objective_value) const {
+      EvaluationContext& context = this->local_context();
+      fint error_flag = 0;
+      objective_value = this->objective_sign * (*(context.asl)->p.Objval)(context.asl, 0, const_cast<double*>(x.data()), &error_flag);
+      return not (0 < error_flag);
+   }
+
+   // sparse gradient, on the exact objective sparsity pattern derived from the ASL ograd lists
    void AMPLModel::evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const {
+      gradient.load_pattern(this->objective_gradient_pattern);
+
+      // the gradient of a linear objective does not depend on x: serve it from the cache
+      // (the mutex makes the lazy cache fill safe for concurrent caller threads)
+      if (this->objective_is_linear) {
+         const std::lock_guard<std::mutex> lock(this->linear_gradient_cache_mutex);
+         if (not this->linear_objective_gradient.empty()) {
+            std::copy(this->linear_objective_gradient.cbegin(), this->linear_objective_gradient.cend(), gradient.values_data());
+            return;
+         }
+      }
+
+      EvaluationContext& context = this->local_context();
       fint error_flag = 0;
       // prevent ASL to crash by catching all evaluation errors
       Jmp_buf err_jmp_uno;
-      asl->i.err_jmp_ = &err_jmp_uno;
-      asl->i.err_jmp1_ = &err_jmp_uno;
+      context.asl->i.err_jmp_ = &err_jmp_uno;
+      context.asl->i.err_jmp1_ = &err_jmp_uno;
       if (setjmp(err_jmp_uno.jb)) {
          error_flag = 1;
       }
       // evaluate the ASL gradient (always in a dense vector)
-      (*(this->asl)->p.Objgrd)(this->asl, 0, const_cast<double*>(x.data()), const_cast<double*>(this->asl_gradient.data()), &error_flag);
+      (*(context.asl)->p.Objgrd)(context.asl, 0, const_cast<double*>(x.data()), const_cast<double*>(context.dense_gradient.data()), &error_flag);
       if (0 < error_flag) {
          throw GradientEvaluationError();
       }
 
-      // create the Uno sparse vector
-      ograd* asl_variables_tmp = this->asl->i.Ograd_[0];
-      while (asl_variables_tmp != nullptr) {
-         const size_t variable_index = static_cast<size_t>(asl_variables_tmp->varno);
-         // scale by the objective sign
-         const double partial_derivative = this->objective_sign*this->asl_gradient[variable_index];
-         gradient.insert(variable_index, partial_derivative);
-         asl_variables_tmp = asl_variables_tmp->next;
+      // gather only the pattern entries of the evaluation into the caller-owned sparse vector,
+      // scaled by the objective sign (ASL only offers a dense objective gradient entry point, so the
+      // staging buffer cannot be bypassed; the gather itself is O(pattern size), not O(n))
+      double* gradient_values = gradient.values_data();
+      for (size_t nonzero_index: Range(this->objective_gradient_pattern.size())) {
+         gradient_values[nonzero_index] = this->objective_sign * context.dense_gradient[this->objective_gradient_pattern[nonzero_index]];
+      }
+
+      if (this->objective_is_linear && not this->objective_gradient_pattern.empty()) {
+         const std::lock_guard<std::mutex> lock(this->linear_gradient_cache_mutex);
+         this->linear_objective_gradient.assign(gradient_values, gradient_values + this->objective_gradient_pattern.size());
       }
    }
 
@@ -153,39 +643,244 @@ namespace uno {
    */
 
    void AMPLModel::evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      EvaluationContext& context = this->local_context();
+      // route the sampled passes through the timed per-constraint evaluation
+      if (0 < this->constraint_profiling_interval && ++this->constraint_evaluation_calls % this->constraint_profiling_interval == 0) {
+         if (not this->evaluate_constraints_with_timing(context, x, constraints)) {
+            throw FunctionEvaluationError();
+         }
+         return;
+      }
+      // sharded evaluation across the ASL workspaces. The chunk workers belong to the owner of the
+      // main context: a secondary caller thread always evaluates serially on its own workspace
+      if (this->parallel_constraint_evaluation && not this->asl_workers.empty() && context.asl == this->asl &&
+            this->asl_workers.size() + 1 < this->number_constraints) {
+         if (not this->evaluate_constraints_sharded(x, constraints)) {
+            throw FunctionEvaluationError();
+         }
+         return;
+      }
       fint error_flag = 0;
-      (*(this->asl)->p.Conval)(this->asl, const_cast<double*>(x.data()), constraints.data(), &error_flag);
+      (*(context.asl)->p.Conval)(context.asl, const_cast<double*>(x.data()), constraints.data(), &error_flag);
       if (0 < error_flag) {
          throw FunctionEvaluationError();
       }
    }
 
+   bool AMPLModel::try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      EvaluationContext& context = this->local_context();
+      if (0 < this->constraint_profiling_interval && ++this->constraint_evaluation_calls % this->constraint_profiling_interval == 0) {
+         return this->evaluate_constraints_with_timing(context, x, constraints);
+      }
+      if (this->parallel_constraint_evaluation && not this->asl_workers.empty() && context.asl == this->asl &&
+            this->asl_workers.size() + 1 < this->number_constraints) {
+         return this->evaluate_constraints_sharded(x, constraints);
+      }
+      fint error_flag = 0;
+      (*(context.asl)->p.Conval)(context.asl, const_cast<double*>(x.data()), constraints.data(), &error_flag);
+      return not (0 < error_flag);
+   }
+
+   // timed per-constraint pass of the cost profiling: the point is registered once (the constraints
+   // share the defined-variable computations, as in evaluate_constraints_subset), then each
+   // constraint is evaluated and timed individually and its time accumulates in the profile
+   bool AMPLModel::evaluate_constraints_with_timing(EvaluationContext& context, const Vector<double>& x,
+         std::vector<double>& constraints) const {
+      if (this->constraint_evaluation_seconds.size() != this->number_constraints) {
+         this->constraint_evaluation_seconds.assign(this->number_constraints, 0.);
+      }
+      (*(context.asl)->p.Xknown)(context.asl, const_cast<double*>(x.data()), nullptr);
+      fint error_flag = 0;
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         const auto start_time = std::chrono::steady_clock::now();
+         constraints[constraint_index] = (*(context.asl)->p.Conival)(context.asl, static_cast<int>(constraint_index),
+               const_cast<double*>(x.data()), &error_flag);
+         const auto end_time = std::chrono::steady_clock::now();
+         this->constraint_evaluation_seconds[constraint_index] += std::chrono::duration<double>(end_time - start_time).count();
+         if (0 < error_flag) {
+            context.asl->i.x_known = 0;
+            return false;
+         }
+      }
+      // unregister the vector of variables
+      context.asl->i.x_known = 0;
+      return true;
+   }
+
+   // sharded evaluation: the constraints are split in contiguous chunks, one per ASL workspace, and
+   // evaluated with per-constraint conival calls. The point is registered once per workspace, so
+   // that the constraints of a chunk share the defined-variable computations. One Conval call is
+   // cheaper in overhead, so this only pays off when individual constraints are expensive
+   bool AMPLModel::evaluate_constraints_sharded(const Vector<double>& x, std::vector<double>& constraints) const {
+      const size_t number_workspaces = this->asl_workers.size() + 1;
+      const size_t chunk_size = (this->number_constraints + number_workspaces - 1) / number_workspaces;
+      std::vector<fint> error_flags(number_workspaces, 0);
+      const auto evaluate_chunk = [&](ASL* workspace, size_t workspace_index) {
+         const size_t start = workspace_index * chunk_size;
+         const size_t end = std::min(start + chunk_size, this->number_constraints);
+         (*workspace->p.Xknown)(workspace, const_cast<double*>(x.data()), nullptr);
+         for (size_t constraint_index: Range(start, end)) {
+            constraints[constraint_index] = (*workspace->p.Conival)(workspace, static_cast<int>(constraint_index),
+                  const_cast<double*>(x.data()), &error_flags[workspace_index]);
+            if (0 < error_flags[workspace_index]) {
+               break;
+            }
+         }
+         // unregister the vector of variables
+         workspace->i.x_known = 0;
+      };
+      std::vector<std::thread> threads;
+      threads.reserve(this->asl_workers.size());
+      for (size_t worker_index: Range(this->asl_workers.size())) {
+         threads.emplace_back(evaluate_chunk, this->asl_workers[worker_index], worker_index + 1);
+      }
+      // the main thread evaluates the first chunk on the main ASL workspace
+      evaluate_chunk(this->asl, 0);
+      for (std::thread& thread: threads) {
+         thread.join();
+      }
+      for (const fint workspace_error_flag: error_flags) {
+         if (0 < workspace_error_flag) {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   std::vector<std::pair<size_t, double>> AMPLModel::get_constraint_cost_profile() const {
+      std::vector<std::pair<size_t, double>> profile;
+      profile.reserve(this->constraint_evaluation_seconds.size());
+      for (size_t constraint_index: Range(this->constraint_evaluation_seconds.size())) {
+         if (0. < this->constraint_evaluation_seconds[constraint_index]) {
+            profile.emplace_back(constraint_index, this->constraint_evaluation_seconds[constraint_index]);
+         }
+      }
+      std::stable_sort(profile.begin(), profile.end(), [](const auto& first, const auto& second) {
+         return second.second < first.second;
+      });
+      return profile;
+   }
+
+   // fused evaluation: register the point once, so that the objective and constraint trees share
+   // the common-subexpression ("defined variable") computations of ASL in a single pass, instead
+   // of re-computing them in separate Objval and Conval calls
+   bool AMPLModel::try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+         std::vector<double>& constraints) const {
+      EvaluationContext& context = this->local_context();
+      (*(context.asl)->p.Xknown)(context.asl, const_cast<double*>(x.data()), nullptr);
+      fint error_flag = 0;
+      objective_value = this->objective_sign * (*(context.asl)->p.Objval)(context.asl, 0, const_cast<double*>(x.data()), &error_flag);
+      if (0 < error_flag) {
+         context.asl->i.x_known = 0;
+         return false;
+      }
+      (*(context.asl)->p.Conval)(context.asl, const_cast<double*>(x.data()), constraints.data(), &error_flag);
+      // unregister the vector of variables
+      context.asl->i.x_known = 0;
+      return not (0 < error_flag);
+   }
+
+   void AMPLModel::evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+         std::vector<double>& constraints) const {
+      EvaluationContext& context = this->local_context();
+      // register the vector of variables once: the per-constraint evaluations then share the
+      // common-subexpression computations
+      (*(context.asl)->p.Xknown)(context.asl, const_cast<double*>(x.data()), nullptr);
+      fint error_flag = 0;
+      for (size_t constraint_index: constraint_indices) {
+         constraints[constraint_index] = (*(context.asl)->p.Conival)(context.asl, static_cast<int>(constraint_index),
+               const_cast<double*>(x.data()), &error_flag);
+         if (0 < error_flag) {
+            context.asl->i.x_known = 0;
+            throw FunctionEvaluationError();
+         }
+      }
+      // unregister the vector of variables
+      context.asl->i.x_known = 0;
+   }
+
+   // sparse gradient, evaluated on an arbitrary ASL workspace. Errors are reported through error_flag
+   // instead of an exception, so that the routine can run outside of the main thread
+   void AMPLModel::evaluate_constraint_gradient_on_workspace(ASL* workspace, const Vector<double>& x, size_t constraint_index,
+         SparseVector<double>& gradient, fint& error_flag) const {
+      // load the precomputed sparsity pattern and let ASL write the sparse values (congrd_mode = 1)
+      // directly into the caller-owned storage, without going through a staging buffer
+      const size_t pattern_start = this->constraint_pattern_offsets[constraint_index];
+      const size_t number_nonzeros = this->constraint_pattern_offsets[constraint_index + 1] - pattern_start;
+      gradient.load_pattern(this->constraint_pattern_indices + pattern_start, number_nonzeros);
+
+      // the gradient of a linear constraint does not depend on x: serve it from the cache
+      // (the mutex makes the lazy cache fills safe for concurrent caller threads)
+      {
+         const std::lock_guard<std::mutex> lock(this->linear_gradient_cache_mutex);
+         const std::vector<double>& cached_gradient = this->linear_constraint_gradients[constraint_index];
+         if (this->constraint_type[constraint_index] == LINEAR && not cached_gradient.empty()) {
+            std::copy(cached_gradient.cbegin(), cached_gradient.cend(), gradient.values_data());
+            return;
+         }
+      }
+
+      (*workspace->p.Congrd)(workspace, static_cast<int>(constraint_index), const_cast<double*>(x.data()), gradient.values_data(), &error_flag);
+      if (0 < error_flag) {
+         return;
+      }
+
+      if (this->constraint_type[constraint_index] == LINEAR && 0 < number_nonzeros) {
+         const std::lock_guard<std::mutex> lock(this->linear_gradient_cache_mutex);
+         this->linear_constraint_gradients[constraint_index].assign(gradient.values_data(), gradient.values_data() + number_nonzeros);
+      }
+   }
+
    // sparse gradient
    void AMPLModel::evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const {
-      // compute the AMPL sparse gradient
       fint error_flag = 0;
-      (*(this->asl)->p.Congrd)(this->asl, static_cast<int>(constraint_index), const_cast<double*>(x.data()), const_cast<double*>(this->asl_gradient.data()),
-            &error_flag);
+      this->evaluate_constraint_gradient_on_workspace(this->local_context().asl, x, constraint_index, gradient, error_flag);
       if (0 < error_flag) {
          throw GradientEvaluationError();
       }
-
-      // construct the Uno sparse vector
-      gradient.clear();
-      cgrad* asl_variables_tmp = this->asl->i.Cgrad_[constraint_index];
-      size_t sparse_asl_index = 0;
-      while (asl_variables_tmp != nullptr) {
-         const size_t variable_index = static_cast<size_t>(asl_variables_tmp->varno);
-         gradient.insert(variable_index, this->asl_gradient[sparse_asl_index]);
-         asl_variables_tmp = asl_variables_tmp->next;
-         sparse_asl_index++;
-      }
    }
 
    void AMPLModel::evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const {
-      for (size_t constraint_index: Range(this->number_constraints)) {
-         constraint_jacobian[constraint_index].clear();
-         this->evaluate_constraint_gradient(x, constraint_index, constraint_jacobian[constraint_index]);
+      // serial evaluation on the caller's context. The chunk workers belong to the owner of the main
+      // context: a secondary caller thread always evaluates serially on its own workspace
+      if (this->asl_workers.empty() || this->local_context().asl != this->asl ||
+            this->number_constraints <= this->asl_workers.size() + 1) {
+         for (size_t constraint_index: Range(this->number_constraints)) {
+            this->evaluate_constraint_gradient(x, constraint_index, constraint_jacobian[constraint_index]);
+         }
+         return;
+      }
+
+      // concurrent evaluation: split the constraints in contiguous chunks, one per ASL workspace.
+      // Each constraint (gradient, pattern and cache entry) is touched by exactly one thread
+      const size_t number_workspaces = this->asl_workers.size() + 1;
+      const size_t chunk_size = (this->number_constraints + number_workspaces - 1) / number_workspaces;
+      std::vector<fint> error_flags(number_workspaces, 0);
+      const auto evaluate_chunk = [&](ASL* workspace, size_t workspace_index) {
+         const size_t start = workspace_index * chunk_size;
+         const size_t end = std::min(start + chunk_size, this->number_constraints);
+         for (size_t constraint_index: Range(start, end)) {
+            this->evaluate_constraint_gradient_on_workspace(workspace, x, constraint_index, constraint_jacobian[constraint_index],
+                  error_flags[workspace_index]);
+            if (0 < error_flags[workspace_index]) {
+               return;
+            }
+         }
+      };
+      std::vector<std::thread> threads;
+      threads.reserve(this->asl_workers.size());
+      for (size_t worker_index: Range(this->asl_workers.size())) {
+         threads.emplace_back(evaluate_chunk, this->asl_workers[worker_index], worker_index + 1);
+      }
+      // the main thread evaluates the first chunk on the main ASL workspace
+      evaluate_chunk(this->asl, 0);
+      for (std::thread& thread: threads) {
+         thread.join();
+      }
+      for (const fint workspace_error_flag: error_flags) {
+         if (0 < workspace_error_flag) {
+            throw GradientEvaluationError();
+         }
       }
    }
 
@@ -195,7 +890,6 @@ namespace uno {
       const int objective_number = -1;
       const int upper_triangular = 1;
       this->number_asl_hessian_nonzeros = static_cast<size_t>((*(this->asl)->p.Sphset)(this->asl, nullptr, objective_number, 1, 1, upper_triangular));
-      this->asl_hessian.reserve(this->number_asl_hessian_nonzeros);
 
       // use Lagrangian scale: in AMPL, the Lagrangian is f + lambda.g, while Uno uses f - lambda.g
       fint error_flag{};
@@ -252,45 +946,56 @@ namespace uno {
       });
    }
 
-   size_t AMPLModel::compute_hessian_number_nonzeros(double objective_multiplier, const Vector<double>& multipliers) const {
+   size_t AMPLModel::compute_hessian_number_nonzeros(ASL* workspace, double objective_multiplier, const Vector<double>& multipliers) const {
       // compute the sparsity
       const int objective_number = -1;
       const int upper_triangular = 1;
       const bool all_zeros_multipliers = are_all_zeros(multipliers);
-      int number_nonzeros = (*(this->asl)->p.Sphset)(this->asl, nullptr, objective_number, (objective_multiplier != 0.),
+      int number_nonzeros = (*workspace->p.Sphset)(workspace, nullptr, objective_number, (objective_multiplier != 0.),
             not all_zeros_multipliers, upper_triangular);
       return static_cast<size_t>(number_nonzeros);
    }
 
    void AMPLModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
-         SymmetricMatrix<size_t, double>& hessian) const {
+         SymmetricMatrix<SparseIndex, double>& hessian) const {
+      EvaluationContext& context = this->local_context();
       // register the vector of variables
-      (*(this->asl)->p.Xknown)(this->asl, const_cast<double*>(x.data()), nullptr);
+      (*(context.asl)->p.Xknown)(context.asl, const_cast<double*>(x.data()), nullptr);
 
       // scale by the objective sign
       objective_multiplier *= this->objective_sign;
 
+      // concurrent evaluation over the workspaces (Lagrangian additivity across constraint blocks):
+      // only on the fixed shared pattern, and only for the owner of the main context (the chunk
+      // workers belong to it, as in evaluate_constraint_jacobian)
+      if (this->fixed_hessian_sparsity && not this->asl_workers.empty() && context.asl == this->asl &&
+            this->asl_workers.size() + 1 < this->number_constraints) {
+         context.asl->i.x_known = 0;
+         this->evaluate_lagrangian_hessian_in_parallel(x, objective_multiplier, multipliers, hessian);
+         return;
+      }
+
       // compute the number of nonzeros
       [[maybe_unused]] const size_t number_nonzeros = this->fixed_hessian_sparsity ? this->number_asl_hessian_nonzeros :
-                                                      this->compute_hessian_number_nonzeros(objective_multiplier, multipliers);
+                                                      this->compute_hessian_number_nonzeros(context.asl, objective_multiplier, multipliers);
       assert(hessian.capacity() >= number_nonzeros);
 
-      // evaluate the Hessian: store the matrix in a preallocated array this->asl_hessian
+      // evaluate the Hessian: store the matrix in the preallocated staging buffer of the context
       const int objective_number = -1;
       if (this->fixed_hessian_sparsity) {
-         (*(this->asl)->p.Sphes)(this->asl, nullptr, const_cast<double*>(this->asl_hessian.data()), objective_number, &objective_multiplier,
+         (*(context.asl)->p.Sphes)(context.asl, nullptr, const_cast<double*>(context.hessian_values.data()), objective_number, &objective_multiplier,
                const_cast<double*>(multipliers.data()));
       }
       else {
          double* objective_multiplier_pointer = (objective_multiplier != 0.) ? &objective_multiplier : nullptr;
          const bool all_zeros_multipliers = are_all_zeros(multipliers);
-         (*(this->asl)->p.Sphes)(this->asl, nullptr, const_cast<double*>(this->asl_hessian.data()), objective_number, objective_multiplier_pointer,
-               all_zeros_multipliers ? nullptr : const_cast<double*>(multipliers.data()));
+         (*(context.asl)->p.Sphes)(context.asl, nullptr, const_cast<double*>(context.hessian_values.data()), objective_number,
+               objective_multiplier_pointer, all_zeros_multipliers ? nullptr : const_cast<double*>(multipliers.data()));
       }
 
       // generate the sparsity pattern in the right sparse format
-      const fint* asl_column_start = this->asl->i.sputinfo_->hcolstarts;
-      const fint* asl_row_index = this->asl->i.sputinfo_->hrownos;
+      const fint* asl_column_start = context.asl->i.sputinfo_->hcolstarts;
+      const fint* asl_row_index = context.asl->i.sputinfo_->hrownos;
       // check that the column pointers are sorted in increasing order
       // TODO throw exception
       assert(in_increasing_order(asl_column_start, this->number_variables + 1) && "AMPLModel::evaluate_lagrangian_hessian: column starts are not ordered");
@@ -300,13 +1005,108 @@ namespace uno {
       for (size_t column_index: Range(this->number_variables)) {
          for (size_t k: Range(static_cast<size_t>(asl_column_start[column_index]), static_cast<size_t>(asl_column_start[column_index + 1]))) {
             const size_t row_index = static_cast<size_t>(asl_row_index[k]);
-            const double entry = this->asl_hessian[k];
+            const double entry = context.hessian_values[k];
             hessian.insert(entry, row_index, column_index);
          }
          hessian.finalize_column(column_index);
       }
       // unregister the vector of variables
-      this->asl->i.x_known = 0;
+      context.asl->i.x_known = 0;
+   }
+
+   // concurrent Hessian evaluation: the Lagrangian Hessian is additive in the multipliers
+   // (H = sigma H_f + sum_i lambda_i H_{c_i}), so the constraints are split in contiguous blocks,
+   // one per ASL workspace, and each workspace evaluates its block on the fixed shared sparsity
+   // pattern with the multipliers outside of its block masked to zero. The value buffers are then
+   // summed entrywise, in workspace order, so that the result does not depend on the thread timing
+   void AMPLModel::evaluate_lagrangian_hessian_in_parallel(const Vector<double>& x, double scaled_objective_multiplier,
+         const Vector<double>& multipliers, SymmetricMatrix<SparseIndex, double>& hessian) const {
+      EvaluationContext& context = this->local_context();
+      assert(hessian.capacity() >= this->number_asl_hessian_nonzeros);
+
+      // split the constraints in contiguous blocks, one per workspace; the objective term is
+      // evaluated with the first block, on the main workspace
+      const size_t number_workspaces = this->asl_workers.size() + 1;
+      const size_t block_size = (this->number_constraints + number_workspaces - 1) / number_workspaces;
+      const int objective_number = -1;
+      const auto evaluate_block = [&](ASL* workspace, double* hessian_values, size_t workspace_index) {
+         // mask the multipliers outside of [start, end)
+         const size_t start = workspace_index * block_size;
+         const size_t end = std::min(start + block_size, this->number_constraints);
+         std::vector<double>& block_multipliers = this->masked_multipliers[workspace_index];
+         std::fill(block_multipliers.begin(), block_multipliers.end(), 0.);
+         std::copy(multipliers.begin() + static_cast<std::ptrdiff_t>(start), multipliers.begin() + static_cast<std::ptrdiff_t>(end),
+               block_multipliers.begin() + static_cast<std::ptrdiff_t>(start));
+         double block_objective_multiplier = (workspace_index == 0) ? scaled_objective_multiplier : 0.;
+
+         // register the vector of variables and evaluate the block on the shared pattern
+         (*workspace->p.Xknown)(workspace, const_cast<double*>(x.data()), nullptr);
+         (*workspace->p.Sphes)(workspace, nullptr, hessian_values, objective_number, &block_objective_multiplier,
+               block_multipliers.data());
+         // unregister the vector of variables
+         workspace->i.x_known = 0;
+      };
+      std::vector<std::thread> threads;
+      threads.reserve(this->asl_workers.size());
+      for (size_t worker_index: Range(this->asl_workers.size())) {
+         threads.emplace_back(evaluate_block, this->asl_workers[worker_index], this->worker_hessian_values[worker_index].data(),
+               worker_index + 1);
+      }
+      // the main thread evaluates the first block (with the objective term) on the main ASL workspace
+      evaluate_block(this->asl, const_cast<double*>(context.hessian_values.data()), 0);
+      for (std::thread& thread: threads) {
+         thread.join();
+      }
+
+      // accumulate the block contributions entrywise: the blocks share the fixed sparsity pattern
+      double* accumulated_values = const_cast<double*>(context.hessian_values.data());
+      for (const std::vector<double>& block_values: this->worker_hessian_values) {
+         for (size_t nonzero_index: Range(this->number_asl_hessian_nonzeros)) {
+            accumulated_values[nonzero_index] += block_values[nonzero_index];
+         }
+      }
+
+      // generate the sparsity pattern in the right sparse format (shared by all the workspaces)
+      const fint* asl_column_start = context.asl->i.sputinfo_->hcolstarts;
+      const fint* asl_row_index = context.asl->i.sputinfo_->hrownos;
+      assert(in_increasing_order(asl_column_start, this->number_variables + 1) && "AMPLModel::evaluate_lagrangian_hessian_in_parallel: column starts are not ordered");
+
+      // copy the nonzeros in the Hessian
+      hessian.reset();
+      for (size_t column_index: Range(this->number_variables)) {
+         for (size_t k: Range(static_cast<size_t>(asl_column_start[column_index]), static_cast<size_t>(asl_column_start[column_index + 1]))) {
+            const size_t row_index = static_cast<size_t>(asl_row_index[k]);
+            const double entry = accumulated_values[k];
+            hessian.insert(entry, row_index, column_index);
+         }
+         hessian.finalize_column(column_index);
+      }
+   }
+
+   // Hessian-vector product through the ASL operator interface (hvpinit/hvcomp): the product is
+   // assembled from the partially separable structure and the matrix is never formed, which pays
+   // off when the Hessian is much denser than the Jacobian
+   void AMPLModel::compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         const Vector<double>& vector, Vector<double>& result) const {
+      EvaluationContext& context = this->local_context();
+      // register the vector of variables
+      (*(context.asl)->p.Xknown)(context.asl, const_cast<double*>(x.data()), nullptr);
+
+      // scale by the objective sign
+      objective_multiplier *= this->objective_sign;
+
+      // point-dependent setup of the internal Hessian structure, then the product itself. The limit
+      // on the dimension of the dense element Hessians is a performance knob: any value yields
+      // correct products
+      const int dense_element_hessian_limit = 0;
+      const int objective_number = -1;
+      (*(context.asl)->p.Hvinit)(context.asl, dense_element_hessian_limit, objective_number, &objective_multiplier,
+            const_cast<double*>(multipliers.data()));
+      (*(context.asl)->p.Hvcomp)(context.asl, result.data(), const_cast<double*>(vector.data()), objective_number,
+            &objective_multiplier, const_cast<double*>(multipliers.data()));
+
+      // unregister the vector of variables
+      context.asl->i.x_known = 0;
    }
 
    double AMPLModel::variable_lower_bound(size_t variable_index) const {
@@ -349,6 +1149,42 @@ namespace uno {
       std::copy(this->asl->i.pi0_, this->asl->i.pi0_ + this->number_constraints, multipliers.begin());
    }
 
+   namespace {
+      BoundType bound_type_of(double lower_bound, double upper_bound) {
+         if (lower_bound == upper_bound) {
+            return EQUAL_BOUNDS;
+         }
+         else if (is_finite(lower_bound) && is_finite(upper_bound)) {
+            return BOUNDED_BOTH_SIDES;
+         }
+         else if (is_finite(lower_bound)) {
+            return BOUNDED_LOWER;
+         }
+         else if (is_finite(upper_bound)) {
+            return BOUNDED_UPPER;
+         }
+         return UNBOUNDED;
+      }
+   } // namespace
+
+   void AMPLModel::set_variable_bounds(size_t variable_index, double lower_bound, double upper_bound) {
+      if (bound_type_of(lower_bound, upper_bound) != this->variable_status[variable_index]) {
+         throw std::runtime_error("AMPLModel: the perturbation of the bounds of variable x" + std::to_string(variable_index) +
+               " changes their type. Only structure-preserving perturbations are supported.");
+      }
+      this->variable_lower_bounds[variable_index] = lower_bound;
+      this->variable_upper_bounds[variable_index] = upper_bound;
+   }
+
+   void AMPLModel::set_constraint_bounds(size_t constraint_index, double lower_bound, double upper_bound) {
+      if (bound_type_of(lower_bound, upper_bound) != this->constraint_status[constraint_index]) {
+         throw std::runtime_error("AMPLModel: the perturbation of the bounds of constraint c" + std::to_string(constraint_index) +
+               " changes their type. Only structure-preserving perturbations are supported.");
+      }
+      this->constraint_lower_bounds[constraint_index] = lower_bound;
+      this->constraint_upper_bounds[constraint_index] = upper_bound;
+   }
+
    void AMPLModel::postprocess_solution(Iterate& /*iterate*/, TerminationStatus /*termination_status*/) const {
       // do nothing
    }
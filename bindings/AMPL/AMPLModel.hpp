@@ -4,6 +4,10 @@
 #ifndef UNO_AMPLMODEL_H
 #define UNO_AMPLMODEL_H
 
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include "model/Model.hpp"
 #include "linear_algebra/SparseVector.hpp"
@@ -23,16 +27,35 @@ namespace uno {
     */
    class AMPLModel: public Model {
    public:
-      explicit AMPLModel(const std::string& file_name);
+      explicit AMPLModel(const std::string& file_name, size_t number_evaluation_threads = 1, bool use_structure_cache = false,
+            bool use_shared_structure = false, size_t constraint_profiling_interval = 0, bool parallel_constraint_evaluation = false);
       ~AMPLModel() override;
 
       [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
       void evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const override;
       void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+      // per-constraint evaluation (ASL conival): only the requested subset is evaluated
+      void evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+            std::vector<double>& constraints) const override;
+      // non-throwing variants: the ASL error flag becomes a return value instead of an exception
+      [[nodiscard]] bool try_evaluate_objective(const Vector<double>& x, double& objective_value) const override;
+      [[nodiscard]] bool try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+      [[nodiscard]] bool try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+            std::vector<double>& constraints) const override;
+      // evaluation cost samples accumulated by the profiled passes (empty when profiling is off)
+      [[nodiscard]] std::vector<std::pair<size_t, double>> get_constraint_cost_profile() const override;
       void evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const override;
       void evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const override;
       void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
-            SymmetricMatrix<size_t, double>& hessian) const override;
+            SymmetricMatrix<SparseIndex, double>& hessian) const override;
+
+      // matrix-free Hessian operator on top of the ASL Hessian-vector products
+      [[nodiscard]] bool has_hessian_operator() const override { return true; }
+      void compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            const Vector<double>& vector, Vector<double>& result) const override;
+
+      // every caller thread evaluates on its own context (see EvaluationContext)
+      [[nodiscard]] bool supports_concurrent_evaluations() const override { return true; }
 
       [[nodiscard]] double variable_lower_bound(size_t variable_index) const override;
       [[nodiscard]] double variable_upper_bound(size_t variable_index) const override;
@@ -51,6 +74,12 @@ namespace uno {
       [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override;
       [[nodiscard]] const std::vector<size_t>& get_linear_constraints() const override;
 
+      // parametric re-solve support: structure-preserving bound perturbations (the bound type may
+      // not change, so that the index lists computed in generate_variables/generate_constraints
+      // stay valid)
+      void set_variable_bounds(size_t variable_index, double lower_bound, double upper_bound) override;
+      void set_constraint_bounds(size_t constraint_index, double lower_bound, double upper_bound) override;
+
       void initial_primal_point(Vector<double>& x) const override;
       void initial_dual_point(Vector<double>& multipliers) const override;
       void postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const override;
@@ -61,14 +90,73 @@ namespace uno {
 
    private:
       // private constructor to pass the dimensions to the Model base constructor
-      AMPLModel(const std::string& file_name, ASL* asl);
+      AMPLModel(const std::string& file_name, ASL* asl, size_t number_evaluation_threads, bool use_structure_cache, bool use_shared_structure,
+            size_t constraint_profiling_interval, bool parallel_constraint_evaluation);
+
+      // per-thread evaluation context: an independent ASL workspace plus the staging buffers that
+      // the evaluations write into. ASL mutates its workspace during every evaluation, so evaluations
+      // are only thread-safe across distinct contexts
+      struct EvaluationContext {
+         ASL* asl{nullptr};
+         std::vector<double> dense_gradient{}; // ASL only writes the objective gradient densely
+         std::vector<double> hessian_values{};
+      };
 
       // mutable: can be modified by const methods (internal state not seen by user)
       mutable ASL* asl; /*!< Instance of the AMPL Solver Library class */
-      mutable std::vector<double> asl_gradient{};
-      mutable std::vector<double> asl_hessian{};
+      // additional independent ASL workspaces (each obtained by re-reading the .nl file), used by the
+      // owner of the main context to evaluate the rows of the constraint Jacobian and blocks of the
+      // Lagrangian Hessian concurrently. Empty unless several evaluation threads were requested
+      mutable std::vector<ASL*> asl_workers{};
+      // staging buffers of the block Hessian evaluations: one value buffer per worker (the caller
+      // evaluates its block into its context buffer) and one masked multiplier vector per workspace
+      mutable std::vector<std::vector<double>> worker_hessian_values{};
+      mutable std::vector<std::vector<double>> masked_multipliers{};
+      // per-caller-thread evaluation contexts. Entry 0 wraps the main workspace and belongs to the
+      // first caller thread; further caller threads get a context cloned by re-reading the .nl file
+      mutable std::vector<std::unique_ptr<EvaluationContext>> evaluation_contexts{};
+      mutable std::unordered_map<std::thread::id, size_t> thread_context_indices{};
+      mutable std::mutex context_assignment_mutex{};
+      mutable std::mutex linear_gradient_cache_mutex{};
       size_t number_asl_hessian_nonzeros{0}; /*!< Number of nonzero elements in the Hessian */
 
+      // sparsity patterns of the objective gradient and the constraint gradients, precomputed once
+      // from the ASL linked lists so that the evaluations write directly into caller-owned storage.
+      // The constraint patterns are flattened into a single arena (the pattern of constraint i is
+      // constraint_pattern_indices[constraint_pattern_offsets[i] .. constraint_pattern_offsets[i+1])),
+      // so that processes solving the same .nl file can back it by one read-only shared memory
+      // segment instead of one private copy each (option AMPL_shared_structure)
+      std::vector<size_t> objective_gradient_pattern{};
+      std::vector<size_t> constraint_gradient_pattern_offsets{};
+      std::vector<size_t> constraint_gradient_pattern_arena{};
+      // read accessors of the flattened patterns: into the private vectors above, or into the shared
+      // memory segment once attached
+      const size_t* constraint_pattern_offsets{nullptr};
+      const size_t* constraint_pattern_indices{nullptr};
+      // shared memory attachment of the flattened patterns (nullptr when sharing is off or failed)
+      void* shared_structure_mapping{nullptr};
+      size_t shared_structure_mapping_size{0};
+      // gradients of the linear constraints are constant: they are cached at the first evaluation and
+      // never re-evaluated (mutable: filled lazily by the const evaluation methods)
+      mutable std::vector<std::vector<double>> linear_constraint_gradients{};
+      // the gradient of a linear objective is constant as well: scaled values in the order of
+      // objective_gradient_pattern, cached at the first evaluation
+      bool objective_is_linear{false};
+      mutable std::vector<double> linear_objective_gradient{};
+
+      // per-constraint evaluation cost sampling: every constraint_profiling_interval-th full
+      // constraint evaluation is routed through timed per-constraint conival calls instead of one
+      // Conval call, and the times accumulate per constraint. Sampling whole passes keeps the
+      // steady-state overhead at zero; the point registration (Xknown) keeps the sampled passes
+      // from re-computing the shared defined variables per constraint (0 disables the profiling)
+      const size_t constraint_profiling_interval;
+      mutable std::vector<double> constraint_evaluation_seconds{};
+      mutable size_t constraint_evaluation_calls{0};
+
+      // shard the full constraint evaluations across the ASL workspaces (per-constraint conival
+      // calls on contiguous blocks). Only pays off when individual constraints are expensive
+      const bool parallel_constraint_evaluation;
+
       std::vector<double> variable_lower_bounds;
       std::vector<double> variable_upper_bounds;
       std::vector<double> constraint_lower_bounds;
@@ -96,9 +184,35 @@ namespace uno {
 
       void generate_variables();
       void generate_constraints();
+      void generate_gradient_sparsity_patterns();
+      // evaluation context of the calling thread, assigned (and possibly cloned) on first use
+      [[nodiscard]] EvaluationContext& local_context() const;
+      [[nodiscard]] std::unique_ptr<EvaluationContext> create_evaluation_context() const;
+      void evaluate_constraint_gradient_on_workspace(ASL* workspace, const Vector<double>& x, size_t constraint_index,
+            SparseVector<double>& gradient, fint& error_flag) const;
+      // timed per-constraint pass of the cost profiling; returns false on an evaluation error
+      [[nodiscard]] bool evaluate_constraints_with_timing(EvaluationContext& context, const Vector<double>& x,
+            std::vector<double>& constraints) const;
+      // sharded constraint evaluation: each workspace evaluates a contiguous block of constraints
+      // with per-constraint calls; returns false on an evaluation error
+      [[nodiscard]] bool evaluate_constraints_sharded(const Vector<double>& x, std::vector<double>& constraints) const;
+      // block-parallel Hessian evaluation (the Lagrangian Hessian is additive across the constraint
+      // blocks): each workspace evaluates the fixed shared pattern with masked multipliers
+      void evaluate_lagrangian_hessian_in_parallel(const Vector<double>& x, double scaled_objective_multiplier,
+            const Vector<double>& multipliers, SymmetricMatrix<SparseIndex, double>& hessian) const;
+      // binary sidecar cache of the derived model structure (bounds, types, sparsity patterns):
+      // repeated solves of the same .nl file skip the re-derivation
+      [[nodiscard]] bool load_structure_cache(const std::string& file_name);
+      void write_structure_cache(const std::string& file_name) const;
+      // multi-process solving of the same .nl file: the first loader publishes the flattened
+      // constraint gradient patterns in a shared memory segment, the other loaders attach it
+      // read-only and drop their private copy. Falls back to the private copy on any failure
+      void setup_shared_structure(const std::string& file_name);
+      [[nodiscard]] bool attach_shared_structure(const std::string& file_name);
+      [[nodiscard]] bool publish_shared_structure(const std::string& file_name);
 
       void set_number_hessian_nonzeros();
-      [[nodiscard]] size_t compute_hessian_number_nonzeros(double objective_multiplier, const Vector<double>& multipliers) const;
+      [[nodiscard]] size_t compute_hessian_number_nonzeros(ASL* workspace, double objective_multiplier, const Vector<double>& multipliers) const;
       static void determine_bounds_types(const std::vector<double>& lower_bounds, const std::vector<double>& upper_bounds, std::vector<BoundType>& status);
    };
 
@@ -1,15 +1,38 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
 #include "ingredients/globalization_mechanisms/GlobalizationMechanism.hpp"
 #include "ingredients/globalization_mechanisms/GlobalizationMechanismFactory.hpp"
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.hpp"
 #include "AMPLModel.hpp"
+#include "Multistart.hpp"
 #include "Uno.hpp"
+#include "linear_algebra/FirstTouchAllocator.hpp"
+#include "linear_algebra/RectangularMatrix.hpp"
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "linear_algebra/Vector.hpp"
 #include "model/ModelFactory.hpp"
+#include "solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
+#include "tools/AllocationTracker.hpp"
+#include "tools/AsyncLogger.hpp"
+#include "tools/AutoTuner.hpp"
 #include "tools/Logger.hpp"
 #include "tools/Options.hpp"
+#include "tools/TaskScheduler.hpp"
+#include "tools/ThreadPool.hpp"
+#include "tools/TuningCache.hpp"
 
 /*
 size_t memory_allocation_amount = 0;
@@ -22,9 +45,11 @@ void* operator new(size_t size) {
 */
 
 namespace uno {
-   void run_uno_ampl(const std::string& model_name, const Options& options) {
+   Result run_uno_ampl(const std::string& model_name, const Options& options) {
       // AMPL model
-      std::unique_ptr<Model> ampl_model = std::make_unique<AMPLModel>(model_name);
+      std::unique_ptr<Model> ampl_model = std::make_unique<AMPLModel>(model_name, options.get_unsigned_int("AMPL_number_evaluation_threads"),
+            options.get_bool("AMPL_structure_cache"), options.get_bool("AMPL_shared_structure"),
+            options.get_unsigned_int("AMPL_constraint_profiling_interval"), options.get_bool("AMPL_parallel_constraint_evaluation"));
 
       // initialize initial primal and dual points
       Iterate initial_iterate(ampl_model->number_variables, ampl_model->number_constraints);
@@ -33,30 +58,365 @@ namespace uno {
       ampl_model->initial_dual_point(initial_iterate.multipliers.constraints);
       initial_iterate.feasibility_multipliers.reset();
 
+      // pick the ingredient preset from the structure of this particular instance, if requested
+      Options instance_options = options;
+      if (instance_options.get_string("preset") == "auto") {
+         ModelFactory::select_automatic_preset(*ampl_model, instance_options);
+      }
+
       // reformulate (scale, add slacks, relax the bounds, ...) if necessary
-      std::unique_ptr<Model> model = ModelFactory::reformulate(std::move(ampl_model), initial_iterate, options);
+      std::unique_ptr<Model> model = ModelFactory::reformulate(std::move(ampl_model), initial_iterate, instance_options);
 
       // create the constraint relaxation strategy, the globalization mechanism and the Uno solver
-      auto constraint_relaxation_strategy = ConstraintRelaxationStrategyFactory::create(*model, options);
-      auto globalization_mechanism = GlobalizationMechanismFactory::create(*constraint_relaxation_strategy, options);
-      Uno uno = Uno(*globalization_mechanism, options);
+      auto constraint_relaxation_strategy = ConstraintRelaxationStrategyFactory::create(*model, instance_options);
+      auto globalization_mechanism = GlobalizationMechanismFactory::create(*constraint_relaxation_strategy, instance_options);
+      Uno uno = Uno(*globalization_mechanism, instance_options);
 
       // solve the instance
-      Result result = uno.solve(*model, initial_iterate, options);
-      Uno::print_optimization_summary(options, result);
+      Result result = uno.solve(*model, initial_iterate, instance_options);
       // std::cout << "memory_allocation_amount = " << memory_allocation_amount << '\n';
+      return result;
+   }
+
+   // multistart: read the model once, then solve it from several diversified initial points and
+   // report the best result
+   void run_uno_ampl_multistart(const std::string& model_name, const Options& options) {
+      // AMPL model, shared by all the multistart runs
+      std::unique_ptr<Model> ampl_model = std::make_unique<AMPLModel>(model_name, options.get_unsigned_int("AMPL_number_evaluation_threads"),
+            options.get_bool("AMPL_structure_cache"), options.get_bool("AMPL_shared_structure"),
+            options.get_unsigned_int("AMPL_constraint_profiling_interval"), options.get_bool("AMPL_parallel_constraint_evaluation"));
+
+      // initialize initial primal and dual points
+      Iterate initial_iterate(ampl_model->number_variables, ampl_model->number_constraints);
+      ampl_model->initial_primal_point(initial_iterate.primals);
+      ampl_model->project_onto_variable_bounds(initial_iterate.primals);
+      ampl_model->initial_dual_point(initial_iterate.multipliers.constraints);
+      initial_iterate.feasibility_multipliers.reset();
+
+      // pick the ingredient preset from the structure of the instance, if requested
+      Options instance_options = options;
+      if (instance_options.get_string("preset") == "auto") {
+         ModelFactory::select_automatic_preset(*ampl_model, instance_options);
+      }
+
+      // reformulate (scale, add slacks, relax the bounds, ...) if necessary
+      std::unique_ptr<Model> model = ModelFactory::reformulate(std::move(ampl_model), initial_iterate, instance_options);
+
+      const Multistart multistart(instance_options);
+      const Result result = multistart.solve(*model, initial_iterate, instance_options);
+      Uno::print_optimization_summary(instance_options, result);
+   }
+
+   // inspect mode: load the model and report its dimensions, sparsity counts, constraint partition
+   // and a forecast of the factorization memory, without solving. The output is one "key value" line
+   // per metric, so that a scheduler can size the job before placing it
+   void inspect_uno_ampl(const std::string& model_name, const Options& options) {
+      const AMPLModel model(model_name, 1, options.get_bool("AMPL_structure_cache"));
+      std::cout << "variables " << model.number_variables << '\n';
+      std::cout << "constraints " << model.number_constraints << '\n';
+      std::cout << "equality_constraints " << model.get_equality_constraints().size() << '\n';
+      std::cout << "inequality_constraints " << model.get_inequality_constraints().size() << '\n';
+      std::cout << "linear_constraints " << model.get_linear_constraints().size() << '\n';
+      std::cout << "objective_gradient_nonzeros " << model.number_objective_gradient_nonzeros() << '\n';
+      std::cout << "jacobian_nonzeros " << model.number_jacobian_nonzeros() << '\n';
+      std::cout << "hessian_nonzeros " << model.number_hessian_nonzeros() << '\n';
+
+      // assemble the sparsity pattern of the augmented system at the initial point and run the
+      // analysis phase of the default direct solver to forecast the size of the factors
+      const size_t dimension = model.number_variables + model.number_constraints;
+      const size_t number_nonzeros = model.number_hessian_nonzeros() + model.number_jacobian_nonzeros();
+      Vector<double> x(model.number_variables);
+      model.initial_primal_point(x);
+      model.project_onto_variable_bounds(x);
+
+      SymmetricMatrix<SparseIndex, double> hessian(model.number_variables, model.number_hessian_nonzeros(), false, "COO");
+      Vector<double> constraint_multipliers(model.number_constraints);
+      constraint_multipliers.fill(1.);
+      model.evaluate_lagrangian_hessian(x, 1., constraint_multipliers, hessian);
+      RectangularMatrix<double> constraint_jacobian(model.number_constraints, model.number_variables);
+      model.evaluate_constraint_jacobian(x, constraint_jacobian);
+
+      SymmetricMatrix<SparseIndex, double> augmented_matrix(dimension, number_nonzeros, true, "COO");
+      hessian.for_each([&](size_t row_index, size_t column_index, double element) {
+         augmented_matrix.insert(element, row_index, column_index);
+      });
+      for (size_t constraint_index: Range(model.number_constraints)) {
+         for (const auto [variable_index, derivative]: constraint_jacobian[constraint_index]) {
+            augmented_matrix.insert(derivative, variable_index, model.number_variables + constraint_index);
+         }
+      }
+
+      auto linear_solver = SymmetricIndefiniteLinearSolverFactory::create(options.get_string("linear_solver"), dimension,
+            augmented_matrix.number_nonzeros() + dimension, options);
+      linear_solver->do_symbolic_factorization(augmented_matrix);
+      const size_t factor_entries = linear_solver->expected_number_factor_entries();
+      std::cout << "expected_factor_entries " << factor_entries << '\n';
+      // full forecast of the selected solver (0 when its analysis reports no forecast)
+      std::cout << "expected_factor_memory_bytes " << linear_solver->expected_factor_memory_bytes() << '\n';
+   }
+
+   // collect the .nl instances of a batch: either all the .nl files of a directory, or the paths
+   // listed (one per line) in a plain text file
+   std::vector<std::string> collect_batch_instances(const std::string& path) {
+      std::vector<std::string> instances;
+      if (std::filesystem::is_directory(path)) {
+         for (const auto& entry: std::filesystem::directory_iterator(path)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".nl") {
+               instances.emplace_back(entry.path().string());
+            }
+         }
+      }
+      else {
+         std::ifstream list_file(path);
+         if (!list_file) {
+            throw std::invalid_argument("The batch path " + path + " is neither a directory nor a readable file");
+         }
+         std::string line;
+         while (std::getline(list_file, line)) {
+            if (not line.empty()) {
+               instances.emplace_back(line);
+            }
+         }
+      }
+      std::sort(instances.begin(), instances.end());
+      return instances;
+   }
+
+   const char* const BATCH_REPORT_HEADER = "instance,status,objective,iterations,cpu_time,objective_evaluations,constraint_evaluations,"
+         "objective_gradient_evaluations,jacobian_evaluations,hessian_evaluations,subproblems_solved";
+
+   // multi-node consolidation: once every claim file contains its result line, exactly one node
+   // (the winner of an exclusively created sentinel file) merges them, in instance order, into the
+   // consolidated report. Nodes that finish while others are still solving simply return; the
+   // last-finishing node performs the merge
+   void consolidate_batch_report(const std::string& claim_directory, size_t number_instances, const std::string& report_file_name) {
+      std::vector<std::string> lines(number_instances);
+      for (size_t instance_index: Range(number_instances)) {
+         std::ifstream claim_file(claim_directory + "/claim_" + std::to_string(instance_index) + ".csv");
+         if (not claim_file.is_open() || not std::getline(claim_file, lines[instance_index]) || lines[instance_index].empty()) {
+            return; // unclaimed or still-running instance: a later-finishing node consolidates
+         }
+      }
+      const int sentinel_descriptor = ::open((claim_directory + "/consolidated").c_str(), O_CREAT | O_EXCL | O_WRONLY, 0644);
+      if (sentinel_descriptor < 0) {
+         return; // another node already consolidated
+      }
+      ::close(sentinel_descriptor);
+      std::ofstream report(report_file_name);
+      report << BATCH_REPORT_HEADER << '\n';
+      for (const std::string& line: lines) {
+         report << line << '\n';
+      }
+      INFO << "Consolidated batch report of " << number_instances << " instances written to " << report_file_name << '\n';
+   }
+
+   // solve a set of instances across a thread pool and aggregate the results into a CSV report.
+   // With a claim directory (batch_claim_directory on a shared filesystem), several nodes run the
+   // same batch concurrently and claim instances dynamically by exclusively creating one claim file
+   // per instance: each node pulls the next unclaimed instance, so the work balances itself instead
+   // of following a static split, and the node that finishes last writes the consolidated report.
+   // An instance whose node crashed leaves an empty claim file behind: remove the empty claim files
+   // and rerun to solve the leftovers and complete the consolidation.
+   // Note: the per-instance evaluation counts are approximate in parallel runs, since the evaluation
+   // counters are global
+   void run_uno_ampl_batch(const std::string& path, const Options& options) {
+      const std::vector<std::string> instances = collect_batch_instances(path);
+      INFO << "Batch mode: " << instances.size() << " instances\n";
+
+      const std::string claim_directory = options.get_string("batch_claim_directory");
+      const bool distributed = (claim_directory != "none");
+      std::string report_file_name = options.get_string("batch_report_file");
+      if (distributed) {
+         std::filesystem::create_directories(claim_directory);
+         // per-node local report: the consolidated report is written under the configured name once
+         char hostname[256] = "node";
+         ::gethostname(hostname, sizeof(hostname) - 1);
+         report_file_name += "." + std::string(hostname) + "." + std::to_string(::getpid());
+      }
+      // hard per-instance timeout (see Deadline): caps the solve time of every instance of the
+      // batch, so that one pathological instance cannot dictate the wall time of its node
+      const double batch_time_limit = options.get_double("batch_time_limit");
+
+      std::ofstream report(report_file_name);
+      report << BATCH_REPORT_HEADER << '\n';
+      std::mutex report_mutex;
+      std::atomic<size_t> next_instance{0};
+
+      // online option auto-tuner: one bandit arm per whitelisted option is drawn for each solve
+      // and rewarded with the observed solve time
+      std::unique_ptr<AutoTuner> auto_tuner{};
+      if (options.get_bool("auto_tune")) {
+         auto_tuner = std::make_unique<AutoTuner>(options);
+      }
+
+      const auto worker = [&]() {
+         while (true) {
+            const size_t instance_index = next_instance.fetch_add(1);
+            if (instances.size() <= instance_index) {
+               return;
+            }
+            const std::string& instance = instances[instance_index];
+            // distributed mode: claim the instance by exclusively creating its claim file (the
+            // instance list is sorted, so the indices agree across the nodes)
+            std::string claim_file_name;
+            if (distributed) {
+               claim_file_name = claim_directory + "/claim_" + std::to_string(instance_index) + ".csv";
+               const int claim_descriptor = ::open(claim_file_name.c_str(), O_CREAT | O_EXCL | O_WRONLY, 0644);
+               if (claim_descriptor < 0) {
+                  continue; // another node claimed this instance
+               }
+               ::close(claim_descriptor);
+            }
+            std::ostringstream result_line;
+            try {
+               Options run_options = options;
+               if (0. < batch_time_limit) {
+                  run_options["time_limit"] = std::to_string(batch_time_limit);
+               }
+               std::vector<size_t> tuner_selection;
+               if (auto_tuner != nullptr) {
+                  tuner_selection = auto_tuner->apply(run_options);
+               }
+               const Result result = run_uno_ampl(instance, run_options);
+               if (auto_tuner != nullptr) {
+                  const bool solved = (result.solution.status == TerminationStatus::FEASIBLE_KKT_POINT ||
+                        result.solution.status == TerminationStatus::FEASIBLE_ACCEPTABLE_POINT ||
+                        result.solution.status == TerminationStatus::FEASIBLE_FJ_POINT ||
+                        result.solution.status == TerminationStatus::FEASIBLE_SMALL_STEP);
+                  auto_tuner->report(tuner_selection, result.cpu_time, solved);
+               }
+               result_line << instance << ',' << static_cast<int>(result.solution.status) << ',' << result.solution.evaluations.objective << ','
+                           << result.iteration << ',' << result.cpu_time << ',' << result.objective_evaluations << ','
+                           << result.constraint_evaluations << ',' << result.objective_gradient_evaluations << ','
+                           << result.jacobian_evaluations << ',' << result.hessian_evaluations << ',' << result.number_subproblems_solved;
+            }
+            catch (const std::exception& exception) {
+               result_line << instance << ",error,,,,,,,,,";
+               INFO << "Instance " << instance << " failed: " << exception.what() << '\n';
+            }
+            if (distributed) {
+               // publish the result line in the claim file, where the consolidation collects it
+               std::ofstream claim_file(claim_file_name);
+               claim_file << result_line.str() << '\n';
+            }
+            const std::lock_guard<std::mutex> lock(report_mutex);
+            report << result_line.str() << '\n';
+         }
+      };
+
+      const size_t number_threads = std::max<size_t>(1, options.get_unsigned_int("batch_number_threads"));
+      std::vector<std::thread> threads;
+      threads.reserve(number_threads);
+      for (size_t thread_index = 0; thread_index < number_threads; thread_index++) {
+         threads.emplace_back(worker);
+      }
+      for (std::thread& thread: threads) {
+         thread.join();
+      }
+      INFO << "Batch report written to " << report_file_name << '\n';
+      if (distributed) {
+         report.close();
+         consolidate_batch_report(claim_directory, instances.size(), options.get_string("batch_report_file"));
+      }
+   }
+   // server mode: a long-lived process reads solve requests from stdin (one per line) and streams
+   // results back on stdout, amortizing process launch, dynamic linking, option parsing and
+   // allocator warmup across the solves of high-frequency small instances. Protocol:
+   //    solve <model.nl> [option=value ...]   solve one instance with per-request option overrides
+   //    quit                                  shut the server down (EOF works too)
+   // Each request is answered with a single line, "result <instance> <status> <objective>
+   // <iterations> <cpu_time>" on success or "error <instance> <message>" on failure, followed by
+   // "ready" once the server can accept the next request. Run with "-logger ERROR" (or WARNING)
+   // so that the solver logging does not interleave with the protocol lines
+   void run_uno_ampl_server(const Options& options) {
+      std::cout << "ready" << std::endl;
+      std::string line;
+      while (std::getline(std::cin, line)) {
+         std::istringstream request(line);
+         std::string command;
+         request >> command;
+         if (command.empty()) {
+            continue;
+         }
+         if (command == "quit") {
+            break;
+         }
+         else if (command == "solve") {
+            std::string model_name;
+            request >> model_name;
+            if (model_name.empty()) {
+               std::cout << "error solve missing_model_path" << std::endl;
+            }
+            else {
+               // per-request option overrides, on top of the options of the server process
+               Options request_options = options;
+               std::string override_token;
+               bool malformed_override = false;
+               while (request >> override_token) {
+                  const size_t equal_position = override_token.find('=');
+                  if (equal_position == std::string::npos || equal_position == 0) {
+                     std::cout << "error " << model_name << " malformed_option " << override_token << std::endl;
+                     malformed_override = true;
+                     break;
+                  }
+                  const std::string name = override_token.substr(0, equal_position);
+                  const std::string value = override_token.substr(equal_position + 1);
+                  if (name == "preset") {
+                     find_preset(value, request_options);
+                  }
+                  else {
+                     request_options[name] = value;
+                  }
+               }
+               if (not malformed_override) {
+                  try {
+                     const Result result = run_uno_ampl(model_name, request_options);
+                     std::cout << "result " << model_name << ' ' << static_cast<int>(result.solution.status) << ' ' <<
+                           result.solution.evaluations.objective << ' ' << result.iteration << ' ' << result.cpu_time << std::endl;
+                  }
+                  catch (const std::exception& exception) {
+                     std::cout << "error " << model_name << ' ' << exception.what() << std::endl;
+                  }
+               }
+            }
+         }
+         else {
+            std::cout << "error unknown_command " << command << std::endl;
+         }
+         std::cout << "ready" << std::endl;
+      }
    }
 } // namespace
 
 int main(int argc, char* argv[]) {
    using namespace uno;
-   
+
    if (1 < argc) {
       // get the default options
       Options options = Options::get_default_options("uno.options");
       // override them with the command line arguments
       options.get_command_line_arguments(argc, argv);
       Logger::set_logger(options.get_string("logger"));
+      if (options.get_bool("logger_async")) {
+         // move the blocking log and statistics writes off the solver thread
+         AsyncLogger::start();
+      }
+      // size the pool used by the chunked residual and norm reductions
+      ThreadPool::set_global_number_threads(options.get_unsigned_int("reduction_number_threads"));
+      // size the work-stealing scheduler that runs the asynchronous features
+      TaskScheduler::set_global_number_workers(options.get_unsigned_int("scheduler_number_threads"));
+      // first-touch page placement of the large allocations from that pool
+      FirstTouchAllocation::interleave = options.get_bool("NUMA_first_touch_interleave");
+      // transparent huge page advice for the multi-megabyte allocations
+      FirstTouchAllocation::huge_pages = options.get_bool("huge_pages");
+      // fixed chunking and reduction orders, for bitwise run-to-run reproducibility
+      ThreadPool::deterministic = options.get_bool("deterministic_parallel");
+      // O(1) vector copies until mutation, for the snapshot-heavy features
+      CopyOnWrite::active = options.get_bool("copy_on_write_vectors");
+      // heap allocation instrumentation of the solver containers
+      AllocationTracker::active = options.get_bool("allocation_tracking");
+      // cross-instance tuning memory, shared by the solves of a batch
+      TuningCache::active = options.get_bool("tuning_cache");
 
       if (std::string(argv[1]) == "-v") {
          Uno::print_uno_version();
@@ -64,10 +424,27 @@ int main(int argc, char* argv[]) {
       else if (std::string(argv[1]) == "--strategies") {
          Uno::print_available_strategies();
       }
+      else if (std::string(argv[1]) == "--inspect") {
+         // report the structure of the .nl file (last command line argument) without solving
+         inspect_uno_ampl(std::string(argv[argc - 1]), options);
+      }
+      else if (std::string(argv[1]) == "--batch") {
+         // solve all the instances of the directory or list file (last command line argument)
+         run_uno_ampl_batch(std::string(argv[argc - 1]), options);
+      }
+      else if (std::string(argv[1]) == "--server") {
+         // long-lived solver process: accept solve requests on stdin, stream results on stdout
+         run_uno_ampl_server(options);
+      }
+      else if (std::string(argv[1]) == "--multistart") {
+         // solve the .nl file (last command line argument) from several diversified initial points
+         run_uno_ampl_multistart(std::string(argv[argc - 1]), options);
+      }
       else {
          // run Uno on the .nl file (last command line argument)
          std::string model_name = std::string(argv[argc - 1]);
-         run_uno_ampl(model_name, options);
+         const Result result = run_uno_ampl(model_name, options);
+         Uno::print_optimization_summary(options, result);
       }
    }
    else {
@@ -0,0 +1,291 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <tuple>
+#include "CallbackModel.hpp"
+#include "linear_algebra/RectangularMatrix.hpp"
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/Evaluations.hpp"
+#include "optimization/EvaluationErrors.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+
+namespace uno {
+   CallbackModel::CallbackModel(const CallbackProblemDescription& description) :
+         Model(description.name, description.number_variables, description.number_constraints, description.objective_sign),
+         description(description),
+         variable_status(this->number_variables),
+         constraint_status(this->number_constraints),
+         constraint_type(this->number_constraints),
+         equality_constraints_collection(this->equality_constraints),
+         inequality_constraints_collection(this->inequality_constraints),
+         lower_bounded_variables_collection(this->lower_bounded_variables),
+         upper_bounded_variables_collection(this->upper_bounded_variables),
+         single_lower_bounded_variables_collection(this->single_lower_bounded_variables),
+         single_upper_bounded_variables_collection(this->single_upper_bounded_variables),
+         jacobian_rows(this->number_constraints),
+         hessian_column_order(description.hessian_row_indices.size()),
+         dense_gradient(this->number_variables),
+         jacobian_values(description.jacobian_constraint_indices.size()),
+         hessian_values(description.hessian_row_indices.size()) {
+      assert(this->description.variable_lower_bounds.size() == this->number_variables);
+      assert(this->description.constraint_lower_bounds.size() == this->number_constraints);
+
+      // variables: bound types and index lists
+      CallbackModel::determine_bounds_types(this->description.variable_lower_bounds, this->description.variable_upper_bounds, this->variable_status);
+      for (size_t variable_index: Range(this->number_variables)) {
+         const BoundType status = this->get_variable_bound_type(variable_index);
+         if (status == BOUNDED_LOWER || status == BOUNDED_BOTH_SIDES) {
+            this->lower_bounded_variables.emplace_back(variable_index);
+            if (status == BOUNDED_LOWER) {
+               this->single_lower_bounded_variables.emplace_back(variable_index);
+            }
+         }
+         if (status == BOUNDED_UPPER || status == BOUNDED_BOTH_SIDES) {
+            this->upper_bounded_variables.emplace_back(variable_index);
+            if (status == BOUNDED_UPPER) {
+               this->single_upper_bounded_variables.emplace_back(variable_index);
+            }
+         }
+      }
+
+      // constraints: bound types, linearity and equality/inequality partition
+      CallbackModel::determine_bounds_types(this->description.constraint_lower_bounds, this->description.constraint_upper_bounds,
+            this->constraint_status);
+      std::fill(this->constraint_type.begin(), this->constraint_type.end(), NONLINEAR);
+      for (size_t constraint_index: this->description.linear_constraints) {
+         this->constraint_type[constraint_index] = LINEAR;
+      }
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         if (this->get_constraint_bound_type(constraint_index) == EQUAL_BOUNDS) {
+            this->equality_constraints.emplace_back(constraint_index);
+         }
+         else {
+            this->inequality_constraints.emplace_back(constraint_index);
+         }
+      }
+
+      // per-constraint view of the Jacobian pattern
+      for (size_t nonzero_index: Range(this->description.jacobian_constraint_indices.size())) {
+         const size_t constraint_index = this->description.jacobian_constraint_indices[nonzero_index];
+         const size_t variable_index = this->description.jacobian_variable_indices[nonzero_index];
+         this->jacobian_rows[constraint_index].emplace_back(variable_index, nonzero_index);
+      }
+
+      // group the Hessian nonzeros by increasing column (the sparse formats are filled column by
+      // column), whatever the order the user provided the pattern in
+      std::iota(this->hessian_column_order.begin(), this->hessian_column_order.end(), size_t(0));
+      std::sort(this->hessian_column_order.begin(), this->hessian_column_order.end(), [&](size_t k1, size_t k2) {
+         const auto& rows = this->description.hessian_row_indices;
+         const auto& columns = this->description.hessian_column_indices;
+         return std::tie(columns[k1], rows[k1]) < std::tie(columns[k2], rows[k2]);
+      });
+   }
+
+   double CallbackModel::evaluate_objective(const Vector<double>& x) const {
+      double objective_value = 0.;
+      if (this->description.objective != nullptr && this->description.objective(x.data(), &objective_value, this->description.user_data) != 0) {
+         throw FunctionEvaluationError();
+      }
+      return this->objective_sign*objective_value;
+   }
+
+   void CallbackModel::evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const {
+      gradient.clear();
+      if (this->description.objective_gradient == nullptr) {
+         return;
+      }
+      if (this->description.objective_gradient(x.data(), this->dense_gradient.data(), this->description.user_data) != 0) {
+         throw GradientEvaluationError();
+      }
+      for (size_t variable_index: Range(this->number_variables)) {
+         gradient.insert(variable_index, this->objective_sign*this->dense_gradient[variable_index]);
+      }
+   }
+
+   void CallbackModel::evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      if (0 < this->number_constraints && this->description.constraints(x.data(), constraints.data(), this->description.user_data) != 0) {
+         throw FunctionEvaluationError();
+      }
+   }
+
+   // fill the Jacobian values buffer at x, unless it already holds the values at x: the
+   // constraint-by-constraint gradient queries at one point then trigger a single callback
+   void CallbackModel::fill_jacobian_values(const Vector<double>& x) const {
+      const uint64_t point_hash = Evaluations::hash_point(x);
+      if (point_hash == this->jacobian_point_hash) {
+         return;
+      }
+      if (this->description.constraint_jacobian(x.data(), this->jacobian_values.data(), this->description.user_data) != 0) {
+         throw GradientEvaluationError();
+      }
+      this->jacobian_point_hash = point_hash;
+   }
+
+   void CallbackModel::evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const {
+      this->fill_jacobian_values(x);
+      gradient.clear();
+      for (const auto& [variable_index, nonzero_index]: this->jacobian_rows[constraint_index]) {
+         gradient.insert(variable_index, this->jacobian_values[nonzero_index]);
+      }
+   }
+
+   void CallbackModel::evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const {
+      this->fill_jacobian_values(x);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         constraint_jacobian[constraint_index].clear();
+         for (const auto& [variable_index, nonzero_index]: this->jacobian_rows[constraint_index]) {
+            constraint_jacobian[constraint_index].insert(variable_index, this->jacobian_values[nonzero_index]);
+         }
+      }
+   }
+
+   void CallbackModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         SymmetricMatrix<SparseIndex, double>& hessian) const {
+      assert(this->description.lagrangian_hessian != nullptr &&
+             "CallbackModel: no Hessian callback was provided; solve with hessian_model=BFGS or hessian_model=zero");
+      objective_multiplier *= this->objective_sign;
+      if (this->description.lagrangian_hessian(x.data(), objective_multiplier, multipliers.data(), this->hessian_values.data(),
+            this->description.user_data) != 0) {
+         throw GradientEvaluationError();
+      }
+      // copy the nonzeros into the sparse format, grouped by increasing column
+      hessian.reset();
+      size_t current_column = 0;
+      for (const size_t nonzero_index: this->hessian_column_order) {
+         const size_t column_index = this->description.hessian_column_indices[nonzero_index];
+         while (current_column < column_index) {
+            hessian.finalize_column(current_column);
+            current_column++;
+         }
+         hessian.insert(this->hessian_values[nonzero_index], this->description.hessian_row_indices[nonzero_index], column_index);
+      }
+      while (current_column < this->number_variables) {
+         hessian.finalize_column(current_column);
+         current_column++;
+      }
+   }
+
+   double CallbackModel::variable_lower_bound(size_t variable_index) const {
+      return this->description.variable_lower_bounds[variable_index];
+   }
+
+   double CallbackModel::variable_upper_bound(size_t variable_index) const {
+      return this->description.variable_upper_bounds[variable_index];
+   }
+
+   BoundType CallbackModel::get_variable_bound_type(size_t variable_index) const {
+      return this->variable_status[variable_index];
+   }
+
+   const Collection<size_t>& CallbackModel::get_lower_bounded_variables() const {
+      return this->lower_bounded_variables_collection;
+   }
+
+   const Collection<size_t>& CallbackModel::get_upper_bounded_variables() const {
+      return this->upper_bounded_variables_collection;
+   }
+
+   const SparseVector<size_t>& CallbackModel::get_slacks() const {
+      return this->slacks;
+   }
+
+   const Collection<size_t>& CallbackModel::get_single_lower_bounded_variables() const {
+      return this->single_lower_bounded_variables_collection;
+   }
+
+   const Collection<size_t>& CallbackModel::get_single_upper_bounded_variables() const {
+      return this->single_upper_bounded_variables_collection;
+   }
+
+   double CallbackModel::constraint_lower_bound(size_t constraint_index) const {
+      return this->description.constraint_lower_bounds[constraint_index];
+   }
+
+   double CallbackModel::constraint_upper_bound(size_t constraint_index) const {
+      return this->description.constraint_upper_bounds[constraint_index];
+   }
+
+   FunctionType CallbackModel::get_constraint_type(size_t constraint_index) const {
+      return this->constraint_type[constraint_index];
+   }
+
+   BoundType CallbackModel::get_constraint_bound_type(size_t constraint_index) const {
+      return this->constraint_status[constraint_index];
+   }
+
+   const Collection<size_t>& CallbackModel::get_equality_constraints() const {
+      return this->equality_constraints_collection;
+   }
+
+   const Collection<size_t>& CallbackModel::get_inequality_constraints() const {
+      return this->inequality_constraints_collection;
+   }
+
+   const std::vector<size_t>& CallbackModel::get_linear_constraints() const {
+      return this->description.linear_constraints;
+   }
+
+   void CallbackModel::initial_primal_point(Vector<double>& x) const {
+      assert(x.size() >= this->number_variables);
+      if (this->description.initial_primals.empty()) {
+         x.fill(0.);
+      }
+      else {
+         std::copy(this->description.initial_primals.begin(), this->description.initial_primals.end(), x.begin());
+      }
+   }
+
+   void CallbackModel::initial_dual_point(Vector<double>& multipliers) const {
+      assert(multipliers.size() >= this->number_constraints);
+      if (this->description.initial_duals.empty()) {
+         multipliers.fill(0.);
+      }
+      else {
+         std::copy(this->description.initial_duals.begin(), this->description.initial_duals.end(), multipliers.begin());
+      }
+   }
+
+   void CallbackModel::postprocess_solution(Iterate& /*iterate*/, TerminationStatus /*termination_status*/) const {
+      // do nothing
+   }
+
+   size_t CallbackModel::number_objective_gradient_nonzeros() const {
+      return this->number_variables;
+   }
+
+   size_t CallbackModel::number_jacobian_nonzeros() const {
+      return this->description.jacobian_constraint_indices.size();
+   }
+
+   size_t CallbackModel::number_hessian_nonzeros() const {
+      return this->description.hessian_row_indices.size();
+   }
+
+   void CallbackModel::determine_bounds_types(const std::vector<double>& lower_bounds, const std::vector<double>& upper_bounds,
+         std::vector<BoundType>& status) {
+      assert(lower_bounds.size() == status.size());
+      assert(upper_bounds.size() == status.size());
+      for (size_t index: Range(lower_bounds.size())) {
+         if (lower_bounds[index] == upper_bounds[index]) {
+            status[index] = EQUAL_BOUNDS;
+         }
+         else if (is_finite(lower_bounds[index]) && is_finite(upper_bounds[index])) {
+            status[index] = BOUNDED_BOTH_SIDES;
+         }
+         else if (is_finite(lower_bounds[index])) {
+            status[index] = BOUNDED_LOWER;
+         }
+         else if (is_finite(upper_bounds[index])) {
+            status[index] = BOUNDED_UPPER;
+         }
+         else {
+            status[index] = UNBOUNDED;
+         }
+      }
+   }
+} // namespace
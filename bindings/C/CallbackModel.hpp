@@ -0,0 +1,134 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_CALLBACKMODEL_H
+#define UNO_CALLBACKMODEL_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "model/Model.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+#include "uno_c_api.h"
+
+namespace uno {
+   // in-memory description of a problem assembled through the C API (see uno_c_api.h): dimensions,
+   // bounds, fixed sparsity patterns and the evaluation callbacks
+   struct CallbackProblemDescription {
+      std::string name{"callback_model"};
+      size_t number_variables{0};
+      size_t number_constraints{0};
+      double objective_sign{1.};
+      void* user_data{nullptr};
+
+      uno_objective_callback objective{nullptr};
+      uno_objective_gradient_callback objective_gradient{nullptr};
+      uno_constraints_callback constraints{nullptr};
+      uno_constraint_jacobian_callback constraint_jacobian{nullptr};
+      uno_lagrangian_hessian_callback lagrangian_hessian{nullptr};
+
+      std::vector<double> variable_lower_bounds{};
+      std::vector<double> variable_upper_bounds{};
+      std::vector<double> constraint_lower_bounds{};
+      std::vector<double> constraint_upper_bounds{};
+      std::vector<double> initial_primals{};
+      std::vector<double> initial_duals{};
+      // Jacobian pattern in coordinate format: nonzero k sits in row jacobian_constraint_indices[k],
+      // column jacobian_variable_indices[k]
+      std::vector<size_t> jacobian_constraint_indices{};
+      std::vector<size_t> jacobian_variable_indices{};
+      // lower triangular Hessian pattern in coordinate format
+      std::vector<size_t> hessian_row_indices{};
+      std::vector<size_t> hessian_column_indices{};
+      std::vector<size_t> linear_constraints{};
+   };
+
+   /*! \class CallbackModel
+    * \brief Callback model
+    *
+    * Model whose functions are evaluated through user-provided C callbacks, for embedding Uno
+    * without the AMPL layer
+    */
+   class CallbackModel: public Model {
+   public:
+      explicit CallbackModel(const CallbackProblemDescription& description);
+      ~CallbackModel() override = default;
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
+      void evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const override;
+      void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+      void evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const override;
+      void evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            SymmetricMatrix<SparseIndex, double>& hessian) const override;
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override;
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override;
+      [[nodiscard]] BoundType get_variable_bound_type(size_t variable_index) const override;
+      [[nodiscard]] const Collection<size_t>& get_lower_bounded_variables() const override;
+      [[nodiscard]] const Collection<size_t>& get_upper_bounded_variables() const override;
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override;
+      [[nodiscard]] const Collection<size_t>& get_single_lower_bounded_variables() const override;
+      [[nodiscard]] const Collection<size_t>& get_single_upper_bounded_variables() const override;
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override;
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override;
+      [[nodiscard]] FunctionType get_constraint_type(size_t constraint_index) const override;
+      [[nodiscard]] BoundType get_constraint_bound_type(size_t constraint_index) const override;
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override;
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override;
+      [[nodiscard]] const std::vector<size_t>& get_linear_constraints() const override;
+
+      void initial_primal_point(Vector<double>& x) const override;
+      void initial_dual_point(Vector<double>& multipliers) const override;
+      void postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const override;
+
+      [[nodiscard]] size_t number_objective_gradient_nonzeros() const override;
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override;
+      [[nodiscard]] size_t number_hessian_nonzeros() const override;
+
+   private:
+      const CallbackProblemDescription description;
+
+      std::vector<BoundType> variable_status;
+      std::vector<BoundType> constraint_status;
+      std::vector<FunctionType> constraint_type;
+
+      // lists of variables and constraints + corresponding collection objects
+      std::vector<size_t> equality_constraints{};
+      CollectionAdapter<std::vector<size_t>&> equality_constraints_collection;
+      std::vector<size_t> inequality_constraints{};
+      CollectionAdapter<std::vector<size_t>&> inequality_constraints_collection;
+      SparseVector<size_t> slacks{};
+      std::vector<size_t> lower_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> lower_bounded_variables_collection;
+      std::vector<size_t> upper_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> upper_bounded_variables_collection;
+      std::vector<size_t> single_lower_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> single_lower_bounded_variables_collection;
+      std::vector<size_t> single_upper_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> single_upper_bounded_variables_collection;
+
+      // per-constraint view of the Jacobian pattern: (variable index, index into the values buffer)
+      std::vector<std::vector<std::pair<size_t, size_t>>> jacobian_rows;
+      // ordering of the Hessian nonzeros grouped by increasing column (the sparse formats are
+      // filled column by column), computed once since the pattern is fixed
+      std::vector<size_t> hessian_column_order;
+
+      // staging buffers for the callbacks (single evaluation context: no concurrent evaluations)
+      mutable std::vector<double> dense_gradient;
+      mutable std::vector<double> jacobian_values;
+      mutable std::vector<double> hessian_values;
+      // hash of the point at which the Jacobian values buffer was filled (0: none), so that the
+      // constraint-by-constraint gradient queries at one point trigger a single callback
+      mutable uint64_t jacobian_point_hash{0};
+
+      void fill_jacobian_values(const Vector<double>& x) const;
+      static void determine_bounds_types(const std::vector<double>& lower_bounds, const std::vector<double>& upper_bounds,
+            std::vector<BoundType>& status);
+   };
+} // namespace
+
+#endif // UNO_CALLBACKMODEL_H
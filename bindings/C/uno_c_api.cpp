@@ -0,0 +1,163 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <map>
+#include <memory>
+#include <string>
+#include "uno_c_api.h"
+#include "CallbackModel.hpp"
+#include "ingredients/globalization_mechanisms/GlobalizationMechanism.hpp"
+#include "ingredients/globalization_mechanisms/GlobalizationMechanismFactory.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.hpp"
+#include "Uno.hpp"
+#include "model/ModelFactory.hpp"
+#include "optimization/Result.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+
+// definition of the opaque C handle: the in-memory problem description plus the option overrides
+struct uno_problem {
+   uno::CallbackProblemDescription description{};
+   std::string option_file{"uno.options"};
+   std::map<std::string, std::string> option_overrides{};
+   std::string last_error{};
+};
+
+uno_problem* uno_create_problem(const char* name, size_t number_variables, size_t number_constraints) {
+   auto* problem = new uno_problem();
+   problem->description.name = (name != nullptr) ? name : "callback_model";
+   problem->description.number_variables = number_variables;
+   problem->description.number_constraints = number_constraints;
+   // unbounded by default
+   problem->description.variable_lower_bounds.assign(number_variables, -uno::INF<double>);
+   problem->description.variable_upper_bounds.assign(number_variables, uno::INF<double>);
+   problem->description.constraint_lower_bounds.assign(number_constraints, -uno::INF<double>);
+   problem->description.constraint_upper_bounds.assign(number_constraints, uno::INF<double>);
+   return problem;
+}
+
+void uno_destroy_problem(uno_problem* problem) {
+   delete problem;
+}
+
+void uno_set_user_data(uno_problem* problem, void* user_data) {
+   problem->description.user_data = user_data;
+}
+
+void uno_set_variable_bounds(uno_problem* problem, const double* lower_bounds, const double* upper_bounds) {
+   problem->description.variable_lower_bounds.assign(lower_bounds, lower_bounds + problem->description.number_variables);
+   problem->description.variable_upper_bounds.assign(upper_bounds, upper_bounds + problem->description.number_variables);
+}
+
+void uno_set_constraint_bounds(uno_problem* problem, const double* lower_bounds, const double* upper_bounds) {
+   problem->description.constraint_lower_bounds.assign(lower_bounds, lower_bounds + problem->description.number_constraints);
+   problem->description.constraint_upper_bounds.assign(upper_bounds, upper_bounds + problem->description.number_constraints);
+}
+
+void uno_set_initial_primal_point(uno_problem* problem, const double* initial_primals) {
+   problem->description.initial_primals.assign(initial_primals, initial_primals + problem->description.number_variables);
+}
+
+void uno_set_initial_dual_point(uno_problem* problem, const double* initial_duals) {
+   problem->description.initial_duals.assign(initial_duals, initial_duals + problem->description.number_constraints);
+}
+
+void uno_set_objective(uno_problem* problem, double objective_sign, uno_objective_callback objective,
+      uno_objective_gradient_callback objective_gradient) {
+   problem->description.objective_sign = objective_sign;
+   problem->description.objective = objective;
+   problem->description.objective_gradient = objective_gradient;
+}
+
+void uno_set_constraints(uno_problem* problem, uno_constraints_callback constraints, size_t number_jacobian_nonzeros,
+      const size_t* constraint_indices, const size_t* variable_indices, uno_constraint_jacobian_callback constraint_jacobian) {
+   problem->description.constraints = constraints;
+   problem->description.constraint_jacobian = constraint_jacobian;
+   problem->description.jacobian_constraint_indices.assign(constraint_indices, constraint_indices + number_jacobian_nonzeros);
+   problem->description.jacobian_variable_indices.assign(variable_indices, variable_indices + number_jacobian_nonzeros);
+}
+
+void uno_set_lagrangian_hessian(uno_problem* problem, size_t number_hessian_nonzeros, const size_t* row_indices,
+      const size_t* column_indices, uno_lagrangian_hessian_callback lagrangian_hessian) {
+   problem->description.lagrangian_hessian = lagrangian_hessian;
+   problem->description.hessian_row_indices.assign(row_indices, row_indices + number_hessian_nonzeros);
+   problem->description.hessian_column_indices.assign(column_indices, column_indices + number_hessian_nonzeros);
+}
+
+void uno_mark_constraint_linear(uno_problem* problem, size_t constraint_index) {
+   problem->description.linear_constraints.emplace_back(constraint_index);
+}
+
+void uno_set_option_file(uno_problem* problem, const char* file_name) {
+   problem->option_file = file_name;
+}
+
+void uno_set_option(uno_problem* problem, const char* option_name, const char* option_value) {
+   problem->option_overrides[option_name] = option_value;
+}
+
+int uno_solve(uno_problem* problem, double* primal_solution, double* constraint_multipliers, double* objective_value,
+      int* termination_status) {
+   using namespace uno;
+   try {
+      problem->last_error.clear();
+      // options: file defaults, overridden by the options set through the API
+      Options options = Options::get_default_options(problem->option_file);
+      for (const auto& [option_name, option_value]: problem->option_overrides) {
+         options[option_name] = option_value;
+      }
+      Logger::set_logger(options.get_string("logger"));
+
+      // callback model
+      std::unique_ptr<Model> callback_model = std::make_unique<CallbackModel>(problem->description);
+
+      // initialize initial primal and dual points
+      Iterate initial_iterate(callback_model->number_variables, callback_model->number_constraints);
+      callback_model->initial_primal_point(initial_iterate.primals);
+      callback_model->project_onto_variable_bounds(initial_iterate.primals);
+      callback_model->initial_dual_point(initial_iterate.multipliers.constraints);
+      initial_iterate.feasibility_multipliers.reset();
+
+      // pick the ingredient preset from the structure of the problem, if requested
+      if (options.get_string("preset") == "auto") {
+         ModelFactory::select_automatic_preset(*callback_model, options);
+      }
+
+      // reformulate (scale, add slacks, relax the bounds, ...) if necessary
+      std::unique_ptr<Model> model = ModelFactory::reformulate(std::move(callback_model), initial_iterate, options);
+
+      // create the constraint relaxation strategy, the globalization mechanism and the Uno solver
+      auto constraint_relaxation_strategy = ConstraintRelaxationStrategyFactory::create(*model, options);
+      auto globalization_mechanism = GlobalizationMechanismFactory::create(*constraint_relaxation_strategy, options);
+      Uno uno = Uno(*globalization_mechanism, options);
+
+      const Result result = uno.solve(*model, initial_iterate, options);
+
+      // copy the requested pieces of the solution back to the caller
+      if (primal_solution != nullptr) {
+         std::copy(result.solution.primals.begin(), result.solution.primals.begin() + static_cast<long>(problem->description.number_variables),
+               primal_solution);
+      }
+      if (constraint_multipliers != nullptr) {
+         std::copy(result.solution.multipliers.constraints.begin(),
+               result.solution.multipliers.constraints.begin() + static_cast<long>(problem->description.number_constraints),
+               constraint_multipliers);
+      }
+      if (objective_value != nullptr) {
+         *objective_value = result.solution.evaluations.objective;
+      }
+      if (termination_status != nullptr) {
+         *termination_status = static_cast<int>(result.solution.status);
+      }
+      return 0;
+   }
+   catch (const std::exception& exception) {
+      problem->last_error = exception.what();
+      return 1;
+   }
+}
+
+const char* uno_last_error(const uno_problem* problem) {
+   return problem->last_error.c_str();
+}
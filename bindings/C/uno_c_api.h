@@ -0,0 +1,96 @@
+/* Copyright (c) 2018-2024 Charlie Vanaret
+ * Licensed under the MIT license. See LICENSE file in the project directory for details. */
+
+#ifndef UNO_C_API_H
+#define UNO_C_API_H
+
+#include <stddef.h>
+
+/* C-callable embedding API: hand a problem to Uno in memory, with the evaluations provided as
+ * function pointers, instead of round-tripping through a .nl file and the ASL.
+ *
+ * usage:
+ *    uno_problem* problem = uno_create_problem("my_problem", n, m);
+ *    uno_set_variable_bounds(problem, lower, upper);
+ *    ... (bounds, callbacks, sparsity patterns, options) ...
+ *    uno_solve(problem, primal_solution, constraint_multipliers, &objective, &status);
+ *    uno_destroy_problem(problem);
+ *
+ * The sparsity patterns are fixed and given once at setup, in coordinate (COO) format; the
+ * callbacks then only fill the values, in the same order as the given pattern. The Hessian
+ * pattern covers the lower triangular part. All callbacks return 0 on success and a nonzero
+ * value to signal an evaluation error (e.g. log of a negative number), which Uno handles by
+ * rejecting the trial point. */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* opaque problem handle */
+typedef struct uno_problem uno_problem;
+
+/* termination statuses, mirroring uno::TerminationStatus */
+enum {
+   UNO_NOT_OPTIMAL = 0,
+   UNO_FEASIBLE_KKT_POINT,
+   UNO_FEASIBLE_FJ_POINT,
+   UNO_INFEASIBLE_STATIONARY_POINT,
+   UNO_FEASIBLE_SMALL_STEP,
+   UNO_INFEASIBLE_SMALL_STEP,
+   UNO_UNBOUNDED,
+   UNO_FEASIBLE_ACCEPTABLE_POINT
+};
+
+/* evaluation callbacks. x has number_variables entries, multipliers number_constraints entries */
+typedef int (*uno_objective_callback)(const double* x, double* objective_value, void* user_data);
+typedef int (*uno_objective_gradient_callback)(const double* x, double* dense_gradient, void* user_data);
+typedef int (*uno_constraints_callback)(const double* x, double* constraint_values, void* user_data);
+typedef int (*uno_constraint_jacobian_callback)(const double* x, double* jacobian_values, void* user_data);
+typedef int (*uno_lagrangian_hessian_callback)(const double* x, double objective_multiplier, const double* multipliers,
+      double* hessian_values, void* user_data);
+
+/* create a problem with the given dimensions. The variables are unbounded, the initial point is
+ * zero and the objective is minimized until set otherwise */
+uno_problem* uno_create_problem(const char* name, size_t number_variables, size_t number_constraints);
+void uno_destroy_problem(uno_problem* problem);
+
+/* pointer passed back to every callback */
+void uno_set_user_data(uno_problem* problem, void* user_data);
+
+/* problem data (the arrays are copied) */
+void uno_set_variable_bounds(uno_problem* problem, const double* lower_bounds, const double* upper_bounds);
+void uno_set_constraint_bounds(uno_problem* problem, const double* lower_bounds, const double* upper_bounds);
+void uno_set_initial_primal_point(uno_problem* problem, const double* initial_primals);
+void uno_set_initial_dual_point(uno_problem* problem, const double* initial_duals);
+/* objective_sign: 1. to minimize, -1. to maximize */
+void uno_set_objective(uno_problem* problem, double objective_sign, uno_objective_callback objective,
+      uno_objective_gradient_callback objective_gradient);
+/* the Jacobian pattern maps every nonzero k to (constraint_indices[k], variable_indices[k]) */
+void uno_set_constraints(uno_problem* problem, uno_constraints_callback constraints, size_t number_jacobian_nonzeros,
+      const size_t* constraint_indices, const size_t* variable_indices, uno_constraint_jacobian_callback constraint_jacobian);
+/* lower triangular pattern (row_indices[k] >= column_indices[k]). Without a Hessian callback,
+ * solve with hessian_model=BFGS or hessian_model=zero */
+void uno_set_lagrangian_hessian(uno_problem* problem, size_t number_hessian_nonzeros, const size_t* row_indices,
+      const size_t* column_indices, uno_lagrangian_hessian_callback lagrangian_hessian);
+/* declare a constraint linear (enables the linear-constraint preprocessing) */
+void uno_mark_constraint_linear(uno_problem* problem, size_t constraint_index);
+
+/* options: defaults are read from the option file at solve time ("uno.options" unless overridden),
+ * individual options set here take precedence */
+void uno_set_option_file(uno_problem* problem, const char* file_name);
+void uno_set_option(uno_problem* problem, const char* option_name, const char* option_value);
+
+/* solve the problem. primal_solution (number_variables entries) and constraint_multipliers
+ * (number_constraints entries) may be NULL when not wanted. Returns 0 on success, nonzero on
+ * failure (see uno_last_error) */
+int uno_solve(uno_problem* problem, double* primal_solution, double* constraint_multipliers, double* objective_value,
+      int* termination_status);
+
+/* message of the last error encountered by uno_solve, or an empty string */
+const char* uno_last_error(const uno_problem* problem);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* UNO_C_API_H */
@@ -0,0 +1,204 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+#include "Multistart.hpp"
+#include "Uno.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.hpp"
+#include "ingredients/globalization_mechanisms/GlobalizationMechanism.hpp"
+#include "ingredients/globalization_mechanisms/GlobalizationMechanismFactory.hpp"
+#include "model/Model.hpp"
+#include "optimization/Iterate.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+#include "tools/TaskScheduler.hpp"
+#include "tools/ThreadPool.hpp"
+
+namespace uno {
+   Multistart::Multistart(const Options& options):
+         number_points(std::max<size_t>(1, options.get_unsigned_int("multistart_number_points"))),
+         number_threads(std::max<size_t>(1, options.get_unsigned_int("multistart_number_threads"))),
+         perturbation_amplitude(options.get_double("multistart_perturbation_amplitude")),
+         tolerance(options.get_double("tolerance")) {
+   }
+
+   Result Multistart::solve(const Model& model, const Iterate& initial_iterate, const Options& options) const {
+      size_t number_worker_threads = this->number_threads;
+      if (1 < number_worker_threads && not model.supports_concurrent_evaluations()) {
+         WARNING << "Multistart: the model does not support concurrent evaluations, falling back to one thread\n";
+         number_worker_threads = 1;
+      }
+      // the runs go through the shared task scheduler when it has workers, so that the thread
+      // budget stays global (scheduler_number_threads); dedicated threads otherwise
+      TaskScheduler& scheduler = TaskScheduler::global();
+      const bool use_scheduler = 0 < scheduler.number_workers() && model.supports_concurrent_evaluations();
+      if (use_scheduler) {
+         INFO << "Multistart: " << this->number_points << " initial points on the task scheduler (" << scheduler.number_workers() <<
+               " workers)\n";
+      }
+      else {
+         INFO << "Multistart: " << this->number_points << " initial points on " << number_worker_threads << " threads\n";
+      }
+      std::optional<Result> best_result{};
+      std::mutex best_result_mutex;
+      // objective of the best feasible solution found so far, read by the cancellation tests
+      std::atomic<double> best_feasible_objective{INF<double>};
+      std::atomic<size_t> next_point{0};
+      // deterministic mode: no cross-run cancellation, and the best result is selected in point
+      // order once all the runs completed, so that the outcome does not depend on thread timing
+      const bool deterministic = ThreadPool::deterministic;
+      std::vector<std::optional<Result>> results_per_point{};
+      if (deterministic) {
+         results_per_point.resize(this->number_points);
+      }
+
+      const auto solve_point = [&](size_t point_index) {
+         try {
+            // each run gets a fresh strategy stack (the strategies are stateful); the model is shared
+            auto constraint_relaxation_strategy = ConstraintRelaxationStrategyFactory::create(model, options);
+            auto globalization_mechanism = GlobalizationMechanismFactory::create(*constraint_relaxation_strategy, options);
+            Uno uno = Uno(*globalization_mechanism, options);
+            // cancel this run as soon as it is feasible but dominated by the incumbent objective
+            // (timing-dependent, hence disabled in deterministic mode)
+            if (not deterministic) {
+               uno.add_user_termination_callback([&](const Iterate& iterate, const Statistics& /*statistics*/) {
+                  return iterate.is_objective_computed && iterate.primal_feasibility <= this->tolerance &&
+                        best_feasible_objective.load() < iterate.evaluations.objective;
+               });
+            }
+
+            Iterate start_iterate = this->generate_initial_point(model, initial_iterate, point_index);
+            Result result = uno.solve(model, start_iterate, options);
+
+            // publish the objective of a feasible solution for the cancellation tests
+            if (result.solution.is_objective_computed && result.solution.primal_feasibility <= this->tolerance) {
+               double current_best = best_feasible_objective.load();
+               while (result.solution.evaluations.objective < current_best &&
+                      not best_feasible_objective.compare_exchange_weak(current_best, result.solution.evaluations.objective)) {
+               }
+            }
+            if (deterministic) {
+               // no lock needed: every run writes its own slot
+               results_per_point[point_index].emplace(std::move(result));
+            }
+            else {
+               const std::lock_guard<std::mutex> lock(best_result_mutex);
+               if (not best_result.has_value() || Multistart::is_better(result, *best_result)) {
+                  best_result.emplace(std::move(result));
+               }
+            }
+         }
+         catch (const std::exception& exception) {
+            INFO << "Multistart: the run from initial point " << point_index << " failed: " << exception.what() << '\n';
+         }
+      };
+
+      if (use_scheduler) {
+         // one task per point: the work stealing balances the runs across the scheduler workers
+         std::vector<std::future<void>> futures;
+         futures.reserve(this->number_points);
+         for (size_t point_index: Range(this->number_points)) {
+            futures.emplace_back(scheduler.submit(TaskScheduler::Priority::CRITICAL, CancellationToken(),
+                  [&solve_point, point_index]() { solve_point(point_index); }));
+         }
+         for (std::future<void>& future: futures) {
+            future.get();
+         }
+      }
+      else {
+         const auto worker = [&]() {
+            while (true) {
+               const size_t point_index = next_point.fetch_add(1);
+               if (this->number_points <= point_index) {
+                  return;
+               }
+               solve_point(point_index);
+            }
+         };
+         std::vector<std::thread> threads;
+         threads.reserve(number_worker_threads);
+         for (size_t thread_index = 0; thread_index < number_worker_threads; thread_index++) {
+            threads.emplace_back(worker);
+         }
+         for (std::thread& thread: threads) {
+            thread.join();
+         }
+      }
+
+      if (deterministic) {
+         // fixed selection order: ties are broken by the smallest point index
+         for (std::optional<Result>& result: results_per_point) {
+            if (result.has_value() && (not best_result.has_value() || Multistart::is_better(*result, *best_result))) {
+               best_result.emplace(std::move(*result));
+            }
+         }
+      }
+      if (not best_result.has_value()) {
+         throw std::runtime_error("Multistart: all the runs failed");
+      }
+      return std::move(*best_result);
+   }
+
+   // diversified starts: point 0 is the nominal initial point. The later points are deterministic
+   // perturbations of it: a variable with two finite bounds is sampled uniformly in its range, the
+   // others are perturbed around their nominal value and projected onto their bounds
+   Iterate Multistart::generate_initial_point(const Model& model, const Iterate& nominal_iterate, size_t point_index) const {
+      Iterate start_iterate(nominal_iterate);
+      if (point_index == 0) {
+         return start_iterate;
+      }
+      std::mt19937 generator(static_cast<std::mt19937::result_type>(point_index));
+      std::uniform_real_distribution<double> unit_interval(0., 1.);
+      for (size_t variable_index: Range(model.number_variables)) {
+         const double lower_bound = model.variable_lower_bound(variable_index);
+         const double upper_bound = model.variable_upper_bound(variable_index);
+         if (is_finite(lower_bound) && is_finite(upper_bound)) {
+            start_iterate.primals[variable_index] = lower_bound + unit_interval(generator) * (upper_bound - lower_bound);
+         }
+         else {
+            const double amplitude = this->perturbation_amplitude * std::max(1., std::abs(nominal_iterate.primals[variable_index]));
+            start_iterate.primals[variable_index] += amplitude * (2.*unit_interval(generator) - 1.);
+         }
+      }
+      model.project_onto_variable_bounds(start_iterate.primals);
+      return start_iterate;
+   }
+
+   // smaller rank is better: feasible outcomes (ranks 0 to 3) first, then unboundedness, then
+   // infeasible stationary outcomes, then no convergence
+   size_t Multistart::status_rank(TerminationStatus status) {
+      switch (status) {
+         case TerminationStatus::FEASIBLE_KKT_POINT: return 0;
+         case TerminationStatus::FEASIBLE_ACCEPTABLE_POINT: return 1;
+         case TerminationStatus::FEASIBLE_FJ_POINT: return 2;
+         case TerminationStatus::FEASIBLE_SMALL_STEP: return 3;
+         case TerminationStatus::UNBOUNDED: return 4;
+         case TerminationStatus::INFEASIBLE_STATIONARY_POINT: return 5;
+         case TerminationStatus::INFEASIBLE_SMALL_STEP: return 6;
+         default: return 7;
+      }
+   }
+
+   bool Multistart::is_better(const Result& candidate, const Result& incumbent) {
+      const size_t candidate_rank = Multistart::status_rank(candidate.solution.status);
+      const size_t incumbent_rank = Multistart::status_rank(incumbent.solution.status);
+      if (candidate_rank != incumbent_rank) {
+         return (candidate_rank < incumbent_rank);
+      }
+      if (candidate_rank <= 3) { // both runs terminated at feasible points: compare the objectives
+         return (candidate.solution.evaluations.objective < incumbent.solution.evaluations.objective);
+      }
+      // otherwise, prefer the smaller constraint violation
+      return (candidate.solution.primal_feasibility < incumbent.solution.primal_feasibility);
+   }
+} // namespace
@@ -0,0 +1,39 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_MULTISTART_H
+#define UNO_MULTISTART_H
+
+#include <cstddef>
+#include "optimization/Result.hpp"
+#include "optimization/TerminationStatus.hpp"
+
+namespace uno {
+   // forward declarations
+   class Model;
+   class Options;
+
+   // multistart driver: solves the same model from several diversified initial points, possibly
+   // concurrently, and returns the best result. The workers share the (immutable) model but each
+   // builds its own strategy stack; when several threads are requested, the model evaluations must
+   // therefore be safe for concurrent callers (e.g. one evaluation workspace per thread). A run
+   // whose iterate is feasible but dominated by the incumbent objective is cancelled early
+   class Multistart {
+   public:
+      explicit Multistart(const Options& options);
+
+      [[nodiscard]] Result solve(const Model& model, const Iterate& initial_iterate, const Options& options) const;
+
+   private:
+      const size_t number_points;
+      const size_t number_threads;
+      const double perturbation_amplitude;
+      const double tolerance;
+
+      [[nodiscard]] Iterate generate_initial_point(const Model& model, const Iterate& nominal_iterate, size_t point_index) const;
+      [[nodiscard]] static size_t status_rank(TerminationStatus status);
+      [[nodiscard]] static bool is_better(const Result& candidate, const Result& incumbent);
+   };
+} // namespace
+
+#endif // UNO_MULTISTART_H
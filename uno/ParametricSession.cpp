@@ -0,0 +1,80 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include "ParametricSession.hpp"
+#include "Uno.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.hpp"
+#include "ingredients/globalization_mechanisms/GlobalizationMechanism.hpp"
+#include "ingredients/globalization_mechanisms/GlobalizationMechanismFactory.hpp"
+#include "model/Model.hpp"
+#include "model/ModelFactory.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   ParametricSession::ParametricSession(std::unique_ptr<Model> original_model, const Options& options):
+         options(options),
+         perturbable_model(original_model.get()),
+         current_iterate(original_model->number_variables, original_model->number_constraints) {
+      // initialize initial primal and dual points
+      original_model->initial_primal_point(this->current_iterate.primals);
+      original_model->project_onto_variable_bounds(this->current_iterate.primals);
+      original_model->initial_dual_point(this->current_iterate.multipliers.constraints);
+      this->current_iterate.feasibility_multipliers.reset();
+
+      if (this->options.get_bool("presolve_fixed_variables") || this->options.get_bool("presolve_bound_tightening") ||
+            this->options.get_bool("presolve_redundant_constraints")) {
+         WARNING << "Parametric session: the materializing presolves freeze the bounds at construction and will not see the perturbations\n";
+      }
+
+      // reformulate (scale, add slacks, relax the bounds, ...) if necessary, then build the
+      // strategy stack once: it is retained across the solves of the session
+      this->model = ModelFactory::reformulate(std::move(original_model), this->current_iterate, this->options);
+      this->constraint_relaxation_strategy = ConstraintRelaxationStrategyFactory::create(*this->model, this->options);
+      this->globalization_mechanism = GlobalizationMechanismFactory::create(*this->constraint_relaxation_strategy, this->options);
+   }
+
+   // out of line, where Model and the strategies are complete types
+   ParametricSession::~ParametricSession() = default;
+
+   void ParametricSession::set_variable_bounds(size_t variable_index, double lower_bound, double upper_bound) {
+      this->perturbable_model->set_variable_bounds(variable_index, lower_bound, upper_bound);
+   }
+
+   void ParametricSession::set_constraint_bounds(size_t constraint_index, double lower_bound, double upper_bound) {
+      this->perturbable_model->set_constraint_bounds(constraint_index, lower_bound, upper_bound);
+   }
+
+   Result ParametricSession::solve() {
+      // the Uno driver itself is cheap to recreate; the expensive state lives in the strategies
+      Uno uno(*this->globalization_mechanism, this->options);
+      Iterate solve_iterate(this->current_iterate);
+      // the perturbed bounds may have moved past the warm-start point
+      this->model->project_onto_variable_bounds(solve_iterate.primals);
+      Result result = uno.solve(*this->model, solve_iterate, this->options);
+
+      // warm-start the next solve from this solution. The solution was postprocessed into the
+      // original space, whose dimensions may differ from the reformulated ones: copy the
+      // overlapping entries and keep the remainder (e.g. slacks) from the previous start
+      const size_t number_common_variables = std::min(this->current_iterate.primals.size(), result.solution.primals.size());
+      for (size_t variable_index: Range(number_common_variables)) {
+         this->current_iterate.primals[variable_index] = result.solution.primals[variable_index];
+         this->current_iterate.multipliers.lower_bounds[variable_index] = result.solution.multipliers.lower_bounds[variable_index];
+         this->current_iterate.multipliers.upper_bounds[variable_index] = result.solution.multipliers.upper_bounds[variable_index];
+      }
+      const size_t number_common_constraints = std::min(this->current_iterate.multipliers.constraints.size(),
+            result.solution.multipliers.constraints.size());
+      for (size_t constraint_index: Range(number_common_constraints)) {
+         this->current_iterate.multipliers.constraints[constraint_index] = result.solution.multipliers.constraints[constraint_index];
+      }
+      // the cached evaluations of the previous start are stale
+      this->current_iterate.is_objective_computed = false;
+      this->current_iterate.are_constraints_computed = false;
+      this->current_iterate.is_objective_gradient_computed = false;
+      this->current_iterate.is_constraint_jacobian_computed = false;
+      this->current_iterate.progress.reset();
+      return result;
+   }
+} // namespace
@@ -0,0 +1,47 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_PARAMETRICSESSION_H
+#define UNO_PARAMETRICSESSION_H
+
+#include <memory>
+#include "optimization/Iterate.hpp"
+#include "optimization/Result.hpp"
+#include "tools/Options.hpp"
+
+namespace uno {
+   // forward declarations
+   class ConstraintRelaxationStrategy;
+   class GlobalizationMechanism;
+   class Model;
+
+   // parametric re-solve driver: retains the model, the reformulation stack and the whole strategy
+   // stack across a sequence of solves of instances that differ only in their bounds. Between
+   // solves, the bounds of the retained model are perturbed in place (see Model::set_variable_bounds)
+   // and everything structural stays alive: sparsity patterns, the analysis phases of the direct
+   // solvers, scaling factors and the ingredient workspaces. From the second call on, the solve is
+   // warm-started from the previous solution. The materializing presolves (fixed variables, bound
+   // tightening, redundant constraints) freeze the data they derive at construction and should be
+   // disabled for parametric runs
+   class ParametricSession {
+   public:
+      ParametricSession(std::unique_ptr<Model> original_model, const Options& options);
+      ~ParametricSession();
+
+      // perturb the bounds of the retained model; the perturbation may not change the bound types
+      void set_variable_bounds(size_t variable_index, double lower_bound, double upper_bound);
+      void set_constraint_bounds(size_t constraint_index, double lower_bound, double upper_bound);
+
+      [[nodiscard]] Result solve();
+
+   private:
+      Options options;
+      Model* perturbable_model; /*!< innermost model, target of the perturbations (not owned) */
+      std::unique_ptr<Model> model; /*!< reformulated model */
+      Iterate current_iterate;
+      std::unique_ptr<ConstraintRelaxationStrategy> constraint_relaxation_strategy;
+      std::unique_ptr<GlobalizationMechanism> globalization_mechanism;
+   };
+} // namespace
+
+#endif // UNO_PARAMETRICSESSION_H
@@ -1,7 +1,12 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include <cmath>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
 #include "Uno.hpp"
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.hpp"
 #include "ingredients/globalization_mechanisms/GlobalizationMechanism.hpp"
@@ -10,8 +15,12 @@
 #include "ingredients/subproblems/SubproblemFactory.hpp"
 #include "model/Model.hpp"
 #include "optimization/Iterate.hpp"
+#include "tools/AllocationTracker.hpp"
+#include "tools/Deadline.hpp"
 #include "tools/Logger.hpp"
+#include "tools/MemoryUsage.hpp"
 #include "tools/Options.hpp"
+#include "tools/Profiler.hpp"
 #include "tools/Statistics.hpp"
 #include "tools/Timer.hpp"
 
@@ -19,7 +28,28 @@ namespace uno {
    Uno::Uno(GlobalizationMechanism& globalization_mechanism, const Options& options) :
          globalization_mechanism(globalization_mechanism),
          max_iterations(options.get_unsigned_int("max_iterations")),
-         time_limit(options.get_double("time_limit")) {
+         time_limit(options.get_double("time_limit")),
+         snapshot_file(options.get_string("snapshot_file")),
+         snapshot_interval(options.get_unsigned_int("snapshot_interval")),
+         option_overlay_file(options.get_string("option_overlay_file")),
+         flight_recorder_file(options.get_string("flight_recorder_file")),
+         flight_recorder_length(options.get_unsigned_int("flight_recorder_length")),
+         restart_max_attempts(options.get_unsigned_int("restart_max_attempts")),
+         restart_perturbation_amplitude(options.get_double("restart_perturbation_amplitude")),
+         restart_stall_iteration_threshold(options.get_unsigned_int("restart_stall_iteration_threshold")),
+         divergence_iteration_threshold(options.get_unsigned_int("divergence_iteration_threshold")),
+         divergence_objective_threshold(options.get_double("divergence_objective_threshold")),
+         tolerance(options.get_double("tolerance")),
+         acceleration_memory(options.get_unsigned_int("acceleration_memory")),
+         residual_norm(norm_from_string(options.get_string("residual_norm"))),
+         allocation_tracking(options.get_bool("allocation_tracking")),
+         allocation_assert_iteration(options.get_unsigned_int("allocation_assert_iteration")) {
+   }
+
+   Uno::~Uno() {
+      if (this->snapshot_thread.joinable()) {
+         this->snapshot_thread.join();
+      }
    }
    
    Level Logger::level = INFO;
@@ -28,15 +58,32 @@ namespace uno {
       std::cout << "Problem " << model.name << '\n' << model.number_variables << " variables, " << model.number_constraints << " constraints\n\n";
       
       Timer timer{};
+      // cooperative time-limit enforcement inside the inner loops and the solver wrappers
+      Deadline::arm(this->time_limit);
+      Profiler::enabled = options.get_bool("profiler");
+      Profiler::counters_enabled = Profiler::enabled && options.get_bool("profiler_hardware_counters");
+      Profiler::reset();
       Statistics statistics = Uno::create_statistics(model, options);
+      // install the per-solve evaluation counters: they become the active counters of this thread
+      // and of the iterates of this solve (including their copies, e.g. the trial iterate)
+      this->evaluation_counters.reset();
+      EvaluationCounters::active = &this->evaluation_counters;
+      current_iterate.counters = &this->evaluation_counters;
 
       // use the initial primal-dual point to initialize the strategies and generate the initial iterate
       this->initialize(statistics, current_iterate, options);
+      // possibly resume from the snapshot of a previous, interrupted solve
+      if (this->snapshot_file != "none" && this->read_snapshot(model, current_iterate)) {
+         INFO << "Resumed from snapshot " << this->snapshot_file << '\n';
+      }
       current_iterate.status = TerminationStatus::NOT_OPTIMAL;
-      // allocate the trial iterate once and for all here
+      // allocate the trial iterate once and for all here; the copy does not carry the spare
+      // capacity over, so the reservation of the maximum phase size is repeated explicitly
       Iterate trial_iterate(current_iterate);
+      trial_iterate.reserve(current_iterate.reserved_number_variables);
 
       size_t major_iterations = 0;
+      this->allocation_count_reference = AllocationTracker::count();
       try {
          bool termination = false;
          // check for termination
@@ -44,13 +91,62 @@ namespace uno {
             major_iterations++;
             statistics.start_new_line();
             statistics.set("iter", major_iterations);
+            // report the heap allocations of the previous outer iteration (the console line of an
+            // iteration is printed before the iteration ends, hence the one-line lag)
+            if (this->allocation_tracking) {
+               const size_t allocations = AllocationTracker::count() - this->allocation_count_reference;
+               statistics.set("allocs", allocations);
+               this->allocation_count_reference = AllocationTracker::count();
+               if (0 < this->allocation_assert_iteration && this->allocation_assert_iteration + 1 < major_iterations && 0 < allocations) {
+                  throw std::runtime_error("Steady-state allocation: iteration " + std::to_string(major_iterations - 1) + " performed " +
+                        std::to_string(allocations) + " heap allocations beyond allocation_assert_iteration");
+               }
+            }
             DEBUG << "### Outer iteration " << major_iterations << '\n';
+            // mid-solve retuning: apply possible changes of the option overlay file
+            this->poll_option_overlay();
 
             // compute an acceptable iterate by solving a subproblem at the current point
             this->globalization_mechanism.compute_next_iterate(statistics, model, current_iterate, trial_iterate);
             termination = this->termination_criteria(trial_iterate.status, major_iterations, timer.get_duration());
+            for (const auto& callback: this->user_termination_callbacks) {
+               if (not termination && callback(trial_iterate, statistics)) {
+                  DEBUG << "The solve was cancelled by a user termination callback\n";
+                  termination = true;
+               }
+            }
+            // hopeless runs: declare unboundedness or infeasibility from the trends of the recent
+            // iterations, without burning the full iteration or time budget
+            if (not termination && 0 < this->divergence_iteration_threshold) {
+               const TerminationStatus trend_status = this->detect_hopeless_trend(trial_iterate);
+               if (trend_status != TerminationStatus::NOT_OPTIMAL) {
+                  trial_iterate.status = trend_status;
+                  termination = true;
+               }
+            }
             // the trial iterate becomes the current iterate for the next iteration
             std::swap(current_iterate, trial_iterate);
+
+            // Anderson/DIIS acceleration: once the recent residuals are nearly collinear, an
+            // extrapolated iterate may save several factorizations at the cost of one evaluation
+            if (not termination && 0 < this->acceleration_memory) {
+               this->record_acceleration_entry(model, current_iterate);
+               if (this->try_accelerated_iterate(model, current_iterate)) {
+                  DEBUG << "Anderson acceleration: extrapolated iterate adopted\n";
+               }
+            }
+
+            // stalled solve: perturb the current point and reinitialize the strategies, a bounded
+            // number of times, before the iteration limit declares failure
+            if (not termination && this->restart_attempts < this->restart_max_attempts && this->stall_detected(current_iterate)) {
+               this->perturbed_restart(statistics, model, current_iterate, options);
+            }
+
+            // periodic checkpoint: a node failure loses at most snapshot_interval iterations
+            if (this->snapshot_file != "none" && 0 < this->snapshot_interval && not termination &&
+                  major_iterations % this->snapshot_interval == 0) {
+               this->write_snapshot_async(model, current_iterate);
+            }
          }
       }
       catch (std::exception& exception) {
@@ -58,13 +154,375 @@ namespace uno {
          statistics.set("status", exception.what());
          if (Logger::level == INFO) statistics.print_current_line();
          DEBUG << exception.what();
+         // flight recorder: dump the trailing iteration statistics for post-mortem analysis,
+         // instead of re-running the failure at DEBUG level
+         if (this->flight_recorder_file != "none") {
+            std::ofstream recorder_stream(this->flight_recorder_file);
+            if (recorder_stream.is_open()) {
+               recorder_stream << "# " << model.name << ": " << exception.what() << '\n';
+               statistics.write_recent_history(recorder_stream, this->flight_recorder_length);
+               INFO << "Flight recorder dump written to " << this->flight_recorder_file << '\n';
+            }
+         }
       }
+      Deadline::disarm();
       if (Logger::level == INFO) statistics.print_footer();
 
+      // wait for a possible in-flight checkpoint before the final snapshot logic
+      if (this->snapshot_thread.joinable()) {
+         this->snapshot_thread.join();
+      }
+
+      // report where the time went
+      if (Profiler::enabled) {
+         INFO << "Time profile (s):\n";
+         for (size_t bucket_index: Range(Profiler::NUMBER_BUCKETS)) {
+            const auto bucket = static_cast<Profiler::Bucket>(bucket_index);
+            INFO << "- " << Profiler::bucket_name(bucket) << ": " << Profiler::get_duration(bucket) << '\n';
+         }
+         if (Profiler::counters_enabled) {
+            INFO << "Hardware counter profile:\n";
+            for (size_t bucket_index: Range(Profiler::NUMBER_BUCKETS)) {
+               const auto bucket = static_cast<Profiler::Bucket>(bucket_index);
+               INFO << "- " << Profiler::bucket_name(bucket) << ':';
+               for (size_t counter_index: Range(Profiler::NUMBER_COUNTERS)) {
+                  const auto counter = static_cast<Profiler::Counter>(counter_index);
+                  INFO << ' ' << Profiler::counter_name(counter) << ' ' << Profiler::get_counter(bucket, counter);
+               }
+               INFO << '\n';
+            }
+         }
+      }
+
+      // dump the per-iteration statistics history (including the lines that were never printed)
+      const std::string& statistics_history_file = options.get_string("statistics_history_file");
+      if (statistics_history_file != "none") {
+         std::ofstream history_stream(statistics_history_file);
+         statistics.write_history(history_stream);
+      }
+
+      // the solve was interrupted by a limit: save a snapshot so that a re-launched process can resume
+      if (this->snapshot_file != "none" && current_iterate.status == TerminationStatus::NOT_OPTIMAL) {
+         this->write_snapshot(model, current_iterate);
+      }
+
       Uno::postprocess_iterate(model, current_iterate, current_iterate.status);
       return this->create_result(model, current_iterate, major_iterations, timer);
    }
 
+   // cheap mid-solve retuning: only the timestamp of the overlay file is checked every outer
+   // iteration; when it changed, the file is read and the whitelisted options are applied without
+   // interrupting the solve (e.g. extending the time limit of a long run after a bad initial guess)
+   void Uno::poll_option_overlay() {
+      if (this->option_overlay_file == "none") {
+         return;
+      }
+      std::error_code error{};
+      const auto timestamp = std::filesystem::last_write_time(this->option_overlay_file, error);
+      if (error || timestamp == this->option_overlay_timestamp) {
+         return;
+      }
+      this->option_overlay_timestamp = timestamp;
+      std::ifstream stream(this->option_overlay_file);
+      if (not stream.is_open()) {
+         return;
+      }
+      // same format as the option file: "option_name option_value" lines, # comments
+      std::string line{};
+      while (std::getline(stream, line)) {
+         if (not line.empty() && line.find('#') != 0) {
+            std::istringstream input(line);
+            std::string option_name{}, option_value{};
+            input >> option_name >> option_value;
+            this->apply_overlay_option(option_name, option_value);
+         }
+      }
+   }
+
+   void Uno::apply_overlay_option(const std::string& option_name, const std::string& option_value) {
+      try {
+         if (option_name == "time_limit") {
+            this->time_limit = std::stod(option_value);
+            INFO << "Option overlay: time_limit set to " << this->time_limit << '\n';
+         }
+         else if (option_name == "max_iterations") {
+            this->max_iterations = std::stoul(option_value);
+            INFO << "Option overlay: max_iterations set to " << this->max_iterations << '\n';
+         }
+         else if (option_name == "logger") {
+            Logger::set_logger(option_value);
+         }
+         else if (this->globalization_mechanism.apply_overlay_option(option_name, option_value)) {
+            INFO << "Option overlay: " << option_name << " set to " << option_value << '\n';
+         }
+         else {
+            WARNING << "Option overlay: " << option_name << " is not dynamically adjustable and was ignored\n";
+         }
+      }
+      catch (const std::exception&) {
+         WARNING << "Option overlay: the value " << option_value << " of " << option_name << " could not be parsed\n";
+      }
+   }
+
+   // windowed progress monitoring: an iteration makes progress when it improves the best primal
+   // feasibility or the best stationarity seen so far; too many consecutive iterations without
+   // progress flag a stall (degenerate instances typically cycle with tiny rejected steps)
+   bool Uno::stall_detected(const Iterate& current_iterate) {
+      bool progress = false;
+      if (current_iterate.primal_feasibility < this->best_primal_feasibility) {
+         this->best_primal_feasibility = current_iterate.primal_feasibility;
+         progress = true;
+      }
+      if (current_iterate.residuals.stationarity < this->best_stationarity) {
+         this->best_stationarity = current_iterate.residuals.stationarity;
+         progress = true;
+      }
+      if (progress) {
+         this->iterations_without_progress = 0;
+         return false;
+      }
+      this->iterations_without_progress++;
+      return this->restart_stall_iteration_threshold <= this->iterations_without_progress;
+   }
+
+   // trend monitors for hopeless runs. Unboundedness: the objective stays below the soft
+   // divergence threshold while primal feasibility remains stable (the hard
+   // unbounded_objective_threshold still terminates immediately, see
+   // ConstraintRelaxationStrategy::check_termination). Infeasibility: the restoration phase
+   // (objective multiplier 0) fails to reduce its infeasibility by at least 1% per iteration.
+   // Both trends must persist for divergence_iteration_threshold consecutive iterations
+   TerminationStatus Uno::detect_hopeless_trend(const Iterate& iterate) {
+      // unboundedness trend
+      this->divergence_best_feasibility = std::min(this->divergence_best_feasibility, iterate.primal_feasibility);
+      const bool feasibility_stable = iterate.primal_feasibility <= std::max(this->tolerance, 10. * this->divergence_best_feasibility);
+      if (iterate.is_objective_computed && iterate.evaluations.objective < this->divergence_objective_threshold && feasibility_stable) {
+         this->divergence_streak++;
+         if (this->divergence_iteration_threshold <= this->divergence_streak) {
+            INFO << "Divergence detector: objective below " << this->divergence_objective_threshold << " for " <<
+               this->divergence_streak << " iterations with stable feasibility, declaring unboundedness\n";
+            return TerminationStatus::UNBOUNDED;
+         }
+      }
+      else {
+         this->divergence_streak = 0;
+      }
+
+      // restoration plateau trend
+      if (iterate.objective_multiplier == 0. && this->tolerance < iterate.primal_feasibility) {
+         if (iterate.primal_feasibility < 0.99 * this->restoration_best_feasibility) {
+            this->restoration_best_feasibility = iterate.primal_feasibility;
+            this->restoration_plateau_streak = 0;
+         }
+         else {
+            this->restoration_plateau_streak++;
+            if (this->divergence_iteration_threshold <= this->restoration_plateau_streak) {
+               INFO << "Divergence detector: restoration infeasibility plateaued at " << iterate.primal_feasibility <<
+                  " for " << this->restoration_plateau_streak << " iterations, declaring infeasibility\n";
+               return TerminationStatus::INFEASIBLE_STATIONARY_POINT;
+            }
+         }
+      }
+      else {
+         this->restoration_plateau_streak = 0;
+         this->restoration_best_feasibility = std::numeric_limits<double>::infinity();
+      }
+      return TerminationStatus::NOT_OPTIMAL;
+   }
+
+   // Anderson/DIIS acceleration: keep a ring buffer of the last iterates and their dual residuals.
+   // A phase change (different variable space) invalidates the stored window
+   void Uno::record_acceleration_entry(const Model& model, const Iterate& iterate) {
+      if (iterate.number_variables != model.number_variables ||
+            iterate.residuals.lagrangian_gradient.size() != model.number_variables) {
+         this->acceleration_history.clear();
+         return;
+      }
+      AccelerationEntry entry;
+      entry.primals.resize(model.number_variables);
+      entry.constraint_multipliers.resize(model.number_constraints);
+      entry.residual.resize(model.number_variables);
+      for (size_t variable_index: Range(model.number_variables)) {
+         entry.primals[variable_index] = iterate.primals[variable_index];
+         entry.residual[variable_index] = iterate.residuals.lagrangian_gradient[variable_index];
+      }
+      for (size_t constraint_index: Range(model.number_constraints)) {
+         entry.constraint_multipliers[constraint_index] = iterate.multipliers.constraints[constraint_index];
+      }
+      this->acceleration_history.push_back(std::move(entry));
+      if (this->acceleration_memory < this->acceleration_history.size()) {
+         this->acceleration_history.pop_front();
+      }
+   }
+
+   // DIIS extrapolation: the affine combination of the stored iterates that minimizes the norm of
+   // the combined dual residuals, obtained from the Gram matrix of the residuals bordered by the
+   // sum-to-one constraint. The extrapolated point is adopted only when the predicted stationarity
+   // improves on the last iterate and the measured constraint violation does not deteriorate;
+   // when it is rejected, the only cost is one constraint evaluation
+   bool Uno::try_accelerated_iterate(const Model& model, Iterate& current_iterate) {
+      const size_t window = this->acceleration_history.size();
+      if (window < this->acceleration_memory || window < 2) {
+         return false;
+      }
+      // Gram matrix of the residuals
+      std::vector<double> gram(window * window);
+      for (size_t i: Range(window)) {
+         for (size_t j: Range(i + 1)) {
+            double product = 0.;
+            for (size_t variable_index: Range(model.number_variables)) {
+               product += this->acceleration_history[i].residual[variable_index] * this->acceleration_history[j].residual[variable_index];
+            }
+            gram[i * window + j] = gram[j * window + i] = product;
+         }
+      }
+      // bordered system [B 1; 1^T 0] [c; lambda] = [0; 1]
+      const size_t dimension = window + 1;
+      std::vector<double> matrix(dimension * dimension, 0.);
+      std::vector<double> coefficients(dimension, 0.);
+      for (size_t i: Range(window)) {
+         for (size_t j: Range(window)) {
+            matrix[i * dimension + j] = gram[i * window + j];
+         }
+         matrix[i * dimension + window] = matrix[window * dimension + i] = 1.;
+      }
+      coefficients[window] = 1.;
+      if (not Uno::solve_dense_system(matrix, coefficients, dimension)) {
+         // (near-)singular Gram matrix: the oldest residual is redundant, shrink the window
+         this->acceleration_history.pop_front();
+         return false;
+      }
+      // predicted squared norm of the combined residuals, against the last (current) residual
+      double predicted_residual = 0.;
+      for (size_t i: Range(window)) {
+         for (size_t j: Range(window)) {
+            predicted_residual += coefficients[i] * coefficients[j] * gram[i * window + j];
+         }
+      }
+      const double last_residual = gram[(window - 1) * window + (window - 1)];
+      if (predicted_residual < 0. || last_residual <= predicted_residual) {
+         return false;
+      }
+      // form the extrapolated primal-dual point
+      Vector<double> extrapolated_primals(model.number_variables);
+      std::vector<double> extrapolated_multipliers(model.number_constraints, 0.);
+      for (size_t i: Range(window)) {
+         const AccelerationEntry& entry = this->acceleration_history[i];
+         for (size_t variable_index: Range(model.number_variables)) {
+            extrapolated_primals[variable_index] += coefficients[i] * entry.primals[variable_index];
+         }
+         for (size_t constraint_index: Range(model.number_constraints)) {
+            extrapolated_multipliers[constraint_index] += coefficients[i] * entry.constraint_multipliers[constraint_index];
+         }
+      }
+      model.project_onto_variable_bounds(extrapolated_primals);
+      // one evaluation: reject the extrapolation if the constraint violation deteriorates
+      std::vector<double> constraints(model.number_constraints);
+      if (not model.try_evaluate_constraints(extrapolated_primals, constraints)) {
+         return false;
+      }
+      const double constraint_violation = model.constraint_violation(constraints, this->residual_norm);
+      if (current_iterate.primal_feasibility < constraint_violation) {
+         DEBUG << "Anderson acceleration: extrapolated iterate rejected (violation " << constraint_violation << ")\n";
+         return false;
+      }
+      // adopt the extrapolated point as the current iterate and restart the window
+      for (size_t variable_index: Range(model.number_variables)) {
+         current_iterate.primals[variable_index] = extrapolated_primals[variable_index];
+      }
+      for (size_t constraint_index: Range(model.number_constraints)) {
+         current_iterate.multipliers.constraints[constraint_index] = extrapolated_multipliers[constraint_index];
+      }
+      current_iterate.progress.reset();
+      current_iterate.is_objective_computed = false;
+      current_iterate.is_objective_gradient_computed = false;
+      current_iterate.are_constraints_computed = false;
+      current_iterate.is_constraint_jacobian_computed = false;
+      this->acceleration_history.clear();
+      return true;
+   }
+
+   // dense Gaussian elimination with partial pivoting, for the small bordered Gram systems of the
+   // DIIS extrapolation. Returns false when a pivot is negligible (redundant residuals)
+   bool Uno::solve_dense_system(std::vector<double>& matrix, std::vector<double>& rhs, size_t dimension) {
+      for (size_t column_index: Range(dimension)) {
+         size_t pivot_row = column_index;
+         for (size_t row_index: Range(column_index + 1, dimension)) {
+            if (std::abs(matrix[pivot_row * dimension + column_index]) < std::abs(matrix[row_index * dimension + column_index])) {
+               pivot_row = row_index;
+            }
+         }
+         if (std::abs(matrix[pivot_row * dimension + column_index]) < 1e-12) {
+            return false;
+         }
+         if (pivot_row != column_index) {
+            for (size_t other_column: Range(dimension)) {
+               std::swap(matrix[column_index * dimension + other_column], matrix[pivot_row * dimension + other_column]);
+            }
+            std::swap(rhs[column_index], rhs[pivot_row]);
+         }
+         const double pivot = matrix[column_index * dimension + column_index];
+         for (size_t row_index: Range(column_index + 1, dimension)) {
+            const double factor = matrix[row_index * dimension + column_index] / pivot;
+            if (factor != 0.) {
+               for (size_t other_column: Range(column_index, dimension)) {
+                  matrix[row_index * dimension + other_column] -= factor * matrix[column_index * dimension + other_column];
+               }
+               rhs[row_index] -= factor * rhs[column_index];
+            }
+         }
+      }
+      // back substitution
+      for (size_t reverse_index: Range(dimension)) {
+         const size_t row_index = dimension - 1 - reverse_index;
+         double value = rhs[row_index];
+         for (size_t column_index: Range(row_index + 1, dimension)) {
+            value -= matrix[row_index * dimension + column_index] * rhs[column_index];
+         }
+         rhs[row_index] = value / matrix[row_index * dimension + row_index];
+      }
+      return true;
+   }
+
+   // structured restart of a stalled solve: perturb the primals around the current point (in the
+   // spirit of the multistart exploration), reset the multipliers and reinitialize the strategies
+   // (filter/funnel contents, trust-region radius) at the perturbed point
+   void Uno::perturbed_restart(Statistics& statistics, const Model& model, Iterate& current_iterate, const Options& options) {
+      this->restart_attempts++;
+      INFO << "Stall detected: perturbed restart " << this->restart_attempts << '/' << this->restart_max_attempts << '\n';
+      // deterministic perturbation, seeded by the attempt number
+      std::mt19937 generator(static_cast<std::mt19937::result_type>(this->restart_attempts));
+      std::uniform_real_distribution<double> unit_interval(0., 1.);
+      for (size_t variable_index: Range(model.number_variables)) {
+         const double amplitude = this->restart_perturbation_amplitude * std::max(1., std::abs(current_iterate.primals[variable_index]));
+         current_iterate.primals[variable_index] += amplitude * (2.*unit_interval(generator) - 1.);
+      }
+      model.project_onto_variable_bounds(current_iterate.primals);
+      current_iterate.multipliers.constraints.fill(0.);
+      current_iterate.multipliers.lower_bounds.fill(0.);
+      current_iterate.multipliers.upper_bounds.fill(0.);
+      current_iterate.feasibility_multipliers.constraints.fill(0.);
+      current_iterate.feasibility_multipliers.lower_bounds.fill(0.);
+      current_iterate.feasibility_multipliers.upper_bounds.fill(0.);
+      // the perturbed point invalidates the evaluations performed at the stalled iterate
+      current_iterate.progress.reset();
+      current_iterate.is_objective_computed = false;
+      current_iterate.is_objective_gradient_computed = false;
+      current_iterate.are_constraints_computed = false;
+      current_iterate.is_constraint_jacobian_computed = false;
+      statistics.start_new_line();
+      statistics.set("status", "perturbed restart");
+      this->globalization_mechanism.initialize(statistics, current_iterate, options);
+      if (Logger::level == INFO) statistics.print_current_line();
+      // rearm the detector
+      this->iterations_without_progress = 0;
+      this->best_primal_feasibility = std::numeric_limits<double>::infinity();
+      this->best_stationarity = std::numeric_limits<double>::infinity();
+   }
+
+   void Uno::add_user_termination_callback(std::function<bool(const Iterate& current_iterate, const Statistics& statistics)> callback) {
+      this->user_termination_callbacks.emplace_back(std::move(callback));
+   }
+
    void Uno::initialize(Statistics& statistics, Iterate& current_iterate, const Options& options) {
       try {
          statistics.start_new_line();
@@ -80,6 +538,109 @@ namespace uno {
       }
    }
 
+   // restore the iterate and the strategy states (filter/funnel, trust-region radius) from the
+   // snapshot file. Returns false (and leaves everything untouched) if no usable snapshot exists
+   bool Uno::read_snapshot(const Model& model, Iterate& current_iterate) {
+      std::ifstream stream(this->snapshot_file);
+      if (not stream.is_open()) {
+         return false;
+      }
+      std::string tag{};
+      size_t number_variables = 0;
+      size_t number_constraints = 0;
+      stream >> tag >> number_variables >> number_constraints;
+      if (tag != "uno_snapshot" || number_variables != model.number_variables || number_constraints != model.number_constraints) {
+         WARNING << "The snapshot " << this->snapshot_file << " does not match the model and is ignored\n";
+         return false;
+      }
+      // read the primal-dual point into a copy first, so that a truncated file leaves the iterate intact
+      Iterate snapshot_iterate(current_iterate);
+      const auto read_vector = [&stream](Vector<double>& vector) {
+         for (size_t index: Range(vector.size())) {
+            stream >> vector[index];
+         }
+      };
+      read_vector(snapshot_iterate.primals);
+      read_vector(snapshot_iterate.multipliers.constraints);
+      read_vector(snapshot_iterate.multipliers.lower_bounds);
+      read_vector(snapshot_iterate.multipliers.upper_bounds);
+      read_vector(snapshot_iterate.feasibility_multipliers.constraints);
+      read_vector(snapshot_iterate.feasibility_multipliers.lower_bounds);
+      read_vector(snapshot_iterate.feasibility_multipliers.upper_bounds);
+      if (not stream) {
+         WARNING << "The snapshot " << this->snapshot_file << " is incomplete and is ignored\n";
+         return false;
+      }
+      this->globalization_mechanism.read_snapshot(stream);
+      current_iterate = std::move(snapshot_iterate);
+      // the restored point invalidates the evaluations performed at the initial iterate
+      current_iterate.progress.reset();
+      current_iterate.is_objective_computed = false;
+      current_iterate.is_objective_gradient_computed = false;
+      current_iterate.are_constraints_computed = false;
+      current_iterate.is_constraint_jacobian_computed = false;
+      return true;
+   }
+
+   void Uno::write_snapshot(const Model& model, const Iterate& current_iterate) const {
+      std::ostringstream strategy_stream;
+      this->globalization_mechanism.write_snapshot(strategy_stream);
+      Uno::commit_snapshot(this->snapshot_file,
+            Uno::serialize_snapshot(model.number_variables, model.number_constraints, current_iterate, strategy_stream.str()));
+      INFO << "Snapshot written to " << this->snapshot_file << '\n';
+   }
+
+   // periodic checkpoint: the iterate is copied here (cheap compared to an outer iteration), the
+   // serialization and the file accesses run on a background thread
+   void Uno::write_snapshot_async(const Model& model, const Iterate& current_iterate) {
+      // at most one writer in flight: wait for the previous checkpoint (normally long finished)
+      if (this->snapshot_thread.joinable()) {
+         this->snapshot_thread.join();
+      }
+      // the strategy state is tiny: serialize it synchronously to avoid racing with the next iteration
+      std::ostringstream strategy_stream;
+      this->globalization_mechanism.write_snapshot(strategy_stream);
+      this->snapshot_thread = std::thread([file_name = this->snapshot_file, number_variables = model.number_variables,
+            number_constraints = model.number_constraints, iterate = Iterate(current_iterate), strategy_state = strategy_stream.str()]() {
+         Uno::commit_snapshot(file_name, Uno::serialize_snapshot(number_variables, number_constraints, iterate, strategy_state));
+      });
+   }
+
+   std::string Uno::serialize_snapshot(size_t number_variables, size_t number_constraints, const Iterate& iterate,
+         const std::string& strategy_state) {
+      std::ostringstream stream;
+      // full precision, so that the restart resumes from the exact same point
+      stream.precision(std::numeric_limits<double>::max_digits10);
+      stream << "uno_snapshot " << number_variables << ' ' << number_constraints << '\n';
+      print_vector(stream, iterate.primals);
+      print_vector(stream, iterate.multipliers.constraints);
+      print_vector(stream, iterate.multipliers.lower_bounds);
+      print_vector(stream, iterate.multipliers.upper_bounds);
+      print_vector(stream, iterate.feasibility_multipliers.constraints);
+      print_vector(stream, iterate.feasibility_multipliers.lower_bounds);
+      print_vector(stream, iterate.feasibility_multipliers.upper_bounds);
+      stream << strategy_state;
+      return stream.str();
+   }
+
+   // double-buffered write: the contents go to a temporary file that atomically replaces the
+   // snapshot, so that a crash mid-write never corrupts the previous checkpoint
+   void Uno::commit_snapshot(const std::string& file_name, const std::string& contents) {
+      const std::string temporary_file_name = file_name + ".tmp";
+      std::ofstream stream(temporary_file_name);
+      if (not stream.is_open()) {
+         WARNING << "The snapshot " << file_name << " could not be written\n";
+         return;
+      }
+      stream << contents;
+      stream.close();
+      std::error_code error{};
+      std::filesystem::rename(temporary_file_name, file_name, error);
+      if (error) {
+         WARNING << "The snapshot " << temporary_file_name << " could not be moved to " << file_name << '\n';
+      }
+   }
+
    Statistics Uno::create_statistics(const Model& model, const Options& options) {
       Statistics statistics(options);
       statistics.add_column("iter", Statistics::int_width, options.get_int("statistics_major_column_order"));
@@ -91,6 +652,9 @@ namespace uno {
       statistics.add_column("stationarity", Statistics::double_width - 3, options.get_int("statistics_stationarity_column_order"));
       statistics.add_column("complementarity", Statistics::double_width, options.get_int("statistics_complementarity_column_order"));
       statistics.add_column("status", Statistics::string_width - 2, options.get_int("statistics_status_column_order"));
+      if (options.get_bool("allocation_tracking")) {
+         statistics.add_column("allocs", Statistics::int_width, options.get_int("statistics_allocations_column_order"));
+      }
       return statistics;
    }
 
@@ -108,9 +672,14 @@ namespace uno {
    Result Uno::create_result(const Model& model, Iterate& current_iterate, size_t major_iterations, const Timer& timer) {
       const size_t number_subproblems_solved = this->globalization_mechanism.get_number_subproblems_solved();
       const size_t number_hessian_evaluations = this->globalization_mechanism.get_hessian_evaluation_count();
+      // the memory gauges cover the whole process lifetime (like the peak resident set size): the
+      // dominant structures are allocated when the strategy stack is built, before solve() is entered
       return {std::move(current_iterate), model.number_variables, model.number_constraints, major_iterations, timer.get_duration(),
-            Iterate::number_eval_objective, Iterate::number_eval_constraints, Iterate::number_eval_objective_gradient,
-            Iterate::number_eval_jacobian, number_hessian_evaluations, number_subproblems_solved};
+            this->evaluation_counters.objective.load(std::memory_order_relaxed),
+            this->evaluation_counters.constraints.load(std::memory_order_relaxed),
+            this->evaluation_counters.objective_gradient.load(std::memory_order_relaxed),
+            this->evaluation_counters.jacobian.load(std::memory_order_relaxed), number_hessian_evaluations, number_subproblems_solved,
+            MemoryUsage::peak_resident_set_bytes(), MemoryUsage::get_all_bytes(), model.get_constraint_cost_profile()};
    }
 
    void join(const std::vector<std::string>& vector, char separator) {
@@ -131,7 +700,7 @@ namespace uno {
       std::cout << "To choose a globalization mechanism, use the argument -globalization_mechanism [LS|TR]\n";
       std::cout << "To choose a globalization strategy, use the argument -globalization_strategy "
                    "[l1_merit|fletcher_filter_method|waechter_filter_method]\n";
-      std::cout << "To choose a preset, use the argument -preset [filtersqp|ipopt|byrd]\n";
+      std::cout << "To choose a preset, use the argument -preset [auto|filtersqp|ipopt|byrd]\n";
       std::cout << "The options can be combined in the same command line. Autocompletion is possible (see README).\n";
    }
 
@@ -158,6 +727,14 @@ namespace uno {
    }
 
    void Uno::print_optimization_summary(const Options& options, const Result& result) {
+      // binary result record for high-volume deployments that parse results downstream
+      const std::string& result_file = options.get_string("result_file");
+      if (result_file != "none") {
+         result.write_binary(result_file);
+      }
+      if (not options.get_bool("print_summary")) {
+         return;
+      }
       Uno::print_strategy_combination(options);
       std::cout << Timer::get_current_date();
       std::cout << "────────────────────────────────────────\n";
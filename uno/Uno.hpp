@@ -4,6 +4,15 @@
 #ifndef UNO_H
 #define UNO_H
 
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include "linear_algebra/Norm.hpp"
+#include "optimization/EvaluationCounters.hpp"
 #include "optimization/Result.hpp"
 #include "optimization/TerminationStatus.hpp"
 
@@ -26,9 +35,16 @@ namespace uno {
    class Uno {
    public:
       Uno(GlobalizationMechanism& globalization_mechanism, const Options& options);
+      ~Uno();
 
       [[nodiscard]] Result solve(const Model& model, Iterate& initial_iterate, const Options& options);
 
+      // external early stopping: the registered callbacks are tested after every outer iteration
+      // with the trial iterate and the statistics of the current line; the solve terminates as soon
+      // as one of them returns true (e.g. a multistart orchestrator cancelling a dominated run, or
+      // an external controller detecting a primal feasibility plateau)
+      void add_user_termination_callback(std::function<bool(const Iterate& current_iterate, const Statistics& statistics)> callback);
+
       static void print_uno_version();
       static void print_available_strategies();
       static void print_strategy_combination(const Options& options);
@@ -36,10 +52,65 @@ namespace uno {
 
    private:
       GlobalizationMechanism& globalization_mechanism; /*!< Globalization mechanism */
-      const size_t max_iterations; /*!< Maximum number of iterations */
-      const double time_limit; /*!< CPU time limit (can be inf) */
+      size_t max_iterations; /*!< Maximum number of iterations (dynamically adjustable) */
+      double time_limit; /*!< CPU time limit (can be inf, dynamically adjustable) */
+      const std::string snapshot_file; /*!< Warm-restart snapshot file ("none" to disable) */
+      const size_t snapshot_interval; /*!< Periodic checkpointing period in outer iterations (0 to disable) */
+      std::thread snapshot_thread{}; /*!< Background checkpoint writer */
+      const std::string option_overlay_file; /*!< Mid-solve retuning overlay file ("none" to disable) */
+      // flight recorder: post-mortem dump of the recent iteration statistics on abnormal exit
+      const std::string flight_recorder_file; /*!< Dump file ("none" to disable) */
+      const size_t flight_recorder_length; /*!< Number of trailing iteration lines in the dump */
+      std::filesystem::file_time_type option_overlay_timestamp{};
+      // stall detection and perturbed restarts (see Uno::stall_detected and Uno::perturbed_restart)
+      const size_t restart_max_attempts; /*!< Maximum number of perturbed restarts (0 to disable) */
+      const double restart_perturbation_amplitude;
+      const size_t restart_stall_iteration_threshold;
+      size_t restart_attempts{0};
+      size_t iterations_without_progress{0};
+      double best_primal_feasibility{std::numeric_limits<double>::infinity()};
+      double best_stationarity{std::numeric_limits<double>::infinity()};
+      // early detection of hopeless runs (see Uno::detect_hopeless_trend): a diverging objective
+      // with stable feasibility, or a plateauing restoration phase
+      const size_t divergence_iteration_threshold; /*!< Consecutive iterations before declaring (0 to disable) */
+      const double divergence_objective_threshold; /*!< Soft unboundedness threshold of the trend monitor */
+      const double tolerance;
+      size_t divergence_streak{0};
+      double divergence_best_feasibility{std::numeric_limits<double>::infinity()};
+      size_t restoration_plateau_streak{0};
+      double restoration_best_feasibility{std::numeric_limits<double>::infinity()};
+      // Anderson/DIIS acceleration of the iteration tail (see Uno::try_accelerated_iterate)
+      const size_t acceleration_memory; /*!< Number of stored iterates and residuals (0 to disable) */
+      const Norm residual_norm; /*!< Norm of the feasibility test of the extrapolated point */
+      struct AccelerationEntry {
+         std::vector<double> primals;
+         std::vector<double> constraint_multipliers;
+         std::vector<double> residual;
+      };
+      std::deque<AccelerationEntry> acceleration_history{};
+      // allocation instrumentation (see AllocationTracker): per-iteration counts in the statistics
+      const bool allocation_tracking;
+      const size_t allocation_assert_iteration; /*!< Any allocation after this iteration is a hard failure (0 to disable) */
+      size_t allocation_count_reference{0};
+      // per-solve evaluation tallies, installed at the start of solve() and aggregated into Result
+      EvaluationCounters evaluation_counters{};
+      std::vector<std::function<bool(const Iterate& current_iterate, const Statistics& statistics)>> user_termination_callbacks{};
 
       void initialize(Statistics& statistics, Iterate& current_iterate, const Options& options);
+      void poll_option_overlay();
+      [[nodiscard]] bool stall_detected(const Iterate& current_iterate);
+      [[nodiscard]] TerminationStatus detect_hopeless_trend(const Iterate& iterate);
+      void record_acceleration_entry(const Model& model, const Iterate& iterate);
+      [[nodiscard]] bool try_accelerated_iterate(const Model& model, Iterate& current_iterate);
+      [[nodiscard]] static bool solve_dense_system(std::vector<double>& matrix, std::vector<double>& rhs, size_t dimension);
+      void perturbed_restart(Statistics& statistics, const Model& model, Iterate& current_iterate, const Options& options);
+      void apply_overlay_option(const std::string& option_name, const std::string& option_value);
+      [[nodiscard]] bool read_snapshot(const Model& model, Iterate& current_iterate);
+      void write_snapshot(const Model& model, const Iterate& current_iterate) const;
+      void write_snapshot_async(const Model& model, const Iterate& current_iterate);
+      [[nodiscard]] static std::string serialize_snapshot(size_t number_variables, size_t number_constraints, const Iterate& iterate,
+            const std::string& strategy_state);
+      static void commit_snapshot(const std::string& file_name, const std::string& contents);
       [[nodiscard]] static Statistics create_statistics(const Model& model, const Options& options);
       [[nodiscard]] bool termination_criteria(TerminationStatus current_status, size_t iteration, double current_time) const;
       static void postprocess_iterate(const Model& model, Iterate& iterate, TerminationStatus termination_status);
@@ -1,18 +1,24 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
+#include <cmath>
 #include "ConstraintRelaxationStrategy.hpp"
 #include "ingredients/globalization_strategies/GlobalizationStrategy.hpp"
 #include "ingredients/globalization_strategies/GlobalizationStrategyFactory.hpp"
 #include "ingredients/subproblems/Direction.hpp"
 #include "ingredients/subproblems/Subproblem.hpp"
 #include "ingredients/subproblems/SubproblemFactory.hpp"
+#include "linear_algebra/CompensatedSum.hpp"
+#include "linear_algebra/SparseVector.hpp"
 #include "linear_algebra/SymmetricMatrix.hpp"
 #include "model/Model.hpp"
+#include "symbolic/Range.hpp"
 #include "optimization/Iterate.hpp"
 #include "optimization/Multipliers.hpp"
 #include "reformulation/OptimizationProblem.hpp"
 #include "symbolic/VectorView.hpp"
+#include "symbolic/VectorExpression.hpp"
 #include "symbolic/Expression.hpp"
 #include "tools/Options.hpp"
 #include "tools/Statistics.hpp"
@@ -31,7 +37,14 @@ namespace uno {
          loose_tolerance(options.get_double("loose_tolerance")),
          loose_tolerance_consecutive_iteration_threshold(options.get_unsigned_int("loose_tolerance_consecutive_iteration_threshold")),
          unbounded_objective_threshold(options.get_double("unbounded_objective_threshold")),
-         first_order_predicted_reduction(options.get_string("globalization_mechanism") == "LS") {
+         extended_precision_residuals(options.get_bool("extended_precision_residuals")),
+         extended_precision_threshold(options.get_double("extended_precision_threshold")),
+         first_order_predicted_reduction(options.get_string("globalization_mechanism") == "LS"),
+         inexact_subproblem_solves(options.get_bool("subproblem_inexact_solves")),
+         inexact_subproblem_tolerance_factor(options.get_double("subproblem_inexact_tolerance_factor")),
+         inexact_subproblem_max_tolerance(options.get_double("subproblem_inexact_max_tolerance")),
+         auxiliary_direction(number_variables, number_constraints),
+         jacobian_direction_products(number_constraints) {
    }
 
    ConstraintRelaxationStrategy::~ConstraintRelaxationStrategy() { }
@@ -62,17 +75,69 @@ namespace uno {
       };
    }
 
+   // fused objective and infeasibility measures. Requesting the objective first routes through the
+   // fused objective-and-constraints model evaluation (a single evaluation tree pass for AMPL
+   // models), and the violation is accumulated right after, while the constraint vector is still
+   // cache-resident. Setting the infeasibility measure first -- the historical order -- evaluates
+   // the constraints alone and leaves the objective to a second model pass
+   void ConstraintRelaxationStrategy::set_objective_and_infeasibility_measures(Iterate& iterate) const {
+      iterate.evaluate_objective(this->model);
+      const double objective = iterate.evaluations.objective;
+      iterate.progress.objective = [=](double objective_multiplier) {
+         return objective_multiplier * objective;
+      };
+      // the constraints are already available when the fused evaluation ran; this is a no-op then
+      iterate.evaluate_constraints(this->model);
+      iterate.progress.infeasibility = this->model.constraint_violation(iterate.evaluations.constraints, this->progress_norm);
+   }
+
+   double ConstraintRelaxationStrategy::compute_linearized_constraint_violation(const Iterate& current_iterate,
+         const Vector<double>& primal_direction, double step_length, Norm norm) const {
+      // Jacobian-direction products through the contiguous row arena: a sequential memory walk,
+      // instead of evaluating the lazy matrix-vector expression over the scattered per-row storage
+      current_iterate.evaluations.constraint_jacobian.product(primal_direction, this->jacobian_direction_products);
+      const Range constraints_range(this->model.number_constraints);
+      const VectorExpression linearized_constraints{constraints_range, [&](size_t constraint_index) {
+         return current_iterate.evaluations.constraints[constraint_index] + step_length * this->jacobian_direction_products[constraint_index];
+      }};
+      return this->model.constraint_violation(linearized_constraints, norm);
+   }
+
    double ConstraintRelaxationStrategy::compute_predicted_infeasibility_reduction_model(const Iterate& current_iterate,
          const Vector<double>& primal_direction, double step_length) const {
       // predicted infeasibility reduction: "‖c(x)‖ - ‖c(x) + ∇c(x)^T (αd)‖"
-      const double current_constraint_violation = this->model.constraint_violation(current_iterate.evaluations.constraints, this->progress_norm);
-      const double trial_linearized_constraint_violation = this->model.constraint_violation(current_iterate.evaluations.constraints + step_length *
-                                                                                                                                      (current_iterate.evaluations.constraint_jacobian * primal_direction), this->progress_norm);
+      // fused single sweep over the constraints: the current and the linearized trial violations
+      // are accumulated together, while the constraint value and the Jacobian row are hot in cache
+      const auto accumulate = [this](double& violation, double element) {
+         if (this->progress_norm == Norm::L1) {
+            norm_1_accumulation(violation, element);
+         }
+         else if (this->progress_norm == Norm::INF) {
+            norm_inf_accumulation(violation, element);
+         }
+         else { // L2 and L2_SQUARED
+            norm_2_squared_accumulation(violation, element);
+         }
+      };
+      // Jacobian-direction products through the contiguous row arena (sequential memory walk)
+      current_iterate.evaluations.constraint_jacobian.product(primal_direction, this->jacobian_direction_products);
+      double current_constraint_violation = 0.;
+      double trial_linearized_constraint_violation = 0.;
+      for (size_t constraint_index: Range(this->model.number_constraints)) {
+         const double constraint_value = current_iterate.evaluations.constraints[constraint_index];
+         const double linearized_constraint_value = constraint_value + step_length * this->jacobian_direction_products[constraint_index];
+         accumulate(current_constraint_violation, this->model.constraint_violation(constraint_value, constraint_index));
+         accumulate(trial_linearized_constraint_violation, this->model.constraint_violation(linearized_constraint_value, constraint_index));
+      }
+      if (this->progress_norm == Norm::L2) {
+         current_constraint_violation = std::sqrt(current_constraint_violation);
+         trial_linearized_constraint_violation = std::sqrt(trial_linearized_constraint_violation);
+      }
       return current_constraint_violation - trial_linearized_constraint_violation;
    }
 
    std::function<double(double)> ConstraintRelaxationStrategy::compute_predicted_objective_reduction_model(const Iterate& current_iterate,
-         const Vector<double>& primal_direction, double step_length, const SymmetricMatrix<size_t, double>& hessian) const {
+         const Vector<double>& primal_direction, double step_length, const SymmetricMatrix<SparseIndex, double>& hessian) const {
       // predicted objective reduction: "-∇f(x)^T (αd) - α^2/2 d^T H d"
       const double directional_derivative = dot(primal_direction, current_iterate.evaluations.objective_gradient);
       const double quadratic_term = hessian.quadratic_product(primal_direction, primal_direction);
@@ -106,6 +171,15 @@ namespace uno {
       iterate.evaluate_constraints(this->model);
       iterate.evaluate_constraint_jacobian(this->model);
 
+      // constraint violation of the original problem (computed first: it arms the tail phase below)
+      iterate.primal_feasibility = this->model.constraint_violation(iterate.evaluations.constraints, this->residual_norm);
+
+      // extended-precision tail phase: near convergence, the dual residuals are dominated by the
+      // cancellation between large Lagrangian contributions; compensated accumulation removes that
+      // rounding noise, so the tolerance is certified without grinding through extra factorizations
+      ExtendedPrecision::enabled = this->extended_precision_residuals &&
+                                   iterate.primal_feasibility <= this->extended_precision_threshold;
+
       // stationarity errors:
       // - for KKT conditions: with standard multipliers and current objective multiplier
       // - for FJ conditions: with standard multipliers and 0 objective multiplier
@@ -117,9 +191,6 @@ namespace uno {
       iterate.feasibility_residuals.stationarity = OptimizationProblem::stationarity_error(iterate.feasibility_residuals.lagrangian_gradient, 0.,
             this->residual_norm);
 
-      // constraint violation of the original problem
-      iterate.primal_feasibility = this->model.constraint_violation(iterate.evaluations.constraints, this->residual_norm);
-
       // complementarity error
       const double shift_value = 0.;
       iterate.residuals.complementarity = optimality_problem.complementarity_error(iterate.primals, iterate.evaluations.constraints,
@@ -132,6 +203,24 @@ namespace uno {
       iterate.residuals.complementarity_scaling = this->compute_complementarity_scaling(iterate.multipliers);
       iterate.feasibility_residuals.stationarity_scaling = this->compute_stationarity_scaling(iterate.feasibility_multipliers);
       iterate.feasibility_residuals.complementarity_scaling = this->compute_complementarity_scaling(iterate.feasibility_multipliers);
+
+      // the fresh residuals drive the inexactness ladder for the next subproblem solve
+      this->update_subproblem_solve_tolerance(iterate);
+   }
+
+   // inexactness ladder: the accuracy requested from the subproblem follows the primal-dual error of
+   // the iterates down to the termination tolerance, so that the early iterations (whose directions
+   // are discarded anyway) do not pay for full accuracy
+   void ConstraintRelaxationStrategy::update_subproblem_solve_tolerance(const Iterate& iterate) {
+      if (not this->inexact_subproblem_solves) {
+         return;
+      }
+      const double scaled_stationarity = iterate.residuals.stationarity / iterate.residuals.stationarity_scaling;
+      const double primal_dual_error = std::max(iterate.primal_feasibility, scaled_stationarity);
+      const double new_solve_tolerance = std::max(this->tight_tolerance,
+            std::min(this->inexact_subproblem_max_tolerance, this->inexact_subproblem_tolerance_factor * primal_dual_error));
+      DEBUG << "Subproblem solve tolerance set to " << new_solve_tolerance << '\n';
+      this->subproblem->set_solve_tolerance(new_solve_tolerance);
    }
 
    double ConstraintRelaxationStrategy::compute_stationarity_scaling(const Multipliers& multipliers) const {
@@ -183,15 +272,29 @@ namespace uno {
       const TerminationStatus status_loose_tolerance = this->check_first_order_convergence(iterate, this->loose_tolerance);
       // if converged, keep track of the number of consecutive iterations
       if (status_loose_tolerance != TerminationStatus::NOT_OPTIMAL) {
+         // acceptable tier: terminate early only when the solve has plateaued. An iteration that
+         // still improves the worst scaled residual is converging towards the tight tolerance and
+         // is left to finish the job; polishing a plateaued solve burns the entire time budget
+         // for digits the downstream consumer does not need
+         const double worst_scaled_residual = std::max({iterate.residuals.stationarity / iterate.residuals.stationarity_scaling,
+               iterate.primal_feasibility, iterate.residuals.complementarity / iterate.residuals.complementarity_scaling});
+         if (worst_scaled_residual < ConstraintRelaxationStrategy::loose_tolerance_progress_factor * this->loose_tolerance_best_error) {
+            this->loose_tolerance_best_error = worst_scaled_residual;
+            this->loose_tolerance_consecutive_iterations = 0;
+            return TerminationStatus::NOT_OPTIMAL;
+         }
          this->loose_tolerance_consecutive_iterations++;
       }
       else {
          this->loose_tolerance_consecutive_iterations = 0;
          return TerminationStatus::NOT_OPTIMAL;
       }
-      // check if loose tolerance achieved for enough consecutive iterations
+      // check if loose tolerance achieved for enough consecutive iterations without progress
       if (this->loose_tolerance_consecutive_iteration_threshold <= this->loose_tolerance_consecutive_iterations) {
-         return status_loose_tolerance;
+         // report the acceptable tier with its own status, so that the drivers can distinguish a
+         // full-tolerance KKT point from an acceptable one
+         return (status_loose_tolerance == TerminationStatus::FEASIBLE_KKT_POINT) ?
+               TerminationStatus::FEASIBLE_ACCEPTABLE_POINT : status_loose_tolerance;
       }
       else {
          return TerminationStatus::NOT_OPTIMAL;
@@ -247,4 +350,12 @@ namespace uno {
    size_t ConstraintRelaxationStrategy::get_number_subproblems_solved() const {
       return this->subproblem->number_subproblems_solved;
    }
+
+   void ConstraintRelaxationStrategy::write_snapshot(std::ostream& stream) const {
+      this->globalization_strategy->write_snapshot(stream);
+   }
+
+   void ConstraintRelaxationStrategy::read_snapshot(std::istream& stream) {
+      this->globalization_strategy->read_snapshot(stream);
+   }
 } // namespace
\ No newline at end of file
@@ -5,13 +5,16 @@
 #define UNO_CONSTRAINTRELAXATIONSTRATEGY_H
 
 #include <cstddef>
+#include <iosfwd>
 #include <memory>
+#include "ingredients/subproblems/Direction.hpp"
 #include "linear_algebra/Norm.hpp"
+#include "linear_algebra/SparseIndex.hpp"
 #include "optimization/TerminationStatus.hpp"
+#include "tools/Infinity.hpp"
 
 namespace uno {
    // forward declarations
-   class Direction;
    class GlobalizationStrategy;
    class Iterate;
    template <typename ElementType>
@@ -47,6 +50,8 @@ namespace uno {
             const Vector<double>& initial_point, WarmstartInformation& warmstart_information);
       [[nodiscard]] virtual bool solving_feasibility_problem() const = 0;
       virtual void switch_to_feasibility_problem(Statistics& statistics, Iterate& current_iterate) = 0;
+      // second-order correction of a rejected trial iterate (against the Maratos effect)
+      [[nodiscard]] virtual bool compute_second_order_correction(Iterate& current_iterate, Iterate& trial_iterate, Direction& direction) = 0;
 
       // trial iterate acceptance
       [[nodiscard]] virtual bool is_iterate_acceptable(Statistics& statistics, Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction,
@@ -60,6 +65,10 @@ namespace uno {
       [[nodiscard]] size_t get_hessian_evaluation_count() const;
       [[nodiscard]] size_t get_number_subproblems_solved() const;
 
+      // warm-restart snapshots: delegated to the globalization strategy (filter or funnel state)
+      void write_snapshot(std::ostream& stream) const;
+      void read_snapshot(std::istream& stream);
+
    protected:
       const Model& model;
       const std::unique_ptr<GlobalizationStrategy> globalization_strategy;
@@ -71,22 +80,47 @@ namespace uno {
       const double loose_tolerance; /*!< Loose tolerance of the termination criteria */
       size_t loose_tolerance_consecutive_iterations{0};
       const size_t loose_tolerance_consecutive_iteration_threshold;
+      // acceptable tier: only plateaued solves terminate at the loose tolerance. An iteration that
+      // improves the worst scaled residual by this factor still makes progress towards the tight
+      // tolerance and resets the streak
+      static constexpr double loose_tolerance_progress_factor{0.9};
+      double loose_tolerance_best_error{INF<double>};
       const double unbounded_objective_threshold;
+      // extended-precision tail phase: once primal feasibility crosses the threshold, the dual
+      // residual accumulations switch to compensated (double-double) arithmetic
+      const bool extended_precision_residuals;
+      const double extended_precision_threshold;
       // first_order_predicted_reduction is true when the predicted reduction can be taken as first-order (e.g. in line-search methods)
       const bool first_order_predicted_reduction;
+      // inexactness ladder: solve the subproblems loosely while the outer iterates are far from a
+      // KKT point, tightening the solve tolerance proportionally to the primal-dual error
+      const bool inexact_subproblem_solves;
+      const double inexact_subproblem_tolerance_factor;
+      const double inexact_subproblem_max_tolerance;
+      // pre-sized scratch direction shared by the concrete strategies (feasibility probes, phase
+      // switches): borrowed and swapped instead of constructing n+m-sized buffers in the hot loop
+      Direction auxiliary_direction;
+      // staging buffer of the Jacobian-direction products (mutable: filled by const evaluations)
+      mutable Vector<double> jacobian_direction_products;
 
       void set_objective_measure(Iterate& iterate) const;
       void set_infeasibility_measure(Iterate& iterate) const;
+      // fused version of the two setters above, evaluated in the order that triggers a single model pass
+      void set_objective_and_infeasibility_measures(Iterate& iterate) const;
+      // ‖c(x) + ∇c(x)^T (αd)‖, with the Jacobian-direction products taken through the contiguous row arena
+      [[nodiscard]] double compute_linearized_constraint_violation(const Iterate& current_iterate, const Vector<double>& primal_direction,
+            double step_length, Norm norm) const;
       [[nodiscard]] double compute_predicted_infeasibility_reduction_model(const Iterate& current_iterate, const Vector<double>& primal_direction,
             double step_length) const;
       [[nodiscard]] std::function<double(double)> compute_predicted_objective_reduction_model(const Iterate& current_iterate,
-            const Vector<double>& primal_direction, double step_length, const SymmetricMatrix<size_t, double>& hessian) const;
+            const Vector<double>& primal_direction, double step_length, const SymmetricMatrix<SparseIndex, double>& hessian) const;
       [[nodiscard]] std::function<double(double)> compute_predicted_objective_reduction_model(const Iterate& current_iterate,
             const Vector<double>& primal_direction, double step_length) const;
       void compute_progress_measures(Iterate& current_iterate, Iterate& trial_iterate);
       virtual void evaluate_progress_measures(Iterate& iterate) const = 0;
 
       void compute_primal_dual_residuals(const OptimizationProblem& optimality_problem, const OptimizationProblem& feasibility_problem, Iterate& iterate);
+      void update_subproblem_solve_tolerance(const Iterate& iterate);
 
       [[nodiscard]] double compute_stationarity_scaling(const Multipliers& multipliers) const;
       [[nodiscard]] double compute_complementarity_scaling(const Multipliers& multipliers) const;
@@ -47,7 +47,9 @@ namespace uno {
       statistics.add_column("phase", Statistics::int_width, options.get_int("statistics_restoration_phase_column_order"));
       statistics.set("phase", "OPT");
 
-      // initial iterate
+      // initial iterate: reserve the feasibility (maximum) variable space up front, so that the
+      // phase transitions resize within capacity
+      initial_iterate.reserve(this->feasibility_problem.number_variables);
       initial_iterate.feasibility_residuals.lagrangian_gradient.resize(this->feasibility_problem.number_variables);
       initial_iterate.feasibility_multipliers.lower_bounds.resize(this->feasibility_problem.number_variables);
       initial_iterate.feasibility_multipliers.upper_bounds.resize(this->feasibility_problem.number_variables);
@@ -98,6 +100,18 @@ namespace uno {
       return (this->current_phase == Phase::FEASIBILITY_RESTORATION);
    }
 
+   bool FeasibilityRestoration::compute_second_order_correction(Iterate& current_iterate, Iterate& trial_iterate, Direction& direction) {
+      // the correction addresses the Maratos effect, which concerns optimality steps
+      if (this->current_phase != Phase::OPTIMALITY) {
+         return false;
+      }
+      if (not this->subproblem->compute_second_order_correction(this->optimality_problem, current_iterate, current_iterate.multipliers,
+            trial_iterate, direction)) {
+         return false;
+      }
+      return true;
+   }
+
    // precondition: this->current_phase == Phase::OPTIMALITY
    void FeasibilityRestoration::switch_to_feasibility_problem(Statistics& statistics, Iterate& current_iterate) {
       DEBUG << "Switching from optimality to restoration phase\n";
@@ -125,8 +139,8 @@ namespace uno {
       }
 
       direction.set_dimensions(problem.number_variables, problem.number_constraints);
+      // the subproblem fills direction.norm during its solution unpacking, in the same sweep
       this->subproblem->solve(statistics, problem, current_iterate, current_multipliers, direction, warmstart_information);
-      direction.norm = norm_inf(view(direction.primals, 0, this->model.number_variables));
       DEBUG3 << direction << '\n';
    }
 
@@ -134,8 +148,8 @@ namespace uno {
          double step_length) {
       return this->globalization_strategy->is_infeasibility_sufficiently_reduced(this->reference_optimality_progress, trial_iterate.progress) &&
          (not this->switch_to_optimality_requires_linearized_feasibility ||
-         this->model.constraint_violation(current_iterate.evaluations.constraints + step_length*(current_iterate.evaluations.constraint_jacobian *
-         direction.primals), this->residual_norm) <= this->linear_feasibility_tolerance);
+         this->compute_linearized_constraint_violation(current_iterate, direction.primals, step_length, this->residual_norm) <=
+         this->linear_feasibility_tolerance);
    }
 
    void FeasibilityRestoration::switch_to_optimality_phase(Iterate& current_iterate, Iterate& trial_iterate) {
@@ -196,8 +210,7 @@ namespace uno {
    }
 
    void FeasibilityRestoration::evaluate_progress_measures(Iterate& iterate) const {
-      this->set_infeasibility_measure(iterate);
-      this->set_objective_measure(iterate);
+      this->set_objective_and_infeasibility_measures(iterate);
       this->subproblem->set_auxiliary_measure(this->model, iterate);
    }
 
@@ -12,7 +12,7 @@
 namespace uno {
    enum class Phase {FEASIBILITY_RESTORATION = 1, OPTIMALITY = 2};
 
-   class FeasibilityRestoration : public ConstraintRelaxationStrategy {
+   class FeasibilityRestoration final : public ConstraintRelaxationStrategy {
    public:
       FeasibilityRestoration(const Model& model, const Options& options);
 
@@ -25,6 +25,7 @@ namespace uno {
       void compute_feasible_direction(Statistics& statistics, Iterate& current_iterate, Direction& direction, WarmstartInformation& warmstart_information) override;
       [[nodiscard]] bool solving_feasibility_problem() const override;
       void switch_to_feasibility_problem(Statistics& statistics, Iterate& current_iterate) override;
+      [[nodiscard]] bool compute_second_order_correction(Iterate& current_iterate, Iterate& trial_iterate, Direction& direction) override;
 
       // trial iterate acceptance
       [[nodiscard]] bool is_iterate_acceptable(Statistics& statistics, Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction,
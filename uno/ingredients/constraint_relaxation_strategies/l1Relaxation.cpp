@@ -47,6 +47,7 @@ namespace uno {
                options.get_double("l1_relaxation_residual_small_threshold")
          }),
          small_duals_threshold(options.get_double("l1_small_duals_threshold")),
+         steering_stable_iteration_threshold(options.get_unsigned_int("l1_relaxation_steering_stable_iteration_threshold")),
          trial_multipliers(this->l1_relaxed_problem.number_variables, model.number_constraints) {
    }
 
@@ -55,8 +56,11 @@ namespace uno {
       this->subproblem->initialize_statistics(statistics, options);
       statistics.add_column("penalty param.", Statistics::double_width, options.get_int("statistics_penalty_parameter_column_order"));
       statistics.set("penalty param.", this->penalty_parameter);
+      statistics.add_column("probes", Statistics::int_width, options.get_int("statistics_probe_solves_column_order"));
 
-      // initial iterate
+      // initial iterate: reserve the relaxed (maximum) variable space up front, so that the
+      // later resizes stay within capacity
+      initial_iterate.reserve(this->feasibility_problem.number_variables);
       initial_iterate.feasibility_residuals.lagrangian_gradient.resize(this->feasibility_problem.number_variables);
       initial_iterate.feasibility_multipliers.lower_bounds.resize(this->feasibility_problem.number_variables);
       initial_iterate.feasibility_multipliers.upper_bounds.resize(this->feasibility_problem.number_variables);
@@ -72,7 +76,9 @@ namespace uno {
          WarmstartInformation& warmstart_information) {
       statistics.set("penalty param.", this->penalty_parameter);
       direction.reset();
+      this->number_probe_solves = 0;
       this->solve_sequence_of_relaxed_subproblems(statistics, current_iterate, direction, warmstart_information);
+      statistics.set("probes", this->number_probe_solves);
    }
 
    bool l1Relaxation::solving_feasibility_problem() const {
@@ -93,42 +99,64 @@ namespace uno {
 
       // penalty update: if penalty parameter is already 0 or fixed by the user, no need to decrease it
       if (0. < this->penalty_parameter && not this->parameters.fixed_parameter) {
-         double linearized_residual = this->model.constraint_violation(current_iterate.evaluations.constraints +
-               current_iterate.evaluations.constraint_jacobian * direction.primals, Norm::L1);
+         double linearized_residual = this->compute_linearized_constraint_violation(current_iterate, direction.primals, 1., Norm::L1);
          DEBUG << "Linearized infeasibility mk(dk): " << linearized_residual << "\n\n";
 
          // if the current direction is already feasible, terminate
          if (this->tolerance < linearized_residual) {
+            // steering history: when the recent steering rounds all left the penalty parameter
+            // unchanged, skip the probe solves for a few iterations before verifying again
+            if (0 < this->remaining_steering_skips) {
+               this->remaining_steering_skips--;
+               DEBUG << "Penalty parameter stable over recent steering rounds, skipping the probe solves\n";
+               return;
+            }
             const double current_penalty_parameter = this->penalty_parameter;
 
             // stage c: compute the lowest possible constraint violation (penalty parameter = 0)
             DEBUG << "Compute ideal solution by solving the feasibility problem:\n";
             this->subproblem->initialize_feasibility_problem(this->feasibility_problem, current_iterate);
-            Direction feasibility_direction(direction.number_variables, direction.number_constraints);
-            this->solve_subproblem(statistics, this->feasibility_problem, current_iterate, current_iterate.feasibility_multipliers, feasibility_direction,
-                  warmstart_information);
+            // borrow the shared pre-sized direction: no heap allocation in steady state
+            this->auxiliary_direction.reset();
+            this->auxiliary_direction.set_dimensions(direction.number_variables, direction.number_constraints);
+            this->solve_subproblem(statistics, this->feasibility_problem, current_iterate, current_iterate.feasibility_multipliers,
+                  this->auxiliary_direction, warmstart_information);
+            this->number_probe_solves++;
             std::swap(direction.multipliers, direction.feasibility_multipliers);
-            const double residual_lowest_violation = this->model.constraint_violation(current_iterate.evaluations.constraints +
-                  current_iterate.evaluations.constraint_jacobian * feasibility_direction.primals, Norm::L1);
+            const double residual_lowest_violation = this->compute_linearized_constraint_violation(current_iterate,
+                  this->auxiliary_direction.primals, 1., Norm::L1);
             DEBUG << "Lowest linearized infeasibility mk(dk): " << residual_lowest_violation << '\n';
             this->subproblem->exit_feasibility_problem(this->feasibility_problem, current_iterate);
 
             // stage f: update the penalty parameter based on the current dual error
-            this->decrease_parameter_aggressively(current_iterate, feasibility_direction);
+            this->decrease_parameter_aggressively(current_iterate, this->auxiliary_direction);
             if (this->penalty_parameter < current_penalty_parameter) {
                this->solve_l1_relaxed_problem(statistics, current_iterate, direction, this->penalty_parameter, warmstart_information);
-               linearized_residual = this->model.constraint_violation(current_iterate.evaluations.constraints +
-                     current_iterate.evaluations.constraint_jacobian * direction.primals, Norm::L1);
+               this->number_probe_solves++;
+               linearized_residual = this->compute_linearized_constraint_violation(current_iterate, direction.primals, 1., Norm::L1);
             }
 
             // stage d: further decrease penalty parameter to reach a fraction of the ideal decrease
             this->enforce_linearized_residual_sufficient_decrease(statistics, current_iterate, direction, linearized_residual,
                   residual_lowest_violation, warmstart_information);
             // stage e: further decrease penalty parameter to guarantee a descent direction for the l1 merit function
-            this->enforce_descent_direction_for_l1_merit(statistics, current_iterate, direction, feasibility_direction, warmstart_information);
-
-            // save the dual feasibility direction
-            direction.feasibility_multipliers = feasibility_direction.multipliers;
+            this->enforce_descent_direction_for_l1_merit(statistics, current_iterate, direction, this->auxiliary_direction, warmstart_information);
+
+            // save the dual feasibility direction (swap: the borrowed buffer is dead until the next iteration)
+            std::swap(direction.feasibility_multipliers, this->auxiliary_direction.multipliers);
+
+            // record the outcome of this full steering round
+            if (this->penalty_parameter == current_penalty_parameter) {
+               this->consecutive_stable_steering_rounds++;
+               if (0 < this->steering_stable_iteration_threshold &&
+                     this->steering_stable_iteration_threshold <= this->consecutive_stable_steering_rounds) {
+                  this->remaining_steering_skips = this->steering_stable_iteration_threshold;
+                  this->consecutive_stable_steering_rounds = 0;
+               }
+            }
+            else {
+               this->consecutive_stable_steering_rounds = 0;
+            }
          }
       }
    }
@@ -139,12 +167,21 @@ namespace uno {
 
       // solve the subproblem
       direction.set_dimensions(problem.number_variables, problem.number_constraints);
+      // the subproblem fills direction.norm during its solution unpacking, in the same sweep
       this->subproblem->solve(statistics, problem, current_iterate, current_multipliers, direction, warmstart_information);
-      direction.norm = norm_inf(view(direction.primals, 0, this->model.number_variables));
       DEBUG3 << direction << '\n';
       assert(direction.status == SubproblemStatus::OPTIMAL && "The subproblem was not solved to optimality");
    }
 
+   bool l1Relaxation::compute_second_order_correction(Iterate& current_iterate, Iterate& trial_iterate, Direction& direction) {
+      // correct the direction for the l1 relaxed problem with the current penalty parameter
+      if (not this->subproblem->compute_second_order_correction(this->l1_relaxed_problem, current_iterate, current_iterate.multipliers,
+            trial_iterate, direction)) {
+         return false;
+      }
+      return true;
+   }
+
    void l1Relaxation::solve_l1_relaxed_problem(Statistics& statistics, Iterate& current_iterate, Direction& direction,
          double current_penalty_parameter, const WarmstartInformation& warmstart_information) {
       this->l1_relaxed_problem.set_objective_multiplier(current_penalty_parameter);
@@ -191,10 +228,10 @@ namespace uno {
          this->penalty_parameter /= this->parameters.decrease_factor;
          DEBUG << "Further decrease the penalty parameter to " << this->penalty_parameter << '\n';
          this->solve_l1_relaxed_problem(statistics, current_iterate, direction, this->penalty_parameter, warmstart_information);
+         this->number_probe_solves++;
 
          // recompute the linearized residual
-         linearized_residual = this->model.constraint_violation(current_iterate.evaluations.constraints +
-               current_iterate.evaluations.constraint_jacobian * direction.primals, Norm::L1);
+         linearized_residual = this->compute_linearized_constraint_violation(current_iterate, direction.primals, 1., Norm::L1);
          DEBUG << "Linearized infeasibility mk(dk): " << linearized_residual << "\n\n";
       }
       DEBUG << "Condition enforce_linearized_residual_sufficient_decrease is true\n";
@@ -220,6 +257,7 @@ namespace uno {
          this->penalty_parameter /= this->parameters.decrease_factor;
          DEBUG << "Further decrease the penalty parameter to " << this->penalty_parameter << '\n';
          this->solve_l1_relaxed_problem(statistics, current_iterate, direction, this->penalty_parameter, warmstart_information);
+         this->number_probe_solves++;
       }
       DEBUG << "Condition enforce_descent_direction_for_l1_merit is true\n\n";
    }
@@ -263,8 +301,7 @@ namespace uno {
    }
 
    void l1Relaxation::evaluate_progress_measures(Iterate& iterate) const {
-      this->set_infeasibility_measure(iterate);
-      this->set_objective_measure(iterate);
+      this->set_objective_and_infeasibility_measures(iterate);
       this->subproblem->set_auxiliary_measure(this->model, iterate);
    }
 
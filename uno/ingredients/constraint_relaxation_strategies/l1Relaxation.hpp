@@ -6,6 +6,7 @@
 
 #include <memory>
 #include "ConstraintRelaxationStrategy.hpp"
+#include "ingredients/subproblems/Direction.hpp"
 #include "reformulation/l1RelaxedProblem.hpp"
 
 namespace uno {
@@ -17,7 +18,7 @@ namespace uno {
       double residual_small_threshold;
    };
 
-   class l1Relaxation : public ConstraintRelaxationStrategy {
+   class l1Relaxation final : public ConstraintRelaxationStrategy {
    public:
       l1Relaxation(const Model& model, const Options& options);
 
@@ -31,6 +32,7 @@ namespace uno {
             WarmstartInformation& warmstart_information) override;
       [[nodiscard]] bool solving_feasibility_problem() const override;
       void switch_to_feasibility_problem(Statistics& statistics, Iterate& current_iterate) override;
+      [[nodiscard]] bool compute_second_order_correction(Iterate& current_iterate, Iterate& trial_iterate, Direction& direction) override;
 
       // trial iterate acceptance
       [[nodiscard]] bool is_iterate_acceptable(Statistics& statistics, Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction,
@@ -47,6 +49,13 @@ namespace uno {
       const double tolerance;
       const l1RelaxationParameters parameters;
       const double small_duals_threshold;
+      // steering history: after this many consecutive steering rounds without a penalty decrease,
+      // the probe solves are skipped for as many iterations (0 disables the skipping)
+      const size_t steering_stable_iteration_threshold;
+      size_t consecutive_stable_steering_rounds{0};
+      size_t remaining_steering_skips{0};
+      // number of extra subproblem solves (probe and re-solves) performed at the current iteration
+      size_t number_probe_solves{0};
       // preallocated temporary multipliers
       Multipliers trial_multipliers;
 
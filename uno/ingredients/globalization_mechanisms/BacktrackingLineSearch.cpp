@@ -1,15 +1,20 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include <cassert>
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
 #include "BacktrackingLineSearch.hpp"
+#include "linear_algebra/Vector.hpp"
 #include "model/Model.hpp"
 #include "optimization/EvaluationErrors.hpp"
 #include "optimization/Iterate.hpp"
 #include "optimization/WarmstartInformation.hpp"
+#include "tools/Deadline.hpp"
+#include "tools/Infinity.hpp"
 #include "tools/Logger.hpp"
 #include "tools/Options.hpp"
+#include "tools/Profiler.hpp"
 #include "tools/Statistics.hpp"
 
 namespace uno {
@@ -17,7 +22,10 @@ namespace uno {
          GlobalizationMechanism(constraint_relaxation_strategy),
          backtracking_ratio(options.get_double("LS_backtracking_ratio")),
          minimum_step_length(options.get_double("LS_min_step_length")),
-         scale_duals_with_step_length(options.get_bool("LS_scale_duals_with_step_length")) {
+         scale_duals_with_step_length(options.get_bool("LS_scale_duals_with_step_length")),
+         use_second_order_correction(options.get_bool("LS_second_order_correction")),
+         use_speculative_evaluations(options.get_bool("LS_speculative_evaluations")),
+         corrected_direction(constraint_relaxation_strategy.maximum_number_variables(), constraint_relaxation_strategy.maximum_number_constraints()) {
       // check the initial and minimal step lengths
       assert(0 < this->backtracking_ratio && this->backtracking_ratio < 1. && "The LS backtracking ratio should be in (0, 1)");
       assert(0 < this->minimum_step_length && this->minimum_step_length < 1. && "The LS minimum step length should be in (0, 1)");
@@ -26,6 +34,9 @@ namespace uno {
    void BacktrackingLineSearch::initialize(Statistics& statistics, Iterate& initial_iterate, const Options& options) {
       statistics.add_column("LS iter", Statistics::int_width + 2, options.get_int("statistics_minor_column_order"));
       statistics.add_column("step length", Statistics::double_width - 4, options.get_int("statistics_LS_step_length_column_order"));
+      if (this->use_second_order_correction) {
+         statistics.add_column("SOC", Statistics::int_width - 2, options.get_int("statistics_SOC_column_order"));
+      }
       
       this->constraint_relaxation_strategy.initialize(statistics, initial_iterate, options);
    }
@@ -46,26 +57,61 @@ namespace uno {
       double step_length = 1.;
       bool termination = false;
       size_t number_iterations = 0;
+      // in-flight speculative evaluations of the next candidate step lengths (their destructors join
+      // the workers, so every exit of this function waits for them)
+      std::array<SpeculativeEvaluation, 2> speculations{};
+      const bool speculate = this->use_speculative_evaluations && model.supports_concurrent_evaluations();
+      // the bound multipliers take a full step whatever the step length: write them once per direction
+      GlobalizationMechanism::take_full_dual_steps(current_iterate, trial_iterate, this->direction);
       while (not termination) {
+         // cancellation point: a backtracking cascade may outlive the time budget between two outer iterations
+         Deadline::check();
          number_iterations++;
          DEBUG << "\n\tLine-search iteration " << number_iterations << ", step_length " << step_length << '\n';
          if (1 < number_iterations) { statistics.start_new_line(); }
          statistics.set("step length", step_length);
 
          bool is_acceptable = false;
-         try {
-            // take a step as a fraction of the direction
-            GlobalizationMechanism::assemble_trial_iterate(model, current_iterate, trial_iterate, this->direction, step_length,
-                  // scale or not the constraint dual direction with the LS step length
-                  this->scale_duals_with_step_length ? step_length : 1.);
-
-            is_acceptable = this->constraint_relaxation_strategy.is_iterate_acceptable(statistics, current_iterate, trial_iterate, this->direction, step_length);
-            this->set_statistics(statistics, trial_iterate, this->direction, step_length, number_iterations);
+         // take a step as a fraction of the direction (the full-step dual blocks are already in place)
+         GlobalizationMechanism::take_scaled_steps(model, current_iterate, trial_iterate, this->direction, step_length,
+               // scale or not the constraint dual direction with the LS step length
+               this->scale_duals_with_step_length ? step_length : 1.);
+         if (speculate) {
+            // install the evaluations speculated for this step length, then start evaluating the
+            // next two candidates while the current trial point is tested
+            this->harvest_and_relaunch_speculations(speculations, model, current_iterate, trial_iterate, step_length);
          }
-         catch (const EvaluationError& e) {
+
+         // non-throwing pre-evaluation of the trial functions: a domain error at an aggressive trial
+         // point (frequent while backtracking) is a plain branch to a shorter step, instead of an
+         // exception unwound through the ingredient stack. The acceptance test below then hits the
+         // evaluation caches of the trial iterate
+         if (not (trial_iterate.try_evaluate_objective(model) && trial_iterate.try_evaluate_constraints(model))) {
             this->set_statistics(statistics, number_iterations);
             statistics.set("status", "eval. error");
          }
+         else {
+            try {
+               const ScopedProfile profile(Profiler::GLOBALIZATION);
+               is_acceptable = this->constraint_relaxation_strategy.is_iterate_acceptable(statistics, current_iterate, trial_iterate, this->direction, step_length);
+               this->set_statistics(statistics, trial_iterate, this->direction, step_length, number_iterations);
+            }
+            catch (const EvaluationError& e) {
+               this->set_statistics(statistics, number_iterations);
+               statistics.set("status", "eval. error");
+            }
+         }
+
+         // before the first halving, attempt a second-order correction (against the Maratos effect):
+         // one extra solve with the existing factorization often avoids a backtracking cascade and
+         // its constraint evaluations
+         if (not is_acceptable && this->use_second_order_correction && number_iterations == 1) {
+            is_acceptable = this->try_second_order_correction(statistics, model, current_iterate, trial_iterate);
+            if (not is_acceptable) {
+               // the rejected corrected trial iterate overwrote the full-step dual blocks: restore them
+               GlobalizationMechanism::take_full_dual_steps(current_iterate, trial_iterate, this->direction);
+            }
+         }
 
          if (is_acceptable) {
             trial_iterate.status = this->constraint_relaxation_strategy.check_termination(trial_iterate);
@@ -93,7 +139,18 @@ namespace uno {
                this->constraint_relaxation_strategy.compute_feasible_direction(statistics, current_iterate, this->direction, this->direction.primals,
                      warmstart_information);
                BacktrackingLineSearch::check_unboundedness(this->direction);
-               // restart backtracking
+               // the direction changed: discard the in-flight speculations (a cancelled evaluation
+               // that has not started yet completes as a no-op)
+               for (SpeculativeEvaluation& speculation: speculations) {
+                  if (speculation.worker.valid()) {
+                     speculation.token.cancel();
+                     speculation.worker.wait();
+                     speculation.worker = {};
+                  }
+                  speculation.step_length = 0.;
+               }
+               // restart backtracking along the new direction
+               GlobalizationMechanism::take_full_dual_steps(current_iterate, trial_iterate, this->direction);
                step_length = 1.;
                number_iterations = 0;
             }
@@ -101,6 +158,135 @@ namespace uno {
       } // end while loop
    }
 
+   // join the speculation that targeted the current step length and install its evaluations into the
+   // freshly assembled trial iterate, discard the stale ones, and start evaluating the candidates of
+   // the next two backtracking steps
+   void BacktrackingLineSearch::harvest_and_relaunch_speculations(std::array<SpeculativeEvaluation, 2>& speculations, const Model& model,
+         const Iterate& current_iterate, Iterate& trial_iterate, double step_length) {
+      const double next_step_length = this->decrease_step_length(step_length);
+      const double second_next_step_length = this->decrease_step_length(next_step_length);
+      for (SpeculativeEvaluation& speculation: speculations) {
+         if (speculation.worker.valid()) {
+            if (speculation.step_length == step_length) {
+               speculation.worker.get();
+               BacktrackingLineSearch::inject_speculative_evaluation(speculation, trial_iterate);
+               speculation.step_length = 0.;
+            }
+            else if (speculation.step_length != next_step_length && speculation.step_length != second_next_step_length) {
+               // skipped step length: the speculation can never be consumed
+               speculation.token.cancel();
+               speculation.worker.wait();
+               speculation.worker = {};
+               speculation.step_length = 0.;
+            }
+         }
+      }
+      for (const double candidate_step_length: {next_step_length, second_next_step_length}) {
+         if (candidate_step_length < this->minimum_step_length) {
+            continue;
+         }
+         const bool in_flight = std::any_of(speculations.begin(), speculations.end(), [&](const SpeculativeEvaluation& speculation) {
+            return speculation.worker.valid() && speculation.step_length == candidate_step_length;
+         });
+         if (not in_flight) {
+            for (SpeculativeEvaluation& speculation: speculations) {
+               if (not speculation.worker.valid()) {
+                  this->launch_speculative_evaluation(speculation, model, current_iterate, candidate_step_length);
+                  break;
+               }
+            }
+         }
+      }
+   }
+
+   void BacktrackingLineSearch::launch_speculative_evaluation(SpeculativeEvaluation& speculation, const Model& model,
+         const Iterate& current_iterate, double step_length) const {
+      speculation.step_length = step_length;
+      speculation.objective_evaluated = false;
+      speculation.constraints_evaluated = false;
+      // assemble the candidate primals exactly like assemble_trial_iterate does, so that the later
+      // comparison with the actual trial iterate is an exact match
+      speculation.primals.resize(current_iterate.primals.size());
+      GlobalizationMechanism::assemble_trial_primals(model, current_iterate.primals, this->direction, step_length, speculation.primals);
+      speculation.constraints.resize(model.number_constraints);
+      speculation.token = CancellationToken();
+      const auto evaluate = [&speculation, &model]() {
+         try {
+            speculation.objective = model.evaluate_objective(speculation.primals);
+            speculation.objective_evaluated = true;
+            if (model.is_constrained()) {
+               model.evaluate_constraints(speculation.primals, speculation.constraints);
+            }
+            speculation.constraints_evaluated = true;
+         }
+         catch (const std::exception&) {
+            // the speculation is discarded; the main thread re-evaluates and handles the error
+         }
+      };
+      // shared scheduler when it has workers (speculative priority: the evaluation yields to
+      // critical-path work); a dedicated thread otherwise, since running the evaluation inline on
+      // the submitter would defeat the speculation
+      TaskScheduler& scheduler = TaskScheduler::global();
+      if (0 < scheduler.number_workers()) {
+         speculation.worker = scheduler.submit(TaskScheduler::Priority::SPECULATIVE, speculation.token, evaluate);
+      }
+      else {
+         speculation.worker = std::async(std::launch::async, evaluate);
+      }
+   }
+
+   // install the speculative evaluations into the trial iterate, if the speculative point matches it
+   // bit for bit. Non-finite values are not installed, so that the normal evaluation path reports them
+   void BacktrackingLineSearch::inject_speculative_evaluation(SpeculativeEvaluation& speculation, Iterate& trial_iterate) {
+      if (speculation.primals.size() != trial_iterate.primals.size() ||
+            not std::equal(speculation.primals.begin(), speculation.primals.end(), trial_iterate.primals.begin())) {
+         return;
+      }
+      const uint64_t point_hash = Evaluations::hash_point(trial_iterate.primals);
+      if (speculation.objective_evaluated && is_finite(speculation.objective)) {
+         trial_iterate.evaluations.objective = speculation.objective;
+         trial_iterate.evaluations.objective_point_hash = point_hash;
+         trial_iterate.is_objective_computed = true;
+         trial_iterate.counters->increment_objective();
+      }
+      if (speculation.constraints_evaluated && std::all_of(speculation.constraints.cbegin(), speculation.constraints.cend(),
+            [](double constraint_j) { return is_finite(constraint_j); })) {
+         trial_iterate.evaluations.constraints = speculation.constraints;
+         trial_iterate.evaluations.constraints_point_hash = point_hash;
+         trial_iterate.are_constraints_computed = true;
+         if (not speculation.constraints.empty()) {
+            trial_iterate.counters->increment_constraints();
+         }
+      }
+   }
+
+   // correct the direction by re-solving the subproblem against the existing factorization, with the
+   // constraints re-evaluated at the rejected trial iterate, and test the corrected trial iterate. If
+   // it is rejected as well, the backtracking resumes along the original direction
+   bool BacktrackingLineSearch::try_second_order_correction(Statistics& statistics, const Model& model, Iterate& current_iterate,
+         Iterate& trial_iterate) {
+      // copy into the pre-sized buffer: no heap allocation per correction attempt
+      this->corrected_direction = this->direction;
+      if (not this->constraint_relaxation_strategy.compute_second_order_correction(current_iterate, trial_iterate, this->corrected_direction)) {
+         return false;
+      }
+      DEBUG << "Testing the second-order corrected trial iterate\n";
+      try {
+         GlobalizationMechanism::assemble_trial_iterate(model, current_iterate, trial_iterate, this->corrected_direction, 1., 1.);
+         const ScopedProfile profile(Profiler::GLOBALIZATION);
+         if (this->constraint_relaxation_strategy.is_iterate_acceptable(statistics, current_iterate, trial_iterate, this->corrected_direction, 1.)) {
+            statistics.set("SOC", "x");
+            std::swap(this->direction, this->corrected_direction);
+            this->set_statistics(statistics, trial_iterate, this->direction, 1., 1);
+            return true;
+         }
+      }
+      catch (const EvaluationError&) {
+      }
+      DEBUG << "The second-order correction was rejected, resuming the backtracking\n";
+      return false;
+   }
+
    bool BacktrackingLineSearch::terminate_with_small_step_length(Statistics& statistics, Iterate& trial_iterate) {
       bool termination = false;
       trial_iterate.status = this->constraint_relaxation_strategy.check_termination(trial_iterate);
@@ -4,7 +4,11 @@
 #ifndef UNO_BACKTRACKINGLINESEARCH_H
 #define UNO_BACKTRACKINGLINESEARCH_H
 
+#include <array>
+#include <future>
+#include <vector>
 #include "GlobalizationMechanism.hpp"
+#include "tools/TaskScheduler.hpp"
 
 namespace uno {
    // forward declaration
@@ -17,13 +21,49 @@ namespace uno {
       void initialize(Statistics& statistics, Iterate& initial_iterate, const Options& options) override;
       void compute_next_iterate(Statistics& statistics, const Model& model, Iterate& current_iterate, Iterate& trial_iterate) override;
 
-   private:
+   protected:
       const double backtracking_ratio;
       const double minimum_step_length;
       const bool scale_duals_with_step_length;
+      // attempt a second-order correction before the first halving (against the Maratos effect)
+      const bool use_second_order_correction;
+      // evaluate the next candidate step lengths on background threads while the current one is tested
+      const bool use_speculative_evaluations;
+      // pre-sized buffer for the second-order corrected direction: copied into (no allocation) and
+      // swapped with the current direction on acceptance
+      Direction corrected_direction;
+
+      // speculative evaluation of a candidate trial point: the backtracking sequence is
+      // deterministic, so the functions at the next step lengths can be evaluated while the current
+      // trial point is tested. The evaluation runs on the shared task scheduler (speculative
+      // priority, so it yields to critical-path work) when it has workers, on a dedicated thread
+      // otherwise. The destructor waits for the in-flight evaluation, so no work outlives the
+      // backtracking; the token lets the discard paths drop an evaluation that has not started yet
+      struct SpeculativeEvaluation {
+         std::future<void> worker{};
+         CancellationToken token{};
+         double step_length{0.};
+         Vector<double> primals{};
+         std::vector<double> constraints{};
+         double objective{0.};
+         bool objective_evaluated{false};
+         bool constraints_evaluated{false};
+
+         ~SpeculativeEvaluation() {
+            if (this->worker.valid()) {
+               this->worker.wait();
+            }
+         }
+      };
 
       void backtrack_along_direction(Statistics& statistics, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
             WarmstartInformation& warmstart_information);
+      void harvest_and_relaunch_speculations(std::array<SpeculativeEvaluation, 2>& speculations, const Model& model,
+            const Iterate& current_iterate, Iterate& trial_iterate, double step_length);
+      void launch_speculative_evaluation(SpeculativeEvaluation& speculation, const Model& model, const Iterate& current_iterate,
+            double step_length) const;
+      static void inject_speculative_evaluation(SpeculativeEvaluation& speculation, Iterate& trial_iterate);
+      [[nodiscard]] bool try_second_order_correction(Statistics& statistics, const Model& model, Iterate& current_iterate, Iterate& trial_iterate);
       [[nodiscard]] bool terminate_with_small_step_length(Statistics& statistics, Iterate& trial_iterate);
       [[nodiscard]] double decrease_step_length(double step_length) const;
       static void check_unboundedness(const Direction& direction);
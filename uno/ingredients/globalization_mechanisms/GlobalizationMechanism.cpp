@@ -1,6 +1,7 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include "GlobalizationMechanism.hpp"
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
 #include "model/Model.hpp"
@@ -16,18 +17,31 @@ namespace uno {
 
    void GlobalizationMechanism::assemble_trial_iterate(const Model& model, Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction,
          double primal_step_length, double dual_step_length) {
+      GlobalizationMechanism::take_full_dual_steps(current_iterate, trial_iterate, direction);
+      GlobalizationMechanism::take_scaled_steps(model, current_iterate, trial_iterate, direction, primal_step_length, dual_step_length);
+   }
+
+   // bound multipliers updated with full step: these vectors do not depend on the step length and
+   // are therefore invariant within a backtracking sequence
+   void GlobalizationMechanism::take_full_dual_steps(const Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction) {
       trial_iterate.set_number_variables(current_iterate.primals.size());
-      // take primal step
-      trial_iterate.primals = current_iterate.primals + primal_step_length * direction.primals;
-      // project the trial iterate onto the bounds to avoid numerical errors
-      model.project_onto_variable_bounds(trial_iterate.primals);
-      // take dual step: line-search carried out only on constraint multipliers. Bound multipliers updated with full step
-      trial_iterate.multipliers.constraints = current_iterate.multipliers.constraints + dual_step_length * direction.multipliers.constraints;
-      trial_iterate.multipliers.lower_bounds = current_iterate.multipliers.lower_bounds + direction.multipliers.lower_bounds;
-      trial_iterate.multipliers.upper_bounds = current_iterate.multipliers.upper_bounds + direction.multipliers.upper_bounds;
-      trial_iterate.feasibility_multipliers.constraints = current_iterate.feasibility_multipliers.constraints + dual_step_length * direction.feasibility_multipliers.constraints;
-      trial_iterate.feasibility_multipliers.lower_bounds = current_iterate.feasibility_multipliers.lower_bounds + direction.feasibility_multipliers.lower_bounds;
-      trial_iterate.feasibility_multipliers.upper_bounds = current_iterate.feasibility_multipliers.upper_bounds + direction.feasibility_multipliers.upper_bounds;
+      add_vectors(current_iterate.multipliers.lower_bounds, direction.multipliers.lower_bounds, 1., trial_iterate.multipliers.lower_bounds);
+      add_vectors(current_iterate.multipliers.upper_bounds, direction.multipliers.upper_bounds, 1., trial_iterate.multipliers.upper_bounds);
+      add_vectors(current_iterate.feasibility_multipliers.lower_bounds, direction.feasibility_multipliers.lower_bounds, 1.,
+            trial_iterate.feasibility_multipliers.lower_bounds);
+      add_vectors(current_iterate.feasibility_multipliers.upper_bounds, direction.feasibility_multipliers.upper_bounds, 1.,
+            trial_iterate.feasibility_multipliers.upper_bounds);
+   }
+
+   void GlobalizationMechanism::take_scaled_steps(const Model& model, const Iterate& current_iterate, Iterate& trial_iterate,
+         const Direction& direction, double primal_step_length, double dual_step_length) {
+      trial_iterate.set_number_variables(current_iterate.primals.size());
+      // take primal step, projected onto the bounds
+      GlobalizationMechanism::assemble_trial_primals(model, current_iterate.primals, direction, primal_step_length, trial_iterate.primals);
+      // take dual step: line-search carried out only on constraint multipliers
+      add_vectors(current_iterate.multipliers.constraints, direction.multipliers.constraints, dual_step_length, trial_iterate.multipliers.constraints);
+      add_vectors(current_iterate.feasibility_multipliers.constraints, direction.feasibility_multipliers.constraints, dual_step_length,
+            trial_iterate.feasibility_multipliers.constraints);
       trial_iterate.progress.reset();
       trial_iterate.is_objective_computed = false;
       trial_iterate.is_objective_gradient_computed = false;
@@ -36,6 +50,28 @@ namespace uno {
       trial_iterate.status = TerminationStatus::NOT_OPTIMAL;
    }
 
+   void GlobalizationMechanism::assemble_trial_primals(const Model& model, const Vector<double>& current_primals, const Direction& direction,
+         double primal_step_length, Vector<double>& trial_primals) {
+      if (direction.moved_variables.has_value()) {
+         // sparse direction (active-set subproblem that moved few variables): copy the current
+         // primals and update/project the moved entries only, instead of sweeping all of them
+         trial_primals = current_primals;
+         for (size_t variable_index: *direction.moved_variables) {
+            const double trial_value = current_primals[variable_index] + primal_step_length * direction.primals[variable_index];
+            // same projection as project_onto_variable_bounds (the unmoved entries are already projected)
+            trial_primals[variable_index] = (variable_index < model.number_variables) ?
+                  std::max(std::min(trial_value, model.variable_upper_bound(variable_index)), model.variable_lower_bound(variable_index)) :
+                  trial_value;
+         }
+      }
+      else {
+         // vectorized kernel: repeated in every backtracking step on possibly very large vectors
+         add_vectors(current_primals, direction.primals, primal_step_length, trial_primals);
+         // project the trial iterate onto the bounds to avoid numerical errors
+         model.project_onto_variable_bounds(trial_primals);
+      }
+   }
+
    size_t GlobalizationMechanism::get_hessian_evaluation_count() const {
       return this->constraint_relaxation_strategy.get_hessian_evaluation_count();
    }
@@ -43,4 +79,17 @@ namespace uno {
    size_t GlobalizationMechanism::get_number_subproblems_solved() const {
       return this->constraint_relaxation_strategy.get_number_subproblems_solved();
    }
+
+   void GlobalizationMechanism::write_snapshot(std::ostream& stream) const {
+      this->constraint_relaxation_strategy.write_snapshot(stream);
+   }
+
+   void GlobalizationMechanism::read_snapshot(std::istream& stream) {
+      this->constraint_relaxation_strategy.read_snapshot(stream);
+   }
+
+   bool GlobalizationMechanism::apply_overlay_option(const std::string& /*option_name*/, const std::string& /*option_value*/) {
+      // no dynamically adjustable parameter by default
+      return false;
+   }
 } // namespace
@@ -4,6 +4,8 @@
 #ifndef UNO_GLOBALIZATIONMECHANISM_H
 #define UNO_GLOBALIZATIONMECHANISM_H
 
+#include <iosfwd>
+#include <string>
 #include "ingredients/subproblems/Direction.hpp"
 
 namespace uno {
@@ -25,6 +27,14 @@ namespace uno {
       [[nodiscard]] size_t get_hessian_evaluation_count() const;
       [[nodiscard]] size_t get_number_subproblems_solved() const;
 
+      // warm-restart snapshots: mechanisms with internal state (e.g. trust-region radius) extend these
+      virtual void write_snapshot(std::ostream& stream) const;
+      virtual void read_snapshot(std::istream& stream);
+
+      // mid-solve retuning (see Uno::poll_option_overlay): mechanisms with dynamically adjustable
+      // parameters extend this and return whether the option was applied
+      virtual bool apply_overlay_option(const std::string& option_name, const std::string& option_value);
+
    protected:
       // reference to allow polymorphism
       ConstraintRelaxationStrategy& constraint_relaxation_strategy; /*!< Constraint relaxation strategy */
@@ -32,6 +42,16 @@ namespace uno {
 
       static void assemble_trial_iterate(const Model& model, Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction,
             double primal_step_length, double dual_step_length);
+      // split assembly for backtracking: the bound multipliers always take a full step, so their
+      // (possibly very large) vectors are written once per direction instead of once per trial point
+      static void take_full_dual_steps(const Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction);
+      static void take_scaled_steps(const Model& model, const Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction,
+            double primal_step_length, double dual_step_length);
+      // primal half of take_scaled_steps, also used by the speculative evaluations of the line
+      // search (the candidate primals must match the later trial iterate exactly). When the
+      // direction carries a sparse view, only the moved entries are updated and projected
+      static void assemble_trial_primals(const Model& model, const Vector<double>& current_primals, const Direction& direction,
+            double primal_step_length, Vector<double>& trial_primals);
    };
 } // namespace
 
@@ -7,6 +7,7 @@
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
 #include "ingredients/globalization_mechanisms/TrustRegionStrategy.hpp"
 #include "ingredients/globalization_mechanisms/BacktrackingLineSearch.hpp"
+#include "ingredients/globalization_mechanisms/WatchdogLineSearch.hpp"
 #include "tools/Options.hpp"
 
 namespace uno {
@@ -19,10 +20,13 @@ namespace uno {
        else if (mechanism_type == "LS") {
            return std::make_unique<BacktrackingLineSearch>(constraint_relaxation_strategy, options);
        }
+       else if (mechanism_type == "LS_watchdog") {
+           return std::make_unique<WatchdogLineSearch>(constraint_relaxation_strategy, options);
+       }
        throw std::invalid_argument("GlobalizationMechanism " + mechanism_type + " is not supported");
    }
 
    std::vector<std::string> GlobalizationMechanismFactory::available_strategies() {
-      return {"TR", "LS"};
+      return {"TR", "LS", "LS_watchdog"};
    }
 } // namespace
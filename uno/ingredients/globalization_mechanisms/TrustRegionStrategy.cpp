@@ -1,16 +1,22 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include <cmath>
 #include <cassert>
+#include <istream>
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.hpp"
 #include "TrustRegionStrategy.hpp"
 #include "model/Model.hpp"
+#include "symbolic/Range.hpp"
 #include "optimization/EvaluationErrors.hpp"
 #include "optimization/Iterate.hpp"
 #include "optimization/WarmstartInformation.hpp"
+#include "tools/Deadline.hpp"
 #include "tools/Logger.hpp"
 #include "tools/Options.hpp"
+#include "tools/Profiler.hpp"
 #include "tools/Statistics.hpp"
 
 namespace uno {
@@ -23,13 +29,26 @@ namespace uno {
          activity_tolerance(options.get_double("TR_activity_tolerance")),
          minimum_radius(options.get_double("TR_min_radius")),
          radius_reset_threshold(options.get_double("TR_radius_reset_threshold")),
-         tolerance(options.get_double("tolerance")) {
+         tolerance(options.get_double("tolerance")),
+         speculate_on_rejection(options.get_bool("TR_speculative_radius")),
+         speculative_direction(constraint_relaxation_strategy.maximum_number_variables(),
+               constraint_relaxation_strategy.maximum_number_constraints()) {
       assert(0 < this->radius && "The trust-region radius should be positive");
       assert(1. < this->increase_factor && "The trust-region increase factor should be > 1");
       assert(1. < this->decrease_factor && "The trust-region decrease factor should be > 1");
+      if (this->speculate_on_rejection) {
+         // retained for the lazy construction of the twin strategy stack
+         this->speculation_options = std::make_unique<Options>(options);
+      }
+   }
+
+   TrustRegionStrategy::~TrustRegionStrategy() {
+      this->join_speculative_solve();
    }
 
    void TrustRegionStrategy::initialize(Statistics& statistics, Iterate& initial_iterate, const Options& options) {
+      // a no-op at the initial point, but a perturbed restart reinitializes a possibly tiny radius
+      this->radius = options.get_double("TR_radius");
       statistics.add_column("TR iter", Statistics::int_width + 2, options.get_int("statistics_minor_column_order"));
       statistics.add_column("TR radius", Statistics::double_width - 4, options.get_int("statistics_TR_radius_column_order"));
       statistics.set("TR radius", this->radius);
@@ -47,6 +66,8 @@ namespace uno {
       bool termination = false;
       while (not termination) {
          try {
+            // cancellation point: a rejection streak may outlive the time budget between two outer iterations
+            Deadline::check();
             number_iterations++;
             DEBUG << "\n\t### Trust-region inner iteration " << number_iterations << " with radius " << this->radius << "\n\n";
             if (1 < number_iterations) { statistics.start_new_line(); }
@@ -54,7 +75,21 @@ namespace uno {
 
             // compute the direction within the trust region
             this->constraint_relaxation_strategy.set_trust_region_radius(this->radius);
-            this->constraint_relaxation_strategy.compute_feasible_direction(statistics, current_iterate, this->direction, warmstart_information);
+            if (this->speculative_direction_available && this->radius == this->speculative_radius) {
+               // the speculative solve of the previous rejection already computed this direction
+               DEBUG << "Adopting the direction of the speculative solve\n";
+               this->direction = this->speculative_direction;
+            }
+            else if (this->reuse_previous_solution) {
+               // radius continuation: resolve from the previous solution, clamped into the shrunken trust region
+               this->constraint_relaxation_strategy.compute_feasible_direction(statistics, current_iterate, this->direction,
+                     this->continuation_point, warmstart_information);
+            }
+            else {
+               this->constraint_relaxation_strategy.compute_feasible_direction(statistics, current_iterate, this->direction, warmstart_information);
+            }
+            this->reuse_previous_solution = false;
+            this->speculative_direction_available = false;
 
             // deal with errors in the subproblem
             if (this->direction.status == SubproblemStatus::UNBOUNDED_PROBLEM) {
@@ -77,7 +112,12 @@ namespace uno {
                GlobalizationMechanism::assemble_trial_iterate(model, current_iterate, trial_iterate, this->direction, 1., 1.);
                this->reset_active_trust_region_multipliers(model, this->direction, trial_iterate);
 
+               // overlap the acceptance test with the subproblem solve of the would-be next radius
+               if (this->speculate_on_rejection && model.supports_concurrent_evaluations()) {
+                  this->start_speculative_solve(model, current_iterate);
+               }
                const bool is_acceptable = this->is_iterate_acceptable(statistics, current_iterate, trial_iterate, this->direction);
+               this->join_speculative_solve();
                if (is_acceptable) {
                   this->constraint_relaxation_strategy.set_dual_residuals_statistics(statistics, trial_iterate);
                   this->reset_radius();
@@ -87,12 +127,17 @@ namespace uno {
                   this->decrease_radius(this->direction.norm);
                   // after the first iteration, only the variable bounds are updated
                   warmstart_information.only_variable_bounds_changed();
+                  // the radius continuation is superseded when the speculative direction matches
+                  if (not (this->speculative_direction_available && this->radius == this->speculative_radius)) {
+                     this->seed_radius_continuation();
+                  }
                }
                if (Logger::level == INFO) statistics.print_current_line();
             }
          }
          // if an evaluation error occurs, decrease the radius
          catch (const EvaluationError& e) {
+            this->join_speculative_solve();
             statistics.set("status", "eval. error");
             if (Logger::level == INFO) statistics.print_current_line();
             this->decrease_radius();
@@ -101,6 +146,58 @@ namespace uno {
       }
    }
 
+   // the radius only enters the subproblem through the bounds on the variable displacements. When a step is
+   // rejected and the radius decreased, the previous solution clamped into the shrunken trust region is
+   // therefore a feasible starting iterate for the resolve, which the subproblem solver can refine cheaply
+   void TrustRegionStrategy::seed_radius_continuation() {
+      this->continuation_point.resize(this->direction.number_variables);
+      for (size_t variable_index: Range(this->direction.number_variables)) {
+         this->continuation_point[variable_index] = std::clamp(this->direction.primals[variable_index], -this->radius, this->radius);
+      }
+      this->reuse_previous_solution = true;
+   }
+
+   // launch the subproblem solve of the radius that decrease_radius() would produce on a rejection,
+   // on a second thread and on a twin strategy stack, while the caller evaluates the current trial
+   // iterate. The twin stack evolves its own internal state (penalty parameter, warm bases): its
+   // direction is only adopted when its subproblem solve terminated cleanly. The twin evaluates on
+   // a private copy of the current iterate, so the only shared object is the (thread-safe) model
+   void TrustRegionStrategy::start_speculative_solve(const Model& model, const Iterate& current_iterate) {
+      this->speculative_direction_available = false;
+      this->speculative_radius = std::min(this->radius, this->direction.norm) / this->decrease_factor;
+      if (this->speculative_radius <= 0. || not std::isfinite(this->speculative_radius)) {
+         return;
+      }
+      // the twin stack is created and initialized lazily, on the first speculation
+      if (this->speculative_strategy == nullptr) {
+         this->speculative_strategy = ConstraintRelaxationStrategyFactory::create(model, *this->speculation_options);
+         this->speculative_statistics = std::make_unique<Statistics>(*this->speculation_options);
+         this->speculative_iterate = std::make_unique<Iterate>(current_iterate);
+         this->speculative_strategy->initialize(*this->speculative_statistics, *this->speculative_iterate, *this->speculation_options);
+      }
+      *this->speculative_iterate = Iterate(current_iterate);
+      this->speculative_thread = std::thread([this] {
+         try {
+            WarmstartInformation speculative_warmstart_information{};
+            speculative_warmstart_information.set_cold_start();
+            this->speculative_strategy->set_trust_region_radius(this->speculative_radius);
+            this->speculative_strategy->compute_feasible_direction(*this->speculative_statistics, *this->speculative_iterate,
+                  this->speculative_direction, speculative_warmstart_information);
+            this->speculative_direction_available = (this->speculative_direction.status == SubproblemStatus::OPTIMAL);
+         }
+         catch (...) {
+            // a failed speculation is simply discarded
+            this->speculative_direction_available = false;
+         }
+      });
+   }
+
+   void TrustRegionStrategy::join_speculative_solve() {
+      if (this->speculative_thread.joinable()) {
+         this->speculative_thread.join();
+      }
+   }
+
    void TrustRegionStrategy::reset_active_trust_region_multipliers(const Model& model, const Direction& direction, Iterate& trial_iterate) const {
       assert(0 < this->radius && "The trust-region radius should be positive");
       // set multipliers for bound constraints active at trust region to 0 (except if one of the original bounds is active)
@@ -121,6 +218,7 @@ namespace uno {
    // the trial iterate is accepted by the constraint relaxation strategy or if the step is small and we cannot switch to solving the feasibility problem
    bool TrustRegionStrategy::is_iterate_acceptable(Statistics& statistics, Iterate& current_iterate, Iterate& trial_iterate,
          const Direction& direction) {
+      const ScopedProfile profile(Profiler::GLOBALIZATION);
       // direction.primal_dual_step_length is usually 1, can be lower if reduced by fraction-to-boundary rule
       bool accept_iterate = this->constraint_relaxation_strategy.is_iterate_acceptable(statistics, current_iterate, trial_iterate, direction, 1.);
       this->set_statistics(statistics, trial_iterate, direction);
@@ -180,6 +278,29 @@ namespace uno {
       this->radius = std::max(this->radius, this->radius_reset_threshold);
    }
 
+   void TrustRegionStrategy::write_snapshot(std::ostream& stream) const {
+      stream << "radius " << this->radius << '\n';
+      GlobalizationMechanism::write_snapshot(stream);
+   }
+
+   void TrustRegionStrategy::read_snapshot(std::istream& stream) {
+      std::string tag{};
+      stream >> tag >> this->radius;
+      GlobalizationMechanism::read_snapshot(stream);
+   }
+
+   bool TrustRegionStrategy::apply_overlay_option(const std::string& option_name, const std::string& option_value) {
+      // the current radius can be retuned mid-solve (e.g. unstuck a solve whose radius collapsed)
+      if (option_name == "TR_radius") {
+         const double new_radius = std::stod(option_value);
+         if (0. < new_radius) {
+            this->radius = new_radius;
+            return true;
+         }
+      }
+      return false;
+   }
+
    void TrustRegionStrategy::set_trust_region_statistics(Statistics& statistics, size_t number_iterations) const {
       statistics.set("TR iter", number_iterations);
       statistics.set("TR radius", this->radius);
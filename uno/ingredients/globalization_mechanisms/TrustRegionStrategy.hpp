@@ -4,15 +4,22 @@
 #ifndef UNO_TRUSTREGIONSTRATEGY_H
 #define UNO_TRUSTREGIONSTRATEGY_H
 
+#include <memory>
+#include <thread>
 #include "GlobalizationMechanism.hpp"
+#include "linear_algebra/Vector.hpp"
 
 namespace uno {
-   class TrustRegionStrategy : public GlobalizationMechanism {
+   class TrustRegionStrategy final : public GlobalizationMechanism {
    public:
       TrustRegionStrategy(ConstraintRelaxationStrategy& constraint_relaxation_strategy, const Options& options);
+      ~TrustRegionStrategy() override;
 
       void initialize(Statistics& statistics, Iterate& initial_iterate, const Options& options) override;
       void compute_next_iterate(Statistics& statistics, const Model& model, Iterate& current_iterate, Iterate& trial_iterate) override;
+      void write_snapshot(std::ostream& stream) const override;
+      void read_snapshot(std::istream& stream) override;
+      bool apply_overlay_option(const std::string& option_name, const std::string& option_value) override;
 
    private:
       double radius; /*!< Current trust region radius */
@@ -23,7 +30,26 @@ namespace uno {
       const double minimum_radius;
       const double radius_reset_threshold;
       const double tolerance;
+      // radius continuation: starting point handed to the subproblem when only the radius changed
+      Vector<double> continuation_point{};
+      bool reuse_previous_solution{false};
 
+      // speculative shrink (TR_speculative_radius): while the trial iterate of the current radius
+      // is evaluated, a twin strategy stack solves the subproblem of the deterministic next-smaller
+      // radius on a second thread. On rejection its direction is adopted, on acceptance discarded
+      const bool speculate_on_rejection;
+      std::unique_ptr<Options> speculation_options{};
+      std::unique_ptr<ConstraintRelaxationStrategy> speculative_strategy{};
+      std::unique_ptr<Statistics> speculative_statistics{};
+      std::unique_ptr<Iterate> speculative_iterate{};
+      Direction speculative_direction;
+      double speculative_radius{0.};
+      bool speculative_direction_available{false};
+      std::thread speculative_thread{};
+
+      void start_speculative_solve(const Model& model, const Iterate& current_iterate);
+      void join_speculative_solve();
+      void seed_radius_continuation();
       bool is_iterate_acceptable(Statistics& statistics, Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction);
       void possibly_increase_radius(double step_norm);
       void decrease_radius(double step_norm);
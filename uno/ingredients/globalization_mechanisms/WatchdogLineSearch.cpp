@@ -0,0 +1,77 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
+#include "WatchdogLineSearch.hpp"
+#include "optimization/EvaluationErrors.hpp"
+#include "optimization/WarmstartInformation.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+#include "tools/Profiler.hpp"
+#include "tools/Statistics.hpp"
+
+namespace uno {
+   WatchdogLineSearch::WatchdogLineSearch(ConstraintRelaxationStrategy& constraint_relaxation_strategy, const Options& options):
+         BacktrackingLineSearch(constraint_relaxation_strategy, options),
+         maximum_relaxed_iterations(options.get_unsigned_int("LS_watchdog_max_relaxed_iterations")) {
+   }
+
+   void WatchdogLineSearch::compute_next_iterate(Statistics& statistics, const Model& model, Iterate& current_iterate, Iterate& trial_iterate) {
+      WarmstartInformation warmstart_information{};
+      warmstart_information.set_hot_start();
+      DEBUG2 << "Current iterate\n" << current_iterate << '\n';
+
+      this->constraint_relaxation_strategy.compute_feasible_direction(statistics, current_iterate, this->direction, warmstart_information);
+      BacktrackingLineSearch::check_unboundedness(this->direction);
+
+      // test the full step
+      bool is_acceptable = false;
+      try {
+         GlobalizationMechanism::assemble_trial_iterate(model, current_iterate, trial_iterate, this->direction, 1., 1.);
+         const ScopedProfile profile(Profiler::GLOBALIZATION);
+         is_acceptable = this->constraint_relaxation_strategy.is_iterate_acceptable(statistics, current_iterate, trial_iterate, this->direction, 1.);
+         this->set_statistics(statistics, trial_iterate, this->direction, 1., 1);
+      }
+      catch (const EvaluationError& e) {
+         this->set_statistics(statistics, 1);
+         statistics.set("status", "eval. error");
+      }
+
+      if (is_acceptable) {
+         // genuine progress: the watchdog is reset and the reference iterate dropped
+         this->relaxed_iterations = 0;
+         this->reference_iterate.reset();
+         trial_iterate.status = this->constraint_relaxation_strategy.check_termination(trial_iterate);
+         this->constraint_relaxation_strategy.set_dual_residuals_statistics(statistics, trial_iterate);
+         if (Logger::level == INFO) statistics.print_current_line();
+      }
+      else if (this->relaxed_iterations < this->maximum_relaxed_iterations) {
+         // tentatively accept the non-improving full step; the last acceptable iterate is kept as a fallback point
+         if (this->relaxed_iterations == 0) {
+            this->reference_iterate.emplace(current_iterate);
+         }
+         this->relaxed_iterations++;
+         DEBUG << "Watchdog: tentative acceptance of a non-improving full step (" << this->relaxed_iterations << "/" <<
+               this->maximum_relaxed_iterations << ")\n";
+         statistics.set("status", "watchdog relaxed");
+         trial_iterate.status = this->constraint_relaxation_strategy.check_termination(trial_iterate);
+         this->constraint_relaxation_strategy.set_dual_residuals_statistics(statistics, trial_iterate);
+         if (Logger::level == INFO) statistics.print_current_line();
+      }
+      else {
+         // the watchdog ran out of patience: restore the reference iterate and require acceptance
+         // with a regular backtracking search
+         if (this->reference_iterate.has_value()) {
+            DEBUG << "Watchdog: restoring the reference iterate\n";
+            current_iterate = std::move(*this->reference_iterate);
+            this->reference_iterate.reset();
+            // the direction was computed at the abandoned iterate: recompute it from scratch
+            warmstart_information.set_cold_start();
+            this->constraint_relaxation_strategy.compute_feasible_direction(statistics, current_iterate, this->direction, warmstart_information);
+            BacktrackingLineSearch::check_unboundedness(this->direction);
+         }
+         this->relaxed_iterations = 0;
+         this->backtrack_along_direction(statistics, model, current_iterate, trial_iterate, warmstart_information);
+      }
+   }
+} // namespace
@@ -0,0 +1,31 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_WATCHDOGLINESEARCH_H
+#define UNO_WATCHDOGLINESEARCH_H
+
+#include <optional>
+#include "BacktrackingLineSearch.hpp"
+#include "optimization/Iterate.hpp"
+
+namespace uno {
+   // watchdog line search (in the spirit of Chamberlain et al., 1982): tentatively accepts up to a
+   // fixed number of non-improving full steps before restoring the last acceptable iterate and
+   // falling back to a regular backtracking search. On well-scaled problems, full Newton steps go
+   // through without paying one acceptance test cascade per iteration
+   class WatchdogLineSearch final : public BacktrackingLineSearch {
+   public:
+      WatchdogLineSearch(ConstraintRelaxationStrategy& constraint_relaxation_strategy, const Options& options);
+
+      void compute_next_iterate(Statistics& statistics, const Model& model, Iterate& current_iterate, Iterate& trial_iterate) override;
+
+   private:
+      // number of consecutive non-improving full steps tolerated before falling back
+      const size_t maximum_relaxed_iterations;
+      size_t relaxed_iterations{0};
+      // last acceptable iterate, restored when the watchdog runs out of patience
+      std::optional<Iterate> reference_iterate{};
+   };
+} // namespace
+
+#endif // UNO_WATCHDOGLINESEARCH_H
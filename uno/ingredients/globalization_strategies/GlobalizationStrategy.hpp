@@ -4,6 +4,8 @@
 #ifndef UNO_GLOBALIZATIONSTRATEGY_H
 #define UNO_GLOBALIZATIONSTRATEGY_H
 
+#include <iosfwd>
+
 namespace uno {
    // forward declarations
    class Iterate;
@@ -29,10 +31,18 @@ namespace uno {
       virtual void notify_switch_to_feasibility(const ProgressMeasures& current_progress) = 0;
       virtual void notify_switch_to_optimality(const ProgressMeasures& current_progress) = 0;
 
+      // warm-restart snapshots: strategies with internal state (filter, funnel) override these
+      virtual void write_snapshot(std::ostream& /*stream*/) const { }
+      virtual void read_snapshot(std::istream& /*stream*/) { }
+
    protected:
       const double armijo_decrease_fraction; /*!< Sufficient reduction constant */
       const double armijo_tolerance;
       const bool protect_actual_reduction_against_roundoff;
+      // warm-started sequential solves: when set, initialize() preserves the internal state
+      // (filter/funnel upper bound) from the second call on instead of re-initializing it
+      const bool warm_start_ingredient_state;
+      bool already_initialized{false};
 
       [[nodiscard]] bool armijo_sufficient_decrease(double predicted_reduction, double actual_reduction) const;
    };
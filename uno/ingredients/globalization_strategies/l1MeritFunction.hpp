@@ -8,7 +8,7 @@
 #include "tools/Infinity.hpp"
 
 namespace uno {
-   class l1MeritFunction : public GlobalizationStrategy {
+   class l1MeritFunction final : public GlobalizationStrategy {
    public:
       explicit l1MeritFunction(const Options& options);
 
@@ -4,7 +4,7 @@
 #include <cmath>
 #include "SwitchingMethod.hpp"
 #include "../ProgressMeasures.hpp"
-#include "optimization/Iterate.hpp"
+#include "optimization/EvaluationCounters.hpp"
 #include "tools/Logger.hpp"
 #include "tools/Options.hpp"
 #include "tools/Statistics.hpp"
@@ -59,7 +59,9 @@ namespace uno {
       else {
          DEBUG << "Trial iterate (h-type) was rejected by violating the Armijo condition\n";
       }
-      Iterate::number_eval_objective--;
+      // the feasibility test does not use the objective: discount the trial objective evaluation
+      // from the counters of the solve running on this thread
+      EvaluationCounters::active->objective.fetch_sub(1, std::memory_order_relaxed);
       statistics.set("status", std::string(accept ? "accepted" : "rejected") + " (restoration)");
       return accept;
    }
@@ -19,9 +19,12 @@ namespace uno {
    }
 
    void FilterMethod::initialize(Statistics& /*statistics*/, const Iterate& initial_iterate, const Options& /*options*/) {
-      // set the filter upper bound
-      const double upper_bound = std::max(this->parameters.upper_bound, this->parameters.infeasibility_factor * initial_iterate.progress.infeasibility);
-      this->filter->set_infeasibility_upper_bound(upper_bound);
+      // set the filter upper bound, unless the state of a previous solve is carried over
+      if (not (this->warm_start_ingredient_state && this->already_initialized)) {
+         const double upper_bound = std::max(this->parameters.upper_bound, this->parameters.infeasibility_factor * initial_iterate.progress.infeasibility);
+         this->filter->set_infeasibility_upper_bound(upper_bound);
+      }
+      this->already_initialized = true;
    }
 
    void FilterMethod::reset() {
@@ -38,6 +41,14 @@ namespace uno {
       this->filter->add(current_progress.infeasibility, current_objective_measure);
    }
 
+   void FilterMethod::write_snapshot(std::ostream& stream) const {
+      this->filter->write_snapshot(stream);
+   }
+
+   void FilterMethod::read_snapshot(std::istream& stream) {
+      this->filter->read_snapshot(stream);
+   }
+
    double FilterMethod::compute_actual_objective_reduction(double current_objective_measure, double current_infeasibility, double trial_objective_measure) {
       double actual_reduction = this->filter->compute_actual_objective_reduction(current_objective_measure, current_infeasibility, trial_objective_measure);
       if (this->protect_actual_reduction_against_roundoff) {
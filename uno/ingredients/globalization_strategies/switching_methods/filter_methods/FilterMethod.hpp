@@ -31,6 +31,8 @@ namespace uno {
       void reset() override;
       void notify_switch_to_feasibility(const ProgressMeasures& current_progress) override;
       void notify_switch_to_optimality(const ProgressMeasures& current_progress) override;
+      void write_snapshot(std::ostream& stream) const override;
+      void read_snapshot(std::istream& stream) override;
 
    protected:
       // pointer to allow polymorphism
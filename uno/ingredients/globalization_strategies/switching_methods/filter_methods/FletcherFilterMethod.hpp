@@ -7,7 +7,7 @@
 #include "FilterMethod.hpp"
 
 namespace uno {
-   class FletcherFilterMethod : public FilterMethod {
+   class FletcherFilterMethod final : public FilterMethod {
    public:
       explicit FletcherFilterMethod(const Options& options);
       ~FletcherFilterMethod();
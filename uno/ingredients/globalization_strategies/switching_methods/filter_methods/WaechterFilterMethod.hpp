@@ -8,7 +8,7 @@
 #include "tools/Infinity.hpp"
 
 namespace uno {
-   class WaechterFilterMethod : public FilterMethod {
+   class WaechterFilterMethod final : public FilterMethod {
    public:
       explicit WaechterFilterMethod(const Options& options);
       ~WaechterFilterMethod();
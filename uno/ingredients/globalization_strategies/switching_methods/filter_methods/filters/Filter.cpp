@@ -54,20 +54,34 @@ namespace uno {
       }
    }
 
+   // binary search for the left-most entry whose infeasibility the trial point sufficiently reduces.
+   // The filter is a dominance staircase (infeasibility increases, objective decreases), so the
+   // predicate is monotone along the entries
+   size_t Filter::first_sufficiently_reduced_position(double trial_infeasibility) const {
+      const auto begin = this->infeasibility.cbegin();
+      const auto end = begin + static_cast<std::ptrdiff_t>(this->number_entries);
+      const auto iterator = std::partition_point(begin, end, [&](double entry_infeasibility) {
+         return not this->infeasibility_sufficient_reduction(entry_infeasibility, trial_infeasibility);
+      });
+      return static_cast<size_t>(iterator - begin);
+   }
+
    //  add (infeasibility, objective) to the filter
    void Filter::add(double current_infeasibility, double current_objective) {
       // remove dominated filter entries
-      // find position in filter without margin
-      size_t start_position = 0;
-      while (start_position < this->number_entries && this->infeasibility[start_position] < current_infeasibility) {
-         start_position++;
-      }
-
-      // find redundant entries starting from position
-      size_t end_position = start_position;
-      while (end_position < this->number_entries && current_objective <= this->objective[end_position]) {
-         end_position++;
-      }
+      // find position in filter without margin (binary search on the increasing infeasibility values)
+      const auto infeasibility_begin = this->infeasibility.cbegin();
+      const auto infeasibility_end = infeasibility_begin + static_cast<std::ptrdiff_t>(this->number_entries);
+      size_t start_position = static_cast<size_t>(std::lower_bound(infeasibility_begin, infeasibility_end, current_infeasibility) -
+            infeasibility_begin);
+
+      // find redundant entries starting from position (binary search on the decreasing objective values)
+      const auto objective_begin = this->objective.cbegin();
+      const auto objective_end = objective_begin + static_cast<std::ptrdiff_t>(this->number_entries);
+      const size_t end_position = static_cast<size_t>(std::partition_point(objective_begin + static_cast<std::ptrdiff_t>(start_position),
+            objective_end, [&](double entry_objective) {
+         return current_objective <= entry_objective;
+      }) - objective_begin);
 
       // remove entries [position:end_position] from filter
       const size_t number_redundant_entries = end_position - start_position;
@@ -85,10 +99,7 @@ namespace uno {
       }
 
       // add new entry to the filter at position
-      start_position = 0;
-      while (start_position < this->number_entries && not this->infeasibility_sufficient_reduction(this->infeasibility[start_position], current_infeasibility)) {
-         start_position++;
-      }
+      start_position = this->first_sufficiently_reduced_position(current_infeasibility);
       // shift entries by one to right to make room for new entry
       if (start_position < this->number_entries) {
          this->right_shift(start_position, 1);
@@ -111,11 +122,7 @@ namespace uno {
          return false;
       }
 
-      // TODO: use binary search
-      size_t position = 0;
-      while (position < this->number_entries && not this->infeasibility_sufficient_reduction(this->infeasibility[position], trial_infeasibility)) {
-         position++;
-      }
+      const size_t position = this->first_sufficiently_reduced_position(trial_infeasibility);
 
       // check acceptability
       if (position == 0) {
@@ -148,6 +155,23 @@ namespace uno {
       return (trial_objective <= current_objective - this->parameters.gamma * trial_infeasibility);
    }
 
+   void Filter::write_snapshot(std::ostream& stream) const {
+      stream << "filter " << this->number_entries << ' ' << this->infeasibility_upper_bound << '\n';
+      for (size_t position: Range(this->number_entries)) {
+         stream << this->infeasibility[position] << ' ' << this->objective[position] << '\n';
+      }
+   }
+
+   void Filter::read_snapshot(std::istream& stream) {
+      std::string tag{};
+      size_t snapshot_number_entries = 0;
+      stream >> tag >> snapshot_number_entries >> this->infeasibility_upper_bound;
+      this->number_entries = std::min(snapshot_number_entries, this->capacity);
+      for (size_t position: Range(this->number_entries)) {
+         stream >> this->infeasibility[position] >> this->objective[position];
+      }
+   }
+
    std::string to_string(double number) {
       std::ostringstream stream;
       stream << std::defaultfloat << std::setprecision(7) << number;
@@ -4,6 +4,7 @@
 #ifndef UNO_FILTER_H
 #define UNO_FILTER_H
 
+#include <iosfwd>
 #include <vector>
 #include <memory>
 #include "tools/Infinity.hpp"
@@ -35,6 +36,10 @@ namespace uno {
       [[nodiscard]] bool infeasibility_sufficient_reduction(double current_infeasibility, double trial_infeasibility) const;
       [[nodiscard]] bool objective_sufficient_reduction(double current_objective, double trial_objective, double trial_infeasibility) const;
 
+      // warm-restart snapshots
+      void write_snapshot(std::ostream& stream) const;
+      void read_snapshot(std::istream& stream);
+
       friend std::ostream& operator<<(std::ostream& stream, Filter& filter);
 
    protected:
@@ -47,6 +52,7 @@ namespace uno {
 
       [[nodiscard]] bool is_empty() const;
       [[nodiscard]] bool acceptable_wrt_upper_bound(double trial_infeasibility) const;
+      [[nodiscard]] size_t first_sufficiently_reduced_position(double trial_infeasibility) const;
       void left_shift(size_t start, size_t shift_size);
       void right_shift(size_t start, size_t shift_size);
    };
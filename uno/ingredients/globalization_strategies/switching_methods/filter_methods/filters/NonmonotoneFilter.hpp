@@ -7,7 +7,7 @@
 #include "Filter.hpp"
 
 namespace uno {
-   class NonmonotoneFilter : public Filter {
+   class NonmonotoneFilter final : public Filter {
    public:
       explicit NonmonotoneFilter(const Options& options);
 
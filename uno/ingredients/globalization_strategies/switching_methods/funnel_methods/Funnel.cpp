@@ -1,6 +1,8 @@
 // Copyright (c) 2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <istream>
+#include <string>
 #include "Funnel.hpp"
 #include "tools/Logger.hpp"
 #include "tools/Options.hpp"
@@ -9,7 +11,10 @@ namespace uno {
    Funnel::Funnel(const Options& options):
          margin(options.get_double("funnel_beta")),
          update_strategy(options.get_int("funnel_update_strategy")),
-         kappa(options.get_double("funnel_kappa")) {
+         kappa(options.get_double("funnel_kappa")),
+         adaptive_contraction(options.get_bool("funnel_adaptive_contraction")),
+         max_consecutive_rejections(options.get_unsigned_int("funnel_max_consecutive_rejections")),
+         relaxation_factor(options.get_double("funnel_relaxation_factor")) {
    }
 
    void Funnel::set_infeasibility_upper_bound(double new_upper_bound) {
@@ -20,6 +25,15 @@ namespace uno {
       return this->width;
    }
 
+   void Funnel::write_snapshot(std::ostream& stream) const {
+      stream << "funnel " << this->width << ' ' << this->acceptance_rate << ' ' << this->consecutive_rejections << '\n';
+   }
+
+   void Funnel::read_snapshot(std::istream& stream) {
+      std::string tag{};
+      stream >> tag >> this->width >> this->acceptance_rate >> this->consecutive_rejections;
+   }
+
    /* check if the trial iterate is inside the current funnel */
    bool Funnel::acceptable(double trial_infeasibility) const {
       return (trial_infeasibility <= this->width);
@@ -33,19 +47,19 @@ namespace uno {
    void Funnel::update(double current_infeasibility, double trial_infeasibility) {
       if (this->update_strategy == 1) {
          if (trial_infeasibility <= current_infeasibility) {
-            this->width = std::max(this->margin * this->width,
+            this->width = std::max(this->effective_margin() * this->width,
                   Funnel::convex_combination(current_infeasibility, trial_infeasibility, this->kappa));
          }
          else {
             DEBUG << "Trial infeasibility higher than current infeasibility" << '\n';
-            this->width = this->margin * this->width;
+            this->width = this->effective_margin() * this->width;
          }
       }
       else if (this->update_strategy == 2) {
          this->width = Funnel::convex_combination(this->width, trial_infeasibility, this->kappa);
       }
       else if (this->update_strategy == 3) {
-         this->width = this->margin * this->width;
+         this->width = this->effective_margin() * this->width;
       }
       else {
          throw std::runtime_error("Funnel update strategy " + std::to_string(this->update_strategy) + " is unknown.");
@@ -58,6 +72,31 @@ namespace uno {
       DEBUG << "\t\tNew funnel parameter is: " << this->width << '\n';
    }
 
+   void Funnel::record_acceptance(bool accepted) {
+      // exponentially smoothed acceptance rate over the recent trial points
+      const double smoothing = 0.9;
+      this->acceptance_rate = Funnel::convex_combination(this->acceptance_rate, accepted ? 1. : 0., smoothing);
+      if (accepted) {
+         this->consecutive_rejections = 0;
+      }
+      else {
+         this->consecutive_rejections++;
+         if (0 < this->max_consecutive_rejections && this->max_consecutive_rejections <= this->consecutive_rejections) {
+            this->width *= this->relaxation_factor;
+            this->consecutive_rejections = 0;
+            DEBUG << "\t\tRejection streak: temporarily relaxing the funnel width to " << this->width << '\n';
+         }
+      }
+   }
+
+   // the margin is relaxed towards 1 (weaker contraction) when the recent acceptance rate is low
+   double Funnel::effective_margin() const {
+      if (not this->adaptive_contraction) {
+         return this->margin;
+      }
+      return this->margin + (1. - this->margin) * (1. - this->acceptance_rate);
+   }
+
    void Funnel::print() const {
       DEBUG << "Current funnel width: " << this->width << '\n';
    }
@@ -4,6 +4,7 @@
 #ifndef UNO_FUNNEL_H
 #define UNO_FUNNEL_H
 
+#include <iosfwd>
 #include "tools/Infinity.hpp"
 
 namespace uno {
@@ -21,15 +22,30 @@ namespace uno {
       [[nodiscard]] bool sufficient_decrease_condition(double trial_infeasibility) const;
       void update(double current_infeasibility, double trial_infeasibility);
       void update_restoration(double current_infeasibility);
+      // acceptance-rate history, fed by the funnel method after each trial point: drives the
+      // adaptive contraction and the temporary relaxation after a rejection streak
+      void record_acceptance(bool accepted);
 
       void print() const;
 
+      // warm-restart snapshots
+      void write_snapshot(std::ostream& stream) const;
+      void read_snapshot(std::istream& stream);
+
    protected:
       double width{INF<double>};
       const double margin;
       const int update_strategy;
       const double kappa;
-
+      // adaptive contraction: the effective margin is relaxed towards 1 when the recent acceptance
+      // rate (exponentially smoothed) is low, so that the funnel does not collapse on noisy models
+      const bool adaptive_contraction;
+      const size_t max_consecutive_rejections;
+      const double relaxation_factor;
+      double acceptance_rate{1.};
+      size_t consecutive_rejections{0};
+
+      [[nodiscard]] double effective_margin() const;
       [[nodiscard]] static double convex_combination(double a, double b, double coefficient);
    };
 } // namespace
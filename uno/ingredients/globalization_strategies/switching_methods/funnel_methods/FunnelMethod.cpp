@@ -22,8 +22,12 @@ namespace uno {
    }
 
    void FunnelMethod::initialize(Statistics& statistics, const Iterate& initial_iterate, const Options& options) {
-      const double upper_bound = std::max(this->parameters.initial_upper_bound, this->parameters.infeasibility_factor * initial_iterate.progress.infeasibility);
-      this->funnel.set_infeasibility_upper_bound(upper_bound);
+      // set the funnel width, unless the state of a previous solve is carried over
+      if (not (this->warm_start_ingredient_state && this->already_initialized)) {
+         const double upper_bound = std::max(this->parameters.initial_upper_bound, this->parameters.infeasibility_factor * initial_iterate.progress.infeasibility);
+         this->funnel.set_infeasibility_upper_bound(upper_bound);
+      }
+      this->already_initialized = true;
       DEBUG << "Current funnel width: " << this->funnel.current_width() << '\n';
 
       statistics.add_column("funnel width", Statistics::double_width, options.get_int("statistics_funnel_width_column_order"));
@@ -88,6 +92,9 @@ namespace uno {
       }
 
       statistics.set("status", std::string(accept ? "accepted" : "rejected") + " (" + scenario + ")");
+      // feed the acceptance-rate history (may temporarily relax the funnel after a rejection streak)
+      this->funnel.record_acceptance(accept);
+      statistics.set("funnel width", this->funnel.current_width());
       if (accept) {
          this->funnel.print();
       }
@@ -111,6 +118,14 @@ namespace uno {
       this->funnel.update_restoration(current_progress_measures.infeasibility);
    }
 
+   void FunnelMethod::write_snapshot(std::ostream& stream) const {
+      this->funnel.write_snapshot(stream);
+   }
+
+   void FunnelMethod::read_snapshot(std::istream& stream) {
+      this->funnel.read_snapshot(stream);
+   }
+
    // check acceptability wrt current point
    bool FunnelMethod::acceptable_wrt_current_iterate(double current_infeasibility, double current_objective, double trial_infeasibility,
          double trial_objective) const {
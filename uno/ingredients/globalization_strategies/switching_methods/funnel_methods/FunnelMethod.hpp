@@ -26,7 +26,7 @@ namespace uno {
     *
     *  Strategy that accepts or declines a trial step
     */
-   class FunnelMethod: public SwitchingMethod {
+   class FunnelMethod final: public SwitchingMethod {
    public:
       explicit FunnelMethod(const Options& options);
       ~FunnelMethod() override = default;
@@ -37,6 +37,8 @@ namespace uno {
       void reset() override;
       void notify_switch_to_feasibility(const ProgressMeasures& current_progress_measures) override;
       void notify_switch_to_optimality(const ProgressMeasures& current_progress_measures) override;
+      void write_snapshot(std::ostream& stream) const override;
+      void read_snapshot(std::istream& stream) override;
 
       [[nodiscard]] bool acceptable_wrt_current_iterate(double current_infeasibility, double current_objective, double trial_infeasibility,
             double trial_objective) const;
@@ -23,6 +23,7 @@ namespace uno {
       this->feasibility_multipliers.reset();
       this->active_bounds.at_lower_bound.clear();
       this->active_bounds.at_upper_bound.clear();
+      this->moved_variables.reset();
    }
 
    std::string status_to_string(SubproblemStatus status) {
@@ -45,6 +45,12 @@ namespace uno {
       double subproblem_objective{INF<double>}; /*!< Objective value */
       ActiveConstraints active_bounds; /*!< Active bound constraints */
 
+      // optional sparse view of the primal direction, filled by the subproblem solver when it
+      // detects that only a few variables move (late active-set iterations): the indices of the
+      // nonzero entries of primals. The dense sweeps over the direction (trial-point assembly,
+      // step norm) then visit those entries only. Nullopt means no information (dense direction)
+      std::optional<std::vector<size_t>> moved_variables{};
+
       void set_dimensions(size_t new_number_variables, size_t new_number_constraints);
       void reset();
 
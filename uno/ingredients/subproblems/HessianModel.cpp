@@ -1,37 +1,296 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 #include "HessianModel.hpp"
+#include "linear_algebra/SparseFormatSelector.hpp"
 #include "linear_algebra/SparseStorageFactory.hpp"
+#include "optimization/Iterate.hpp"
 #include "reformulation/OptimizationProblem.hpp"
 #include "solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
 #include "solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
+#include "tools/MemoryUsage.hpp"
 #include "tools/Options.hpp"
+#include "tools/Profiler.hpp"
 #include "tools/Statistics.hpp"
 
 namespace uno {
-   HessianModel::HessianModel(size_t dimension, size_t maximum_number_nonzeros, const std::string& sparse_format, bool use_regularization) :
-         hessian(dimension, maximum_number_nonzeros, use_regularization, sparse_format) {
+   HessianModel::HessianModel(size_t dimension, size_t maximum_number_nonzeros, const std::string& sparse_format, bool use_regularization,
+         size_t compaction_iterations, double compaction_threshold) :
+         hessian(dimension, maximum_number_nonzeros, use_regularization, sparse_format),
+         compaction_iterations(compaction_iterations),
+         compaction_threshold(compaction_threshold) {
+      MemoryUsage::record(MemoryUsage::HESSIAN, this->hessian.capacity() * (sizeof(double) + 2*sizeof(SparseIndex)));
+   }
+
+   // dynamic pattern compaction: entries that are structurally present but have stayed numerically
+   // below hessian_compaction_threshold over the first hessian_compaction_iterations evaluations
+   // (inactive nonlinear terms) are dropped from the pattern handed to the factorization. The
+   // shrunken pattern triggers one re-analysis in the linear solver, which pays for itself over the
+   // remaining iterations. Diagonal entries are never dropped: the regularization writes them
+   void HessianModel::compact_vanishing_entries() {
+      if (this->compaction_iterations == 0 || (this->compaction_decided && not this->has_dropped_entries)) {
+         return;
+      }
+      // snapshot the entries in the deterministic order of the evaluation
+      this->compaction_rows.clear();
+      this->compaction_columns.clear();
+      this->compaction_values.clear();
+      this->hessian.for_each([this](SparseIndex row_index, SparseIndex column_index, double element) {
+         this->compaction_rows.emplace_back(static_cast<size_t>(row_index));
+         this->compaction_columns.emplace_back(static_cast<size_t>(column_index));
+         this->compaction_values.emplace_back(element);
+      });
+      const size_t number_entries = this->compaction_values.size();
+      if (number_entries != this->entry_magnitudes.size()) {
+         // the pattern itself changed (e.g. a phase switch): restart the tracking
+         this->entry_magnitudes.assign(number_entries, 0.);
+         this->dropped_entries.assign(number_entries, false);
+         this->tracked_evaluations = 0;
+         this->compaction_decided = false;
+         this->has_dropped_entries = false;
+      }
+      if (not this->compaction_decided) {
+         // observation phase: accumulate the per-entry magnitude maxima
+         for (size_t entry_index: Range(number_entries)) {
+            this->entry_magnitudes[entry_index] = std::max(this->entry_magnitudes[entry_index],
+                  std::abs(this->compaction_values[entry_index]));
+         }
+         this->tracked_evaluations++;
+         if (this->tracked_evaluations < this->compaction_iterations) {
+            return;
+         }
+         // decision: mark the off-diagonal entries whose magnitude never rose above the threshold
+         size_t number_dropped = 0;
+         for (size_t entry_index: Range(number_entries)) {
+            if (this->compaction_rows[entry_index] != this->compaction_columns[entry_index] &&
+                  this->entry_magnitudes[entry_index] < this->compaction_threshold) {
+               this->dropped_entries[entry_index] = true;
+               number_dropped++;
+            }
+         }
+         this->compaction_decided = true;
+         this->has_dropped_entries = (0 < number_dropped);
+         DEBUG << "Hessian compaction: " << number_dropped << " of " << number_entries << " entries dropped\n";
+         if (not this->has_dropped_entries) {
+            return;
+         }
+      }
+      // rebuild the matrix without the dropped entries, sorted by column (the insertion order
+      // expected by the compressed sparse formats)
+      this->compaction_permutation.clear();
+      for (size_t entry_index: Range(number_entries)) {
+         if (not this->dropped_entries[entry_index]) {
+            this->compaction_permutation.emplace_back(entry_index);
+         }
+      }
+      std::stable_sort(this->compaction_permutation.begin(), this->compaction_permutation.end(), [this](size_t first, size_t second) {
+         return this->compaction_columns[first] < this->compaction_columns[second];
+      });
+      const size_t dimension = this->hessian.dimension();
+      this->hessian.reset();
+      size_t position = 0;
+      for (size_t column_index: Range(dimension)) {
+         while (position < this->compaction_permutation.size() &&
+               this->compaction_columns[this->compaction_permutation[position]] == column_index) {
+            const size_t entry_index = this->compaction_permutation[position];
+            this->hessian.insert(this->compaction_values[entry_index], this->compaction_rows[entry_index], column_index);
+            position++;
+         }
+         this->hessian.finalize_column(column_index);
+      }
    }
 
    // exact Hessian
    ExactHessian::ExactHessian(size_t dimension, size_t maximum_number_nonzeros, const Options& options) :
-         HessianModel(dimension, maximum_number_nonzeros, options.get_string("sparse_format"), /* use_regularization = */false) {
+         HessianModel(dimension, maximum_number_nonzeros, SparseFormatSelector::hessian_format(options), /* use_regularization = */false,
+               options.get_unsigned_int("hessian_compaction_iterations"), options.get_double("hessian_compaction_threshold")) {
    }
 
    void ExactHessian::evaluate(Statistics& /*statistics*/, const OptimizationProblem& problem, const Vector<double>& primal_variables,
          const Vector<double>& constraint_multipliers) {
       // evaluate Lagrangian Hessian
+      const ScopedProfile profile(Profiler::EVALUATION);
       this->hessian.set_dimension(problem.number_variables);
       problem.evaluate_lagrangian_hessian(primal_variables, constraint_multipliers, this->hessian);
+      // merge possible duplicate entries before the Hessian is handed to the solvers
+      this->hessian.compress();
       this->evaluation_count++;
+      this->compact_vanishing_entries();
+   }
+
+   // lagged exact Hessian
+   LaggedExactHessian::LaggedExactHessian(size_t dimension, size_t maximum_number_nonzeros, const Options& options) :
+         HessianModel(dimension, maximum_number_nonzeros, SparseFormatSelector::hessian_format(options), /* use_regularization = */false,
+               options.get_unsigned_int("hessian_compaction_iterations"), options.get_double("hessian_compaction_threshold")),
+         max_age(options.get_unsigned_int("lagged_hessian_max_age")),
+         lagrangian_gradient(dimension) {
+   }
+
+   LaggedExactHessian::~LaggedExactHessian() = default;
+
+   void LaggedExactHessian::evaluate(Statistics& /*statistics*/, const OptimizationProblem& problem, const Vector<double>& primal_variables,
+         const Vector<double>& constraint_multipliers) {
+      const size_t number_variables = problem.number_variables;
+      const size_t number_constraints = problem.number_constraints;
+
+      // (re)allocate the scratch structures when the problem dimensions change. The cached pattern
+      // refers to a different variable space: force a fresh exact evaluation
+      if (this->scratch_iterate == nullptr || this->scratch_iterate->number_variables != number_variables ||
+            this->scratch_iterate->number_constraints != number_constraints) {
+         this->scratch_iterate = std::make_unique<Iterate>(number_variables, number_constraints);
+         this->previous_scratch_iterate = std::make_unique<Iterate>(number_variables, number_constraints);
+         this->scratch_multipliers = std::make_unique<Multipliers>(number_variables, number_constraints);
+         this->lagrangian_gradient.resize(number_variables);
+         this->scratch_constraint_jacobian = RectangularMatrix<double>(number_constraints, number_variables);
+         this->current_gradient.resize(number_variables);
+         this->s_new.resize(number_variables);
+         this->y_new.resize(number_variables);
+         this->hessian_step_product.resize(number_variables);
+         this->has_previous_iterate = false;
+      }
+
+      // keep the first-order evaluations at the current point, so that the next call can form a
+      // secant pair from consistent quantities (the gradients are cheap in the targeted deployments)
+      this->scratch_iterate->primals = primal_variables;
+      this->scratch_iterate->is_objective_gradient_computed = false;
+      this->scratch_iterate->is_constraint_jacobian_computed = false;
+      problem.evaluate_objective_gradient(*this->scratch_iterate, this->scratch_objective_gradient);
+      problem.evaluate_constraint_jacobian(*this->scratch_iterate, this->scratch_constraint_jacobian);
+      this->scratch_multipliers->constraints = constraint_multipliers;
+
+      if (not this->has_previous_iterate || this->max_age <= this->age) {
+         // pay the full exact evaluation and capture the pattern for the upcoming secant updates
+         {
+            const ScopedProfile profile(Profiler::EVALUATION);
+            this->hessian.set_dimension(number_variables);
+            problem.evaluate_lagrangian_hessian(primal_variables, constraint_multipliers, this->hessian);
+            this->hessian.compress();
+            this->evaluation_count++;
+            this->compact_vanishing_entries();
+         }
+         // the captured pattern is the compacted one: the secant updates stay on the live entries
+         this->capture_pattern();
+         this->age = 0;
+      }
+      else {
+         this->apply_secant_update(problem, number_variables);
+         this->age++;
+      }
+
+      // the current evaluations become the previous ones
+      std::swap(this->scratch_iterate, this->previous_scratch_iterate);
+      this->has_previous_iterate = true;
+   }
+
+   // snapshot the nonzeros of the freshly evaluated Hessian, sorted by column (the insertion order
+   // expected by the sparse formats when the matrix is rebuilt)
+   void LaggedExactHessian::capture_pattern() {
+      this->pattern_rows.clear();
+      this->pattern_columns.clear();
+      this->pattern_values.clear();
+      this->hessian.for_each([this](SparseIndex row_index, SparseIndex column_index, double element) {
+         this->pattern_rows.emplace_back(static_cast<size_t>(row_index));
+         this->pattern_columns.emplace_back(static_cast<size_t>(column_index));
+         this->pattern_values.emplace_back(element);
+      });
+      // stable sort by column, preserving the within-column order of the evaluation
+      std::vector<size_t> permutation(this->pattern_rows.size());
+      std::iota(permutation.begin(), permutation.end(), 0);
+      std::stable_sort(permutation.begin(), permutation.end(), [this](size_t first, size_t second) {
+         return this->pattern_columns[first] < this->pattern_columns[second];
+      });
+      std::vector<size_t> sorted_rows(this->pattern_rows.size());
+      std::vector<size_t> sorted_columns(this->pattern_rows.size());
+      std::vector<double> sorted_values(this->pattern_rows.size());
+      for (size_t entry_index: Range(permutation.size())) {
+         sorted_rows[entry_index] = this->pattern_rows[permutation[entry_index]];
+         sorted_columns[entry_index] = this->pattern_columns[permutation[entry_index]];
+         sorted_values[entry_index] = this->pattern_values[permutation[entry_index]];
+      }
+      this->pattern_rows = std::move(sorted_rows);
+      this->pattern_columns = std::move(sorted_columns);
+      this->pattern_values = std::move(sorted_values);
+   }
+
+   // symmetric Broyden (PSB) secant update restricted to the exact pattern: with s the step,
+   // y the Lagrangian gradient difference and r = y - Bs, each stored entry (i, j) receives
+   // (r_i s_j + s_i r_j)/s's - (s'r) s_i s_j/(s's)^2. Entries outside the pattern are dropped,
+   // which trades some secant accuracy for the unchanged sparse structure
+   void LaggedExactHessian::apply_secant_update(const OptimizationProblem& problem, size_t number_variables) {
+      // Lagrangian gradient at the current point
+      problem.evaluate_lagrangian_gradient(this->lagrangian_gradient, *this->scratch_iterate, *this->scratch_multipliers);
+      for (size_t variable_index: Range(number_variables)) {
+         this->current_gradient[variable_index] = this->lagrangian_gradient[variable_index];
+      }
+      // Lagrangian gradient at the previous point, reusing the evaluations kept in the previous
+      // scratch iterate, with the current multipliers
+      problem.evaluate_lagrangian_gradient(this->lagrangian_gradient, *this->previous_scratch_iterate, *this->scratch_multipliers);
+      double ss = 0.;
+      for (size_t variable_index: Range(number_variables)) {
+         this->s_new[variable_index] = this->scratch_iterate->primals[variable_index] - this->previous_scratch_iterate->primals[variable_index];
+         this->y_new[variable_index] = this->current_gradient[variable_index] - this->lagrangian_gradient[variable_index];
+         ss += this->s_new[variable_index] * this->s_new[variable_index];
+      }
+      if (ss <= LaggedExactHessian::step_size_threshold) {
+         // negligible step: the stored values are still accurate, keep them unchanged
+         DEBUG << "Lagged Hessian: the step is negligible, the secant update was skipped\n";
+         return;
+      }
+      // product Bs over the cached entries (both triangles of the symmetric pattern)
+      this->hessian_step_product.fill(0.);
+      for (size_t entry_index: Range(this->pattern_rows.size())) {
+         const size_t row_index = this->pattern_rows[entry_index];
+         const size_t column_index = this->pattern_columns[entry_index];
+         const double element = this->pattern_values[entry_index];
+         this->hessian_step_product[row_index] += element * this->s_new[column_index];
+         if (row_index != column_index) {
+            this->hessian_step_product[column_index] += element * this->s_new[row_index];
+         }
+      }
+      // residual r = y - Bs (y_new is reused to hold it) and s'r
+      double sr = 0.;
+      for (size_t variable_index: Range(number_variables)) {
+         this->y_new[variable_index] -= this->hessian_step_product[variable_index];
+         sr += this->s_new[variable_index] * this->y_new[variable_index];
+      }
+      // update the cached values and rebuild the sparse matrix from them
+      for (size_t entry_index: Range(this->pattern_rows.size())) {
+         const size_t row_index = this->pattern_rows[entry_index];
+         const size_t column_index = this->pattern_columns[entry_index];
+         const double s_i = this->s_new[row_index];
+         const double s_j = this->s_new[column_index];
+         this->pattern_values[entry_index] += (this->y_new[row_index] * s_j + s_i * this->y_new[column_index]) / ss
+               - sr * s_i * s_j / (ss * ss);
+      }
+      this->rebuild_hessian(number_variables);
+      DEBUG << "Lagged Hessian: secant update " << (this->age + 1) << '/' << this->max_age << '\n';
+   }
+
+   // reinsert the cached entries, which capture_pattern sorted by column (the order expected by
+   // the compressed sparse formats)
+   void LaggedExactHessian::rebuild_hessian(size_t number_variables) {
+      this->hessian.set_dimension(number_variables);
+      this->hessian.reset();
+      size_t entry_index = 0;
+      for (size_t column_index: Range(number_variables)) {
+         while (entry_index < this->pattern_columns.size() && this->pattern_columns[entry_index] == column_index) {
+            this->hessian.insert(this->pattern_values[entry_index], this->pattern_rows[entry_index], column_index);
+            entry_index++;
+         }
+         this->hessian.finalize_column(column_index);
+      }
    }
 
    // convexified Hessian
    ConvexifiedHessian::ConvexifiedHessian(size_t dimension, size_t maximum_number_nonzeros, const Options& options):
-         HessianModel(dimension, maximum_number_nonzeros, options.get_string("sparse_format"), /* use_regularization = */true),
+         HessianModel(dimension, maximum_number_nonzeros, SparseFormatSelector::hessian_format(options), /* use_regularization = */true,
+               options.get_unsigned_int("hessian_compaction_iterations"), options.get_double("hessian_compaction_threshold")),
          // inertia-based convexification needs a linear solver
-         linear_solver(SymmetricIndefiniteLinearSolverFactory::create(options.get_string("linear_solver"), dimension, maximum_number_nonzeros)),
+         linear_solver(SymmetricIndefiniteLinearSolverFactory::create(options.get_string("linear_solver"), dimension, maximum_number_nonzeros,
+               options)),
          regularization_initial_value(options.get_double("regularization_initial_value")),
          regularization_increase_factor(options.get_double("regularization_increase_factor")) {
    }
@@ -39,16 +298,22 @@ namespace uno {
    void ConvexifiedHessian::evaluate(Statistics& statistics, const OptimizationProblem& problem, const Vector<double>& primal_variables,
          const Vector<double>& constraint_multipliers) {
       // evaluate Lagrangian Hessian
-      this->hessian.set_dimension(problem.number_variables);
-      problem.evaluate_lagrangian_hessian(primal_variables, constraint_multipliers, this->hessian);
-      this->evaluation_count++;
+      {
+         const ScopedProfile profile(Profiler::EVALUATION);
+         this->hessian.set_dimension(problem.number_variables);
+         problem.evaluate_lagrangian_hessian(primal_variables, constraint_multipliers, this->hessian);
+         // merge possible duplicate entries before the factorizations
+         this->hessian.compress();
+         this->evaluation_count++;
+         this->compact_vanishing_entries();
+      }
       // regularize (only on the original variables) to convexify the problem
       DEBUG2 << "hessian before convexification: " << this->hessian;
       this->regularize(statistics, this->hessian, problem.get_number_original_variables());
    }
 
    // Nocedal and Wright, p51
-   void ConvexifiedHessian::regularize(Statistics& statistics, SymmetricMatrix<size_t, double>& hessian, size_t number_original_variables) {
+   void ConvexifiedHessian::regularize(Statistics& statistics, SymmetricMatrix<SparseIndex, double>& hessian, size_t number_original_variables) {
       const double smallest_diagonal_entry = hessian.smallest_diagonal_entry(number_original_variables);
       DEBUG << "The minimal diagonal entry of the matrix is " << smallest_diagonal_entry << '\n';
 
@@ -82,9 +347,217 @@ namespace uno {
       statistics.set("regularization", regularization_factor);
    }
 
+   // limited-memory quasi-Newton Hessians
+   QuasiNewtonHessian::QuasiNewtonHessian(size_t dimension, size_t memory_size, const Options& options) :
+         HessianModel(dimension, dimension /* diagonal */, SparseFormatSelector::hessian_format(options), /* use_regularization = */false),
+         memory_size(memory_size),
+         lagrangian_gradient(dimension) {
+   }
+
+   QuasiNewtonHessian::~QuasiNewtonHessian() = default;
+
+   void QuasiNewtonHessian::evaluate(Statistics& /*statistics*/, const OptimizationProblem& problem, const Vector<double>& primal_variables,
+         const Vector<double>& constraint_multipliers) {
+      const size_t number_variables = problem.number_variables;
+      const size_t number_constraints = problem.number_constraints;
+      this->hessian.set_dimension(number_variables);
+
+      // (re)allocate the scratch structures when the problem dimensions change. The history is reset,
+      // since correction pairs from a different variable space are meaningless
+      if (this->scratch_iterate == nullptr || this->scratch_iterate->number_variables != number_variables ||
+            this->scratch_iterate->number_constraints != number_constraints) {
+         this->scratch_iterate = std::make_unique<Iterate>(number_variables, number_constraints);
+         this->previous_scratch_iterate = std::make_unique<Iterate>(number_variables, number_constraints);
+         this->scratch_multipliers = std::make_unique<Multipliers>(number_variables, number_constraints);
+         this->lagrangian_gradient.resize(number_variables);
+         this->scratch_constraint_jacobian = RectangularMatrix<double>(number_constraints, number_variables);
+         this->current_gradient.resize(number_variables);
+         this->previous_gradient.resize(number_variables);
+         this->s_new.resize(number_variables);
+         this->y_new.resize(number_variables);
+         this->s_history.clear();
+         this->y_history.clear();
+         this->has_previous_iterate = false;
+      }
+
+      // evaluate the Lagrangian gradient at the current point
+      this->scratch_iterate->primals = primal_variables;
+      this->scratch_iterate->is_objective_gradient_computed = false;
+      this->scratch_iterate->is_constraint_jacobian_computed = false;
+      problem.evaluate_objective_gradient(*this->scratch_iterate, this->scratch_objective_gradient);
+      problem.evaluate_constraint_jacobian(*this->scratch_iterate, this->scratch_constraint_jacobian);
+      this->scratch_multipliers->constraints = constraint_multipliers;
+      problem.evaluate_lagrangian_gradient(this->lagrangian_gradient, *this->scratch_iterate, *this->scratch_multipliers);
+      for (size_t variable_index: Range(number_variables)) {
+         this->current_gradient[variable_index] = this->lagrangian_gradient[variable_index];
+      }
+
+      if (this->has_previous_iterate) {
+         // the Lagrangian gradient at the previous point reuses the evaluations kept in the previous
+         // scratch iterate, with the current multipliers
+         problem.evaluate_lagrangian_gradient(this->lagrangian_gradient, *this->previous_scratch_iterate, *this->scratch_multipliers);
+         double sy = 0., ss = 0., yy = 0.;
+         for (size_t variable_index: Range(number_variables)) {
+            this->s_new[variable_index] = this->scratch_iterate->primals[variable_index] - this->previous_scratch_iterate->primals[variable_index];
+            this->y_new[variable_index] = this->current_gradient[variable_index] - this->lagrangian_gradient[variable_index];
+            sy += this->s_new[variable_index] * this->y_new[variable_index];
+            ss += this->s_new[variable_index] * this->s_new[variable_index];
+            yy += this->y_new[variable_index] * this->y_new[variable_index];
+         }
+         if (this->accept_new_pair(sy, ss, yy)) {
+            this->s_history.emplace_back(this->s_new);
+            this->y_history.emplace_back(this->y_new);
+            if (this->memory_size < this->s_history.size()) {
+               this->s_history.pop_front();
+               this->y_history.pop_front();
+            }
+         }
+         else {
+            DEBUG << "Quasi-Newton: the pair was skipped (s'y = " << sy << ")\n";
+         }
+      }
+      this->rebuild_representation(number_variables);
+      this->fill_diagonal(number_variables);
+
+      // the current evaluations become the previous ones
+      std::swap(this->scratch_iterate, this->previous_scratch_iterate);
+      this->has_previous_iterate = true;
+      this->evaluation_count++;
+   }
+
+   namespace {
+      double quasi_newton_dot_product(const Vector<double>& x, const Vector<double>& y, size_t number_variables) {
+         double result = 0.;
+         for (size_t variable_index: Range(number_variables)) {
+            result += x[variable_index] * y[variable_index];
+         }
+         return result;
+      }
+   } // namespace
+
+   void QuasiNewtonHessian::apply_current_representation(const Vector<double>& vector, Vector<double>& result, size_t number_variables) const {
+      for (size_t variable_index: Range(number_variables)) {
+         result[variable_index] = this->initial_scaling * vector[variable_index];
+      }
+      for (size_t term_index: Range(this->rank_one_vectors.size())) {
+         const Vector<double>& w = this->rank_one_vectors[term_index];
+         const double factor = this->rank_one_coefficients[term_index] * quasi_newton_dot_product(w, vector, number_variables);
+         for (size_t variable_index: Range(number_variables)) {
+            result[variable_index] += factor * w[variable_index];
+         }
+      }
+   }
+
+   void QuasiNewtonHessian::fill_diagonal(size_t number_variables) {
+      this->hessian.reset();
+      for (size_t variable_index: Range(number_variables)) {
+         double entry = this->initial_scaling;
+         for (size_t term_index: Range(this->rank_one_vectors.size())) {
+            const double w_entry = this->rank_one_vectors[term_index][variable_index];
+            entry += this->rank_one_coefficients[term_index] * w_entry * w_entry;
+         }
+         this->hessian.insert(entry, variable_index, variable_index);
+         this->hessian.finalize_column(variable_index);
+      }
+   }
+
+   void QuasiNewtonHessian::compute_hessian_vector_product(const Vector<double>& vector, Vector<double>& result) const {
+      this->apply_current_representation(vector, result, vector.size());
+   }
+
+   // limited-memory BFGS Hessian
+   LBFGSHessian::LBFGSHessian(size_t dimension, const Options& options) :
+         QuasiNewtonHessian(dimension, options.get_unsigned_int("BFGS_memory_size"), options) {
+   }
+
+   // curvature condition: skip the pair if s'y is not sufficiently positive, which keeps B positive definite
+   bool LBFGSHessian::accept_new_pair(double sy, double ss, double yy) const {
+      return QuasiNewtonHessian::curvature_threshold * std::sqrt(ss * yy) < sy;
+   }
+
+   void LBFGSHessian::rebuild_representation(size_t number_variables) {
+      // initial scaling sigma = y'y / s'y of the most recent pair (Nocedal & Wright (6.20))
+      if (this->s_history.empty()) {
+         this->initial_scaling = 1.;
+      }
+      else {
+         const Vector<double>& last_s = this->s_history.back();
+         const Vector<double>& last_y = this->y_history.back();
+         this->initial_scaling = quasi_newton_dot_product(last_y, last_y, number_variables) /
+            quasi_newton_dot_product(last_s, last_y, number_variables);
+      }
+
+      // each pair contributes the terms +y y'/s'y and -u u'/s'u, where u_i = B_i s_i is computed by
+      // applying the terms of the previous pairs (O(m^2 n) for memory m)
+      this->rank_one_vectors.clear();
+      this->rank_one_coefficients.clear();
+      for (size_t pair_index: Range(this->s_history.size())) {
+         const Vector<double>& s = this->s_history[pair_index];
+         const Vector<double>& y = this->y_history[pair_index];
+         Vector<double> u(number_variables);
+         this->apply_current_representation(s, u, number_variables);
+         const double su = quasi_newton_dot_product(s, u, number_variables);
+         const double sy = quasi_newton_dot_product(s, y, number_variables);
+         this->rank_one_vectors.emplace_back(y);
+         this->rank_one_coefficients.emplace_back(1. / sy);
+         this->rank_one_vectors.emplace_back(std::move(u));
+         this->rank_one_coefficients.emplace_back(-1. / su);
+      }
+   }
+
+   // limited-memory SR1 Hessian
+   SR1Hessian::SR1Hessian(size_t dimension, const Options& options) :
+         QuasiNewtonHessian(dimension, options.get_unsigned_int("SR1_memory_size"), options) {
+   }
+
+   // SR1 tolerates negative curvature: every pair enters the history, the skipping decision is taken
+   // term by term during the rebuild
+   bool SR1Hessian::accept_new_pair(double /*sy*/, double /*ss*/, double /*yy*/) const {
+      return true;
+   }
+
+   void SR1Hessian::rebuild_representation(size_t number_variables) {
+      // initial scaling sigma = y'y / s'y of the most recent pair when the curvature is positive,
+      // identity otherwise (sigma must stay positive for a sensible initial matrix)
+      this->initial_scaling = 1.;
+      if (not this->s_history.empty()) {
+         const Vector<double>& last_s = this->s_history.back();
+         const Vector<double>& last_y = this->y_history.back();
+         const double sy = quasi_newton_dot_product(last_s, last_y, number_variables);
+         if (0. < sy) {
+            this->initial_scaling = quasi_newton_dot_product(last_y, last_y, number_variables) / sy;
+         }
+      }
+
+      // each pair contributes the single term v v'/v's with v_i = y_i - B_i s_i, skipped when v's is
+      // too small relative to ||s|| ||v|| (Nocedal & Wright (6.26)): this rules out the unbounded
+      // updates, while negative v's (indefiniteness) is perfectly acceptable
+      this->rank_one_vectors.clear();
+      this->rank_one_coefficients.clear();
+      for (size_t pair_index: Range(this->s_history.size())) {
+         const Vector<double>& s = this->s_history[pair_index];
+         const Vector<double>& y = this->y_history[pair_index];
+         Vector<double> v(number_variables);
+         this->apply_current_representation(s, v, number_variables);
+         for (size_t variable_index: Range(number_variables)) {
+            v[variable_index] = y[variable_index] - v[variable_index];
+         }
+         const double vs = quasi_newton_dot_product(v, s, number_variables);
+         const double norm_s = std::sqrt(quasi_newton_dot_product(s, s, number_variables));
+         const double norm_v = std::sqrt(quasi_newton_dot_product(v, v, number_variables));
+         if (QuasiNewtonHessian::curvature_threshold * norm_s * norm_v < std::abs(vs)) {
+            this->rank_one_vectors.emplace_back(std::move(v));
+            this->rank_one_coefficients.emplace_back(1. / vs);
+         }
+         else {
+            DEBUG << "SR1: the update was skipped (v's = " << vs << ")\n";
+         }
+      }
+   }
+
    // zero Hessian
    ZeroHessian::ZeroHessian(size_t dimension, const Options& options) :
-         HessianModel(dimension, 0, options.get_string("sparse_format"), /* use_regularization = */false) {
+         HessianModel(dimension, 0, SparseFormatSelector::hessian_format(options), /* use_regularization = */false) {
       std::cout << "Current zero Hessian:\n" << this->hessian << '\n';
    }
 
@@ -4,14 +4,19 @@
 #ifndef UNO_HESSIANMODEL_H
 #define UNO_HESSIANMODEL_H
 
+#include <deque>
 #include <memory>
 #include <vector>
 #include "linear_algebra/SymmetricMatrix.hpp"
+#include "linear_algebra/RectangularMatrix.hpp"
+#include "optimization/LagrangianGradient.hpp"
+#include "optimization/Multipliers.hpp"
 
 namespace uno {
    // forward declarations
    template <typename IndexType, typename NumericalType>
    class DirectSymmetricIndefiniteLinearSolver;
+   class Iterate;
    class OptimizationProblem;
    class Options;
    class Statistics;
@@ -20,18 +25,36 @@ namespace uno {
 
    class HessianModel {
    public:
-      HessianModel(size_t dimension, size_t maximum_number_nonzeros, const std::string& sparse_format, bool use_regularization);
+      HessianModel(size_t dimension, size_t maximum_number_nonzeros, const std::string& sparse_format, bool use_regularization,
+            size_t compaction_iterations = 0, double compaction_threshold = 0.);
       virtual ~HessianModel() = default;
 
-      SymmetricMatrix<size_t, double> hessian;
+      SymmetricMatrix<SparseIndex, double> hessian;
       size_t evaluation_count{0};
 
       virtual void evaluate(Statistics& statistics, const OptimizationProblem& problem, const Vector<double>& primal_variables,
             const Vector<double>& constraint_multipliers) = 0;
+
+   protected:
+      // dynamic pattern compaction (see compact_vanishing_entries)
+      const size_t compaction_iterations; /*!< Number of observed evaluations before compacting (0 to disable) */
+      const double compaction_threshold; /*!< Entries that stayed below it are dropped */
+      std::vector<double> entry_magnitudes{}; /*!< Running per-entry magnitude maxima, in evaluation order */
+      std::vector<bool> dropped_entries{};
+      size_t tracked_evaluations{0};
+      bool compaction_decided{false};
+      bool has_dropped_entries{false};
+      // scratch of the compaction passes, reused across evaluations
+      std::vector<size_t> compaction_rows{};
+      std::vector<size_t> compaction_columns{};
+      std::vector<double> compaction_values{};
+      std::vector<size_t> compaction_permutation{};
+
+      void compact_vanishing_entries();
    };
 
    // exact Hessian
-   class ExactHessian : public HessianModel {
+   class ExactHessian final : public HessianModel {
    public:
       ExactHessian(size_t dimension, size_t maximum_number_nonzeros, const Options& options);
 
@@ -39,8 +62,50 @@ namespace uno {
             const Vector<double>& constraint_multipliers) override;
    };
 
+   // lagged exact Hessian: the exact Hessian is evaluated every lagged_hessian_max_age + 1
+   // iterations; in between, the stored values receive cheap symmetric Broyden (PSB-style) secant
+   // updates restricted to the exact sparsity pattern. Targets the same evaluation-bound
+   // deployments as the limited-memory models, but keeps the sparse exact structure that the
+   // trust-region configurations rely on
+   class LaggedExactHessian final : public HessianModel {
+   public:
+      LaggedExactHessian(size_t dimension, size_t maximum_number_nonzeros, const Options& options);
+      ~LaggedExactHessian() override;
+
+      void evaluate(Statistics& statistics, const OptimizationProblem& problem, const Vector<double>& primal_variables,
+            const Vector<double>& constraint_multipliers) override;
+
+   protected:
+      const size_t max_age; /*!< Maximum number of secant updates between two exact evaluations */
+      size_t age{0};
+      // pattern and values of the last exact Hessian, sorted by column; the secant updates modify
+      // the values in place and the sparse matrix is rebuilt from them
+      std::vector<size_t> pattern_rows{};
+      std::vector<size_t> pattern_columns{};
+      std::vector<double> pattern_values{};
+      // scratch space for the gradient evaluations, in the manner of QuasiNewtonHessian: the secant
+      // pair (s, y) is formed with consistent multipliers from the evaluations kept at the previous point
+      bool has_previous_iterate{false};
+      std::unique_ptr<Iterate> scratch_iterate{};
+      std::unique_ptr<Iterate> previous_scratch_iterate{};
+      std::unique_ptr<Multipliers> scratch_multipliers{};
+      LagrangianGradient<double> lagrangian_gradient;
+      SparseVector<double> scratch_objective_gradient{};
+      RectangularMatrix<double> scratch_constraint_jacobian{0, 0};
+      Vector<double> current_gradient{};
+      Vector<double> s_new{};
+      Vector<double> y_new{};
+      Vector<double> hessian_step_product{};
+
+      static constexpr double step_size_threshold{1e-16};
+
+      void capture_pattern();
+      void apply_secant_update(const OptimizationProblem& problem, size_t number_variables);
+      void rebuild_hessian(size_t number_variables);
+   };
+
    // Hessian with convexification (inertia correction)
-   class ConvexifiedHessian : public HessianModel {
+   class ConvexifiedHessian final : public HessianModel {
    public:
       ConvexifiedHessian(size_t dimension, size_t maximum_number_nonzeros, const Options& options);
 
@@ -48,15 +113,88 @@ namespace uno {
             const Vector<double>& constraint_multipliers) override;
 
    protected:
-      std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<size_t, double>> linear_solver; /*!< Solver that computes the inertia */
+      std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> linear_solver; /*!< Solver that computes the inertia */
       const double regularization_initial_value{};
       const double regularization_increase_factor{};
 
-      void regularize(Statistics& statistics, SymmetricMatrix<size_t, double>& hessian, size_t number_original_variables);
+      void regularize(Statistics& statistics, SymmetricMatrix<SparseIndex, double>& hessian, size_t number_original_variables);
+   };
+
+   // limited-memory quasi-Newton Hessians: the Lagrangian Hessian is approximated from gradient
+   // differences, which avoids the (possibly very expensive) exact Hessian evaluations altogether.
+   // The approximation B = sigma I + low-rank corrections is kept as a list of weighted rank-one
+   // terms and is never formed densely: the sparse matrix exposes its exact diagonal, while the full
+   // operator is available through compute_hessian_vector_product(). The update rule (BFGS or SR1)
+   // is supplied by the derived classes
+   class QuasiNewtonHessian : public HessianModel {
+   public:
+      QuasiNewtonHessian(size_t dimension, size_t memory_size, const Options& options);
+      ~QuasiNewtonHessian() override;
+
+      void evaluate(Statistics& statistics, const OptimizationProblem& problem, const Vector<double>& primal_variables,
+            const Vector<double>& constraint_multipliers) override;
+      // apply the full limited-memory approximation (including the low-rank corrections) to a vector
+      void compute_hessian_vector_product(const Vector<double>& vector, Vector<double>& result) const;
+
+   protected:
+      const size_t memory_size;
+      // most recent correction pairs (s, y) = (step difference, Lagrangian gradient difference)
+      std::deque<Vector<double>> s_history{};
+      std::deque<Vector<double>> y_history{};
+      // unified low-rank representation, rebuilt after each update: B = sigma I + sum_i c_i w_i w_i'
+      std::vector<Vector<double>> rank_one_vectors{};
+      std::vector<double> rank_one_coefficients{};
+      double initial_scaling{1.};
+
+      // scratch space for the gradient evaluations: the scratch iterates hold the evaluations at the
+      // current and the previous point, so that y = grad L(x_k, multipliers_k) - grad L(x_{k-1}, multipliers_k)
+      // is formed with consistent multipliers and without re-evaluating anything at the previous point
+      bool has_previous_iterate{false};
+      std::unique_ptr<Iterate> scratch_iterate{};
+      std::unique_ptr<Iterate> previous_scratch_iterate{};
+      std::unique_ptr<Multipliers> scratch_multipliers{};
+      LagrangianGradient<double> lagrangian_gradient;
+      SparseVector<double> scratch_objective_gradient{};
+      RectangularMatrix<double> scratch_constraint_jacobian{0, 0};
+      Vector<double> current_gradient{};
+      Vector<double> previous_gradient{};
+      Vector<double> s_new{};
+      Vector<double> y_new{};
+
+      static constexpr double curvature_threshold{1e-8};
+
+      // whether the new pair enters the history (update-rule specific)
+      [[nodiscard]] virtual bool accept_new_pair(double sy, double ss, double yy) const = 0;
+      // rebuild the rank-one terms from the pair history (update-rule specific)
+      virtual void rebuild_representation(size_t number_variables) = 0;
+      // apply the terms accumulated so far (sigma I and the current rank-one list) to a vector
+      void apply_current_representation(const Vector<double>& vector, Vector<double>& result, size_t number_variables) const;
+      void fill_diagonal(size_t number_variables);
+   };
+
+   // limited-memory BFGS: positive definite by construction, pairs with negative curvature are skipped
+   class LBFGSHessian final : public QuasiNewtonHessian {
+   public:
+      LBFGSHessian(size_t dimension, const Options& options);
+
+   protected:
+      [[nodiscard]] bool accept_new_pair(double sy, double ss, double yy) const override;
+      void rebuild_representation(size_t number_variables) override;
+   };
+
+   // limited-memory SR1: possibly indefinite, but a better curvature approximation than BFGS.
+   // Intended for the trust-region globalization, which handles indefiniteness natively
+   class SR1Hessian final : public QuasiNewtonHessian {
+   public:
+      SR1Hessian(size_t dimension, const Options& options);
+
+   protected:
+      [[nodiscard]] bool accept_new_pair(double sy, double ss, double yy) const override;
+      void rebuild_representation(size_t number_variables) override;
    };
 
    // zero Hessian
-   class ZeroHessian : public HessianModel {
+   class ZeroHessian final : public HessianModel {
    public:
       ZeroHessian(size_t dimension, const Options& options);
 
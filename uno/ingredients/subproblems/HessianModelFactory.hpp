@@ -26,6 +26,22 @@ namespace uno {
             return std::make_unique<ExactHessian>(dimension, maximum_number_nonzeros, options);
          }
       }
+      else if (hessian_model == "lagged_exact") {
+         if (convexify) {
+            // the secant updates would destroy the inertia correction; the model targets the
+            // trust-region configurations, which handle indefiniteness natively
+            throw std::invalid_argument("The lagged_exact Hessian model cannot be combined with convexification");
+         }
+         return std::make_unique<LaggedExactHessian>(dimension, maximum_number_nonzeros, options);
+      }
+      else if (hessian_model == "BFGS") {
+         // the limited-memory approximation is positive definite by construction: no convexification needed
+         return std::make_unique<LBFGSHessian>(dimension, options);
+      }
+      else if (hessian_model == "SR1") {
+         // possibly indefinite: intended for the trust-region globalization, which bounds the step anyway
+         return std::make_unique<SR1Hessian>(dimension, options);
+      }
       else if (hessian_model == "zero") {
          return std::make_unique<ZeroHessian>(dimension, options);
       }
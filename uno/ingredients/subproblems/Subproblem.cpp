@@ -2,11 +2,13 @@
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
 #include "Subproblem.hpp"
+#include "tools/Options.hpp"
 
 namespace uno {
    Subproblem::Subproblem(const std::string& hessian_model, size_t dimension, size_t number_hessian_nonzeros, bool convexify,
          const Options& options) :
-         hessian_model(HessianModelFactory::create(hessian_model, dimension, number_hessian_nonzeros, convexify, options)) {
+         hessian_model(HessianModelFactory::create(hessian_model, dimension, number_hessian_nonzeros, convexify, options)),
+         solve_tolerance(options.get_double("tolerance")) {
    }
 
    void Subproblem::set_trust_region_radius(double new_trust_region_radius) {
@@ -14,7 +16,12 @@ namespace uno {
       this->trust_region_radius = new_trust_region_radius;
    }
 
-   const SymmetricMatrix<size_t, double>& Subproblem::get_lagrangian_hessian() const {
+   void Subproblem::set_solve_tolerance(double new_solve_tolerance) {
+      assert(0. < new_solve_tolerance && "The solve tolerance should be positive.");
+      this->solve_tolerance = new_solve_tolerance;
+   }
+
+   const SymmetricMatrix<SparseIndex, double>& Subproblem::get_lagrangian_hessian() const {
       return this->hessian_model->hessian;
    }
 
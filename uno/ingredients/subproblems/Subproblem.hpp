@@ -7,6 +7,7 @@
 #include <cassert>
 #include <vector>
 #include "HessianModelFactory.hpp"
+#include "linear_algebra/SparseIndex.hpp"
 #include "tools/Infinity.hpp"
 
 namespace uno {
@@ -39,15 +40,24 @@ namespace uno {
       virtual void generate_initial_iterate(const OptimizationProblem& problem, Iterate& initial_iterate) = 0;
       virtual void solve(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate, const Multipliers& current_multipliers,
             Direction& direction, const WarmstartInformation& warmstart_information) = 0;
+      // second-order correction (against the Maratos effect): correct the direction by re-solving against the
+      // existing factorization, with the constraints re-evaluated at the rejected trial iterate. Subproblems
+      // that do not implement a correction return false
+      [[nodiscard]] virtual bool compute_second_order_correction(const OptimizationProblem& /*problem*/, Iterate& /*current_iterate*/,
+            const Multipliers& /*current_multipliers*/, Iterate& /*trial_iterate*/, Direction& /*direction*/) {
+         return false;
+      }
 
       void set_trust_region_radius(double new_trust_region_radius);
+      // inexactness ladder: accuracy to which the subproblem (or its inner linear systems) is solved
+      void set_solve_tolerance(double new_solve_tolerance);
       virtual void initialize_feasibility_problem(const l1RelaxedProblem& problem, Iterate& current_iterate) = 0;
       virtual void set_elastic_variable_values(const l1RelaxedProblem& problem, Iterate& current_iterate) = 0;
       [[nodiscard]] virtual double proximal_coefficient(const Iterate& current_iterate) const = 0;
       virtual void exit_feasibility_problem(const OptimizationProblem& problem, Iterate& trial_iterate) = 0;
 
       // progress measures
-      [[nodiscard]] const SymmetricMatrix<size_t, double>& get_lagrangian_hessian() const;
+      [[nodiscard]] const SymmetricMatrix<SparseIndex, double>& get_lagrangian_hessian() const;
       virtual void set_auxiliary_measure(const Model& model, Iterate& iterate) = 0;
       [[nodiscard]] virtual double compute_predicted_auxiliary_reduction_model(const Model& model, const Iterate& current_iterate,
             const Vector<double>& primal_direction, double step_length) const = 0;
@@ -64,6 +74,7 @@ namespace uno {
    protected:
       const std::unique_ptr<HessianModel> hessian_model; /*!< Strategy to evaluate or approximate the Hessian */
       double trust_region_radius{INF<double>};
+      double solve_tolerance;
    };
 } // namespace
 
@@ -30,6 +30,11 @@ namespace uno {
          return std::make_unique<PrimalDualInteriorPointSubproblem>(number_variables, number_constraints, number_jacobian_nonzeros,
                number_hessian_nonzeros, options);
       }
+      // interior-point method with a Mehrotra-style second-order corrector
+      else if (subproblem_strategy == "primal_dual_interior_point_predictor_corrector") {
+         return std::make_unique<PrimalDualInteriorPointSubproblem>(number_variables, number_constraints, number_jacobian_nonzeros,
+               number_hessian_nonzeros, options, true);
+      }
       throw std::invalid_argument("Subproblem strategy " + subproblem_strategy + " is not supported");
    }
 
@@ -41,6 +46,7 @@ namespace uno {
       }
       if (not SymmetricIndefiniteLinearSolverFactory::available_solvers().empty()) {
          strategies.emplace_back("primal_dual_interior_point");
+         strategies.emplace_back("primal_dual_interior_point_predictor_corrector");
       }
       return strategies;
    }
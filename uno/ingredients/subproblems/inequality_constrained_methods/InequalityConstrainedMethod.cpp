@@ -1,11 +1,17 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
+#include <cmath>
 #include "InequalityConstrainedMethod.hpp"
 #include "ingredients/subproblems/Direction.hpp"
+#include "linear_algebra/Norm.hpp"
 #include "linear_algebra/Vector.hpp"
 #include "reformulation/l1RelaxedProblem.hpp"
+#include "solvers/LPSolver.hpp"
+#include "tools/MemoryUsage.hpp"
 #include "tools/Options.hpp"
+#include "tools/Statistics.hpp"
 #include "symbolic/VectorView.hpp"
 
 namespace uno {
@@ -20,9 +26,56 @@ namespace uno {
          objective_gradient(number_variables),
          constraints(number_constraints),
          constraint_jacobian(number_constraints, number_variables) {
+      MemoryUsage::record(MemoryUsage::JACOBIAN, this->constraint_jacobian.memory_footprint());
    }
 
-   void InequalityConstrainedMethod::initialize_statistics(Statistics& /*statistics*/, const Options& /*options*/) {
+   void InequalityConstrainedMethod::initialize_statistics(Statistics& statistics, const Options& options) {
+      statistics.add_column("AS hits", Statistics::double_width, options.get_int("statistics_active_set_hits_column_order"));
+   }
+
+   void InequalityConstrainedMethod::predict_working_set(const OptimizationProblem& problem, LPSolver& solver) {
+      this->predicted_working_set.clear();
+      for (const WorkingSetMemory& memory: this->working_set_memory) {
+         if (memory.number_variables == problem.number_variables && memory.number_constraints == problem.number_constraints) {
+            solver.load_working_set_estimate(memory.working_set);
+            this->predicted_working_set = memory.working_set;
+            return;
+         }
+      }
+   }
+
+   void InequalityConstrainedMethod::update_working_set_memory(Statistics& statistics, const OptimizationProblem& problem, const LPSolver& solver,
+         const Direction& direction) {
+      if (direction.status != SubproblemStatus::OPTIMAL) {
+         return;
+      }
+      solver.get_working_set(this->solution_working_set);
+      if (this->solution_working_set.empty()) {
+         // the solver does not expose its working set
+         return;
+      }
+      // fraction of the prediction that was confirmed by the solve
+      if (not this->predicted_working_set.empty()) {
+         statistics.set("AS hits", InequalityConstrainedMethod::working_set_agreement(this->predicted_working_set, this->solution_working_set));
+      }
+      // cache the optimal working set for the next solve of a problem with the same dimensions
+      for (WorkingSetMemory& memory: this->working_set_memory) {
+         if (memory.number_variables == problem.number_variables && memory.number_constraints == problem.number_constraints) {
+            memory.working_set = this->solution_working_set;
+            return;
+         }
+      }
+      this->working_set_memory.push_back({problem.number_variables, problem.number_constraints, this->solution_working_set});
+   }
+
+   // fraction of entries (index and bound side) common to both working sets
+   double InequalityConstrainedMethod::working_set_agreement(std::vector<int> first, std::vector<int> second) {
+      std::sort(first.begin(), first.end());
+      std::sort(second.begin(), second.end());
+      std::vector<int> intersection;
+      intersection.reserve(first.size());
+      std::set_intersection(first.cbegin(), first.cend(), second.cbegin(), second.cend(), std::back_inserter(intersection));
+      return static_cast<double>(intersection.size()) / static_cast<double>(std::max<size_t>(1, first.size()));
    }
 
    void InequalityConstrainedMethod::set_initial_point(const Vector<double>& point) {
@@ -81,6 +134,20 @@ namespace uno {
       view(direction_multipliers.upper_bounds, 0, current_multipliers.upper_bounds.size()) -= current_multipliers.upper_bounds;
    }
 
+   double InequalityConstrainedMethod::compute_direction_norm(const Direction& direction, size_t number_variables) {
+      if (direction.moved_variables.has_value()) {
+         // sparse direction: the unmoved entries are 0 and do not contribute to the norm
+         double norm = 0.;
+         for (size_t variable_index: *direction.moved_variables) {
+            if (variable_index < number_variables) {
+               norm = std::max(norm, std::abs(direction.primals[variable_index]));
+            }
+         }
+         return norm;
+      }
+      return norm_inf(view(direction.primals, 0, number_variables));
+   }
+
    // auxiliary measure is 0 in inequality-constrained methods
    void InequalityConstrainedMethod::set_auxiliary_measure(const Model& /*model*/, Iterate& iterate) {
       iterate.progress.auxiliary = 0.;
@@ -10,6 +10,9 @@
 #include "linear_algebra/Vector.hpp"
 
 namespace uno {
+   // forward declaration
+   class LPSolver;
+
    class InequalityConstrainedMethod : public Subproblem {
    public:
       InequalityConstrainedMethod(const std::string& hessian_model, size_t number_variables, size_t number_constraints,
@@ -39,9 +42,28 @@ namespace uno {
       std::vector<double> constraints; /*!< Constraint values (size \f$m)\f$ */
       RectangularMatrix<double> constraint_jacobian; /*!< Sparse Jacobian of the constraints */
 
+      // cross-iteration active-set memory: near convergence, the optimal working set is essentially
+      // static. The optimality and the feasibility problems alternate within the same solver instance,
+      // so one working set is cached per problem dimensions
+      struct WorkingSetMemory {
+         size_t number_variables;
+         size_t number_constraints;
+         std::vector<int> working_set;
+      };
+      std::vector<WorkingSetMemory> working_set_memory{};
+      std::vector<int> predicted_working_set{};
+      std::vector<int> solution_working_set{};
+
+      void predict_working_set(const OptimizationProblem& problem, LPSolver& solver);
+      void update_working_set_memory(Statistics& statistics, const OptimizationProblem& problem, const LPSolver& solver, const Direction& direction);
+      [[nodiscard]] static double working_set_agreement(std::vector<int> first, std::vector<int> second);
+
       void set_direction_bounds(const OptimizationProblem& problem, const Iterate& current_iterate);
       void set_linearized_constraint_bounds(const OptimizationProblem& problem, const std::vector<double>& current_constraints);
       static void compute_dual_displacements(const Multipliers& current_multipliers, Multipliers& direction_multipliers);
+      // infinity norm of the direction over the first number_variables entries, restricted to the
+      // moved entries when the solver produced a sparse view of the direction
+      [[nodiscard]] static double compute_direction_norm(const Direction& direction, size_t number_variables);
    };
 } // namespace
 
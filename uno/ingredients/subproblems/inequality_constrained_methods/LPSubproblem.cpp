@@ -4,11 +4,14 @@
 #include "LPSubproblem.hpp"
 #include "ingredients/subproblems/Direction.hpp"
 #include "linear_algebra/COOSparseStorage.hpp"
+#include "linear_algebra/Norm.hpp"
 #include "optimization/WarmstartInformation.hpp"
 #include "reformulation/OptimizationProblem.hpp"
 #include "solvers/LPSolver.hpp"
 #include "solvers/LPSolverFactory.hpp"
+#include "symbolic/VectorView.hpp"
 #include "tools/Options.hpp"
+#include "tools/Profiler.hpp"
 
 namespace uno {
    LPSubproblem::LPSubproblem(size_t number_variables, size_t number_constraints, size_t number_objective_gradient_nonzeros,
@@ -16,7 +19,7 @@ namespace uno {
          InequalityConstrainedMethod("zero", number_variables, number_constraints, 0, false, options),
          solver(LPSolverFactory::create(options.get_string("LP_solver"), number_variables, number_constraints,
                number_objective_gradient_nonzeros, number_jacobian_nonzeros, options)),
-         zero_hessian(SymmetricMatrix<size_t, double>::zero(number_variables)) {
+         zero_hessian(SymmetricMatrix<SparseIndex, double>::zero(number_variables)) {
    }
 
    void LPSubproblem::generate_initial_iterate(const OptimizationProblem& /*problem*/, Iterate& /*initial_iterate*/) {
@@ -34,7 +37,7 @@ namespace uno {
       }
    }
 
-   void LPSubproblem::solve(Statistics& /*statistics*/, const OptimizationProblem& problem, Iterate& current_iterate,  const Multipliers& current_multipliers,
+   void LPSubproblem::solve(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate,  const Multipliers& current_multipliers,
          Direction& direction, const WarmstartInformation& warmstart_information) {
       // evaluate the functions at the current iterate
       this->evaluate_functions(problem, current_iterate, warmstart_information);
@@ -49,11 +52,18 @@ namespace uno {
          this->set_linearized_constraint_bounds(problem, this->constraints);
       }
 
+      // seed the solver with the cached active-set prediction
+      this->predict_working_set(problem, *this->solver);
+
       // solve the LP
+      const ScopedProfile profile(Profiler::SOLVE);
       this->solver->solve_LP(problem.number_variables, problem.number_constraints, this->direction_lower_bounds, this->direction_upper_bounds,
             this->linearized_constraints_lower_bounds, this->linearized_constraints_upper_bounds, this->objective_gradient,
             this->constraint_jacobian, this->initial_point, direction, warmstart_information);
+      this->update_working_set_memory(statistics, problem, *this->solver, direction);
       InequalityConstrainedMethod::compute_dual_displacements(current_multipliers, direction.multipliers);
+      // the subproblem reports the norm of the direction over the original model variables
+      direction.norm = InequalityConstrainedMethod::compute_direction_norm(direction, problem.get_number_original_variables());
       this->number_subproblems_solved++;
       // reset the initial point
       this->initial_point.fill(0.);
@@ -12,7 +12,7 @@ namespace uno {
    // forward reference
    class LPSolver;
 
-   class LPSubproblem : public InequalityConstrainedMethod {
+   class LPSubproblem final : public InequalityConstrainedMethod {
    public:
       LPSubproblem(size_t number_variables, size_t number_constraints, size_t number_objective_gradient_nonzeros, size_t number_jacobian_nonzeros,
             const Options& options);
@@ -24,7 +24,7 @@ namespace uno {
    private:
       // pointer to allow polymorphism
       const std::unique_ptr<LPSolver> solver; /*!< Solver that solves the subproblem */
-      const SymmetricMatrix<size_t, double> zero_hessian;
+      const SymmetricMatrix<SparseIndex, double> zero_hessian;
 
       void evaluate_functions(const OptimizationProblem& problem, Iterate& current_iterate, const WarmstartInformation& warmstart_information);
    };
@@ -4,6 +4,7 @@
 #include "QPSubproblem.hpp"
 #include "ingredients/subproblems/Direction.hpp"
 #include "ingredients/subproblems/HessianModelFactory.hpp"
+#include "linear_algebra/Norm.hpp"
 #include "linear_algebra/SymmetricMatrix.hpp"
 #include "optimization/Iterate.hpp"
 #include "optimization/WarmstartInformation.hpp"
@@ -12,7 +13,10 @@
 #include "solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
 #include "solvers/QPSolver.hpp"
 #include "solvers/QPSolverFactory.hpp"
+#include "symbolic/VectorView.hpp"
+#include "tools/Logger.hpp"
 #include "tools/Options.hpp"
+#include "tools/Profiler.hpp"
 #include "tools/Statistics.hpp"
 
 namespace uno {
@@ -22,15 +26,19 @@ namespace uno {
                options.get_string("globalization_mechanism") == "LS", options),
          use_regularization(options.get_string("globalization_mechanism") != "TR" || options.get_bool("convexify_QP")),
          enforce_linear_constraints_at_initial_iterate(options.get_bool("enforce_linear_constraints")),
+         linear_feasibility_tolerance(options.get_double("tolerance")),
          // maximum number of Hessian nonzeros = number nonzeros + possible diagonal inertia correction
          solver(QPSolverFactory::create(options.get_string("QP_solver"), number_variables, number_constraints,
                number_objective_gradient_nonzeros, number_jacobian_nonzeros,
                // if the QP solver is used during preprocessing, we need to allocate the Hessian with at least number_variables elements
                std::max(this->enforce_linear_constraints_at_initial_iterate ? number_variables : 0, hessian_model->hessian.capacity()),
-               options)) {
+               options)),
+         use_initial_LP_phase(options.get_bool("QP_initial_LP_phase")),
+         LP_phase_active(this->use_initial_LP_phase) {
    }
 
    void QPSubproblem::initialize_statistics(Statistics& statistics, const Options& options) {
+      InequalityConstrainedMethod::initialize_statistics(statistics, options);
       if (this->use_regularization) {
          statistics.add_column("regularization", Statistics::double_width, options.get_int("statistics_regularization_column_order"));
       }
@@ -38,15 +46,21 @@ namespace uno {
 
    void QPSubproblem::generate_initial_iterate(const OptimizationProblem& problem, Iterate& initial_iterate) {
       if (this->enforce_linear_constraints_at_initial_iterate) {
-         Preprocessing::enforce_linear_constraints(problem.model, initial_iterate.primals, initial_iterate.multipliers, *this->solver);
+         Preprocessing::enforce_linear_constraints(problem.model, initial_iterate.primals, initial_iterate.multipliers, *this->solver,
+               this->linear_feasibility_tolerance);
       }
    }
 
    void QPSubproblem::evaluate_functions(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate,
          const Multipliers& current_multipliers, const WarmstartInformation& warmstart_information) {
-      // Lagrangian Hessian
+      // Lagrangian Hessian (evaluated lazily: the LP phase never needs it, and the QP taking over
+      // after a rejected LP step evaluates it at that point)
       if (warmstart_information.objective_changed || warmstart_information.constraints_changed) {
+         this->hessian_is_current = false;
+      }
+      if (not this->LP_phase_active && not this->hessian_is_current) {
          this->hessian_model->evaluate(statistics, problem, current_iterate.primals, current_multipliers.constraints);
+         this->hessian_is_current = true;
       }
       // objective gradient, constraints and constraint Jacobian
       if (warmstart_information.objective_changed) {
@@ -60,6 +74,13 @@ namespace uno {
 
    void QPSubproblem::solve(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate,  const Multipliers& current_multipliers,
          Direction& direction, const WarmstartInformation& warmstart_information) {
+      // a re-solve without fresh function evaluations means that the previous direction was rejected:
+      // the first rejected LP step ends the LP phase, the QP takes over from here on
+      if (this->LP_phase_active && not (warmstart_information.objective_changed || warmstart_information.constraints_changed)) {
+         DEBUG << "QP subproblem: the LP step was rejected, ending the LP phase\n";
+         this->LP_phase_active = false;
+      }
+
       // evaluate the functions at the current iterate
       this->evaluate_functions(statistics, problem, current_iterate, current_multipliers, warmstart_information);
 
@@ -73,11 +94,25 @@ namespace uno {
          this->set_linearized_constraint_bounds(problem, this->constraints);
       }
 
-      // solve the QP
-      this->solver->solve_QP(problem.number_variables, problem.number_constraints, this->direction_lower_bounds, this->direction_upper_bounds,
-            this->linearized_constraints_lower_bounds, this->linearized_constraints_upper_bounds, this->objective_gradient,
-            this->constraint_jacobian, this->hessian_model->hessian, this->initial_point, direction, warmstart_information);
+      // seed the solver with the cached active-set prediction
+      this->predict_working_set(problem, *this->solver);
+
+      // solve the subproblem (an LP while the warm phase lasts, the QP otherwise)
+      const ScopedProfile profile(Profiler::SOLVE);
+      if (this->LP_phase_active) {
+         this->solver->solve_LP(problem.number_variables, problem.number_constraints, this->direction_lower_bounds, this->direction_upper_bounds,
+               this->linearized_constraints_lower_bounds, this->linearized_constraints_upper_bounds, this->objective_gradient,
+               this->constraint_jacobian, this->initial_point, direction, warmstart_information);
+      }
+      else {
+         this->solver->solve_QP(problem.number_variables, problem.number_constraints, this->direction_lower_bounds, this->direction_upper_bounds,
+               this->linearized_constraints_lower_bounds, this->linearized_constraints_upper_bounds, this->objective_gradient,
+               this->constraint_jacobian, this->hessian_model->hessian, this->initial_point, direction, warmstart_information);
+      }
+      this->update_working_set_memory(statistics, problem, *this->solver, direction);
       InequalityConstrainedMethod::compute_dual_displacements(current_multipliers, direction.multipliers);
+      // the subproblem reports the norm of the direction over the original model variables
+      direction.norm = InequalityConstrainedMethod::compute_direction_norm(direction, problem.get_number_original_variables());
       this->number_subproblems_solved++;
       // reset the initial point
       this->initial_point.fill(0.);
@@ -11,7 +11,7 @@ namespace uno {
    // forward reference
    class QPSolver;
 
-   class QPSubproblem : public InequalityConstrainedMethod {
+   class QPSubproblem final : public InequalityConstrainedMethod {
    public:
       QPSubproblem(size_t number_variables, size_t number_constraints, size_t number_objective_gradient_nonzeros, size_t number_jacobian_nonzeros,
             size_t number_hessian_nonzeros, const Options& options);
@@ -24,8 +24,15 @@ namespace uno {
    protected:
       const bool use_regularization;
       const bool enforce_linear_constraints_at_initial_iterate;
+      const double linear_feasibility_tolerance;
       // pointer to allow polymorphism
       const std::unique_ptr<QPSolver> solver; /*!< Solver that solves the subproblem */
+      // optional SLP warm phase: while it lasts, the iterations take the much cheaper LP steps (no
+      // Hessian evaluation, no quadratic solve); the first rejected LP step (observed as a re-solve
+      // without fresh function evaluations) ends the phase and hands the iterations over to the QP
+      const bool use_initial_LP_phase;
+      bool LP_phase_active;
+      bool hessian_is_current{false};
 
       void evaluate_functions(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate, const Multipliers& current_multipliers,
             const WarmstartInformation& warmstart_information);
@@ -0,0 +1,61 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include "AdaptiveMehrotraBarrierParameterUpdateStrategy.hpp"
+#include "optimization/Iterate.hpp"
+#include "reformulation/OptimizationProblem.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+
+namespace uno {
+   AdaptiveMehrotraBarrierParameterUpdateStrategy::AdaptiveMehrotraBarrierParameterUpdateStrategy(const Options& options):
+      BarrierParameterUpdateStrategy(options),
+      update_fraction(options.get_double("barrier_update_fraction")) {
+   }
+
+   bool AdaptiveMehrotraBarrierParameterUpdateStrategy::update_barrier_parameter(const OptimizationProblem& problem,
+         const Iterate& current_iterate, const Multipliers& current_multipliers, const DualResiduals& /*residuals*/) {
+      // average and minimum complementarity products over the bound constraints
+      double sum_products = 0.;
+      double minimum_product = INF<double>;
+      size_t number_products = 0;
+      for (const size_t variable_index: problem.get_lower_bounded_variables()) {
+         const double product = std::max(0., current_multipliers.lower_bounds[variable_index] *
+               (current_iterate.primals[variable_index] - problem.variable_lower_bound(variable_index)));
+         sum_products += product;
+         minimum_product = std::min(minimum_product, product);
+         number_products++;
+      }
+      for (const size_t variable_index: problem.get_upper_bounded_variables()) {
+         // the upper bound multiplier and the distance to the bound are both negative
+         const double product = std::max(0., current_multipliers.upper_bounds[variable_index] *
+               (current_iterate.primals[variable_index] - problem.variable_upper_bound(variable_index)));
+         sum_products += product;
+         minimum_product = std::min(minimum_product, product);
+         number_products++;
+      }
+      if (number_products == 0) {
+         return false;
+      }
+      const double average_complementarity = sum_products / static_cast<double>(number_products);
+      if (average_complementarity <= 0.) {
+         return false;
+      }
+
+      // LOQO centering heuristic: the worse the centrality (small xi), the larger the centering
+      const double xi = minimum_product / average_complementarity;
+      const double centering = 0.1 * std::pow(std::min(0.05 * (1. - xi) / std::max(xi, 1e-10), 2.), 3.);
+
+      const double tolerance_fraction = this->tolerance / this->update_fraction;
+      const double new_barrier_parameter = std::max(tolerance_fraction, centering * average_complementarity);
+      const bool parameter_updated = (new_barrier_parameter != this->barrier_parameter);
+      this->barrier_parameter = new_barrier_parameter;
+      if (parameter_updated) {
+         DEBUG << "Barrier parameter mu updated to " << this->barrier_parameter << '\n';
+      }
+      return parameter_updated;
+   }
+} // namespace
@@ -0,0 +1,25 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_ADAPTIVEMEHROTRABARRIERPARAMETERUPDATESTRATEGY_H
+#define UNO_ADAPTIVEMEHROTRABARRIERPARAMETERUPDATESTRATEGY_H
+
+#include "BarrierParameterUpdateStrategy.hpp"
+
+namespace uno {
+   // adaptive Mehrotra-style schedule: the new barrier parameter is a centering fraction of the
+   // average complementarity product over the bound constraints, with the centering parameter
+   // driven by the spread of the products (Vanderbei & Shanno's LOQO heuristic)
+   class AdaptiveMehrotraBarrierParameterUpdateStrategy: public BarrierParameterUpdateStrategy {
+   public:
+      explicit AdaptiveMehrotraBarrierParameterUpdateStrategy(const Options& options);
+
+      [[nodiscard]] bool update_barrier_parameter(const OptimizationProblem& problem, const Iterate& current_iterate,
+            const Multipliers& current_multipliers, const DualResiduals& residuals) override;
+
+   protected:
+      const double update_fraction;
+   };
+} // namespace
+
+#endif // UNO_ADAPTIVEMEHROTRABARRIERPARAMETERUPDATESTRATEGY_H
@@ -14,25 +14,22 @@ namespace uno {
    template <typename ElementType>
    class Vector;
 
-   struct UpdateParameters {
-      double k_mu;
-      double theta_mu;
-      double k_epsilon;
-      double update_fraction;
-   };
-
+   // abstract barrier parameter schedule: concrete profiles (monotone Fiacco-McCormick, its
+   // aggressive/conservative variants, adaptive Mehrotra) are created by
+   // BarrierParameterUpdateStrategyFactory from the barrier_parameter_update_strategy option
    class BarrierParameterUpdateStrategy {
    public:
       explicit BarrierParameterUpdateStrategy(const Options& options);
+      virtual ~BarrierParameterUpdateStrategy() = default;
+
       [[nodiscard]] double get_barrier_parameter() const;
       void set_barrier_parameter(double new_barrier_parameter);
-      [[nodiscard]] bool update_barrier_parameter(const OptimizationProblem& problem, const Iterate& current_iterate, const Multipliers& current_multipliers,
-            const DualResiduals& residuals);
+      [[nodiscard]] virtual bool update_barrier_parameter(const OptimizationProblem& problem, const Iterate& current_iterate,
+            const Multipliers& current_multipliers, const DualResiduals& residuals) = 0;
 
    protected:
       double barrier_parameter;
       const double tolerance;
-      const UpdateParameters parameters;
 
       [[nodiscard]] static double compute_shifted_complementarity_error(const OptimizationProblem& problem, const Vector<double>& primals,
             const Multipliers& multipliers, double shift_value);
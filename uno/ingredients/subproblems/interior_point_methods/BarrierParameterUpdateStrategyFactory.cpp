@@ -0,0 +1,33 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <stdexcept>
+#include "BarrierParameterUpdateStrategyFactory.hpp"
+#include "AdaptiveMehrotraBarrierParameterUpdateStrategy.hpp"
+#include "MonotoneBarrierParameterUpdateStrategy.hpp"
+#include "tools/Options.hpp"
+
+namespace uno {
+   std::unique_ptr<BarrierParameterUpdateStrategy> BarrierParameterUpdateStrategyFactory::create(const Options& options) {
+      const std::string& strategy_name = options.get_string("barrier_parameter_update_strategy");
+      if (strategy_name == "monotone") {
+         return std::make_unique<MonotoneBarrierParameterUpdateStrategy>(options);
+      }
+      // aggressive profile: fast superlinear decrease for well-behaved problems
+      else if (strategy_name == "aggressive") {
+         return std::make_unique<MonotoneBarrierParameterUpdateStrategy>(options, 0.05, 1.8);
+      }
+      // conservative profile: slow decrease for problems whose centrality degrades easily
+      else if (strategy_name == "conservative") {
+         return std::make_unique<MonotoneBarrierParameterUpdateStrategy>(options, 0.5, 1.1);
+      }
+      else if (strategy_name == "adaptive_Mehrotra") {
+         return std::make_unique<AdaptiveMehrotraBarrierParameterUpdateStrategy>(options);
+      }
+      throw std::invalid_argument("BarrierParameterUpdateStrategy " + strategy_name + " is not supported");
+   }
+
+   std::vector<std::string> BarrierParameterUpdateStrategyFactory::available_strategies() {
+      return {"monotone", "aggressive", "conservative", "adaptive_Mehrotra"};
+   }
+} // namespace
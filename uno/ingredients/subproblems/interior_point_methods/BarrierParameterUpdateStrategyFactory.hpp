@@ -0,0 +1,23 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BARRIERPARAMETERUPDATESTRATEGYFACTORY_H
+#define UNO_BARRIERPARAMETERUPDATESTRATEGYFACTORY_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uno {
+   // forward declarations
+   class BarrierParameterUpdateStrategy;
+   class Options;
+
+   class BarrierParameterUpdateStrategyFactory {
+   public:
+      static std::unique_ptr<BarrierParameterUpdateStrategy> create(const Options& options);
+      static std::vector<std::string> available_strategies();
+   };
+} // namespace
+
+#endif // UNO_BARRIERPARAMETERUPDATESTRATEGYFACTORY_H
@@ -0,0 +1,58 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <cmath>
+#include "MonotoneBarrierParameterUpdateStrategy.hpp"
+#include "optimization/Iterate.hpp"
+#include "reformulation/OptimizationProblem.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+
+namespace uno {
+   MonotoneBarrierParameterUpdateStrategy::MonotoneBarrierParameterUpdateStrategy(const Options& options):
+      MonotoneBarrierParameterUpdateStrategy(options, options.get_double("barrier_k_mu"), options.get_double("barrier_theta_mu")) {
+   }
+
+   MonotoneBarrierParameterUpdateStrategy::MonotoneBarrierParameterUpdateStrategy(const Options& options, double k_mu, double theta_mu):
+      BarrierParameterUpdateStrategy(options),
+      parameters({
+         k_mu,
+         theta_mu,
+         options.get_double("barrier_k_epsilon"),
+         options.get_double("barrier_update_fraction")
+      }) {
+   }
+
+   bool MonotoneBarrierParameterUpdateStrategy::update_barrier_parameter(const OptimizationProblem& problem, const Iterate& current_iterate,
+         const Multipliers& current_multipliers, const DualResiduals& residuals) {
+      // primal-dual errors
+      const double scaled_stationarity = residuals.stationarity / residuals.stationarity_scaling;
+      const double primal_feasibility = (problem.get_objective_multiplier() == 0.) ? 0. : current_iterate.primal_feasibility;
+      double primal_dual_error = std::max({
+         scaled_stationarity,
+         primal_feasibility,
+         residuals.complementarity / residuals.complementarity_scaling
+      });
+      DEBUG << "Max scaled primal-dual error for barrier subproblem is " << primal_dual_error << '\n';
+
+      // update the barrier parameter (Eq. 7 in IPOPT paper)
+      const double tolerance_fraction = this->tolerance / this->parameters.update_fraction;
+      bool parameter_updated = false;
+      while (primal_dual_error <= this->parameters.k_epsilon * this->barrier_parameter && tolerance_fraction < this->barrier_parameter) {
+         this->barrier_parameter = std::max(tolerance_fraction, std::min(this->parameters.k_mu * this->barrier_parameter,
+               std::pow(this->barrier_parameter, this->parameters.theta_mu)));
+         DEBUG << "Barrier parameter mu updated to " << this->barrier_parameter << '\n';
+         // update complementarity error
+         double scaled_complementarity_error = BarrierParameterUpdateStrategy::compute_shifted_complementarity_error(problem, current_iterate.primals,
+               current_multipliers, this->barrier_parameter) / residuals.complementarity_scaling;
+         primal_dual_error = std::max({
+            scaled_stationarity,
+            primal_feasibility,
+            scaled_complementarity_error
+         });
+         DEBUG << "Max scaled primal-dual error for barrier subproblem is " << primal_dual_error << '\n';
+         parameter_updated = true;
+      }
+      return parameter_updated;
+   }
+} // namespace
@@ -0,0 +1,34 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_MONOTONEBARRIERPARAMETERUPDATESTRATEGY_H
+#define UNO_MONOTONEBARRIERPARAMETERUPDATESTRATEGY_H
+
+#include "BarrierParameterUpdateStrategy.hpp"
+
+namespace uno {
+   struct UpdateParameters {
+      double k_mu;
+      double theta_mu;
+      double k_epsilon;
+      double update_fraction;
+   };
+
+   // monotone Fiacco-McCormick schedule (Eq. 7 in the Ipopt paper): the barrier parameter is
+   // decreased superlinearly once the scaled primal-dual error is small enough. The aggressive and
+   // conservative profiles are the same policy with curated (k_mu, theta_mu) constants
+   class MonotoneBarrierParameterUpdateStrategy: public BarrierParameterUpdateStrategy {
+   public:
+      explicit MonotoneBarrierParameterUpdateStrategy(const Options& options);
+      // profile constructor: overrides the decrease constants, keeps the remaining options
+      MonotoneBarrierParameterUpdateStrategy(const Options& options, double k_mu, double theta_mu);
+
+      [[nodiscard]] bool update_barrier_parameter(const OptimizationProblem& problem, const Iterate& current_iterate,
+            const Multipliers& current_multipliers, const DualResiduals& residuals) override;
+
+   protected:
+      const UpdateParameters parameters;
+   };
+} // namespace
+
+#endif // UNO_MONOTONEBARRIERPARAMETERUPDATESTRATEGY_H
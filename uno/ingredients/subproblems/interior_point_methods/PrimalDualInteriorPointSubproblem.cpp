@@ -2,9 +2,12 @@
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
 #include <cmath>
+#include <future>
 #include "PrimalDualInteriorPointSubproblem.hpp"
+#include "BarrierParameterUpdateStrategyFactory.hpp"
 #include "ingredients/subproblems/Direction.hpp"
 #include "ingredients/subproblems/HessianModelFactory.hpp"
+#include "linear_algebra/SparseFormatSelector.hpp"
 #include "linear_algebra/SparseStorageFactory.hpp"
 #include "solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
 #include "solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
@@ -13,15 +16,17 @@
 #include "reformulation/l1RelaxedProblem.hpp"
 #include "symbolic/VectorView.hpp"
 #include "tools/Infinity.hpp"
+#include "tools/MemoryUsage.hpp"
+#include "tools/TuningCache.hpp"
 
 namespace uno {
    PrimalDualInteriorPointSubproblem::PrimalDualInteriorPointSubproblem(size_t number_variables, size_t number_constraints,
-         size_t number_jacobian_nonzeros, size_t number_hessian_nonzeros, const Options& options):
+         size_t number_jacobian_nonzeros, size_t number_hessian_nonzeros, const Options& options, bool use_predictor_corrector):
          Subproblem("exact", number_variables, number_hessian_nonzeros, false, options),
          objective_gradient(2 * number_variables), // original variables + barrier terms
          constraints(number_constraints),
          constraint_jacobian(number_constraints, number_variables),
-         augmented_system(options.get_string("sparse_format"), number_variables + number_constraints,
+         augmented_system(SparseFormatSelector::KKT_format(options), number_variables + number_constraints,
                number_hessian_nonzeros
                + number_variables /* diagonal barrier terms for bound constraints */
                + number_jacobian_nonzeros /* Jacobian */,
@@ -31,8 +36,9 @@ namespace uno {
                number_hessian_nonzeros
                + number_variables + number_constraints /* regularization */
                + 2 * number_variables /* diagonal barrier terms */
-               + number_jacobian_nonzeros /* Jacobian */)),
-         barrier_parameter_update_strategy(options),
+               + number_jacobian_nonzeros /* Jacobian */,
+               options)),
+         barrier_parameter_update_strategy(BarrierParameterUpdateStrategyFactory::create(options)),
          previous_barrier_parameter(options.get_double("barrier_initial_parameter")),
          default_multiplier(options.get_double("barrier_default_multiplier")),
          parameters({
@@ -45,7 +51,23 @@ namespace uno {
          }),
          least_square_multiplier_max_norm(options.get_double("least_square_multiplier_max_norm")),
          damping_factor(options.get_double("barrier_damping_factor")),
-         l1_constraint_violation_coefficient(options.get_double("l1_constraint_violation_coefficient")) {
+         l1_constraint_violation_coefficient(options.get_double("l1_constraint_violation_coefficient")),
+         condense_slack_variables(options.get_bool("barrier_condense_slacks")),
+         use_predictor_corrector(use_predictor_corrector),
+         initial_barrier_parameter(options.get_double("barrier_initial_parameter")),
+         max_consecutive_small_steps(options.get_unsigned_int("barrier_max_consecutive_small_steps")),
+         warm_start_ingredient_state(options.get_bool("warm_start_ingredient_state")),
+         overlap_factorization(options.get_bool("IPM_pipeline")),
+         crossover_to_vertex(options.get_bool("barrier_crossover")) {
+      MemoryUsage::record(MemoryUsage::JACOBIAN, this->constraint_jacobian.memory_footprint());
+      // dimensions-only family fingerprint: cheap, and sufficient to tell the instances of a
+      // batch apart (the augmented system refines its own fingerprint with the pattern)
+      uint64_t fingerprint = TuningCache::fingerprint_start();
+      fingerprint = TuningCache::fingerprint_add(fingerprint, number_variables);
+      fingerprint = TuningCache::fingerprint_add(fingerprint, number_constraints);
+      fingerprint = TuningCache::fingerprint_add(fingerprint, number_jacobian_nonzeros);
+      fingerprint = TuningCache::fingerprint_add(fingerprint, number_hessian_nonzeros);
+      this->tuning_fingerprint = fingerprint;
    }
 
    inline void PrimalDualInteriorPointSubproblem::initialize_statistics(Statistics& statistics, const Options& options) {
@@ -85,22 +107,39 @@ namespace uno {
          initial_iterate.is_constraint_jacobian_computed = false;
       }
 
-      // set the bound multipliers
-      for (const size_t variable_index: problem.get_lower_bounded_variables()) {
-         initial_iterate.multipliers.lower_bounds[variable_index] = this->default_multiplier;
-      }
-      for (const size_t variable_index: problem.get_upper_bounded_variables()) {
-         initial_iterate.multipliers.upper_bounds[variable_index] = -this->default_multiplier;
-      }
+      // set the dual estimates, unless those of a previous solve are carried over (warm-started
+      // sequential solves, where the incoming multipliers are already good estimates)
+      if (not (this->warm_start_ingredient_state && this->already_initialized)) {
+         // set the bound multipliers
+         for (const size_t variable_index: problem.get_lower_bounded_variables()) {
+            initial_iterate.multipliers.lower_bounds[variable_index] = this->default_multiplier;
+         }
+         for (const size_t variable_index: problem.get_upper_bounded_variables()) {
+            initial_iterate.multipliers.upper_bounds[variable_index] = -this->default_multiplier;
+         }
 
-      // compute least-square multipliers
-      if (problem.is_constrained()) {
-         this->compute_least_square_multipliers(problem, initial_iterate, initial_iterate.multipliers.constraints);
+         // compute least-square multipliers
+         if (problem.is_constrained()) {
+            this->compute_least_square_multipliers(problem, initial_iterate, initial_iterate.multipliers.constraints);
+         }
+
+         // cross-instance tuning: start the barrier schedule two orders of magnitude above the
+         // final value of the previous solves of the family — aggressive enough to skip the early
+         // schedule, conservative enough to recover if the new instance drifts from its family
+         if (TuningCache::active) {
+            const TuningCache::Tuning tuning = TuningCache::lookup(this->tuning_fingerprint);
+            if (0. < tuning.barrier_parameter) {
+               const double seeded_parameter = std::min(this->initial_barrier_parameter, 100. * tuning.barrier_parameter);
+               DEBUG << "Tuning cache hit: seeding the barrier parameter with " << seeded_parameter << '\n';
+               this->barrier_parameter_update_strategy->set_barrier_parameter(seeded_parameter);
+            }
+         }
       }
+      this->already_initialized = true;
    }
 
    double PrimalDualInteriorPointSubproblem::barrier_parameter() const {
-      return this->barrier_parameter_update_strategy.get_barrier_parameter();
+      return this->barrier_parameter_update_strategy->get_barrier_parameter();
    }
 
    double PrimalDualInteriorPointSubproblem::push_variable_to_interior(double variable_value, double lower_bound, double upper_bound) const {
@@ -116,6 +155,13 @@ namespace uno {
 
    void PrimalDualInteriorPointSubproblem::evaluate_functions(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate,
          const Multipliers& current_multipliers, const WarmstartInformation& warmstart_information) {
+      this->evaluate_matrix_functions(statistics, problem, current_iterate, current_multipliers, warmstart_information);
+      this->evaluate_rhs_functions(problem, current_iterate, warmstart_information);
+   }
+
+   // quantities that enter the augmented matrix: the barrier Lagrangian Hessian and the constraint Jacobian
+   void PrimalDualInteriorPointSubproblem::evaluate_matrix_functions(Statistics& statistics, const OptimizationProblem& problem,
+         Iterate& current_iterate, const Multipliers& current_multipliers, const WarmstartInformation& warmstart_information) {
       // barrier Lagrangian Hessian
       if (warmstart_information.objective_changed || warmstart_information.constraints_changed) {
          // original Lagrangian Hessian
@@ -136,6 +182,15 @@ namespace uno {
          }
       }
 
+      // constraint Jacobian
+      if (warmstart_information.constraints_changed) {
+         problem.evaluate_constraint_jacobian(current_iterate, this->constraint_jacobian);
+      }
+   }
+
+   // quantities that only enter the right-hand side: the barrier objective gradient and the constraints
+   void PrimalDualInteriorPointSubproblem::evaluate_rhs_functions(const OptimizationProblem& problem, Iterate& current_iterate,
+         const WarmstartInformation& warmstart_information) {
       // barrier objective gradient
       if (warmstart_information.objective_changed) {
          // original objective gradient
@@ -162,10 +217,9 @@ namespace uno {
          }
       }
 
-      // constraints and Jacobian
+      // constraints
       if (warmstart_information.constraints_changed) {
          problem.evaluate_constraints(current_iterate, this->constraints);
-         problem.evaluate_constraint_jacobian(current_iterate, this->constraint_jacobian);
       }
    }
 
@@ -177,6 +231,8 @@ namespace uno {
       if (is_finite(this->trust_region_radius)) {
          throw std::runtime_error("The interior-point subproblem has a trust region. This is not implemented yet.\n");
       }
+      // propagate the requested accuracy to the linear solver (only the iterative solvers use it)
+      this->linear_solver->set_solve_tolerance(this->solve_tolerance);
 
       // possibly update the barrier parameter
       const auto residuals = this->solving_feasibility_problem ? current_iterate.feasibility_residuals : current_iterate.residuals;
@@ -186,36 +242,73 @@ namespace uno {
       else {
          this->first_feasibility_iteration = false;
       }
+      // stalled solve: repeated small steps indicate that the current barrier problem cannot be improved.
+      // Recenter the slacks and restart from a larger barrier parameter instead of burning factorizations
+      if (this->max_consecutive_small_steps <= this->consecutive_small_steps) {
+         this->rescue_stalled_solve(problem, current_iterate);
+      }
       statistics.set("barrier param.", this->barrier_parameter());
 
-      // evaluate the functions at the current iterate
-      this->evaluate_functions(statistics, problem, current_iterate, current_multipliers, warmstart_information);
+      // evaluate the functions at the current iterate and assemble and factorize the augmented matrix
+      if (this->overlap_factorization && problem.model.supports_concurrent_evaluations()) {
+         // pipelined iteration body: the matrix chain (Hessian and Jacobian evaluations, assembly,
+         // factorization and regularization) runs on a worker thread, overlapped with the right-hand
+         // side evaluations (objective gradient and constraints) on this thread. An evaluation error
+         // on the worker propagates through the future
+         std::future<void> matrix_chain = std::async(std::launch::async, [&]() {
+            this->evaluate_matrix_functions(statistics, problem, current_iterate, current_multipliers, warmstart_information);
+            this->assemble_augmented_system(statistics, problem);
+         });
+         this->evaluate_rhs_functions(problem, current_iterate, warmstart_information);
+         matrix_chain.get();
+      }
+      else {
+         this->evaluate_functions(statistics, problem, current_iterate, current_multipliers, warmstart_information);
+         this->assemble_augmented_system(statistics, problem);
+      }
+      // the right-hand side needs the Jacobian: it is assembled once both chains have completed
+      this->assemble_augmented_rhs(problem, current_multipliers);
 
       // compute the primal-dual solution
-      this->assemble_augmented_system(statistics, problem, current_multipliers);
       this->augmented_system.solve(*this->linear_solver);
       assert(direction.status == SubproblemStatus::OPTIMAL && "The primal-dual perturbed subproblem was not solved to optimality");
       this->number_subproblems_solved++;
 
-      this->assemble_primal_dual_direction(problem, current_iterate.primals, current_multipliers, direction.primals, direction.multipliers);
+      // Mehrotra-style corrector: correct the right-hand side with the second-order complementarity
+      // products of the predictor direction and re-solve against the same factorization
+      if (this->use_predictor_corrector) {
+         this->apply_second_order_corrector(problem, current_iterate.primals, current_multipliers);
+      }
+
+      this->assemble_primal_dual_direction(problem, current_iterate.primals, current_multipliers, direction);
       direction.subproblem_objective = this->evaluate_subproblem_objective(direction);
    }
 
-   void PrimalDualInteriorPointSubproblem::assemble_augmented_system(Statistics& statistics, const OptimizationProblem& problem,
-         const Multipliers& current_multipliers) {
-      // assemble, factorize and regularize the augmented matrix
-      this->augmented_system.assemble_matrix(this->hessian_model->hessian, this->constraint_jacobian, problem.number_variables, problem.number_constraints);
+   void PrimalDualInteriorPointSubproblem::assemble_augmented_system(Statistics& statistics, const OptimizationProblem& problem) {
+      // assemble, factorize and regularize the augmented matrix. When condensation is active, the
+      // condensable variables (slacks and elastics, whose rows contain only their diagonal barrier term
+      // and a single Jacobian coefficient) are eliminated analytically before the factorization, which
+      // shrinks the factorized system
+      const SparseVector<size_t>& condensable_variables = problem.get_condensable_variables();
+      const bool condensation = this->condense_slack_variables && not condensable_variables.is_empty();
+      if (condensation) {
+         this->augmented_system.assemble_condensed_matrix(this->hessian_model->hessian, this->constraint_jacobian, problem.number_variables,
+               problem.number_constraints, condensable_variables);
+      }
+      else {
+         this->augmented_system.assemble_matrix(this->hessian_model->hessian, this->constraint_jacobian, problem.number_variables, problem.number_constraints);
+      }
       this->augmented_system.factorize_matrix(problem.model, *this->linear_solver);
+      const size_t size_primal_block = problem.number_variables - (condensation ? condensable_variables.size() : 0);
       const double dual_regularization_parameter = std::pow(this->barrier_parameter(), this->parameters.regularization_exponent);
-      this->augmented_system.regularize_matrix(statistics, problem.model, *this->linear_solver, problem.number_variables, problem.number_constraints,
+      this->augmented_system.regularize_matrix(statistics, *this->linear_solver, size_primal_block, problem.number_constraints,
             dual_regularization_parameter);
 
-      // check the inertia
-      [[maybe_unused]] auto [number_pos_eigenvalues, number_neg_eigenvalues, number_zero_eigenvalues] = this->linear_solver->get_inertia();
-      assert(number_pos_eigenvalues == problem.number_variables && number_neg_eigenvalues == problem.number_constraints && number_zero_eigenvalues == 0);
-
-      // rhs
-      this->assemble_augmented_rhs(problem, current_multipliers);
+      // check the inertia (meaningless in inertia-free mode, where the solver is never asked for it)
+      if (not this->augmented_system.uses_inertia_free_curvature_test()) {
+         [[maybe_unused]] auto [number_pos_eigenvalues, number_neg_eigenvalues, number_zero_eigenvalues] = this->linear_solver->get_inertia();
+         assert(number_pos_eigenvalues == size_primal_block && number_neg_eigenvalues == problem.number_constraints && number_zero_eigenvalues == 0);
+      }
    }
 
    void PrimalDualInteriorPointSubproblem::initialize_feasibility_problem(const l1RelaxedProblem& /*problem*/, Iterate& current_iterate) {
@@ -226,7 +319,7 @@ namespace uno {
       // temporarily update the objective multiplier
       this->previous_barrier_parameter = this->barrier_parameter();
       const double new_barrier_parameter = std::max(this->barrier_parameter(), current_iterate.primal_feasibility);
-      this->barrier_parameter_update_strategy.set_barrier_parameter(new_barrier_parameter);
+      this->barrier_parameter_update_strategy->set_barrier_parameter(new_barrier_parameter);
       DEBUG << "Barrier parameter mu temporarily updated to " << this->barrier_parameter() << '\n';
 
       // set the bound multipliers
@@ -272,25 +365,26 @@ namespace uno {
 
    void PrimalDualInteriorPointSubproblem::exit_feasibility_problem(const OptimizationProblem& problem, Iterate& trial_iterate) {
       assert(this->solving_feasibility_problem && "The barrier subproblem did not know it was solving the feasibility problem.");
-      this->barrier_parameter_update_strategy.set_barrier_parameter(this->previous_barrier_parameter);
+      this->barrier_parameter_update_strategy->set_barrier_parameter(this->previous_barrier_parameter);
       this->solving_feasibility_problem = false;
       this->compute_least_square_multipliers(problem, trial_iterate, trial_iterate.multipliers.constraints);
    }
 
    void PrimalDualInteriorPointSubproblem::set_auxiliary_measure(const Model& model, Iterate& iterate) {
-      // auxiliary measure: barrier terms
+      // auxiliary measure: barrier terms (iteration over the bitmask companions avoids the virtual
+      // calls of the Collection iterators in these hot loops)
       double barrier_terms = 0.;
-      for (const size_t variable_index: model.get_lower_bounded_variables()) {
+      for (const size_t variable_index: model.get_lower_bounded_variables_mask()) {
          barrier_terms -= std::log(iterate.primals[variable_index] - model.variable_lower_bound(variable_index));
       }
-      for (const size_t variable_index: model.get_upper_bounded_variables()) {
+      for (const size_t variable_index: model.get_upper_bounded_variables_mask()) {
          barrier_terms -= std::log(model.variable_upper_bound(variable_index) - iterate.primals[variable_index]);
       }
       // damping
-      for (const size_t variable_index: model.get_single_lower_bounded_variables()) {
+      for (const size_t variable_index: model.get_single_lower_bounded_variables_mask()) {
          barrier_terms += this->damping_factor*(iterate.primals[variable_index] - model.variable_lower_bound(variable_index));
       }
-      for (const size_t variable_index: model.get_single_upper_bounded_variables()) {
+      for (const size_t variable_index: model.get_single_upper_bounded_variables_mask()) {
          barrier_terms += this->damping_factor*(model.variable_upper_bound(variable_index) - iterate.primals[variable_index]);
       }
       barrier_terms *= this->barrier_parameter();
@@ -308,19 +402,19 @@ namespace uno {
    double PrimalDualInteriorPointSubproblem::compute_barrier_term_directional_derivative(const Model& model, const Iterate& current_iterate,
          const Vector<double>& primal_direction) const {
       double directional_derivative = 0.;
-      for (const size_t variable_index: model.get_lower_bounded_variables()) {
+      for (const size_t variable_index: model.get_lower_bounded_variables_mask()) {
          directional_derivative += -this->barrier_parameter() / (current_iterate.primals[variable_index] -
                                                                  model.variable_lower_bound(variable_index)) * primal_direction[variable_index];
       }
-      for (const size_t variable_index: model.get_upper_bounded_variables()) {
+      for (const size_t variable_index: model.get_upper_bounded_variables_mask()) {
          directional_derivative += -this->barrier_parameter() / (current_iterate.primals[variable_index] -
                                                                  model.variable_upper_bound(variable_index)) * primal_direction[variable_index];
       }
       // damping
-      for (const size_t variable_index: model.get_single_lower_bounded_variables()) {
+      for (const size_t variable_index: model.get_single_lower_bounded_variables_mask()) {
          directional_derivative += this->damping_factor * this->barrier_parameter() * primal_direction[variable_index];
       }
-      for (const size_t variable_index: model.get_single_upper_bounded_variables()) {
+      for (const size_t variable_index: model.get_single_upper_bounded_variables_mask()) {
          directional_derivative -= this->damping_factor * this->barrier_parameter() * primal_direction[variable_index];
       }
       return directional_derivative;
@@ -328,12 +422,34 @@ namespace uno {
 
    void PrimalDualInteriorPointSubproblem::update_barrier_parameter(const OptimizationProblem& problem, const Iterate& current_iterate,
          const Multipliers& current_multipliers, const DualResiduals& residuals) {
-      const bool barrier_parameter_updated = this->barrier_parameter_update_strategy.update_barrier_parameter(problem, current_iterate,
+      const bool barrier_parameter_updated = this->barrier_parameter_update_strategy->update_barrier_parameter(problem, current_iterate,
             current_multipliers, residuals);
       // the barrier parameter may have been changed earlier when entering restoration
       this->subproblem_definition_changed = this->subproblem_definition_changed || barrier_parameter_updated;
    }
 
+   // rescue of a stalled barrier solve: the slacks are pulled back to the interior around the current
+   // constraint values and the barrier parameter is reset to (at least) its initial value, so that the
+   // iterates regain room to move instead of grinding through factorizations with tiny steps
+   void PrimalDualInteriorPointSubproblem::rescue_stalled_solve(const OptimizationProblem& problem, Iterate& current_iterate) {
+      DEBUG << "Stalled barrier solve: recentering the slacks and resetting the barrier parameter\n";
+      this->barrier_parameter_update_strategy->set_barrier_parameter(std::max(this->barrier_parameter(), this->initial_barrier_parameter));
+      this->subproblem_definition_changed = true;
+
+      if (not problem.model.get_slacks().is_empty()) {
+         current_iterate.evaluate_constraints(problem.model);
+         for (const auto [constraint_index, slack_index]: problem.model.get_slacks()) {
+            current_iterate.primals[slack_index] = this->push_variable_to_interior(current_iterate.evaluations.constraints[constraint_index],
+                  problem.variable_lower_bound(slack_index), problem.variable_upper_bound(slack_index));
+         }
+         // since the slacks have been moved, the function evaluations should also be updated
+         current_iterate.is_objective_gradient_computed = false;
+         current_iterate.are_constraints_computed = false;
+         current_iterate.is_constraint_jacobian_computed = false;
+      }
+      this->consecutive_small_steps = 0;
+   }
+
    // Section 3.9 in IPOPT paper
    bool PrimalDualInteriorPointSubproblem::is_small_step(const OptimizationProblem& problem, const Vector<double>& current_primals,
          const Vector<double>& direction_primals) const {
@@ -355,49 +471,27 @@ namespace uno {
    double PrimalDualInteriorPointSubproblem::primal_fraction_to_boundary(const OptimizationProblem& problem, const Vector<double>& current_primals,
          const Vector<double>& primal_direction, double tau) {
       double step_length = 1.;
-      for (const size_t variable_index: problem.get_lower_bounded_variables()) {
+      // partitioned iteration (for_each): each part of the bound collections runs in its own tight loop
+      problem.get_lower_bounded_variables().for_each([&](size_t variable_index) {
          if (primal_direction[variable_index] < 0.) {
             double distance = -tau * (current_primals[variable_index] - problem.variable_lower_bound(variable_index)) / primal_direction[variable_index];
             if (0. < distance) {
                step_length = std::min(step_length, distance);
             }
          }
-      }
-      for (const size_t variable_index: problem.get_upper_bounded_variables()) {
+      });
+      problem.get_upper_bounded_variables().for_each([&](size_t variable_index) {
          if (0. < primal_direction[variable_index]) {
             double distance = -tau * (current_primals[variable_index] - problem.variable_upper_bound(variable_index)) / primal_direction[variable_index];
             if (0. < distance) {
                step_length = std::min(step_length, distance);
             }
          }
-      }
+      });
       assert(0. < step_length && step_length <= 1. && "The primal fraction-to-boundary step length is not in (0, 1]");
       return step_length;
    }
 
-   double PrimalDualInteriorPointSubproblem::dual_fraction_to_boundary(const OptimizationProblem& problem, const Multipliers& current_multipliers,
-         Multipliers& direction_multipliers, double tau) {
-      double step_length = 1.;
-      for (const size_t variable_index: problem.get_lower_bounded_variables()) {
-         if (direction_multipliers.lower_bounds[variable_index] < 0.) {
-            double distance = -tau * current_multipliers.lower_bounds[variable_index] / direction_multipliers.lower_bounds[variable_index];
-            if (0. < distance) {
-               step_length = std::min(step_length, distance);
-            }
-         }
-      }
-      for (const size_t variable_index: problem.get_upper_bounded_variables()) {
-         if (0. < direction_multipliers.upper_bounds[variable_index]) {
-            double distance = -tau * current_multipliers.upper_bounds[variable_index] / direction_multipliers.upper_bounds[variable_index];
-            if (0. < distance) {
-               step_length = std::min(step_length, distance);
-            }
-         }
-      }
-      assert(0. < step_length && step_length <= 1. && "The dual fraction-to-boundary step length is not in (0, 1]");
-      return step_length;
-   }
-
    // generate the right-hand side
    void PrimalDualInteriorPointSubproblem::assemble_augmented_rhs(const OptimizationProblem& problem, const Multipliers& current_multipliers) {
       this->augmented_system.rhs.fill(0.);
@@ -421,25 +515,103 @@ namespace uno {
       DEBUG2 << "RHS: "; print_vector(DEBUG2, view(this->augmented_system.rhs, 0, problem.number_variables + problem.number_constraints)); DEBUG << '\n';
    }
 
+   // second-order correction (Section 3.5 in the Ipopt paper, with a single correction): the dual block
+   // of the right-hand side is replaced with the corrected residual c(x) + c(x + d), where the
+   // constraints are re-evaluated at the rejected trial iterate, and the corrected system is solved
+   // against the existing factorization (one extra triangular solve)
+   bool PrimalDualInteriorPointSubproblem::compute_second_order_correction(const OptimizationProblem& problem, Iterate& current_iterate,
+         const Multipliers& current_multipliers, Iterate& trial_iterate, Direction& direction) {
+      std::vector<double> trial_constraints(problem.number_constraints);
+      problem.evaluate_constraints(trial_iterate, trial_constraints);
+      for (size_t constraint_index: Range(problem.number_constraints)) {
+         this->augmented_system.rhs[problem.number_variables + constraint_index] =
+               -(this->constraints[constraint_index] + trial_constraints[constraint_index]);
+      }
+      this->augmented_system.solve(*this->linear_solver);
+      this->number_subproblems_solved++;
+
+      this->assemble_primal_dual_direction(problem, current_iterate.primals, current_multipliers, direction);
+      direction.subproblem_objective = this->evaluate_subproblem_objective(direction);
+      return true;
+   }
+
+   // Mehrotra-style second-order corrector. The first solve provides a predictor direction; the
+   // linearized complementarity conditions are corrected with its second-order products dx*dz and the
+   // corrected system is solved against the factorization of the predictor system (a triangular solve,
+   // much cheaper than a second factorization)
+   void PrimalDualInteriorPointSubproblem::apply_second_order_corrector(const OptimizationProblem& problem, const Vector<double>& current_primals,
+         const Multipliers& current_multipliers) {
+      if (this->corrector_products_lower_bounds.size() < problem.number_variables) {
+         this->corrector_products_lower_bounds.resize(problem.number_variables);
+         this->corrector_products_upper_bounds.resize(problem.number_variables);
+      }
+      const Vector<double>& predictor_solution = this->augmented_system.solution;
+      // partitioned iteration (for_each): each part of the bound collections runs in its own tight loop
+      problem.get_lower_bounded_variables().for_each([&](size_t variable_index) {
+         const double current_dual = current_multipliers.lower_bounds[variable_index];
+         const double distance_to_bound = current_primals[variable_index] - problem.variable_lower_bound(variable_index);
+         // predictor bound dual direction, recovered from the linearized complementarity condition
+         const double predictor_dual_direction = (this->barrier_parameter() - predictor_solution[variable_index] * current_dual) / distance_to_bound -
+               current_dual;
+         const double second_order_product = predictor_solution[variable_index] * predictor_dual_direction;
+         this->corrector_products_lower_bounds[variable_index] = second_order_product;
+         this->augmented_system.rhs[variable_index] -= second_order_product / distance_to_bound;
+      });
+      problem.get_upper_bounded_variables().for_each([&](size_t variable_index) {
+         const double current_dual = current_multipliers.upper_bounds[variable_index];
+         const double distance_to_bound = current_primals[variable_index] - problem.variable_upper_bound(variable_index);
+         const double predictor_dual_direction = (this->barrier_parameter() - predictor_solution[variable_index] * current_dual) / distance_to_bound -
+               current_dual;
+         const double second_order_product = predictor_solution[variable_index] * predictor_dual_direction;
+         this->corrector_products_upper_bounds[variable_index] = second_order_product;
+         this->augmented_system.rhs[variable_index] -= second_order_product / distance_to_bound;
+      });
+      // corrector solve: the factorization of the predictor system is reused
+      this->augmented_system.solve(*this->linear_solver);
+   }
+
    void PrimalDualInteriorPointSubproblem::assemble_primal_dual_direction(const OptimizationProblem& problem, const Vector<double>& current_primals,
-         const Multipliers& current_multipliers, Vector<double>& direction_primals, Multipliers& direction_multipliers) {
-      // form the primal-dual direction
-      direction_primals = view(this->augmented_system.solution, 0, problem.number_variables);
+         const Multipliers& current_multipliers, Direction& direction) {
+      Vector<double>& direction_primals = direction.primals;
+      Multipliers& direction_multipliers = direction.multipliers;
+      // single-sweep unpack of the solution: the primal direction and its infinity norm (over the
+      // original model variables, as reported in direction.norm) come out of one pass
+      const size_t number_model_variables = problem.get_number_original_variables();
+      double unscaled_norm = 0.;
+      // cache-blocked sweeps over the solution of the augmented system, whose dimension can reach
+      // tens of millions on our largest instances
+      for (const ForwardRange block: Range(problem.number_variables).blocks(VECTOR_BLOCK_SIZE)) {
+         for (size_t variable_index: block) {
+            const double entry = this->augmented_system.solution[variable_index];
+            direction_primals[variable_index] = entry;
+            if (variable_index < number_model_variables) {
+               unscaled_norm = std::max(unscaled_norm, std::abs(entry));
+            }
+         }
+      }
       // retrieve the duals with correct signs (note the minus sign)
-      direction_multipliers.constraints = view(-this->augmented_system.solution, problem.number_variables,
-            problem.number_variables + problem.number_constraints);
-      this->compute_bound_dual_direction(problem, current_primals, current_multipliers, direction_primals, direction_multipliers);
+      for (const ForwardRange block: Range(problem.number_constraints).blocks(VECTOR_BLOCK_SIZE)) {
+         for (size_t constraint_index: block) {
+            direction_multipliers.constraints[constraint_index] =
+                  -this->augmented_system.solution[problem.number_variables + constraint_index];
+         }
+      }
+      // "fraction-to-boundary" rule for primal variables and constraints multipliers
+      const double tau = std::max(this->parameters.tau_min, 1. - this->barrier_parameter());
+      // the bound dual direction and the dual fraction-to-boundary rule are fused in a single sweep
+      const double bound_dual_step_length = this->compute_bound_dual_direction(problem, current_primals, current_multipliers, direction_primals,
+            tau, direction_multipliers);
 
-      // determine if the direction is a "small direction" (Section 3.9 of the Ipopt paper) TODO
-      const bool is_small_step = PrimalDualInteriorPointSubproblem::is_small_step(problem, current_primals, direction_primals);
-      if (is_small_step) {
+      // determine if the direction is a "small direction" (Section 3.9 of the Ipopt paper)
+      if (PrimalDualInteriorPointSubproblem::is_small_step(problem, current_primals, direction_primals)) {
          DEBUG << "This is a small step\n";
+         this->consecutive_small_steps++;
+      }
+      else {
+         this->consecutive_small_steps = 0;
       }
 
-      // "fraction-to-boundary" rule for primal variables and constraints multipliers
-      const double tau = std::max(this->parameters.tau_min, 1. - this->barrier_parameter());
       const double primal_step_length = PrimalDualInteriorPointSubproblem::primal_fraction_to_boundary(problem, current_primals, direction_primals, tau);
-      const double bound_dual_step_length = PrimalDualInteriorPointSubproblem::dual_fraction_to_boundary(problem, current_multipliers, direction_multipliers, tau);
       DEBUG << "Fraction-to-boundary rules:\n";
       DEBUG << "primal step length = " << primal_step_length << '\n';
       DEBUG << "bound dual step length = " << bound_dual_step_length << "\n\n";
@@ -448,32 +620,59 @@ namespace uno {
       direction_multipliers.constraints.scale(primal_step_length);
       direction_multipliers.lower_bounds.scale(bound_dual_step_length);
       direction_multipliers.upper_bounds.scale(bound_dual_step_length);
+      // the norm scales like the primal direction: no extra pass needed
+      direction.norm = primal_step_length * unscaled_norm;
    }
 
-   void PrimalDualInteriorPointSubproblem::compute_bound_dual_direction(const OptimizationProblem& problem, const Vector<double>& current_primals,
-         const Multipliers& current_multipliers, const Vector<double>& primal_direction, Multipliers& direction_multipliers) {
+   // fused dual update kernel: computes the bound dual direction and applies the dual
+   // fraction-to-boundary rule in the same sweep, while the current dual, the primal direction and
+   // the dual direction are still in registers. This halves the memory traffic of the dual update
+   // on large bound-constrained problems
+   double PrimalDualInteriorPointSubproblem::compute_bound_dual_direction(const OptimizationProblem& problem, const Vector<double>& current_primals,
+         const Multipliers& current_multipliers, const Vector<double>& primal_direction, double tau, Multipliers& direction_multipliers) {
       direction_multipliers.lower_bounds.fill(0.);
       direction_multipliers.upper_bounds.fill(0.);
-      for (const size_t variable_index: problem.get_lower_bounded_variables()) {
+      double step_length = 1.;
+      // partitioned iteration (for_each): each part of the bound collections runs in its own tight loop
+      problem.get_lower_bounded_variables().for_each([&](size_t variable_index) {
+         const double current_dual = current_multipliers.lower_bounds[variable_index];
          const double distance_to_bound = current_primals[variable_index] - problem.variable_lower_bound(variable_index);
-         direction_multipliers.lower_bounds[variable_index] = (this->barrier_parameter() - primal_direction[variable_index] * current_multipliers.lower_bounds[variable_index]) /
-                                                              distance_to_bound - current_multipliers.lower_bounds[variable_index];
-         assert(is_finite(direction_multipliers.lower_bounds[variable_index]) && "The lower bound dual is infinite");
-      }
-      for (const size_t variable_index: problem.get_upper_bounded_variables()) {
+         // in predictor-corrector mode, the complementarity condition carries the second-order products of the predictor direction
+         const double second_order_term = this->use_predictor_corrector ? this->corrector_products_lower_bounds[variable_index] : 0.;
+         const double dual_direction = (this->barrier_parameter() - second_order_term - primal_direction[variable_index] * current_dual) /
+               distance_to_bound - current_dual;
+         assert(is_finite(dual_direction) && "The lower bound dual is infinite");
+         direction_multipliers.lower_bounds[variable_index] = dual_direction;
+         if (dual_direction < 0.) {
+            const double distance = -tau * current_dual / dual_direction;
+            if (0. < distance) {
+               step_length = std::min(step_length, distance);
+            }
+         }
+      });
+      problem.get_upper_bounded_variables().for_each([&](size_t variable_index) {
+         const double current_dual = current_multipliers.upper_bounds[variable_index];
          const double distance_to_bound = current_primals[variable_index] - problem.variable_upper_bound(variable_index);
-         direction_multipliers.upper_bounds[variable_index] = (this->barrier_parameter() - primal_direction[variable_index] * current_multipliers.upper_bounds[variable_index]) /
-                                                              distance_to_bound - current_multipliers.upper_bounds[variable_index];
-         assert(is_finite(direction_multipliers.upper_bounds[variable_index]) && "The upper bound dual is infinite");
-      }
+         const double second_order_term = this->use_predictor_corrector ? this->corrector_products_upper_bounds[variable_index] : 0.;
+         const double dual_direction = (this->barrier_parameter() - second_order_term - primal_direction[variable_index] * current_dual) /
+               distance_to_bound - current_dual;
+         assert(is_finite(dual_direction) && "The upper bound dual is infinite");
+         direction_multipliers.upper_bounds[variable_index] = dual_direction;
+         if (0. < dual_direction) {
+            const double distance = -tau * current_dual / dual_direction;
+            if (0. < distance) {
+               step_length = std::min(step_length, distance);
+            }
+         }
+      });
+      assert(0. < step_length && step_length <= 1. && "The dual fraction-to-boundary step length is not in (0, 1]");
+      return step_length;
    }
 
    void PrimalDualInteriorPointSubproblem::compute_least_square_multipliers(const OptimizationProblem& problem, Iterate& iterate,
          Vector<double>& constraint_multipliers) {
-      this->augmented_system.matrix.set_dimension(problem.number_variables + problem.number_constraints);
-      this->augmented_system.matrix.reset();
-      Preprocessing::compute_least_square_multipliers(problem.model, this->augmented_system.matrix, this->augmented_system.rhs, *this->linear_solver,
-            iterate, constraint_multipliers, this->least_square_multiplier_max_norm);
+      Preprocessing::compute_least_square_multipliers(problem.model, this->augmented_system, *this->linear_solver, iterate, constraint_multipliers,
+            this->least_square_multiplier_max_norm);
    }
 
    void PrimalDualInteriorPointSubproblem::postprocess_iterate(const OptimizationProblem& problem, Iterate& iterate) {
@@ -513,6 +712,59 @@ namespace uno {
             }
          }
       }
+      if (this->crossover_to_vertex && not this->solving_feasibility_problem) {
+         this->crossover_to_active_set(problem, iterate);
+      }
+      // publish the final barrier parameter for the later solves of the same family
+      if (TuningCache::active && not this->solving_feasibility_problem) {
+         TuningCache::store_barrier_parameter(this->tuning_fingerprint, this->barrier_parameter());
+      }
+   }
+
+   // crossover from the interior solution to a vertex-like one, for downstream warm-started
+   // active-set re-solves: identify the active bounds from the converged iterate, snap them and
+   // discard the fuzzy multipliers of the inactive ones, then polish the constraint multipliers
+   // with a least-squares solve at the snapped point. At convergence, complementarity makes the
+   // bound distance and the bound multiplier straddle sqrt(mu): comparing them identifies the
+   // active set without an extra tolerance
+   void PrimalDualInteriorPointSubproblem::crossover_to_active_set(const OptimizationProblem& problem, Iterate& iterate) {
+      size_t number_active_bounds = 0;
+      size_t number_zeroed_multipliers = 0;
+      for (const size_t variable_index: problem.get_lower_bounded_variables()) {
+         const double distance = iterate.primals[variable_index] - problem.variable_lower_bound(variable_index);
+         double& multiplier = iterate.multipliers.lower_bounds[variable_index];
+         if (distance < multiplier) {
+            iterate.primals[variable_index] = problem.variable_lower_bound(variable_index);
+            number_active_bounds++;
+         }
+         else if (multiplier != 0.) {
+            multiplier = 0.;
+            number_zeroed_multipliers++;
+         }
+      }
+      for (const size_t variable_index: problem.get_upper_bounded_variables()) {
+         const double distance = problem.variable_upper_bound(variable_index) - iterate.primals[variable_index];
+         // upper bound multipliers are nonpositive
+         double& multiplier = iterate.multipliers.upper_bounds[variable_index];
+         if (distance < -multiplier) {
+            iterate.primals[variable_index] = problem.variable_upper_bound(variable_index);
+            number_active_bounds++;
+         }
+         else if (multiplier != 0.) {
+            multiplier = 0.;
+            number_zeroed_multipliers++;
+         }
+      }
+      // the snapped primals invalidate the evaluations performed at the interior point
+      iterate.progress.reset();
+      iterate.is_objective_computed = false;
+      iterate.is_objective_gradient_computed = false;
+      iterate.are_constraints_computed = false;
+      iterate.is_constraint_jacobian_computed = false;
+      // dual polish: recompute the constraint multipliers at the snapped point
+      this->compute_least_square_multipliers(problem, iterate, iterate.multipliers.constraints);
+      INFO << "Crossover: " << number_active_bounds << " bounds snapped, " << number_zeroed_multipliers <<
+            " inactive multipliers zeroed\n";
    }
 
    void PrimalDualInteriorPointSubproblem::set_initial_point(const Vector<double>& /*point*/) {
@@ -23,10 +23,10 @@ namespace uno {
       double push_variable_to_interior_k2;
    };
 
-   class PrimalDualInteriorPointSubproblem : public Subproblem {
+   class PrimalDualInteriorPointSubproblem final : public Subproblem {
    public:
       PrimalDualInteriorPointSubproblem(size_t number_variables, size_t number_constraints, size_t number_jacobian_nonzeros,
-            size_t number_hessian_nonzeros, const Options& options);
+            size_t number_hessian_nonzeros, const Options& options, bool use_predictor_corrector = false);
 
       void initialize_statistics(Statistics& statistics, const Options& options) override;
       void generate_initial_iterate(const OptimizationProblem& problem, Iterate& initial_iterate) override;
@@ -39,6 +39,8 @@ namespace uno {
 
       void solve(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate,  const Multipliers& current_multipliers,
             Direction& direction, const WarmstartInformation& warmstart_information) override;
+      [[nodiscard]] bool compute_second_order_correction(const OptimizationProblem& problem, Iterate& current_iterate,
+            const Multipliers& current_multipliers, Iterate& trial_iterate, Direction& direction) override;
 
       void set_auxiliary_measure(const Model& model, Iterate& iterate) override;
       [[nodiscard]] double compute_predicted_auxiliary_reduction_model(const Model& model, const Iterate& current_iterate,
@@ -52,15 +54,42 @@ namespace uno {
       RectangularMatrix<double> constraint_jacobian; /*!< Sparse Jacobian of the constraints */
 
       SymmetricIndefiniteLinearSystem<double> augmented_system;
-      const std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<size_t, double>> linear_solver;
+      const std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> linear_solver;
 
-      BarrierParameterUpdateStrategy barrier_parameter_update_strategy;
+      const std::unique_ptr<BarrierParameterUpdateStrategy> barrier_parameter_update_strategy;
       double previous_barrier_parameter;
       const double default_multiplier;
       const InteriorPointParameters parameters;
       const double least_square_multiplier_max_norm;
       const double damping_factor; // (Section 3.7 in IPOPT paper)
       const double l1_constraint_violation_coefficient; // (rho in Section 3.3.1 in IPOPT paper)
+      // eliminate the slack variables from the augmented system before factorization (they only carry
+      // their diagonal barrier term and a single constraint coefficient)
+      const bool condense_slack_variables;
+      // Mehrotra-style second-order corrector: re-solve the corrected system against the same factorization
+      const bool use_predictor_corrector;
+      // stall rescue: consecutive small steps trigger a slack recentering and a barrier parameter reset
+      const double initial_barrier_parameter;
+      const size_t max_consecutive_small_steps;
+      size_t consecutive_small_steps{0};
+      // warm-started sequential solves: when set, generate_initial_iterate preserves the dual
+      // estimates of the previous solve from the second call on
+      const bool warm_start_ingredient_state;
+      bool already_initialized{false};
+      // pipelined iteration body: the Hessian/Jacobian evaluations, the matrix assembly and the
+      // factorization only feed the matrix side of the augmented system, while the objective
+      // gradient and constraint evaluations only feed the right-hand side; the two chains run
+      // concurrently when the model supports concurrent evaluations
+      const bool overlap_factorization;
+      // active-set crossover after convergence: snap the active bounds, zero the fuzzy multipliers
+      // of the inactive ones and polish the constraint multipliers (see crossover_to_active_set)
+      const bool crossover_to_vertex;
+      // cross-instance tuning memory (see TuningCache): the initial barrier parameter is seeded
+      // from the final value of the previous solves of the same model family
+      uint64_t tuning_fingerprint{0};
+      // second-order complementarity products of the predictor direction, consumed by the dual recovery
+      Vector<double> corrector_products_lower_bounds{};
+      Vector<double> corrector_products_upper_bounds{};
 
       bool solving_feasibility_problem{false};
       bool first_feasibility_iteration{false};
@@ -69,23 +98,28 @@ namespace uno {
       [[nodiscard]] double push_variable_to_interior(double variable_value, double lower_bound, double upper_bound) const;
       void evaluate_functions(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate, const Multipliers& current_multipliers,
             const WarmstartInformation& warmstart_information);
+      // the two halves of evaluate_functions, split by the side of the augmented system they feed
+      void evaluate_matrix_functions(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate,
+            const Multipliers& current_multipliers, const WarmstartInformation& warmstart_information);
+      void evaluate_rhs_functions(const OptimizationProblem& problem, Iterate& current_iterate, const WarmstartInformation& warmstart_information);
       void update_barrier_parameter(const OptimizationProblem& problem, const Iterate& current_iterate, const Multipliers& current_multipliers,
             const DualResiduals& residuals);
+      void rescue_stalled_solve(const OptimizationProblem& problem, Iterate& current_iterate);
       [[nodiscard]] bool is_small_step(const OptimizationProblem& problem, const Vector<double>& current_primals, const Vector<double>& direction_primals) const;
       [[nodiscard]] double evaluate_subproblem_objective(const Direction& direction) const;
       [[nodiscard]] double compute_barrier_term_directional_derivative(const Model& model, const Iterate& current_iterate,
             const Vector<double>& primal_direction) const;
       [[nodiscard]] static double primal_fraction_to_boundary(const OptimizationProblem& problem, const Vector<double>& current_primals,
             const Vector<double>& primal_direction, double tau);
-      [[nodiscard]] static double dual_fraction_to_boundary(const OptimizationProblem& problem, const Multipliers& current_multipliers,
-            Multipliers& direction_multipliers, double tau);
-      void assemble_augmented_system(Statistics& statistics, const OptimizationProblem& problem, const Multipliers& current_multipliers);
+      void assemble_augmented_system(Statistics& statistics, const OptimizationProblem& problem);
+      void apply_second_order_corrector(const OptimizationProblem& problem, const Vector<double>& current_primals, const Multipliers& current_multipliers);
       void assemble_augmented_rhs(const OptimizationProblem& problem, const Multipliers& current_multipliers);
       void assemble_primal_dual_direction(const OptimizationProblem& problem, const Vector<double>& current_primals, const Multipliers& current_multipliers,
-            Vector<double>& direction_primals, Multipliers& direction_multipliers);
-      void compute_bound_dual_direction(const OptimizationProblem& problem, const Vector<double>& current_primals, const Multipliers& current_multipliers,
-            const Vector<double>& primal_direction, Multipliers& direction_multipliers);
+            Direction& direction);
+      [[nodiscard]] double compute_bound_dual_direction(const OptimizationProblem& problem, const Vector<double>& current_primals,
+            const Multipliers& current_multipliers, const Vector<double>& primal_direction, double tau, Multipliers& direction_multipliers);
       void compute_least_square_multipliers(const OptimizationProblem& problem, Iterate& iterate, Vector<double>& constraint_multipliers);
+      void crossover_to_active_set(const OptimizationProblem& problem, Iterate& iterate);
    };
 } // namespace
 
@@ -0,0 +1,94 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BLASKERNELS_H
+#define UNO_BLASKERNELS_H
+
+#include <cstddef>
+#include <limits>
+#include "tools/ThreadPool.hpp"
+
+#ifdef HAS_BLAS
+extern "C" {
+   double ddot_(const int* n, const double* x, const int* incx, const double* y, const int* incy);
+   double dasum_(const int* n, const double* x, const int* incx);
+   void dscal_(const int* n, const double* alpha, double* x, const int* incx);
+   void daxpy_(const int* n, const double* alpha, const double* x, const int* incx, double* y, const int* incy);
+}
+#endif
+
+namespace uno {
+   // number of elements above which the dense double kernels are handed to the vendor BLAS: below
+   // it, the call overhead dominates and the compiler-vectorized loops win
+   constexpr size_t BLAS_MINIMUM_SIZE = 8192;
+
+   // true when a dense double kernel of this size should go to the vendor BLAS. The deterministic
+   // mode keeps the hand-rolled reductions: a threaded BLAS has its own summation order and would
+   // reintroduce run-to-run variations
+   inline bool use_blas(size_t size) {
+#ifdef HAS_BLAS
+      return BLAS_MINIMUM_SIZE <= size && size <= static_cast<size_t>(std::numeric_limits<int>::max()) &&
+             not ThreadPool::deterministic;
+#else
+      (void) size;
+      return false;
+#endif
+   }
+
+   // thin wrappers over the Fortran BLAS symbols. Without a vendor BLAS, scalar fallbacks keep the
+   // call sites compilable; they are unreachable, since use_blas is then always false
+   inline double blas_dot(size_t size, const double* x, const double* y) {
+#ifdef HAS_BLAS
+      const int n = static_cast<int>(size);
+      const int increment = 1;
+      return ddot_(&n, x, &increment, y, &increment);
+#else
+      double result = 0.;
+      for (size_t index = 0; index < size; index++) {
+         result += x[index] * y[index];
+      }
+      return result;
+#endif
+   }
+
+   inline double blas_sum_absolute_values(size_t size, const double* x) {
+#ifdef HAS_BLAS
+      const int n = static_cast<int>(size);
+      const int increment = 1;
+      return dasum_(&n, x, &increment);
+#else
+      double result = 0.;
+      for (size_t index = 0; index < size; index++) {
+         result += (0. <= x[index]) ? x[index] : -x[index];
+      }
+      return result;
+#endif
+   }
+
+   inline void blas_scale(size_t size, double factor, double* x) {
+#ifdef HAS_BLAS
+      const int n = static_cast<int>(size);
+      const int increment = 1;
+      dscal_(&n, &factor, x, &increment);
+#else
+      for (size_t index = 0; index < size; index++) {
+         x[index] *= factor;
+      }
+#endif
+   }
+
+   // y += factor*x
+   inline void blas_axpy(size_t size, double factor, const double* x, double* y) {
+#ifdef HAS_BLAS
+      const int n = static_cast<int>(size);
+      const int increment = 1;
+      daxpy_(&n, &factor, x, &increment, y, &increment);
+#else
+      for (size_t index = 0; index < size; index++) {
+         y[index] += factor * x[index];
+      }
+#endif
+   }
+} // namespace
+
+#endif // UNO_BLASKERNELS_H
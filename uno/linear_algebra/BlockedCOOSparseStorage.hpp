@@ -0,0 +1,130 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BLOCKEDCOOSPARSESTORAGE_H
+#define UNO_BLOCKEDCOOSPARSESTORAGE_H
+
+#include "COOSparseStorage.hpp"
+#include "symbolic/Range.hpp"
+
+namespace uno {
+   /*
+    * Coordinate list with dense block detection
+    *
+    * Structured problems (e.g. collocated optimal control) produce Hessians whose columns contain
+    * long runs of consecutive rows. Since the matrices are assembled column by column, these runs
+    * are contiguous in the coordinate list. This storage detects them once the pattern is complete
+    * and services quadratic products with small dense kernels over the runs (contiguous loads, no
+    * per-element index lookups), which improves cache behavior over the element-wise traversal.
+    * The detected runs remain valid as long as only the values change (in-place updates through
+    * data_pointer() or set_regularization()); they are recomputed lazily after any insertion.
+    */
+   template <typename IndexType, typename ElementType>
+   class BlockedCOOSparseStorage : public COOSparseStorage<IndexType, ElementType> {
+   public:
+      BlockedCOOSparseStorage(size_t dimension, size_t capacity, bool use_regularization);
+
+      void reset() override;
+      void insert(ElementType term, IndexType row_index, IndexType column_index) override;
+      void compress() override;
+      [[nodiscard]] ElementType quadratic_product(const ElementType* x, const ElementType* y) const override;
+
+      // number of detected runs (for testing purposes)
+      [[nodiscard]] size_t number_dense_runs() const;
+
+   protected:
+      // maximal sequence of consecutively stored nonzeros that share a column and have consecutive rows
+      struct DenseRun {
+         size_t start_nonzero;
+         size_t first_row;
+         size_t column_index;
+         size_t length;
+      };
+      mutable std::vector<DenseRun> dense_runs;
+      mutable bool runs_up_to_date{false};
+
+      void detect_dense_runs() const;
+   };
+
+   // implementation
+
+   template <typename IndexType, typename ElementType>
+   BlockedCOOSparseStorage<IndexType, ElementType>::BlockedCOOSparseStorage(size_t dimension, size_t capacity, bool use_regularization):
+         COOSparseStorage<IndexType, ElementType>(dimension, capacity, use_regularization) {
+   }
+
+   template <typename IndexType, typename ElementType>
+   void BlockedCOOSparseStorage<IndexType, ElementType>::reset() {
+      COOSparseStorage<IndexType, ElementType>::reset();
+      this->runs_up_to_date = false;
+   }
+
+   template <typename IndexType, typename ElementType>
+   void BlockedCOOSparseStorage<IndexType, ElementType>::insert(ElementType term, IndexType row_index, IndexType column_index) {
+      COOSparseStorage<IndexType, ElementType>::insert(term, row_index, column_index);
+      this->runs_up_to_date = false;
+   }
+
+   template <typename IndexType, typename ElementType>
+   void BlockedCOOSparseStorage<IndexType, ElementType>::compress() {
+      COOSparseStorage<IndexType, ElementType>::compress();
+      // the merge reorders the entries: the runs must be detected again
+      this->runs_up_to_date = false;
+   }
+
+   template <typename IndexType, typename ElementType>
+   void BlockedCOOSparseStorage<IndexType, ElementType>::detect_dense_runs() const {
+      this->dense_runs.clear();
+      for (size_t nonzero_index: Range(this->number_nonzeros)) {
+         const size_t row_index = static_cast<size_t>(this->row_indices[nonzero_index]);
+         const size_t column_index = static_cast<size_t>(this->column_indices[nonzero_index]);
+         if (not this->dense_runs.empty()) {
+            DenseRun& current_run = this->dense_runs.back();
+            // extend the current run if this nonzero continues the column with the next row
+            if (column_index == current_run.column_index && row_index == current_run.first_row + current_run.length) {
+               current_run.length++;
+               continue;
+            }
+         }
+         this->dense_runs.push_back({nonzero_index, row_index, column_index, 1});
+      }
+      this->runs_up_to_date = true;
+   }
+
+   template <typename IndexType, typename ElementType>
+   ElementType BlockedCOOSparseStorage<IndexType, ElementType>::quadratic_product(const ElementType* x, const ElementType* y) const {
+      if (not this->runs_up_to_date) {
+         this->detect_dense_runs();
+      }
+      ElementType result = ElementType(0);
+      for (const DenseRun& run: this->dense_runs) {
+         // dense kernel over the run: two dot products on contiguous data
+         const ElementType* values = &this->entries[run.start_nonzero];
+         const ElementType* x_run = &x[run.first_row];
+         const ElementType* y_run = &y[run.first_row];
+         ElementType dot_x = ElementType(0);
+         ElementType dot_y = ElementType(0);
+         for (size_t k: Range(run.length)) {
+            dot_x += values[k] * x_run[k];
+            dot_y += values[k] * y_run[k];
+         }
+         // every element of the run is treated as off-diagonal: m(i, j) contributes m*(x_i*y_j + x_j*y_i)
+         result += dot_x * y[run.column_index] + dot_y * x[run.column_index];
+         // the diagonal element, if the run contains it, was counted twice
+         if (run.first_row <= run.column_index && run.column_index < run.first_row + run.length) {
+            result -= values[run.column_index - run.first_row] * x[run.column_index] * y[run.column_index];
+         }
+      }
+      return result;
+   }
+
+   template <typename IndexType, typename ElementType>
+   size_t BlockedCOOSparseStorage<IndexType, ElementType>::number_dense_runs() const {
+      if (not this->runs_up_to_date) {
+         this->detect_dense_runs();
+      }
+      return this->dense_runs.size();
+   }
+} // namespace
+
+#endif // UNO_BLOCKEDCOOSPARSESTORAGE_H
@@ -4,9 +4,14 @@
 #ifndef UNO_COOSPARSESTORAGE_H
 #define UNO_COOSPARSESTORAGE_H
 
+#include <algorithm>
 #include <cassert>
+#include <numeric>
+#include <tuple>
+#include "FirstTouchAllocator.hpp"
 #include "SparseStorage.hpp"
 #include "symbolic/Range.hpp"
+#include "tools/Prefetch.hpp"
 
 namespace uno {
    /*
@@ -21,7 +26,10 @@ namespace uno {
       void reset() override;
       void insert(ElementType term, IndexType row_index, IndexType column_index) override;
       void finalize_column(IndexType /*column_index*/) override { /* do nothing */ }
+      void compress() override;
       void set_regularization(const std::function<ElementType(size_t index)>& regularization_function) override;
+      void for_each(const std::function<void(IndexType, IndexType, ElementType)>& f) const override;
+      [[nodiscard]] ElementType quadratic_product(const ElementType* x, const ElementType* y) const override;
       const ElementType* data_pointer() const noexcept override { return this->entries.data(); }
       ElementType* data_pointer() noexcept override { return this->entries.data(); }
 
@@ -41,9 +49,10 @@ namespace uno {
       }
 
    protected:
-      std::vector<ElementType> entries;
-      std::vector<IndexType> row_indices;
-      std::vector<IndexType> column_indices;
+      // NUMA-friendly placement of the large arrays (see FirstTouchAllocator)
+      std::vector<ElementType, FirstTouchAllocator<ElementType>> entries;
+      std::vector<IndexType, FirstTouchAllocator<IndexType>> row_indices;
+      std::vector<IndexType, FirstTouchAllocator<IndexType>> column_indices;
 
       void initialize_regularization();
 
@@ -91,6 +100,53 @@ namespace uno {
       this->number_nonzeros++;
    }
 
+   // sort the entries by increasing (column, row) and sum the duplicates in place. The assembly may
+   // produce several entries for the same (row, column) pair (e.g. shared partials in a Lagrangian
+   // Hessian), which the direct solvers then sum internally at every call: merging them once shrinks
+   // the number of nonzeros handed over. The regularization terms at the start of the entries are
+   // left untouched, so that set_regularization() keeps writing to fixed slots
+   template <typename IndexType, typename ElementType>
+   void COOSparseStorage<IndexType, ElementType>::compress() {
+      const size_t offset = this->use_regularization ? this->dimension : 0;
+      if (this->number_nonzeros <= offset + 1) {
+         return;
+      }
+      // sort a permutation of the entries beyond the regularization prefix by increasing (column, row)
+      std::vector<size_t> order(this->number_nonzeros - offset);
+      std::iota(order.begin(), order.end(), offset);
+      std::sort(order.begin(), order.end(), [&](size_t k1, size_t k2) {
+         return std::tie(this->column_indices[k1], this->row_indices[k1]) < std::tie(this->column_indices[k2], this->row_indices[k2]);
+      });
+
+      // apply the permutation and merge the duplicates in a single pass
+      std::vector<ElementType> merged_entries;
+      std::vector<IndexType> merged_row_indices;
+      std::vector<IndexType> merged_column_indices;
+      merged_entries.reserve(order.size());
+      merged_row_indices.reserve(order.size());
+      merged_column_indices.reserve(order.size());
+      for (size_t nonzero_index: order) {
+         if (not merged_entries.empty() && merged_row_indices.back() == this->row_indices[nonzero_index] &&
+               merged_column_indices.back() == this->column_indices[nonzero_index]) {
+            merged_entries.back() += this->entries[nonzero_index];
+         }
+         else {
+            merged_entries.emplace_back(this->entries[nonzero_index]);
+            merged_row_indices.emplace_back(this->row_indices[nonzero_index]);
+            merged_column_indices.emplace_back(this->column_indices[nonzero_index]);
+         }
+      }
+
+      // write the merged entries back after the regularization prefix
+      this->entries.resize(offset + merged_entries.size());
+      this->row_indices.resize(offset + merged_entries.size());
+      this->column_indices.resize(offset + merged_entries.size());
+      std::copy(merged_entries.begin(), merged_entries.end(), this->entries.begin() + static_cast<long>(offset));
+      std::copy(merged_row_indices.begin(), merged_row_indices.end(), this->row_indices.begin() + static_cast<long>(offset));
+      std::copy(merged_column_indices.begin(), merged_column_indices.end(), this->column_indices.begin() + static_cast<long>(offset));
+      this->number_nonzeros = offset + merged_entries.size();
+   }
+
    template <typename IndexType, typename ElementType>
    void COOSparseStorage<IndexType, ElementType>::set_regularization(const std::function<ElementType(size_t /*index*/)>& regularization_function) {
       assert(this->use_regularization && "You are trying to regularize a matrix where regularization was not preallocated.");
@@ -102,6 +158,38 @@ namespace uno {
       }
    }
 
+   template <typename IndexType, typename ElementType>
+   void COOSparseStorage<IndexType, ElementType>::for_each(const std::function<void(IndexType, IndexType, ElementType)>& f) const {
+      for (size_t nonzero_index: Range(this->number_nonzeros)) {
+         f(this->row_indices[nonzero_index], this->column_indices[nonzero_index], this->entries[nonzero_index]);
+      }
+   }
+
+   // raw walk over the triplet arrays with four independent accumulators: avoids the per-nonzero
+   // std::function call of the generic implementation and breaks the dependency chain of the sum
+   template <typename IndexType, typename ElementType>
+   ElementType COOSparseStorage<IndexType, ElementType>::quadratic_product(const ElementType* x, const ElementType* y) const {
+      const ElementType* values = this->entries.data();
+      const IndexType* rows = this->row_indices.data();
+      const IndexType* columns = this->column_indices.data();
+      ElementType partial_sums[4] = {ElementType(0), ElementType(0), ElementType(0), ElementType(0)};
+      for (size_t nonzero_index: Range(this->number_nonzeros)) {
+         // the index arrays stream sequentially, but the x/y accesses they drive are scattered and
+         // latency-bound: prefetch the operands of a later nonzero while this one is processed
+         if (nonzero_index + PREFETCH_DISTANCE < this->number_nonzeros) {
+            prefetch_read(&x[rows[nonzero_index + PREFETCH_DISTANCE]]);
+            prefetch_read(&y[columns[nonzero_index + PREFETCH_DISTANCE]]);
+         }
+         const IndexType row_index = rows[nonzero_index];
+         const IndexType column_index = columns[nonzero_index];
+         const ElementType term = (row_index == column_index) ?
+            values[nonzero_index] * x[row_index] * y[row_index] :
+            values[nonzero_index] * (x[row_index] * y[column_index] + x[column_index] * y[row_index]);
+         partial_sums[nonzero_index % 4] += term;
+      }
+      return (partial_sums[0] + partial_sums[1]) + (partial_sums[2] + partial_sums[3]);
+   }
+
    template <typename IndexType, typename ElementType>
    void COOSparseStorage<IndexType, ElementType>::print(std::ostream& stream) const {
       for (const auto [row_index, column_index, element]: *this) {
@@ -5,9 +5,11 @@
 #define UNO_CSCSPARSESTORAGE_H
 
 #include <cassert>
+#include "FirstTouchAllocator.hpp"
 #include "SparseStorage.hpp"
 #include "linear_algebra/Vector.hpp"
 #include "tools/Infinity.hpp"
+#include "tools/Prefetch.hpp"
 #include "symbolic/VectorView.hpp"
 
 namespace uno {
@@ -24,23 +26,26 @@ namespace uno {
       void reset() override;
       void insert(ElementType term, IndexType row_index, IndexType column_index) override;
       void finalize_column(IndexType column_index) override;
-      void set_regularization(const std::function<ElementType(IndexType /*index*/)>& regularization_function) override;
+      void set_regularization(const std::function<ElementType(size_t /*index*/)>& regularization_function) override;
+      void for_each(const std::function<void(IndexType, IndexType, ElementType)>& f) const override;
+      [[nodiscard]] ElementType quadratic_product(const ElementType* x, const ElementType* y) const override;
       const ElementType* data_pointer() const noexcept override { return this->entries.data(); }
       ElementType* data_pointer() noexcept override { return this->entries.data(); }
 
       void print(std::ostream& stream) const override;
 
    protected:
-      std::vector<ElementType> entries;
+      // NUMA-friendly placement of the large arrays (see FirstTouchAllocator)
+      std::vector<ElementType, FirstTouchAllocator<ElementType>> entries;
       // entries and row_indices have nnz elements
       // column_starts has dimension+1 elements
       Vector<IndexType> column_starts{};
-      std::vector<IndexType> row_indices{};
+      std::vector<IndexType, FirstTouchAllocator<IndexType>> row_indices{};
       IndexType current_column{0};
 
       // iterator functions
-      [[nodiscard]] std::tuple<IndexType, IndexType, ElementType> dereference_iterator(IndexType column_index, size_t nonzero_index) const override;
-      void increment_iterator(IndexType& column_index, IndexType& nonzero_index) const override;
+      [[nodiscard]] std::tuple<IndexType, IndexType, ElementType> dereference_iterator(size_t column_index, size_t nonzero_index) const override;
+      void increment_iterator(size_t& column_index, size_t& nonzero_index) const override;
    };
 
    template <typename IndexType, typename ElementType>
@@ -89,7 +94,7 @@ namespace uno {
    }
 
    template <typename IndexType, typename ElementType>
-   void CSCSparseStorage<IndexType, ElementType>::set_regularization(const std::function<ElementType(IndexType /*index*/)>& regularization_function) {
+   void CSCSparseStorage<IndexType, ElementType>::set_regularization(const std::function<ElementType(size_t /*index*/)>& regularization_function) {
       assert(this->use_regularization && "You are trying to regularize a matrix where regularization was not preallocated.");
 
       for (size_t row_index: Range(this->dimension)) {
@@ -101,13 +106,50 @@ namespace uno {
    }
 
    template <typename IndexType, typename ElementType>
-   std::tuple<IndexType, IndexType, ElementType> CSCSparseStorage<IndexType, ElementType>::dereference_iterator(IndexType column_index,
+   void CSCSparseStorage<IndexType, ElementType>::for_each(const std::function<void(IndexType, IndexType, ElementType)>& f) const {
+      for (size_t column_index: Range(this->dimension)) {
+         for (size_t nonzero_index: Range(static_cast<size_t>(this->column_starts[column_index]),
+               static_cast<size_t>(this->column_starts[column_index + 1]))) {
+            f(this->row_indices[nonzero_index], static_cast<IndexType>(column_index), this->entries[nonzero_index]);
+         }
+      }
+   }
+
+   // raw walk over the compressed columns with four independent accumulators: avoids the
+   // per-nonzero std::function call of the generic implementation
+   template <typename IndexType, typename ElementType>
+   ElementType CSCSparseStorage<IndexType, ElementType>::quadratic_product(const ElementType* x, const ElementType* y) const {
+      const ElementType* values = this->entries.data();
+      const IndexType* rows = this->row_indices.data();
+      ElementType partial_sums[4] = {ElementType(0), ElementType(0), ElementType(0), ElementType(0)};
+      for (size_t column_index: Range(this->dimension)) {
+         const ElementType x_column = x[column_index];
+         const ElementType y_column = y[column_index];
+         for (size_t nonzero_index: Range(static_cast<size_t>(this->column_starts[column_index]),
+               static_cast<size_t>(this->column_starts[column_index + 1]))) {
+            // the scattered x/y accesses are latency-bound: prefetch the operands a few nonzeros ahead
+            if (nonzero_index + PREFETCH_DISTANCE < this->number_nonzeros) {
+               prefetch_read(&x[rows[nonzero_index + PREFETCH_DISTANCE]]);
+               prefetch_read(&y[rows[nonzero_index + PREFETCH_DISTANCE]]);
+            }
+            const IndexType row_index = rows[nonzero_index];
+            const ElementType term = (static_cast<size_t>(row_index) == column_index) ?
+               values[nonzero_index] * x_column * y_column :
+               values[nonzero_index] * (x[row_index] * y_column + x_column * y[row_index]);
+            partial_sums[nonzero_index % 4] += term;
+         }
+      }
+      return (partial_sums[0] + partial_sums[1]) + (partial_sums[2] + partial_sums[3]);
+   }
+
+   template <typename IndexType, typename ElementType>
+   std::tuple<IndexType, IndexType, ElementType> CSCSparseStorage<IndexType, ElementType>::dereference_iterator(size_t column_index,
          size_t nonzero_index) const {
       return {this->row_indices[nonzero_index], column_index, this->entries[nonzero_index]};
    }
 
    template <typename IndexType, typename ElementType>
-   void CSCSparseStorage<IndexType, ElementType>::increment_iterator(IndexType& column_index, IndexType& nonzero_index) const {
+   void CSCSparseStorage<IndexType, ElementType>::increment_iterator(size_t& column_index, size_t& nonzero_index) const {
       if (this->column_starts[column_index] <= nonzero_index && nonzero_index + 1 < this->column_starts[column_index + 1]) {
          // stay in the column
          nonzero_index++;
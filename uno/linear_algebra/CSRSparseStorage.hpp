@@ -0,0 +1,153 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_CSRSPARSESTORAGE_H
+#define UNO_CSRSPARSESTORAGE_H
+
+#include <cassert>
+#include "FirstTouchAllocator.hpp"
+#include "SparseStorage.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "symbolic/VectorView.hpp"
+
+namespace uno {
+   /*
+    * Compressed Sparse Row
+    * https://en.wikipedia.org/wiki/Sparse_matrix#Compressed_sparse_row_(CSR,_CRS_or_Yale_format)
+    *
+    * The storage is used for symmetric matrices that are built column by column. Since the matrix
+    * is symmetric, finalizing column j is equivalent to finalizing row j: the entries of a column
+    * are stored contiguously as a row slice, which vectorizes row-oriented products
+    */
+   template <typename IndexType, typename ElementType>
+   class CSRSparseStorage : public SparseStorage<IndexType, ElementType> {
+   public:
+      CSRSparseStorage(size_t dimension, size_t capacity, bool use_regularization);
+
+      void reset() override;
+      void insert(ElementType term, IndexType row_index, IndexType column_index) override;
+      void finalize_column(IndexType column_index) override;
+      void set_regularization(const std::function<ElementType(size_t /*index*/)>& regularization_function) override;
+      void for_each(const std::function<void(IndexType, IndexType, ElementType)>& f) const override;
+      const ElementType* data_pointer() const noexcept override { return this->entries.data(); }
+      ElementType* data_pointer() noexcept override { return this->entries.data(); }
+
+      void print(std::ostream& stream) const override;
+
+   protected:
+      // NUMA-friendly placement of the large arrays (see FirstTouchAllocator)
+      std::vector<ElementType, FirstTouchAllocator<ElementType>> entries;
+      // entries and column_indices have nnz elements
+      // row_starts has dimension+1 elements
+      Vector<IndexType> row_starts{};
+      std::vector<IndexType, FirstTouchAllocator<IndexType>> column_indices{};
+      IndexType current_row{0};
+
+      // iterator functions
+      [[nodiscard]] std::tuple<IndexType, IndexType, ElementType> dereference_iterator(size_t row_index, size_t nonzero_index) const override;
+      void increment_iterator(size_t& row_index, size_t& nonzero_index) const override;
+   };
+
+   // implementation
+
+   template <typename IndexType, typename ElementType>
+   CSRSparseStorage<IndexType, ElementType>::CSRSparseStorage(size_t dimension, size_t capacity, bool use_regularization):
+         SparseStorage<IndexType, ElementType>(dimension, capacity, use_regularization),
+         row_starts(dimension + 1) {
+      this->entries.reserve(this->capacity);
+      this->column_indices.reserve(this->capacity);
+   }
+
+   template <typename IndexType, typename ElementType>
+   void CSRSparseStorage<IndexType, ElementType>::reset() {
+      // empty the matrix
+      this->number_nonzeros = 0;
+      this->entries.clear();
+      this->column_indices.clear();
+      this->row_starts.fill(0);
+      this->current_row = 0;
+   }
+
+   template <typename IndexType, typename ElementType>
+   void CSRSparseStorage<IndexType, ElementType>::insert(ElementType term, IndexType row_index, IndexType column_index) {
+      assert(column_index == this->current_row && "The previous rows should be finalized");
+
+      // by symmetry, the (row_index, column_index) entry of column column_index is stored as the
+      // (column_index, row_index) entry of row column_index
+      this->entries.emplace_back(term);
+      this->column_indices.emplace_back(row_index);
+      this->row_starts[column_index + 1]++;
+      this->number_nonzeros++;
+   }
+
+   template <typename IndexType, typename ElementType>
+   void CSRSparseStorage<IndexType, ElementType>::finalize_column(IndexType column_index) {
+      assert(column_index == this->current_row && "You are not finalizing the current row");
+      assert(column_index < this->dimension && "The dimension of the matrix was exceeded");
+
+      // possibly add regularization
+      if (this->use_regularization) {
+         this->insert(ElementType(0), column_index, column_index);
+      }
+      this->current_row++;
+
+      // start the next row at the current start
+      if (column_index < this->dimension - 1) {
+         this->row_starts[column_index + 2] = this->row_starts[column_index + 1];
+      }
+   }
+
+   template <typename IndexType, typename ElementType>
+   void CSRSparseStorage<IndexType, ElementType>::set_regularization(const std::function<ElementType(size_t /*index*/)>& regularization_function) {
+      assert(this->use_regularization && "You are trying to regularize a matrix where regularization was not preallocated.");
+
+      for (size_t row_index: Range(this->dimension)) {
+         // the regularization term is located at the end of the row, that is right before the start of the next row
+         const size_t k = static_cast<size_t>(this->row_starts[row_index + 1] - 1);
+         const ElementType element = regularization_function(row_index);
+         this->entries[k] = element;
+      }
+   }
+
+   template <typename IndexType, typename ElementType>
+   void CSRSparseStorage<IndexType, ElementType>::for_each(const std::function<void(IndexType, IndexType, ElementType)>& f) const {
+      for (size_t row_index: Range(this->dimension)) {
+         for (size_t nonzero_index: Range(static_cast<size_t>(this->row_starts[row_index]),
+               static_cast<size_t>(this->row_starts[row_index + 1]))) {
+            // restore the (row, column) orientation in which the entry was inserted
+            f(this->column_indices[nonzero_index], static_cast<IndexType>(row_index), this->entries[nonzero_index]);
+         }
+      }
+   }
+
+   template <typename IndexType, typename ElementType>
+   std::tuple<IndexType, IndexType, ElementType> CSRSparseStorage<IndexType, ElementType>::dereference_iterator(size_t row_index,
+         size_t nonzero_index) const {
+      // restore the (row, column) orientation in which the entry was inserted
+      return {this->column_indices[nonzero_index], static_cast<IndexType>(row_index), this->entries[nonzero_index]};
+   }
+
+   template <typename IndexType, typename ElementType>
+   void CSRSparseStorage<IndexType, ElementType>::increment_iterator(size_t& row_index, size_t& nonzero_index) const {
+      if (this->row_starts[row_index] <= nonzero_index && nonzero_index + 1 < this->row_starts[row_index + 1]) {
+         // stay in the row
+         nonzero_index++;
+      }
+      else {
+         // move on to the next non-empty row
+         do {
+            row_index++;
+         } while (row_index < this->dimension && this->row_starts[row_index] == this->row_starts[row_index + 1]);
+         nonzero_index = this->row_starts[row_index];
+      }
+   }
+
+   template <typename IndexType, typename ElementType>
+   void CSRSparseStorage<IndexType, ElementType>::print(std::ostream& stream) const {
+      stream << "W = "; print_vector(stream, view(this->entries, 0, this->number_nonzeros));
+      stream << "with row start: "; print_vector(stream, view(this->row_starts, 0, this->dimension + 1));
+      stream << "and column index: "; print_vector(stream, view(this->column_indices, 0, this->number_nonzeros));
+   }
+} // namespace
+
+#endif // UNO_CSRSPARSESTORAGE_H
@@ -0,0 +1,8 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "CompensatedSum.hpp"
+
+namespace uno {
+   bool ExtendedPrecision::enabled = false;
+} // namespace
@@ -0,0 +1,42 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_COMPENSATEDSUM_H
+#define UNO_COMPENSATEDSUM_H
+
+#include <cmath>
+
+namespace uno {
+   // double-double accumulator (Neumaier variant of the Kahan summation): the running sum carries
+   // a compensation term that captures the rounding error of every addition, so that cancellation
+   // between large terms does not pollute the small quantity that remains
+   struct CompensatedSum {
+      double sum{0.};
+      double compensation{0.};
+
+      void add(double term) {
+         const double new_sum = this->sum + term;
+         if (std::abs(term) <= std::abs(this->sum)) {
+            this->compensation += (this->sum - new_sum) + term;
+         }
+         else {
+            this->compensation += (term - new_sum) + this->sum;
+         }
+         this->sum = new_sum;
+      }
+
+      [[nodiscard]] double result() const {
+         return this->sum + this->compensation;
+      }
+   };
+
+   // process-wide switch of the extended-precision tail phase (see option extended_precision_residuals):
+   // armed by the constraint relaxation strategy once the primal feasibility crosses the threshold,
+   // and consulted by the accumulation kernels of the dual residuals
+   class ExtendedPrecision {
+   public:
+      static bool enabled;
+   };
+} // namespace
+
+#endif // UNO_COMPENSATEDSUM_H
@@ -0,0 +1,50 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cstdint>
+#include "FirstTouchAllocator.hpp"
+#include "tools/ThreadPool.hpp"
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace uno {
+   bool FirstTouchAllocation::interleave = false;
+   bool FirstTouchAllocation::huge_pages = false;
+
+   // one write per page, performed from the pool workers: each page is placed on the memory node of
+   // the worker that picks its chunk, before the sequential value initialization writes to the
+   // already-placed pages. With a single-threaded pool, this degenerates to a sequential touch
+   void FirstTouchAllocation::touch_pages(void* pointer, size_t number_bytes) {
+      constexpr size_t PAGE_SIZE = 4096;
+      constexpr size_t PAGES_PER_CHUNK = 64;
+      char* bytes = static_cast<char*>(pointer);
+      const size_t number_pages = (number_bytes + PAGE_SIZE - 1) / PAGE_SIZE;
+      const size_t number_chunks = (number_pages + PAGES_PER_CHUNK - 1) / PAGES_PER_CHUNK;
+      ThreadPool::global().parallel_for(number_chunks, [&](size_t chunk_index) {
+         const size_t first_page = chunk_index * PAGES_PER_CHUNK;
+         const size_t last_page = std::min(first_page + PAGES_PER_CHUNK, number_pages);
+         for (size_t page_index = first_page; page_index < last_page; page_index++) {
+            bytes[page_index * PAGE_SIZE] = 0;
+         }
+      });
+   }
+
+   // best-effort advice to back the allocation with 2MB transparent huge pages. madvise requires
+   // page-aligned addresses and only whole huge pages help, so the advice covers the 2MB-aligned
+   // interior of the range; an unsupported kernel simply ignores it
+   void FirstTouchAllocation::advise_huge_pages(void* pointer, size_t number_bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+      const auto start = reinterpret_cast<uintptr_t>(pointer);
+      const uintptr_t aligned_start = (start + FirstTouchAllocation::HUGE_PAGE_BYTES - 1) & ~(FirstTouchAllocation::HUGE_PAGE_BYTES - 1);
+      const uintptr_t aligned_end = (start + number_bytes) & ~(FirstTouchAllocation::HUGE_PAGE_BYTES - 1);
+      if (aligned_start < aligned_end) {
+         madvise(reinterpret_cast<void*>(aligned_start), aligned_end - aligned_start, MADV_HUGEPAGE);
+      }
+#else
+      (void) pointer;
+      (void) number_bytes;
+#endif
+   }
+} // namespace
@@ -0,0 +1,82 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_FIRSTTOUCHALLOCATOR_H
+#define UNO_FIRSTTOUCHALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include "tools/AllocationTracker.hpp"
+
+namespace uno {
+   /*
+    * First-touch placement of the large solver arrays
+    *
+    * On NUMA machines, a page is physically allocated on the memory node of the thread that first
+    * writes to it. The default allocator leaves the first touch to the sequential initialization,
+    * which lands every page on the socket of the solver thread; the memory-bound sweeps running on
+    * another socket then pay the cross-node bandwidth penalty. When the NUMA_first_touch_interleave
+    * option is set, the pages of the large allocations are touched from the global thread pool right
+    * after being reserved, spreading them across the nodes that the pool workers run on.
+    */
+   class FirstTouchAllocation {
+   public:
+      // runtime policy, set once at startup from the options
+      static bool interleave;
+      // when set, the kernel is advised to back the large allocations with 2MB transparent huge
+      // pages, reducing the TLB pressure of the factorizations and vector sweeps
+      static bool huge_pages;
+      // allocations smaller than this bypass the parallel first touch
+      static constexpr size_t MINIMUM_BYTES = size_t(1) << 20;
+      static constexpr size_t HUGE_PAGE_BYTES = size_t(1) << 21;
+      // every allocation is cache-line aligned: a 64-byte boundary never splits a vector lane, and
+      // it is the strictest requirement of the AVX-512 aligned loads and of the BLAS fast paths
+      static constexpr size_t ALIGNMENT = 64;
+
+      static void touch_pages(void* pointer, size_t number_bytes);
+      static void advise_huge_pages(void* pointer, size_t number_bytes);
+   };
+
+   // minimal allocator whose only deviations from std::allocator are the 64-byte alignment and the
+   // optional parallel first touch
+   template <typename ElementType>
+   class FirstTouchAllocator {
+   public:
+      using value_type = ElementType;
+
+      FirstTouchAllocator() noexcept = default;
+      template <typename OtherElementType>
+      FirstTouchAllocator(const FirstTouchAllocator<OtherElementType>& /*other*/) noexcept { }
+
+      [[nodiscard]] ElementType* allocate(size_t number_elements) {
+         // single choke point of the solver containers: report to the allocation instrumentation
+         AllocationTracker::record();
+         const size_t number_bytes = number_elements * sizeof(ElementType);
+         auto* pointer = static_cast<ElementType*>(::operator new(number_bytes, std::align_val_t(FirstTouchAllocation::ALIGNMENT)));
+         // the advice must precede the first write, so that the pages fault in as huge pages
+         if (FirstTouchAllocation::huge_pages && FirstTouchAllocation::HUGE_PAGE_BYTES <= number_bytes) {
+            FirstTouchAllocation::advise_huge_pages(pointer, number_bytes);
+         }
+         if (FirstTouchAllocation::interleave && FirstTouchAllocation::MINIMUM_BYTES <= number_bytes) {
+            FirstTouchAllocation::touch_pages(pointer, number_bytes);
+         }
+         return pointer;
+      }
+
+      void deallocate(ElementType* pointer, size_t /*number_elements*/) noexcept {
+         ::operator delete(pointer, std::align_val_t(FirstTouchAllocation::ALIGNMENT));
+      }
+   };
+
+   template <typename ElementType, typename OtherElementType>
+   bool operator==(const FirstTouchAllocator<ElementType>& /*allocator*/, const FirstTouchAllocator<OtherElementType>& /*other_allocator*/) noexcept {
+      return true;
+   }
+
+   template <typename ElementType, typename OtherElementType>
+   bool operator!=(const FirstTouchAllocator<ElementType>& /*allocator*/, const FirstTouchAllocator<OtherElementType>& /*other_allocator*/) noexcept {
+      return false;
+   }
+} // namespace
+
+#endif // UNO_FIRSTTOUCHALLOCATOR_H
@@ -0,0 +1,63 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "KKTCapture.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   KKTCapture::KKTCapture(const std::string& file_name): file_name(KKTCapture::instance_file_name(file_name)) {
+   }
+
+   std::string KKTCapture::instance_file_name(const std::string& file_name) {
+      static size_t number_instances = 0;
+      const size_t instance = number_instances;
+      number_instances++;
+      return (instance == 0) ? file_name : file_name + '.' + std::to_string(instance);
+   }
+
+   void KKTCapture::record(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      // the stream opens lazily: a linear system that never factorizes leaves no file behind
+      if (not this->stream.is_open()) {
+         this->stream.open(this->file_name, std::ios::binary | std::ios::trunc);
+         if (not this->stream) {
+            WARNING << "The KKT capture file " << this->file_name << " cannot be written\n";
+            return;
+         }
+         this->write_bytes(KKTCapture::MAGIC, sizeof(KKTCapture::MAGIC));
+         INFO << "Capturing the KKT matrices to " << this->file_name << '\n';
+      }
+      // gather the entries in a single deterministic traversal
+      std::vector<uint32_t> rows;
+      std::vector<uint32_t> columns;
+      rows.reserve(matrix.number_nonzeros());
+      columns.reserve(matrix.number_nonzeros());
+      this->value_buffer.clear();
+      this->value_buffer.reserve(matrix.number_nonzeros());
+      matrix.for_each([&](size_t row_index, size_t column_index, double element) {
+         rows.emplace_back(static_cast<uint32_t>(row_index));
+         columns.emplace_back(static_cast<uint32_t>(column_index));
+         this->value_buffer.emplace_back(element);
+      });
+      // write a pattern record only when the pattern changed since the last capture
+      if (this->pattern_dimension != matrix.dimension() || this->pattern_rows != rows || this->pattern_columns != columns) {
+         this->pattern_dimension = matrix.dimension();
+         this->pattern_rows = std::move(rows);
+         this->pattern_columns = std::move(columns);
+         this->write_bytes(&KKTCapture::PATTERN_TAG, 1);
+         const uint64_t dimension = this->pattern_dimension;
+         const uint64_t number_nonzeros = this->pattern_rows.size();
+         this->write_bytes(&dimension, sizeof(dimension));
+         this->write_bytes(&number_nonzeros, sizeof(number_nonzeros));
+         this->write_bytes(this->pattern_rows.data(), this->pattern_rows.size() * sizeof(uint32_t));
+         this->write_bytes(this->pattern_columns.data(), this->pattern_columns.size() * sizeof(uint32_t));
+      }
+      this->write_bytes(&KKTCapture::VALUES_TAG, 1);
+      this->write_bytes(this->value_buffer.data(), this->value_buffer.size() * sizeof(double));
+      // a capture must survive a possible crash of the factorization right after it
+      this->stream.flush();
+   }
+
+   void KKTCapture::write_bytes(const void* data, size_t number_bytes) {
+      this->stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(number_bytes));
+   }
+} // namespace
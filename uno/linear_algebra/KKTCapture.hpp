@@ -0,0 +1,54 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_KKTCAPTURE_H
+#define UNO_KKTCAPTURE_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "linear_algebra/SparseIndex.hpp"
+#include "linear_algebra/SymmetricMatrix.hpp"
+
+namespace uno {
+   /*
+    * Capture of the assembled KKT matrices for offline replay
+    *
+    * When the KKT_capture_file option is set, SymmetricIndefiniteLinearSystem dumps the matrices it
+    * hands to the linear solver into a compact binary stream: the sparsity pattern is written once
+    * (and again only when it changes), the values on every capture. The uno_replay tool feeds the
+    * captured systems back to any configured linear solver, so that solver and ordering comparisons
+    * or parameter sweeps run on the exact matrices of a bad solve, without re-running the solve.
+    *
+    * Format: the magic "UNOKKT01", then a sequence of records introduced by a tag byte:
+    * - 'P' (pattern): uint64 dimension, uint64 nnz, nnz uint32 row indices, nnz uint32 column indices
+    * - 'V' (values):  nnz float64 values, in the pattern order
+    * All fields are written in the native byte order of the capturing machine.
+    */
+   class KKTCapture {
+   public:
+      explicit KKTCapture(const std::string& file_name);
+      void record(const SymmetricMatrix<SparseIndex, double>& matrix);
+
+      static constexpr char MAGIC[8] = {'U', 'N', 'O', 'K', 'K', 'T', '0', '1'};
+      static constexpr char PATTERN_TAG = 'P';
+      static constexpr char VALUES_TAG = 'V';
+
+   private:
+      // several linear systems may capture within one run: each instance writes its own file
+      // (file_name, file_name.1, file_name.2, ...)
+      const std::string file_name;
+      std::ofstream stream{};
+      // pattern of the last record: a new pattern record is written only when it changes
+      size_t pattern_dimension{0};
+      std::vector<uint32_t> pattern_rows{};
+      std::vector<uint32_t> pattern_columns{};
+      std::vector<double> value_buffer{};
+
+      [[nodiscard]] static std::string instance_file_name(const std::string& file_name);
+      void write_bytes(const void* data, size_t number_bytes);
+   };
+} // namespace
+
+#endif // UNO_KKTCAPTURE_H
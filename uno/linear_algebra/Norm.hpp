@@ -7,7 +7,12 @@
 #include <algorithm>
 #include <cmath>
 #include <string>
+#include <type_traits>
+#include <vector>
+#include "linear_algebra/BlasKernels.hpp"
+#include "linear_algebra/Vector.hpp"
 #include "symbolic/Range.hpp"
+#include "tools/ThreadPool.hpp"
 
 namespace uno {
    // norms of any array with elements of any type
@@ -30,10 +35,18 @@ namespace uno {
       throw std::invalid_argument("The norm " + norm_string + " is not known");
    }
 
+   // detects whether an array can be indexed with operator[]. Indexable arrays (dense vectors, views
+   // and arbitrary lazy compositions of the symbolic layer) are traversed by index in a single pass,
+   // the others (e.g. SparseVector) via their [key, value] iterators
+   template <typename Array, typename = void>
+   struct is_indexable: std::false_type {};
+
+   template <typename Array>
+   struct is_indexable<Array, std::void_t<decltype(std::declval<const Array&>()[size_t(0)])>>: std::true_type {};
+
    // generic norm function for iterators that return [key, value] pairs
-   // https://stackoverflow.com/questions/38701475/how-to-overload-function-for-different-iterator-value-types-in-c
    template <typename KeyValueIterable, typename AccumulationFunction, typename ElementType = typename KeyValueIterable::value_type,
-         typename std::enable_if_t<not std::is_member_function_pointer<decltype(&KeyValueIterable::operator[])>::value, int> = 0>
+         typename std::enable_if_t<not is_indexable<KeyValueIterable>::value, int> = 0>
    ElementType generic_norm(const KeyValueIterable& x, const AccumulationFunction& accumulation_function) {
       ElementType result{0};
       for (const auto [_, element]: x) {
@@ -42,8 +55,73 @@ namespace uno {
       return result;
    }
 
-   // generic norm function for iterators that return the elements
-   template <typename Array, typename AccumulationFunction, typename ElementType = typename Array::value_type>
+   // number of elements above which indexable reductions are chunked over the global thread pool
+   constexpr size_t PARALLEL_REDUCTION_THRESHOLD = 65536;
+   // number of indices per chunk in deterministic mode: the chunk boundaries, and hence the shape
+   // of the reduction tree, no longer depend on the thread count
+   constexpr size_t DETERMINISTIC_REDUCTION_CHUNK_SIZE = 65536;
+
+   // chunked reduction with per-thread partials over the given thread pool. The combination
+   // function folds the (nonnegative) partial results into the final one: it coincides with the
+   // accumulation function for the l1 and inf norms, but is a plain sum for the squared l2 norm.
+   // The partials are combined in chunk order, so the result does not depend on which thread
+   // computed which chunk; in deterministic mode, the chunking itself is fixed as well, making the
+   // result bitwise identical for any thread count
+   template <typename Array, typename AccumulationFunction, typename CombinationFunction, typename ElementType = typename Array::value_type>
+   ElementType parallel_generic_norm(const Array& x, const AccumulationFunction& accumulation_function,
+         const CombinationFunction& combination_function, ThreadPool& pool) {
+      size_t chunk_size, number_chunks;
+      if (ThreadPool::deterministic) {
+         chunk_size = DETERMINISTIC_REDUCTION_CHUNK_SIZE;
+         number_chunks = x.size()/chunk_size + 1;
+      }
+      else {
+         number_chunks = pool.number_threads();
+         chunk_size = x.size()/number_chunks + 1;
+      }
+      std::vector<ElementType> partial_results(number_chunks, ElementType(0));
+      pool.parallel_for(number_chunks, [&](size_t chunk_index) {
+         ElementType partial_result{0};
+         const size_t start = chunk_index * chunk_size;
+         const size_t end = std::min(x.size(), start + chunk_size);
+         // traverse the chunk in cache-sized tiles
+         for (const ForwardRange block: Range(start, end).blocks(VECTOR_BLOCK_SIZE)) {
+            for (size_t index: block) {
+               accumulation_function(partial_result, x[index]);
+            }
+         }
+         partial_results[chunk_index] = partial_result;
+      });
+      ElementType result{0};
+      for (const ElementType partial_result: partial_results) {
+         combination_function(result, partial_result);
+      }
+      return result;
+   }
+
+   template <typename Array, typename AccumulationFunction, typename CombinationFunction, typename ElementType = typename Array::value_type>
+   ElementType parallel_generic_norm(const Array& x, const AccumulationFunction& accumulation_function,
+         const CombinationFunction& combination_function) {
+      return parallel_generic_norm(x, accumulation_function, combination_function, ThreadPool::global());
+   }
+
+   // true if the reduction over the array is worth chunking over the thread pool. In deterministic
+   // mode, large reductions take the chunked path even on a single thread, so that the sequential
+   // result has the same reduction shape as the parallel one
+   template <typename Array>
+   bool use_parallel_reduction(const Array& x) {
+      if constexpr (is_indexable<Array>::value) {
+         return PARALLEL_REDUCTION_THRESHOLD <= x.size() &&
+                (1 < ThreadPool::global().number_threads() || ThreadPool::deterministic);
+      }
+      else {
+         return false;
+      }
+   }
+
+   // generic norm function for indexable arrays: evaluates lazy expressions in one pass, without temporaries
+   template <typename Array, typename AccumulationFunction, typename ElementType = typename Array::value_type,
+         typename std::enable_if_t<is_indexable<Array>::value, int> = 0>
    ElementType generic_norm(const Array& x, const AccumulationFunction& accumulation_function) {
       ElementType result{0};
       for (size_t index: Range(x.size())) {
@@ -62,6 +140,17 @@ namespace uno {
 
    template <typename Array, typename ElementType = typename Array::value_type>
    ElementType norm_1(const Array& x) {
+      // contiguous double storage: hand the reduction to the vendor BLAS (dasum), when one is available
+      if constexpr (std::is_same_v<Array, Vector<double>>) {
+         if (use_blas(x.size())) {
+            return blas_sum_absolute_values(x.size(), x.data());
+         }
+      }
+      if constexpr (is_indexable<Array>::value) {
+         if (use_parallel_reduction(x)) {
+            return parallel_generic_norm(x, norm_1_accumulation<ElementType>, norm_1_accumulation<ElementType>);
+         }
+      }
       return generic_norm(x, norm_1_accumulation<ElementType>);
    }
 
@@ -79,8 +168,25 @@ namespace uno {
       result += element * element;
    }
 
+   // combination of the partial results of a chunked squared l2 norm
+   template <typename ElementType>
+   void partial_sum_accumulation(ElementType& result, ElementType partial_result) {
+      result += partial_result;
+   }
+
    template <typename Array, typename ElementType = typename Array::value_type>
    ElementType norm_2_squared(const Array& x) {
+      // contiguous double storage: hand the reduction to the vendor BLAS (ddot), when one is available
+      if constexpr (std::is_same_v<Array, Vector<double>>) {
+         if (use_blas(x.size())) {
+            return blas_dot(x.size(), x.data(), x.data());
+         }
+      }
+      if constexpr (is_indexable<Array>::value) {
+         if (use_parallel_reduction(x)) {
+            return parallel_generic_norm(x, norm_2_squared_accumulation<ElementType>, partial_sum_accumulation<ElementType>);
+         }
+      }
       return generic_norm(x, norm_2_squared_accumulation<ElementType>);
    }
 
@@ -114,6 +220,11 @@ namespace uno {
 
    template <typename Array, typename ElementType = typename Array::value_type>
    ElementType norm_inf(const Array& x) {
+      if constexpr (is_indexable<Array>::value) {
+         if (use_parallel_reduction(x)) {
+            return parallel_generic_norm(x, norm_inf_accumulation<ElementType>, norm_inf_accumulation<ElementType>);
+         }
+      }
       return generic_norm(x, norm_inf_accumulation<ElementType>);
    }
 
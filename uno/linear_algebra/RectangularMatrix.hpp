@@ -4,8 +4,12 @@
 #ifndef UNO_RECTANGULARMATRIX_H
 #define UNO_RECTANGULARMATRIX_H
 
+#include <algorithm>
 #include <vector>
+#include "CompensatedSum.hpp"
 #include "SparseVector.hpp"
+#include "Vector.hpp"
+#include "tools/Prefetch.hpp"
 
 namespace uno {
    // TODO use more appropriate sparse representation
@@ -17,13 +21,16 @@ namespace uno {
    public:
       using value_type = ElementType;
 
-      RectangularMatrix(size_t number_rows, size_t number_columns): matrix(number_rows) {
+      RectangularMatrix(size_t number_rows, size_t number_columns): matrix(number_rows), number_columns(number_columns) {
          for (auto& row: this->matrix) {
             row.reserve(number_columns);
          }
       }
 
       SparseVector<ElementType>& operator[](size_t row_index) {
+         // handing out a mutable row invalidates the contiguous mirrors
+         this->transpose_up_to_date = false;
+         this->row_arena_up_to_date = false;
          return this->matrix[row_index];
       }
 
@@ -35,10 +42,190 @@ namespace uno {
          for (auto& row: this->matrix) {
             row.clear();
          }
+         this->transpose_up_to_date = false;
+         this->row_arena_up_to_date = false;
+      }
+
+      // reserved storage in bytes (the rows and the transposed mirror), for the memory instrumentation
+      [[nodiscard]] size_t memory_footprint() const {
+         size_t number_bytes = 0;
+         for (const auto& row: this->matrix) {
+            number_bytes += row.memory_footprint();
+         }
+         number_bytes += this->transpose_column_starts.capacity() * sizeof(size_t)
+               + this->transpose_row_indices.capacity() * sizeof(size_t)
+               + this->transpose_values.capacity() * sizeof(ElementType);
+         number_bytes += this->row_arena_starts.capacity() * sizeof(size_t)
+               + this->row_arena_column_indices.capacity() * sizeof(size_t)
+               + this->row_arena_values.capacity() * sizeof(ElementType);
+         return number_bytes;
+      }
+
+      // result = J x, evaluated through a contiguous arena of the rows (offsets per row): the
+      // traversal is a sequential memory walk, instead of chasing the per-row heap allocations,
+      // whose scattered placement dominates the row sweep on matrices with many rows
+      void product(const Vector<ElementType>& x, Vector<ElementType>& result) const {
+         if (not this->row_arena_up_to_date) {
+            this->build_row_arena();
+         }
+         const size_t number_rows = std::min(result.size(), this->matrix.size());
+         for (size_t row_index: Range(number_rows)) {
+            ElementType accumulated = ElementType(0);
+            for (size_t nonzero_index: Range(this->row_arena_starts[row_index], this->row_arena_starts[row_index + 1])) {
+               accumulated += this->row_arena_values[nonzero_index] * x[this->row_arena_column_indices[nonzero_index]];
+            }
+            result[row_index] = accumulated;
+         }
+      }
+
+      // result -= J^T y, evaluated through a CSC mirror of the rows: the nonzeros of one column are
+      // contiguous and target a single entry of result, instead of the row-by-row scattered writes.
+      // When few multipliers are nonzero (near convergence, most constraints are inactive), only the
+      // corresponding rows (sparse vectors) are traversed and the mirror is bypassed altogether
+      void subtract_transposed_product(const Vector<ElementType>& y, Vector<ElementType>& result) const {
+         // count the nonzero multipliers (cheap relative to any traversal of the entries)
+         const size_t number_rows = std::min(y.size(), this->matrix.size());
+         size_t number_nonzero_multipliers = 0;
+         for (size_t row_index: Range(number_rows)) {
+            if (y[row_index] != ElementType(0)) {
+               number_nonzero_multipliers++;
+            }
+         }
+         // sparse fast path: scatter the few active rows directly
+         if (8 * number_nonzero_multipliers <= number_rows) {
+            // extended-precision tail phase: one compensated accumulator per entry of the result
+            if (ExtendedPrecision::enabled) {
+               std::vector<CompensatedSum> accumulators(result.size());
+               for (size_t row_index: Range(number_rows)) {
+                  const ElementType multiplier = y[row_index];
+                  if (multiplier != ElementType(0)) {
+                     for (const auto [column_index, element]: this->matrix[row_index]) {
+                        if (column_index < result.size()) {
+                           accumulators[column_index].add(-multiplier * element);
+                        }
+                     }
+                  }
+               }
+               for (size_t column_index: Range(result.size())) {
+                  result[column_index] += accumulators[column_index].result();
+               }
+               return;
+            }
+            for (size_t row_index: Range(number_rows)) {
+               const ElementType multiplier = y[row_index];
+               if (multiplier != ElementType(0)) {
+                  for (const auto [column_index, element]: this->matrix[row_index]) {
+                     if (column_index < result.size()) {
+                        result[column_index] -= multiplier * element;
+                     }
+                  }
+               }
+            }
+            return;
+         }
+         if (not this->transpose_up_to_date) {
+            this->build_transpose();
+         }
+         // only the columns that fit in the result are accumulated
+         const size_t number_accumulated_columns = std::min(result.size(), this->transpose_column_starts.size() - 1);
+         const size_t total_nonzeros = this->transpose_row_indices.size();
+         // extended-precision tail phase: the per-column sum carries a compensation term
+         if (ExtendedPrecision::enabled) {
+            for (size_t column_index: Range(number_accumulated_columns)) {
+               CompensatedSum accumulated{};
+               for (size_t nonzero_index: Range(this->transpose_column_starts[column_index], this->transpose_column_starts[column_index + 1])) {
+                  accumulated.add(this->transpose_values[nonzero_index] * y[this->transpose_row_indices[nonzero_index]]);
+               }
+               result[column_index] -= accumulated.result();
+            }
+            return;
+         }
+         for (size_t column_index: Range(number_accumulated_columns)) {
+            ElementType accumulated = ElementType(0);
+            for (size_t nonzero_index: Range(this->transpose_column_starts[column_index], this->transpose_column_starts[column_index + 1])) {
+               // the gather from y is the latency-bound load: prefetch its operand a few nonzeros ahead
+               if (nonzero_index + PREFETCH_DISTANCE < total_nonzeros) {
+                  prefetch_read(&y[this->transpose_row_indices[nonzero_index + PREFETCH_DISTANCE]]);
+               }
+               accumulated += this->transpose_values[nonzero_index] * y[this->transpose_row_indices[nonzero_index]];
+            }
+            result[column_index] -= accumulated;
+         }
       }
 
    protected:
       std::vector<SparseVector<ElementType>> matrix;
+      size_t number_columns;
+
+      // transposed (CSC) mirror of the rows, rebuilt lazily after the matrix was modified
+      mutable std::vector<size_t> transpose_column_starts{};
+      mutable std::vector<size_t> transpose_row_indices{};
+      mutable std::vector<ElementType> transpose_values{};
+      mutable bool transpose_up_to_date{false};
+
+      // contiguous (CSR) arena of the rows, rebuilt lazily after the matrix was modified: the
+      // nonzeros of row i live in [row_arena_starts[i], row_arena_starts[i + 1])
+      mutable std::vector<size_t> row_arena_starts{};
+      mutable std::vector<size_t> row_arena_column_indices{};
+      mutable std::vector<ElementType> row_arena_values{};
+      mutable bool row_arena_up_to_date{false};
+
+      void build_row_arena() const {
+         this->row_arena_starts.resize(this->matrix.size() + 1);
+         this->row_arena_starts[0] = 0;
+         size_t number_nonzeros = 0;
+         for (size_t row_index: Range(this->matrix.size())) {
+            number_nonzeros += this->matrix[row_index].size();
+            this->row_arena_starts[row_index + 1] = number_nonzeros;
+         }
+         this->row_arena_column_indices.resize(number_nonzeros);
+         this->row_arena_values.resize(number_nonzeros);
+         size_t nonzero_index = 0;
+         for (const auto& row: this->matrix) {
+            for (const auto [column_index, element]: row) {
+               this->row_arena_column_indices[nonzero_index] = column_index;
+               this->row_arena_values[nonzero_index] = element;
+               nonzero_index++;
+            }
+         }
+         this->row_arena_up_to_date = true;
+      }
+
+      void build_transpose() const {
+         // count the nonzeros of each column (entries beyond number_columns, e.g. elastics inserted
+         // into a copied model Jacobian, are counted as well so that the scatter below stays in bounds)
+         size_t width = this->number_columns;
+         for (const auto& row: this->matrix) {
+            for (const auto [column_index, element]: row) {
+               width = std::max(width, static_cast<size_t>(column_index) + 1);
+            }
+         }
+         this->transpose_column_starts.assign(width + 1, 0);
+         size_t number_nonzeros = 0;
+         for (const auto& row: this->matrix) {
+            for (const auto [column_index, element]: row) {
+               this->transpose_column_starts[column_index + 1]++;
+               number_nonzeros++;
+            }
+         }
+         // prefix sum: starts of the columns
+         for (size_t column_index: Range(width)) {
+            this->transpose_column_starts[column_index + 1] += this->transpose_column_starts[column_index];
+         }
+         // scatter the entries into their columns
+         this->transpose_row_indices.resize(number_nonzeros);
+         this->transpose_values.resize(number_nonzeros);
+         std::vector<size_t> column_offsets(this->transpose_column_starts.begin(), this->transpose_column_starts.end() - 1);
+         for (size_t row_index: Range(this->matrix.size())) {
+            for (const auto [column_index, element]: this->matrix[row_index]) {
+               const size_t nonzero_index = column_offsets[column_index];
+               this->transpose_row_indices[nonzero_index] = row_index;
+               this->transpose_values[nonzero_index] = element;
+               column_offsets[column_index]++;
+            }
+         }
+         this->transpose_up_to_date = true;
+      }
    };
 } // namespace
 
@@ -0,0 +1,42 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_SPARSEFORMATSELECTOR_H
+#define UNO_SPARSEFORMATSELECTOR_H
+
+#include <string>
+#include "tools/Options.hpp"
+
+namespace uno {
+   // per-role sparse format selection (see the sparse_format* options): the optimal layout depends
+   // on the consumer of the matrix, not on a global preference. The per-role options override the
+   // global sparse_format; their "auto" mode picks the layout the configured consumer prefers
+   class SparseFormatSelector {
+   public:
+      // Lagrangian Hessian: the active-set QP solver streams the Hessian column by column and runs
+      // quadratic products, which favors compressed columns; the other subproblems assemble the
+      // Hessian into the KKT matrix entry by entry, where the global preference applies
+      [[nodiscard]] static std::string hessian_format(const Options& options) {
+         const std::string& format = options.get_string("sparse_format_hessian");
+         if (format != "auto") {
+            return format;
+         }
+         if (options.get_string("subproblem") == "QP") {
+            return "CSC";
+         }
+         return options.get_string("sparse_format");
+      }
+
+      // KKT/augmented matrix: handed to the direct symmetric indefinite solvers, which ingest
+      // plain triplets
+      [[nodiscard]] static std::string KKT_format(const Options& options) {
+         const std::string& format = options.get_string("sparse_format_KKT");
+         if (format != "auto") {
+            return format;
+         }
+         return "COO";
+      }
+   };
+} // namespace
+
+#endif // UNO_SPARSEFORMATSELECTOR_H
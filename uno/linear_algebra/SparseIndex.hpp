@@ -0,0 +1,22 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_SPARSEINDEX_H
+#define UNO_SPARSEINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace uno {
+   // index type of the sparse matrices handed to the linear solvers. 32-bit indices (configure with
+   // -DWITH_INT32_INDICES=ON) halve the footprint and bandwidth of the index arrays and match the
+   // integer width that the Fortran solvers expect; the default keeps 64-bit indices for problems
+   // beyond 2^32 - 1 nonzeros
+#ifdef UNO_INT32_INDICES
+   using SparseIndex = uint32_t;
+#else
+   using SparseIndex = size_t;
+#endif
+} // namespace
+
+#endif // UNO_SPARSEINDEX_H
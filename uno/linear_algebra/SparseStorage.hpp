@@ -6,6 +6,7 @@
 
 #include <ostream>
 #include <functional>
+#include "linear_algebra/SparseIndex.hpp"
 
 namespace uno {
    // abstract class
@@ -53,7 +54,16 @@ namespace uno {
       virtual void insert(ElementType term, IndexType row_index, IndexType column_index) = 0;
       // this method will be used by the CSCSparseStorage subclass
       virtual void finalize_column(IndexType column_index) = 0;
+      // merge duplicate (row, column) entries in place; formats that cannot hold duplicates do nothing
+      virtual void compress() { /* do nothing */ }
       virtual void set_regularization(const std::function<ElementType(size_t /*index*/)>& regularization_function) = 0;
+      // visit all the nonzeros with a single virtual call, instead of two virtual calls per element
+      // when going through the iterator
+      virtual void for_each(const std::function<void(IndexType /*row_index*/, IndexType /*column_index*/, ElementType /*element*/)>& f) const = 0;
+      // evaluate x^T M y, where M is the symmetric matrix whose lower (or upper) triangular part is
+      // stored. Subclasses that know more about the sparsity pattern may override this with kernels
+      // that exploit it (see BlockedCOOSparseStorage)
+      [[nodiscard]] virtual ElementType quadratic_product(const ElementType* x, const ElementType* y) const;
       virtual const ElementType* data_pointer() const noexcept = 0;
       virtual ElementType* data_pointer() noexcept = 0;
 
@@ -91,6 +101,22 @@ namespace uno {
    void SparseStorage<IndexType, ElementType>::set_dimension(size_t new_dimension) {
       this->dimension = new_dimension;
    }
+
+   template <typename IndexType, typename ElementType>
+   ElementType SparseStorage<IndexType, ElementType>::quadratic_product(const ElementType* x, const ElementType* y) const {
+      ElementType result = ElementType(0);
+      this->for_each([&](IndexType row_index, IndexType column_index, ElementType element) {
+         if (row_index == column_index) {
+            // diagonal term
+            result += element * x[row_index] * y[row_index];
+         }
+         else {
+            // off-diagonal term
+            result += element * (x[row_index] * y[column_index] + x[column_index] * y[row_index]);
+         }
+      });
+      return result;
+   }
    
    template <typename Index, typename Element>
    std::ostream& operator<<(std::ostream& stream, const SparseStorage<Index, Element>& matrix) {
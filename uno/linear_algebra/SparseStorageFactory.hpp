@@ -5,8 +5,10 @@
 #define UNO_SPARSESTORAGEFACTORY_H
 
 #include "SparseStorage.hpp"
+#include "BlockedCOOSparseStorage.hpp"
 #include "COOSparseStorage.hpp"
 #include "CSCSparseStorage.hpp"
+#include "CSRSparseStorage.hpp"
 
 namespace uno {
    template <typename IndexType, typename ElementType>
@@ -25,6 +27,12 @@ namespace uno {
       else if (sparse_storage_type == "CSC") {
          return std::make_unique<CSCSparseStorage<IndexType, ElementType>>(dimension, capacity, use_regularization);
       }
+      else if (sparse_storage_type == "CSR") {
+         return std::make_unique<CSRSparseStorage<IndexType, ElementType>>(dimension, capacity, use_regularization);
+      }
+      else if (sparse_storage_type == "blocked_COO") {
+         return std::make_unique<BlockedCOOSparseStorage<IndexType, ElementType>>(dimension, capacity, use_regularization);
+      }
       throw std::invalid_argument("Sparse storage " + sparse_storage_type + " unknown");
    }
 } // namespace
@@ -4,8 +4,13 @@
 #ifndef UNO_SPARSEVECTOR_H
 #define UNO_SPARSEVECTOR_H
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <functional>
+#include <numeric>
+#include <optional>
+#include "linear_algebra/FirstTouchAllocator.hpp"
 #include "tools/Logger.hpp"
 #include "symbolic/Range.hpp"
 #include "symbolic/Collection.hpp"
@@ -14,7 +19,14 @@ namespace uno {
    // SparseVector is a sparse vector that uses contiguous memory. It contains:
    // - a vector of indices of type size_t
    // - a vector of values of type ElementType
-   // the indices are neither unique nor sorted
+   // by default, the indices are neither unique nor sorted. Calling compact() merges duplicate
+   // indices and sorts the entries, after which find() performs lookups in O(log n). Inserting
+   // a new entry invalidates the compact form.
+   // Small-buffer optimization: the first inline_capacity entries live inside the object itself
+   // (no heap allocation), which most objective gradients and Jacobian rows never outgrow. The
+   // entries spill to the heap on the first overflow and stay there; reserve() on an inline vector
+   // is deferred and honored by the eventual spill, so that generously reserved rows (e.g. those
+   // of RectangularMatrix) do not allocate until they actually exceed the inline capacity
    template <typename ElementType>
    class SparseVector {
    public:
@@ -25,7 +37,7 @@ namespace uno {
          iterator(const SparseVector& vector, size_t index): vector(vector), index(index) { }
 
          value_type operator*() const {
-            return {this->vector.indices[this->index], this->vector.values[this->index]};
+            return {this->vector.index_data()[this->index], this->vector.value_data()[this->index]};
          }
 
          iterator& operator++() {
@@ -44,6 +56,9 @@ namespace uno {
 
       using value_type = ElementType;
 
+      // number of entries held inside the object before spilling to the heap
+      static constexpr size_t inline_capacity{16};
+
       explicit SparseVector(size_t capacity = 0);
 
       [[nodiscard]] size_t size() const;
@@ -54,6 +69,24 @@ namespace uno {
       void clear();
       [[nodiscard]] bool is_empty() const;
 
+      // overwrite the sparsity pattern with a known set of indices. The values are left unspecified
+      // and are meant to be filled in place through values_data(), which avoids a staging buffer
+      // when an external library (e.g. ASL) evaluates directly into caller-owned storage
+      void load_pattern(const std::vector<size_t>& pattern);
+      // pointer variant, for patterns stored in a flat arena (possibly in read-only shared memory)
+      void load_pattern(const size_t* pattern, size_t pattern_size);
+      [[nodiscard]] ElementType* values_data();
+
+      // reserved heap storage in bytes (indices and values), for the memory instrumentation. The
+      // inline buffer is part of sizeof(SparseVector) and is not counted
+      [[nodiscard]] size_t memory_footprint() const;
+
+      // sort the entries by increasing index and merge duplicate indices
+      void compact();
+      [[nodiscard]] bool is_compact() const;
+      // binary-search lookup, available only in compact form
+      [[nodiscard]] std::optional<ElementType> find(size_t index) const;
+
       [[nodiscard]] iterator begin() const { return iterator(*this, 0); }
       [[nodiscard]] iterator end() const { return iterator(*this, this->number_nonzeros); }
 
@@ -61,9 +94,24 @@ namespace uno {
       friend std::ostream& operator<<(std::ostream& stream, const SparseVector<U>& x);
 
    protected:
-      std::vector<size_t> indices{};
-      std::vector<ElementType> values{};
+      // inline storage, active until the entries spill to the heap vectors below
+      std::array<size_t, inline_capacity> inline_indices{};
+      std::array<ElementType, inline_capacity> inline_values{};
+      bool spilled{false};
+      // capacity requested by reserve() while the storage was still inline
+      size_t deferred_capacity{0};
+      // heap storage goes through FirstTouchAllocator, so that the allocation instrumentation
+      // sees the spills
+      std::vector<size_t, FirstTouchAllocator<size_t>> indices{};
+      std::vector<ElementType, FirstTouchAllocator<ElementType>> values{};
       size_t number_nonzeros{0};
+      bool compact_form{false};
+
+      [[nodiscard]] const size_t* index_data() const { return this->spilled ? this->indices.data() : this->inline_indices.data(); }
+      [[nodiscard]] size_t* index_data() { return this->spilled ? this->indices.data() : this->inline_indices.data(); }
+      [[nodiscard]] const ElementType* value_data() const { return this->spilled ? this->values.data() : this->inline_values.data(); }
+      [[nodiscard]] ElementType* value_data() { return this->spilled ? this->values.data() : this->inline_values.data(); }
+      void spill(size_t minimum_capacity);
    };
 
    // SparseVector methods
@@ -79,22 +127,58 @@ namespace uno {
 
    template <typename ElementType>
    void SparseVector<ElementType>::reserve(size_t capacity) {
+      if (this->spilled) {
+         this->indices.reserve(capacity);
+         this->values.reserve(capacity);
+      }
+      else {
+         // deferred: honored by the eventual spill, so that the inline buffer keeps serving the
+         // (common) vectors that never outgrow it
+         this->deferred_capacity = std::max(this->deferred_capacity, capacity);
+      }
+   }
+
+   // move the inline entries to the heap, honoring the largest deferred reservation
+   template <typename ElementType>
+   void SparseVector<ElementType>::spill(size_t minimum_capacity) {
+      const size_t capacity = std::max(minimum_capacity, this->deferred_capacity);
       this->indices.reserve(capacity);
       this->values.reserve(capacity);
+      this->indices.assign(this->inline_indices.data(), this->inline_indices.data() + this->number_nonzeros);
+      this->values.assign(this->inline_values.data(), this->inline_values.data() + this->number_nonzeros);
+      this->spilled = true;
+   }
+
+   template <typename ElementType>
+   size_t SparseVector<ElementType>::memory_footprint() const {
+      return this->indices.capacity() * sizeof(size_t) + this->values.capacity() * sizeof(ElementType);
    }
 
    template <typename ElementType>
    void SparseVector<ElementType>::insert(size_t index, ElementType value) {
+      if (not this->spilled) {
+         if (this->number_nonzeros < SparseVector::inline_capacity) {
+            this->inline_indices[this->number_nonzeros] = index;
+            this->inline_values[this->number_nonzeros] = value;
+            this->number_nonzeros++;
+            this->compact_form = false;
+            return;
+         }
+         this->spill(2 * SparseVector::inline_capacity);
+      }
       this->indices.emplace_back(index);
       this->values.emplace_back(value);
       this->number_nonzeros++;
+      this->compact_form = false;
    }
 
    template <typename ElementType>
    void SparseVector<ElementType>::clear() {
+      // a spilled vector stays on the heap: its capacity is retained for the next fill
       this->indices.clear();
       this->values.clear();
       this->number_nonzeros = 0;
+      this->compact_form = false;
    }
 
    template <typename ElementType>
@@ -104,9 +188,93 @@ namespace uno {
 
    template <typename ElementType>
    void SparseVector<ElementType>::transform(const std::function<ElementType (ElementType)>& f) {
+      ElementType* entries = this->value_data();
       for (size_t index: Range(this->number_nonzeros)) {
-         this->values[index] = f(this->values[index]);
+         entries[index] = f(entries[index]);
+      }
+   }
+
+   template <typename ElementType>
+   void SparseVector<ElementType>::load_pattern(const std::vector<size_t>& pattern) {
+      this->load_pattern(pattern.data(), pattern.size());
+   }
+
+   template <typename ElementType>
+   void SparseVector<ElementType>::load_pattern(const size_t* pattern, size_t pattern_size) {
+      if (not this->spilled && SparseVector::inline_capacity < pattern_size) {
+         this->spill(pattern_size);
+      }
+      if (this->spilled) {
+         this->indices.assign(pattern, pattern + pattern_size);
+         this->values.resize(pattern_size);
+      }
+      else {
+         std::copy(pattern, pattern + pattern_size, this->inline_indices.data());
+      }
+      this->number_nonzeros = pattern_size;
+      this->compact_form = false;
+   }
+
+   template <typename ElementType>
+   ElementType* SparseVector<ElementType>::values_data() {
+      return this->value_data();
+   }
+
+   template <typename ElementType>
+   void SparseVector<ElementType>::compact() {
+      if (this->compact_form) {
+         return;
+      }
+      const size_t* entry_indices = this->index_data();
+      const ElementType* entry_values = this->value_data();
+      // sort a permutation of the entries by increasing index
+      std::vector<size_t, FirstTouchAllocator<size_t>> permutation(this->number_nonzeros);
+      std::iota(permutation.begin(), permutation.end(), size_t(0));
+      std::sort(permutation.begin(), permutation.end(), [&](size_t i, size_t j) {
+         return entry_indices[i] < entry_indices[j];
+      });
+      // apply the permutation and accumulate duplicate indices
+      std::vector<size_t, FirstTouchAllocator<size_t>> compact_indices;
+      std::vector<ElementType, FirstTouchAllocator<ElementType>> compact_values;
+      compact_indices.reserve(this->number_nonzeros);
+      compact_values.reserve(this->number_nonzeros);
+      for (size_t position: permutation) {
+         const size_t index = entry_indices[position];
+         if (not compact_indices.empty() && compact_indices.back() == index) {
+            compact_values.back() += entry_values[position];
+         }
+         else {
+            compact_indices.emplace_back(index);
+            compact_values.emplace_back(entry_values[position]);
+         }
+      }
+      // the compact form is never larger than the original: it fits in the active storage
+      this->number_nonzeros = compact_indices.size();
+      if (this->spilled) {
+         this->indices = std::move(compact_indices);
+         this->values = std::move(compact_values);
+      }
+      else {
+         std::copy(compact_indices.cbegin(), compact_indices.cend(), this->inline_indices.data());
+         std::copy(compact_values.cbegin(), compact_values.cend(), this->inline_values.data());
+      }
+      this->compact_form = true;
+   }
+
+   template <typename ElementType>
+   bool SparseVector<ElementType>::is_compact() const {
+      return this->compact_form;
+   }
+
+   template <typename ElementType>
+   std::optional<ElementType> SparseVector<ElementType>::find(size_t index) const {
+      assert(this->compact_form && "SparseVector.find: the vector is not in compact form. Call compact() first");
+      const size_t* entry_indices = this->index_data();
+      const auto position = std::lower_bound(entry_indices, entry_indices + this->number_nonzeros, index);
+      if (position != entry_indices + this->number_nonzeros && *position == index) {
+         return this->value_data()[static_cast<size_t>(position - entry_indices)];
       }
+      return std::nullopt;
    }
 
    template <typename ElementType>
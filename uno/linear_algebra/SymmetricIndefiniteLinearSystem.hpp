@@ -4,14 +4,24 @@
 #ifndef UNO_SYMMETRICINDEFINITELINEARSYSTEM_H
 #define UNO_SYMMETRICINDEFINITELINEARSYSTEM_H
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "KKTCapture.hpp"
 #include "SymmetricMatrix.hpp"
 #include "SparseStorageFactory.hpp"
+#include "SparseVector.hpp"
 #include "RectangularMatrix.hpp"
 #include "model/Model.hpp"
 #include "solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "tools/MemoryUsage.hpp"
 #include "tools/Options.hpp"
+#include "tools/Profiler.hpp"
 #include "tools/Statistics.hpp"
+#include "tools/TuningCache.hpp"
 
 namespace uno {
    struct UnstableRegularization : public std::exception {
@@ -24,25 +34,94 @@ namespace uno {
    template <typename ElementType>
    class SymmetricIndefiniteLinearSystem {
    public:
-      SymmetricMatrix<size_t, ElementType> matrix;
+      SymmetricMatrix<SparseIndex, ElementType> matrix;
       Vector<ElementType> rhs{};
       Vector<ElementType> solution{};
 
       SymmetricIndefiniteLinearSystem(const std::string& sparse_format, size_t dimension, size_t number_non_zeros, bool use_regularization,
             const Options& options);
-      void assemble_matrix(const SymmetricMatrix<size_t, double>& hessian, const RectangularMatrix<double>& constraint_jacobian,
+      void assemble_matrix(const SymmetricMatrix<SparseIndex, double>& hessian, const RectangularMatrix<double>& constraint_jacobian,
             size_t number_variables, size_t number_constraints);
-      void factorize_matrix(const Model& model, DirectSymmetricIndefiniteLinearSolver<size_t, ElementType>& linear_solver);
-      void regularize_matrix(Statistics& statistics, const Model& model, DirectSymmetricIndefiniteLinearSolver<size_t, ElementType>& linear_solver,
+      // condensed assembly: analytically eliminates variables that appear in a single constraint and only
+      // on the diagonal of the Hessian (e.g. slacks or elastics with their barrier terms), shrinking the
+      // factorized system by the number of eliminated variables. eliminated_variables maps a constraint
+      // index onto an eliminated variable; a constraint may eliminate several variables (e.g. a slack
+      // and a pair of elastics)
+      void assemble_condensed_matrix(const SymmetricMatrix<SparseIndex, double>& hessian, const RectangularMatrix<double>& constraint_jacobian,
+            size_t number_variables, size_t number_constraints, const SparseVector<size_t>& eliminated_variables);
+      void factorize_matrix(const Model& model, DirectSymmetricIndefiniteLinearSolver<SparseIndex, ElementType>& linear_solver);
+      void refactorize_with_shift(DirectSymmetricIndefiniteLinearSolver<SparseIndex, ElementType>& linear_solver);
+      void regularize_matrix(Statistics& statistics, DirectSymmetricIndefiniteLinearSolver<SparseIndex, ElementType>& linear_solver,
             size_t size_primal_block, size_t size_dual_block, ElementType dual_regularization_parameter);
-      void solve(DirectSymmetricIndefiniteLinearSolver<size_t, ElementType>& linear_solver);
+      void solve(DirectSymmetricIndefiniteLinearSolver<SparseIndex, ElementType>& linear_solver);
+      // the matrix was (re)assembled externally (e.g. the least-squares multiplier system of the
+      // preprocessing phase): the next assembly must rebuild the pattern from scratch
+      void invalidate_pattern() { this->pattern_assembled = false; }
       // [[nodiscard]] T get_primal_regularization() const;
+      [[nodiscard]] bool uses_inertia_free_curvature_test() const { return this->inertia_free_curvature_test; }
 
    protected:
+      void update_values(const SymmetricMatrix<SparseIndex, double>& hessian, const RectangularMatrix<double>& constraint_jacobian,
+            size_t number_constraints);
+      void condense_rhs();
+      void expand_solution();
+      void enforce_sufficient_curvature(DirectSymmetricIndefiniteLinearSolver<SparseIndex, ElementType>& linear_solver,
+            const Vector<ElementType>& current_rhs, Vector<ElementType>& current_solution);
+      [[nodiscard]] bool direction_has_sufficient_curvature(const Vector<ElementType>& direction);
+
+   protected:
+      // incremental assembly: once the pattern has been assembled, as long as the structure of the
+      // Hessian and the Jacobian does not change, only the numerical values are overwritten in place
+      const bool use_regularization;
+      bool pattern_assembled{false};
+      size_t assembled_dimension{0};
+      size_t assembled_hessian_nonzeros{0};
+      size_t assembled_jacobian_nonzeros{0};
+      std::vector<size_t> assembly_slots{};
+
+      // condensed (block-eliminated) assembly: bookkeeping needed to compress the right-hand side and
+      // to recover the eliminated components of the solution after the condensed solve
+      struct EliminatedVariable {
+         size_t constraint_index;
+         size_t variable_index;
+         ElementType diagonal_term; // Hessian diagonal of the eliminated variable
+         ElementType jacobian_term; // coefficient of the eliminated variable in its constraint
+      };
+      bool condensation_active{false};
+      size_t full_number_variables{0};
+      size_t full_number_constraints{0};
+      size_t condensed_number_variables{0};
+      std::vector<EliminatedVariable> condensation_variables{};
+      std::vector<size_t> condensed_indices{}; // full variable index -> condensed index (SIZE_MAX if eliminated)
+      std::vector<ElementType> constraint_schur_terms{}; // constraint index -> accumulated Schur term of its eliminated variables
+      std::vector<size_t> variable_elimination_positions{}; // variable index -> position in condensation_variables (SIZE_MAX if kept)
+      Vector<ElementType> condensed_rhs{};
+      Vector<ElementType> condensed_solution{};
+
       size_t number_factorizations{0};
+      // capture mode (see KKTCapture): dump every capture_interval-th assembled matrix for offline replay
+      std::unique_ptr<KKTCapture> capture{};
+      const size_t capture_interval;
       ElementType primal_regularization{0.};
       ElementType dual_regularization{0.};
-      ElementType previous_primal_regularization{0.};
+      // memory of the last successful regularization, kept per problem phase (identified by the block
+      // sizes): later regularization loops start near the value that worked instead of rediscovering
+      // it with several doomed factorizations
+      struct RegularizationMemory {
+         size_t size_primal_block;
+         size_t size_dual_block;
+         ElementType primal_regularization;
+         ElementType dual_regularization;
+      };
+      std::vector<RegularizationMemory> regularization_memory{};
+      [[nodiscard]] RegularizationMemory* find_regularization_memory(size_t size_primal_block, size_t size_dual_block);
+      // cross-instance tuning memory (see TuningCache): the first regularization of a new solve
+      // starts from the values that worked for previous instances of the same family
+      uint64_t tuning_fingerprint{0};
+      bool tuning_consulted{false};
+      ElementType tuning_primal_seed{0.};
+      ElementType tuning_dual_seed{0.};
+      void consult_tuning_cache();
       const ElementType regularization_failure_threshold;
       const ElementType primal_regularization_initial_factor;
       const ElementType dual_regularization_fraction;
@@ -51,6 +130,13 @@ namespace uno {
       const ElementType primal_regularization_fast_increase_factor;
       const ElementType primal_regularization_slow_increase_factor;
       const size_t threshold_unsuccessful_attempts;
+      // inertia-free strategy: instead of requiring the factorization to reveal the inertia, test the
+      // directional curvature d^T W d of each computed direction (see enforce_sufficient_curvature)
+      const bool inertia_free_curvature_test;
+      const ElementType inertia_free_curvature_fraction;
+      size_t last_size_primal_block{0};
+      size_t last_size_dual_block{0};
+      Vector<ElementType> curvature_test_vector{};
    };
 
    template <typename ElementType>
@@ -59,6 +145,8 @@ namespace uno {
          matrix(dimension, number_non_zeros, use_regularization, sparse_format),
          rhs(dimension),
          solution(dimension),
+         use_regularization(use_regularization),
+         capture_interval(std::max(size_t(1), options.get_unsigned_int("KKT_capture_interval"))),
          regularization_failure_threshold(ElementType(options.get_double("regularization_failure_threshold"))),
          primal_regularization_initial_factor(ElementType(options.get_double("primal_regularization_initial_factor"))),
          dual_regularization_fraction(ElementType(options.get_double("dual_regularization_fraction"))),
@@ -66,53 +154,274 @@ namespace uno {
          primal_regularization_decrease_factor(ElementType(options.get_double("primal_regularization_decrease_factor"))),
          primal_regularization_fast_increase_factor(ElementType(options.get_double("primal_regularization_fast_increase_factor"))),
          primal_regularization_slow_increase_factor(ElementType(options.get_double("primal_regularization_slow_increase_factor"))),
-         threshold_unsuccessful_attempts(options.get_unsigned_int("threshold_unsuccessful_attempts")) {
+         threshold_unsuccessful_attempts(options.get_unsigned_int("threshold_unsuccessful_attempts")),
+         inertia_free_curvature_test(options.get_bool("inertia_free_curvature_test")),
+         inertia_free_curvature_fraction(ElementType(options.get_double("inertia_free_curvature_fraction"))) {
+      MemoryUsage::record(MemoryUsage::KKT_MATRIX, this->matrix.capacity() * (sizeof(ElementType) + 2*sizeof(SparseIndex)));
+      if constexpr (std::is_same_v<ElementType, double>) {
+         if (options.get_string("KKT_capture_file") != "none") {
+            this->capture = std::make_unique<KKTCapture>(options.get_string("KKT_capture_file"));
+         }
+      }
    }
 
    template <typename ElementType>
-   void SymmetricIndefiniteLinearSystem<ElementType>::assemble_matrix(const SymmetricMatrix<size_t, double>& hessian,
+   void SymmetricIndefiniteLinearSystem<ElementType>::assemble_matrix(const SymmetricMatrix<SparseIndex, double>& hessian,
          const RectangularMatrix<double>& constraint_jacobian, size_t number_variables, size_t number_constraints) {
+      const ScopedProfile profile(Profiler::ASSEMBLY);
+      this->condensation_active = false;
+      size_t jacobian_nonzeros = 0;
+      for (size_t column_index: Range(number_constraints)) {
+         jacobian_nonzeros += constraint_jacobian[column_index].size();
+      }
+      // if the sparsity pattern is unchanged since the last assembly, overwrite the values in place
+      if (this->pattern_assembled && this->assembled_dimension == number_variables + number_constraints &&
+            this->assembled_hessian_nonzeros == hessian.number_nonzeros() && this->assembled_jacobian_nonzeros == jacobian_nonzeros) {
+         this->update_values(hessian, constraint_jacobian, number_constraints);
+         return;
+      }
+
       this->matrix.set_dimension(number_variables + number_constraints);
       this->matrix.reset();
+      this->assembly_slots.clear();
+      this->assembly_slots.reserve(hessian.number_nonzeros() + jacobian_nonzeros);
       // copy the Lagrangian Hessian in the top left block
       //size_t current_column = 0;
-      for (const auto [row_index, column_index, element]: hessian) {
+      hessian.for_each([&](size_t row_index, size_t column_index, double element) {
          // finalize all empty columns
          /*for (size_t column: Range(current_column, column_index)) {
             this->matrix.finalize_column(column);
             current_column++;
          }*/
          this->matrix.insert(element, row_index, column_index);
-      }
+         this->assembly_slots.emplace_back(this->matrix.number_nonzeros() - 1);
+      });
 
       // Jacobian of general constraints
       for (size_t column_index: Range(number_constraints)) {
          for (const auto [row_index, derivative]: constraint_jacobian[column_index]) {
             this->matrix.insert(derivative, row_index, number_variables + column_index);
+            this->assembly_slots.emplace_back(this->matrix.number_nonzeros() - 1);
+         }
+         this->matrix.finalize_column(column_index);
+      }
+      this->pattern_assembled = true;
+      this->assembled_dimension = number_variables + number_constraints;
+      this->assembled_hessian_nonzeros = hessian.number_nonzeros();
+      this->assembled_jacobian_nonzeros = jacobian_nonzeros;
+   }
+
+   // eliminate the block formed by an eliminated variable s and its constraint c: since s carries only
+   // a (positive) diagonal term d and a single constraint coefficient a, Delta s can be removed
+   // analytically, leaving the Schur complement -a^2/d on the dual diagonal. Several variables may be
+   // eliminated against the same constraint (e.g. a slack and a pair of elastics); their Schur terms
+   // simply accumulate. By Haynsworth's inertia additivity, the condensed matrix has the correct inertia
+   // exactly when the full matrix does, so the inertia-correction loop operates unchanged
+   template <typename ElementType>
+   void SymmetricIndefiniteLinearSystem<ElementType>::assemble_condensed_matrix(const SymmetricMatrix<SparseIndex, double>& hessian,
+         const RectangularMatrix<double>& constraint_jacobian, size_t number_variables, size_t number_constraints,
+         const SparseVector<size_t>& eliminated_variables) {
+      const ScopedProfile profile(Profiler::ASSEMBLY);
+      // record the eliminated variables and number the remaining ones consecutively
+      this->condensation_variables.clear();
+      this->condensed_indices.assign(number_variables, 0);
+      this->variable_elimination_positions.assign(number_variables, SIZE_MAX);
+      for (const auto [constraint_index, variable_index]: eliminated_variables) {
+         this->variable_elimination_positions[variable_index] = this->condensation_variables.size();
+         this->condensation_variables.push_back({constraint_index, variable_index, ElementType(0), ElementType(0)});
+         this->condensed_indices[variable_index] = SIZE_MAX;
+      }
+      size_t condensed_index = 0;
+      for (size_t variable_index: Range(number_variables)) {
+         if (this->condensed_indices[variable_index] != SIZE_MAX) {
+            this->condensed_indices[variable_index] = condensed_index;
+            condensed_index++;
+         }
+      }
+      this->condensed_number_variables = condensed_index;
+      this->full_number_variables = number_variables;
+      this->full_number_constraints = number_constraints;
+
+      // gather the diagonal terms of the eliminated variables (the barrier terms, plus possible
+      // regularization-like contributions) and their constraint coefficients
+      hessian.for_each([&](size_t row_index, size_t column_index, double element) {
+         if (row_index == column_index && this->variable_elimination_positions[row_index] != SIZE_MAX) {
+            this->condensation_variables[this->variable_elimination_positions[row_index]].diagonal_term += ElementType(element);
+         }
+      });
+      for (EliminatedVariable& eliminated_variable: this->condensation_variables) {
+         for (const auto [variable_index, derivative]: constraint_jacobian[eliminated_variable.constraint_index]) {
+            if (variable_index == eliminated_variable.variable_index) {
+               eliminated_variable.jacobian_term = ElementType(derivative);
+            }
+         }
+         assert(0. < eliminated_variable.diagonal_term && "The diagonal term of an eliminated variable is not positive");
+         assert(eliminated_variable.jacobian_term != 0. && "An eliminated variable does not appear in its constraint");
+      }
+
+      // accumulate the Schur terms per constraint: a constraint may eliminate several variables
+      this->constraint_schur_terms.assign(number_constraints, ElementType(0));
+      for (const EliminatedVariable& eliminated_variable: this->condensation_variables) {
+         this->constraint_schur_terms[eliminated_variable.constraint_index] -=
+               (eliminated_variable.jacobian_term * eliminated_variable.jacobian_term) / eliminated_variable.diagonal_term;
+      }
+
+      // assemble the condensed matrix (full rebuild: the Schur terms change the values of the pattern)
+      this->matrix.set_dimension(this->condensed_number_variables + number_constraints);
+      this->matrix.reset();
+      hessian.for_each([&](size_t row_index, size_t column_index, double element) {
+         if (this->condensed_indices[row_index] != SIZE_MAX && this->condensed_indices[column_index] != SIZE_MAX) {
+            this->matrix.insert(element, this->condensed_indices[row_index], this->condensed_indices[column_index]);
+         }
+      });
+      for (size_t column_index: Range(number_constraints)) {
+         for (const auto [row_index, derivative]: constraint_jacobian[column_index]) {
+            if (this->condensed_indices[row_index] != SIZE_MAX) {
+               this->matrix.insert(derivative, this->condensed_indices[row_index], this->condensed_number_variables + column_index);
+            }
+         }
+         // Schur complement of the eliminated blocks on the dual diagonal
+         if (this->constraint_schur_terms[column_index] != 0.) {
+            this->matrix.insert(this->constraint_schur_terms[column_index], this->condensed_number_variables + column_index,
+                  this->condensed_number_variables + column_index);
          }
          this->matrix.finalize_column(column_index);
       }
+      this->condensed_rhs.resize(this->condensed_number_variables + number_constraints);
+      this->condensed_solution.resize(this->condensed_number_variables + number_constraints);
+      this->condensation_active = true;
+      // invalidate the incremental assembly: the next full assembly must rebuild the pattern
+      this->pattern_assembled = false;
+   }
+
+   template <typename ElementType>
+   void SymmetricIndefiniteLinearSystem<ElementType>::update_values(const SymmetricMatrix<SparseIndex, double>& hessian,
+         const RectangularMatrix<double>& constraint_jacobian, size_t number_constraints) {
+      ElementType* entries = this->matrix.data_pointer();
+      size_t slot = 0;
+      // the traversal orders are deterministic, therefore identical to those of the structural assembly
+      hessian.for_each([&](size_t /*row_index*/, size_t /*column_index*/, double element) {
+         entries[this->assembly_slots[slot]] = element;
+         slot++;
+      });
+      for (size_t column_index: Range(number_constraints)) {
+         for (const auto [_, derivative]: constraint_jacobian[column_index]) {
+            entries[this->assembly_slots[slot]] = derivative;
+            slot++;
+         }
+      }
+      // reset the regularization terms, as a full reassembly would
+      if (this->use_regularization) {
+         this->matrix.set_regularization([](size_t /*index*/) {
+            return ElementType(0);
+         });
+      }
    }
 
    template <typename ElementType>
    void SymmetricIndefiniteLinearSystem<ElementType>::factorize_matrix(const Model& model,
-         DirectSymmetricIndefiniteLinearSolver<size_t, ElementType>& linear_solver) {
+         DirectSymmetricIndefiniteLinearSolver<SparseIndex, ElementType>& linear_solver) {
+      const ScopedProfile profile(Profiler::FACTORIZATION);
+      if constexpr (std::is_same_v<ElementType, double>) {
+         if (this->capture != nullptr && this->number_factorizations % this->capture_interval == 0) {
+            this->capture->record(this->matrix);
+         }
+      }
+      if (TuningCache::active && not this->tuning_consulted) {
+         this->consult_tuning_cache();
+      }
       // compute the symbolic factorization only when:
       // the problem has a non-constant augmented system (ie is not an LP or a QP) or it is the first factorization
       if (true || this->number_factorizations == 0 || not model.fixed_hessian_sparsity) {
          linear_solver.do_symbolic_factorization(this->matrix);
       }
+      // upfront memory guard: the analysis predicts the factorization memory, so a node that cannot
+      // fit it is diagnosed now with a clear message instead of OOM-killed deep into the solve
+      if (this->number_factorizations == 0) {
+         const size_t predicted_bytes = linear_solver.expected_factor_memory_bytes();
+         const size_t available_bytes = MemoryUsage::available_system_bytes();
+         if (0 < predicted_bytes && 0 < available_bytes && available_bytes < predicted_bytes) {
+            throw std::runtime_error("The factorization memory predicted by the analysis (" +
+                  std::to_string(predicted_bytes/1000000) + " MB) exceeds the available memory (" +
+                  std::to_string(available_bytes/1000000) + " MB)");
+         }
+      }
       linear_solver.do_numerical_factorization(this->matrix);
       this->number_factorizations++;
    }
 
+   // fingerprint the family of the factorized system (dimension and sparsity pattern) and fetch the
+   // regularization that worked for the previous instances of the family, if any
+   template <typename ElementType>
+   void SymmetricIndefiniteLinearSystem<ElementType>::consult_tuning_cache() {
+      uint64_t fingerprint = TuningCache::fingerprint_start();
+      fingerprint = TuningCache::fingerprint_add(fingerprint, this->matrix.dimension());
+      fingerprint = TuningCache::fingerprint_add(fingerprint, this->matrix.number_nonzeros());
+      this->matrix.for_each([&](size_t row_index, size_t column_index, double /*element*/) {
+         fingerprint = TuningCache::fingerprint_add(fingerprint, (uint64_t(row_index) << 32) | uint64_t(column_index));
+      });
+      this->tuning_fingerprint = fingerprint;
+      this->tuning_consulted = true;
+      const TuningCache::Tuning tuning = TuningCache::lookup(fingerprint);
+      this->tuning_primal_seed = ElementType(tuning.primal_regularization);
+      this->tuning_dual_seed = ElementType(tuning.dual_regularization);
+      if (0. < tuning.primal_regularization || 0. < tuning.dual_regularization) {
+         DEBUG << "Tuning cache hit: seeding the regularization with (" << this->tuning_primal_seed << ", " <<
+               this->tuning_dual_seed << ")\n";
+      }
+   }
+
+   // cheap refactorization inside the regularization loop: only the diagonal shifts changed, so the
+   // analysis is reused and the pattern is not re-assembled
    template <typename ElementType>
-   void SymmetricIndefiniteLinearSystem<ElementType>::regularize_matrix(Statistics& statistics, const Model& model,
-         DirectSymmetricIndefiniteLinearSolver<size_t, ElementType>& linear_solver, size_t size_primal_block, size_t size_dual_block,
+   void SymmetricIndefiniteLinearSystem<ElementType>::refactorize_with_shift(DirectSymmetricIndefiniteLinearSolver<SparseIndex, ElementType>& linear_solver) {
+      const ScopedProfile profile(Profiler::FACTORIZATION);
+      linear_solver.factorize_with_shift(this->matrix);
+      this->number_factorizations++;
+   }
+
+   template <typename ElementType>
+   void SymmetricIndefiniteLinearSystem<ElementType>::regularize_matrix(Statistics& statistics,
+         DirectSymmetricIndefiniteLinearSolver<SparseIndex, ElementType>& linear_solver, size_t size_primal_block, size_t size_dual_block,
          ElementType dual_regularization_parameter) {
+      // no scoped profile here: the repeated factorization attempts are measured in factorize_matrix
       DEBUG2 << "Original matrix\n" << this->matrix << '\n';
       this->primal_regularization = ElementType(0.);
       this->dual_regularization = ElementType(0.);
+      this->last_size_primal_block = size_primal_block;
+      this->last_size_dual_block = size_dual_block;
+
+      // inertia-free strategy: the solver is never asked for the inertia. Only singularity is
+      // corrected here; the directional curvature test after each solve drives the Hessian
+      // regularization (see enforce_sufficient_curvature), skipping re-factorizations whenever the
+      // computed direction already has sufficient curvature
+      if (this->inertia_free_curvature_test) {
+         while (linear_solver.matrix_is_singular()) {
+            DEBUG << "Matrix is singular\n";
+            if (this->dual_regularization == 0.) {
+               this->dual_regularization = this->dual_regularization_fraction * dual_regularization_parameter;
+            }
+            else if (this->primal_regularization == 0.) {
+               this->primal_regularization = this->primal_regularization_initial_factor;
+            }
+            else {
+               this->primal_regularization *= this->primal_regularization_fast_increase_factor;
+            }
+            if (this->regularization_failure_threshold < this->primal_regularization) {
+               throw UnstableRegularization();
+            }
+            this->matrix.set_regularization([=](size_t row_index) {
+               return (row_index < size_primal_block) ? this->primal_regularization : -this->dual_regularization;
+            });
+            this->refactorize_with_shift(linear_solver);
+         }
+         if (TuningCache::active && this->tuning_consulted && (0. < this->primal_regularization || 0. < this->dual_regularization)) {
+            TuningCache::store_regularization(this->tuning_fingerprint, double(this->primal_regularization), double(this->dual_regularization));
+         }
+         statistics.set("regularization", this->primal_regularization);
+         return;
+      }
+
       size_t number_attempts = 1;
       DEBUG << "Testing factorization with regularization factors (" << this->primal_regularization << ", " << this->dual_regularization << ")\n";
 
@@ -126,18 +435,26 @@ namespace uno {
       DEBUG << "got (" << number_pos_eigenvalues << ", " << number_neg_eigenvalues << ", " << number_zero_eigenvalues << ")\n";
       DEBUG << "Number of attempts: " << number_attempts << "\n\n";
 
-      // set the constraint regularization coefficient
-      if (linear_solver.matrix_is_singular()) {
-         DEBUG << "Matrix is singular\n";
+      // last successful regularization for this problem phase, if any
+      RegularizationMemory* memory = this->find_regularization_memory(size_primal_block, size_dual_block);
+
+      // set the constraint regularization coefficient. If this phase needed it last time, the matrix is
+      // likely singular again: set it right away rather than wasting a factorization to find out
+      if (linear_solver.matrix_is_singular() || (memory != nullptr && 0. < memory->dual_regularization) ||
+            (memory == nullptr && 0. < this->tuning_dual_seed)) {
+         DEBUG << "Matrix is (or is expected to be) singular\n";
          this->dual_regularization = this->dual_regularization_fraction * dual_regularization_parameter;
       }
-      // set the Hessian regularization coefficient
-      if (this->previous_primal_regularization == 0.) {
-         this->primal_regularization = this->primal_regularization_initial_factor;
+      // set the Hessian regularization coefficient, starting slightly below the last successful value
+      if (memory == nullptr) {
+         // first regularization of this phase: prefer the cross-instance seed, when one exists
+         this->primal_regularization = (0. < this->tuning_primal_seed) ?
+               std::max(this->primal_regularization_lb, this->tuning_primal_seed / this->primal_regularization_decrease_factor) :
+               this->primal_regularization_initial_factor;
       }
       else {
          this->primal_regularization = std::max(this->primal_regularization_lb,
-               this->previous_primal_regularization / this->primal_regularization_decrease_factor);
+               memory->primal_regularization / this->primal_regularization_decrease_factor);
       }
 
       // regularize the augmented matrix
@@ -149,20 +466,32 @@ namespace uno {
       while (not good_inertia) {
          DEBUG << "Testing factorization with regularization factors (" << this->primal_regularization << ", " << this->dual_regularization << ")\n";
          DEBUG2 << this->matrix << '\n';
-         this->factorize_matrix(model, linear_solver);
+         // only the diagonal regularization terms changed: numerical refactorization only
+         this->refactorize_with_shift(linear_solver);
          number_attempts++;
 
          if (not linear_solver.matrix_is_singular() && linear_solver.number_negative_eigenvalues() == size_dual_block) {
             good_inertia = true;
             DEBUG << "Factorization was a success\n";
-            this->previous_primal_regularization = this->primal_regularization;
+            // remember the successful pair for the next regularization of this phase
+            if (memory != nullptr) {
+               memory->primal_regularization = this->primal_regularization;
+               memory->dual_regularization = this->dual_regularization;
+            }
+            else {
+               this->regularization_memory.push_back({size_primal_block, size_dual_block, this->primal_regularization, this->dual_regularization});
+            }
+            // publish the successful pair for the later solves of the same family
+            if (TuningCache::active && this->tuning_consulted) {
+               TuningCache::store_regularization(this->tuning_fingerprint, double(this->primal_regularization), double(this->dual_regularization));
+            }
          }
          else {
             auto [number_pos_eigenvalues, number_neg_eigenvalues, number_zero_eigenvalues] = linear_solver.get_inertia();
             DEBUG << "Expected inertia (" << size_primal_block << ", " << size_dual_block << ", 0), ";
             DEBUG << "got (" << number_pos_eigenvalues << ", " << number_neg_eigenvalues << ", " << number_zero_eigenvalues << ")\n";
             DEBUG << "Number of attempts: " << number_attempts << "\n";
-            if (this->previous_primal_regularization == 0. || this->threshold_unsuccessful_attempts < number_attempts) {
+            if (memory == nullptr || this->threshold_unsuccessful_attempts < number_attempts) {
                this->primal_regularization *= this->primal_regularization_fast_increase_factor;
             }
             else {
@@ -184,8 +513,113 @@ namespace uno {
    }
 
    template <typename ElementType>
-   void SymmetricIndefiniteLinearSystem<ElementType>::solve(DirectSymmetricIndefiniteLinearSolver<size_t, ElementType>& linear_solver) {
-      linear_solver.solve_indefinite_system(this->matrix, this->rhs, this->solution);
+   typename SymmetricIndefiniteLinearSystem<ElementType>::RegularizationMemory*
+         SymmetricIndefiniteLinearSystem<ElementType>::find_regularization_memory(size_t size_primal_block, size_t size_dual_block) {
+      for (RegularizationMemory& memory: this->regularization_memory) {
+         if (memory.size_primal_block == size_primal_block && memory.size_dual_block == size_dual_block) {
+            return &memory;
+         }
+      }
+      return nullptr;
+   }
+
+   template <typename ElementType>
+   void SymmetricIndefiniteLinearSystem<ElementType>::solve(DirectSymmetricIndefiniteLinearSolver<SparseIndex, ElementType>& linear_solver) {
+      const ScopedProfile profile(Profiler::SOLVE);
+      if (this->condensation_active) {
+         // the caller filled this->rhs in the full numbering: solve in the condensed one, then recover
+         // the eliminated components analytically
+         this->condense_rhs();
+      }
+      Vector<ElementType>& actual_rhs = this->condensation_active ? this->condensed_rhs : this->rhs;
+      Vector<ElementType>& actual_solution = this->condensation_active ? this->condensed_solution : this->solution;
+      linear_solver.solve_indefinite_system(this->matrix, actual_rhs, actual_solution);
+      if (this->inertia_free_curvature_test && this->use_regularization && 0 < this->last_size_primal_block) {
+         this->enforce_sufficient_curvature(linear_solver, actual_rhs, actual_solution);
+      }
+      if (this->condensation_active) {
+         this->expand_solution();
+      }
+   }
+
+   // inertia-free regularization loop: as long as the directional curvature of the computed direction
+   // is insufficient, increase the Hessian regularization, refactorize and re-solve. When the initial
+   // direction passes the test (the common case near a well-conditioned solution), no extra
+   // factorization is performed at all
+   template <typename ElementType>
+   void SymmetricIndefiniteLinearSystem<ElementType>::enforce_sufficient_curvature(
+         DirectSymmetricIndefiniteLinearSolver<SparseIndex, ElementType>& linear_solver, const Vector<ElementType>& current_rhs,
+         Vector<ElementType>& current_solution) {
+      while (not this->direction_has_sufficient_curvature(current_solution)) {
+         this->primal_regularization = (this->primal_regularization == 0.) ? this->primal_regularization_initial_factor :
+               this->primal_regularization * this->primal_regularization_fast_increase_factor;
+         if (this->regularization_failure_threshold < this->primal_regularization) {
+            throw UnstableRegularization();
+         }
+         DEBUG << "Curvature test failed: regularizing with factors (" << this->primal_regularization << ", " <<
+               this->dual_regularization << ")\n";
+         const size_t size_primal_block = this->last_size_primal_block;
+         this->matrix.set_regularization([=](size_t row_index) {
+            return (row_index < size_primal_block) ? this->primal_regularization : -this->dual_regularization;
+         });
+         this->refactorize_with_shift(linear_solver);
+         linear_solver.solve_indefinite_system(this->matrix, current_rhs, current_solution);
+      }
+   }
+
+   // test d^T W d >= fraction * ||d||^2 on the primal block of the direction. The direction is padded
+   // with zeros on the dual block, so that the quadratic product with the augmented matrix reduces to
+   // d^T (W + delta_w I) d: the Jacobian and dual blocks contribute nothing
+   template <typename ElementType>
+   bool SymmetricIndefiniteLinearSystem<ElementType>::direction_has_sufficient_curvature(const Vector<ElementType>& direction) {
+      const size_t dimension = this->matrix.dimension();
+      this->curvature_test_vector.resize(dimension);
+      this->curvature_test_vector.fill(ElementType(0));
+      ElementType direction_norm_squared{0};
+      for (size_t variable_index: Range(std::min(this->last_size_primal_block, dimension))) {
+         const ElementType entry = direction[variable_index];
+         this->curvature_test_vector[variable_index] = entry;
+         direction_norm_squared += entry * entry;
+      }
+      if (direction_norm_squared == ElementType(0)) {
+         return true;
+      }
+      const ElementType curvature = this->matrix.quadratic_product(this->curvature_test_vector, this->curvature_test_vector);
+      return this->inertia_free_curvature_fraction * direction_norm_squared <= curvature;
+   }
+
+   template <typename ElementType>
+   void SymmetricIndefiniteLinearSystem<ElementType>::condense_rhs() {
+      for (size_t variable_index: Range(this->full_number_variables)) {
+         if (this->condensed_indices[variable_index] != SIZE_MAX) {
+            this->condensed_rhs[this->condensed_indices[variable_index]] = this->rhs[variable_index];
+         }
+      }
+      for (size_t constraint_index: Range(this->full_number_constraints)) {
+         this->condensed_rhs[this->condensed_number_variables + constraint_index] = this->rhs[this->full_number_variables + constraint_index];
+      }
+      for (const EliminatedVariable& eliminated_variable: this->condensation_variables) {
+         this->condensed_rhs[this->condensed_number_variables + eliminated_variable.constraint_index] -=
+               eliminated_variable.jacobian_term * this->rhs[eliminated_variable.variable_index] / eliminated_variable.diagonal_term;
+      }
+   }
+
+   template <typename ElementType>
+   void SymmetricIndefiniteLinearSystem<ElementType>::expand_solution() {
+      for (size_t variable_index: Range(this->full_number_variables)) {
+         if (this->condensed_indices[variable_index] != SIZE_MAX) {
+            this->solution[variable_index] = this->condensed_solution[this->condensed_indices[variable_index]];
+         }
+      }
+      for (size_t constraint_index: Range(this->full_number_constraints)) {
+         this->solution[this->full_number_variables + constraint_index] = this->condensed_solution[this->condensed_number_variables + constraint_index];
+      }
+      // back-substitute the eliminated variables
+      for (const EliminatedVariable& eliminated_variable: this->condensation_variables) {
+         const ElementType dual_component = this->condensed_solution[this->condensed_number_variables + eliminated_variable.constraint_index];
+         this->solution[eliminated_variable.variable_index] =
+               (this->rhs[eliminated_variable.variable_index] - eliminated_variable.jacobian_term * dual_component) / eliminated_variable.diagonal_term;
+      }
    }
 
    /*
@@ -9,6 +9,7 @@
 #include <cassert>
 #include "SparseStorage.hpp"
 #include "SparseStorageFactory.hpp"
+#include "Vector.hpp"
 #include "tools/Infinity.hpp"
 
 namespace uno {
@@ -21,17 +22,32 @@ namespace uno {
       SymmetricMatrix(size_t dimension, size_t capacity, bool use_regularization, const std::string& sparse_format);
       ~SymmetricMatrix() = default;
 
-      void reset() { this->sparse_storage->reset(); }
+      void reset() { this->structure_version_counter++; this->sparse_storage->reset(); }
+      // merge duplicate (row, column) entries in place (no-op for formats without duplicates)
+      void compress() { this->structure_version_counter++; this->sparse_storage->compress(); }
       size_t dimension() const { return this->sparse_storage->dimension; }
-      void set_dimension(size_t new_dimension) { this->sparse_storage->set_dimension(new_dimension); }
+      void set_dimension(size_t new_dimension) { this->structure_version_counter++; this->sparse_storage->set_dimension(new_dimension); }
+      // structural modifications (reset + rebuild, compression, dimension changes) bump this counter;
+      // value-only updates (through data_pointer() or set_regularization()) leave it unchanged.
+      // Consumers that maintain a converted copy of the pattern (e.g. the direct solvers) compare it
+      // to detect that their copy is still valid
+      [[nodiscard]] size_t structure_version() const { return this->structure_version_counter; }
       size_t number_nonzeros() const { return this->sparse_storage->number_nonzeros; }
       size_t capacity() const { return this->sparse_storage->capacity; }
       template <typename Vector1, typename Vector2>
       ElementType quadratic_product(const Vector1& x, const Vector2& y) const;
+      // overload for contiguous vectors: a single virtual call into the storage, which may exploit
+      // the sparsity pattern (e.g. the blocked_COO format runs dense kernels over detected blocks)
+      ElementType quadratic_product(const Vector<ElementType>& x, const Vector<ElementType>& y) const;
+      // single-virtual-call traversal of the nonzeros (cheaper than the iterator on hot paths)
+      void for_each(const std::function<void(IndexType /*row_index*/, IndexType /*column_index*/, ElementType /*element*/)>& f) const {
+         this->sparse_storage->for_each(f);
+      }
 
-      // build the matrix incrementally
-      void insert(ElementType term, IndexType row_index, IndexType column_index);
-      void finalize_column(IndexType column_index) { this->sparse_storage->finalize_column(column_index); }
+      // build the matrix incrementally. The indices are taken as size_t and narrowed here, so that
+      // the call sites are written once, whatever the configured SparseIndex width
+      void insert(ElementType term, size_t row_index, size_t column_index);
+      void finalize_column(size_t column_index) { this->sparse_storage->finalize_column(static_cast<IndexType>(column_index)); }
       
       [[nodiscard]] ElementType smallest_diagonal_entry(size_t max_dimension) const;
       
@@ -55,6 +71,7 @@ namespace uno {
 
    protected:
       std::unique_ptr<SparseStorage<IndexType, ElementType>> sparse_storage;
+      size_t structure_version_counter{0};
    };
 
    // implementation
@@ -68,11 +85,11 @@ namespace uno {
    // TODO fix. We need to scan through all the columns
    inline ElementType SymmetricMatrix<IndexType, ElementType>::smallest_diagonal_entry(size_t max_dimension) const {
       ElementType smallest_entry = INF<ElementType>;
-      for (const auto [row_index, column_index, element]: *this->sparse_storage) {
+      this->sparse_storage->for_each([&](IndexType row_index, IndexType column_index, ElementType element) {
          if (row_index == column_index && row_index < max_dimension) {
             smallest_entry = std::min(smallest_entry, element);
          }
-      }
+      });
       if (smallest_entry == INF<ElementType>) {
          smallest_entry = ElementType(0);
       }
@@ -87,7 +104,7 @@ namespace uno {
       assert(x.size() == y.size() && "SymmetricMatrix::quadratic_product: the two vectors x and y do not have the same size");
 
       ElementType result = ElementType(0);
-      for (const auto [row_index, column_index, element]: *this) {
+      this->sparse_storage->for_each([&](IndexType row_index, IndexType column_index, ElementType element) {
          if (row_index == column_index) {
             // diagonal term
             result += element * x[row_index] * y[row_index];
@@ -96,14 +113,20 @@ namespace uno {
             // off-diagonal term
             result += element * (x[row_index] * y[column_index] + x[column_index] * y[row_index]);
          }
-      }
+      });
       return result;
    }
 
    template <typename IndexType, typename ElementType>
-   inline void SymmetricMatrix<IndexType, ElementType>::insert(ElementType term, IndexType row_index, IndexType column_index) {
+   inline ElementType SymmetricMatrix<IndexType, ElementType>::quadratic_product(const Vector<ElementType>& x, const Vector<ElementType>& y) const {
+      assert(x.size() == y.size() && "SymmetricMatrix::quadratic_product: the two vectors x and y do not have the same size");
+      return this->sparse_storage->quadratic_product(x.data(), y.data());
+   }
+
+   template <typename IndexType, typename ElementType>
+   inline void SymmetricMatrix<IndexType, ElementType>::insert(ElementType term, size_t row_index, size_t column_index) {
       // check if element in upper/lower triangular part
-      this->sparse_storage->insert(term, row_index, column_index);
+      this->sparse_storage->insert(term, static_cast<IndexType>(row_index), static_cast<IndexType>(column_index));
    }
    
    template <typename Index, typename Element>
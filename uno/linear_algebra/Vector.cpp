@@ -0,0 +1,10 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "Vector.hpp"
+
+namespace uno {
+   // deep copies by default: the copy-on-write sharing is opted into by the snapshot-heavy
+   // drivers (copy_on_write_vectors option)
+   bool CopyOnWrite::active = false;
+} // namespace
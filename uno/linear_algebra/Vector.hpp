@@ -4,33 +4,79 @@
 #ifndef UNO_VECTOR_H
 #define UNO_VECTOR_H
 
+#include <cassert>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <type_traits>
 #include <vector>
 #include <initializer_list>
+#include "linear_algebra/BlasKernels.hpp"
+#include "linear_algebra/FirstTouchAllocator.hpp"
 #include "symbolic/Range.hpp"
 
 namespace uno {
+   // process-wide switch of the copy-on-write vector copies (see Vector): when active, copying a
+   // Vector shares its buffer in O(1) and each side clones upon its first subsequent mutation.
+   // Enabled by the snapshot-heavy drivers (multistart, checkpointing) through the
+   // copy_on_write_vectors option, off by default (copies are deep, as before)
+   class CopyOnWrite {
+   public:
+      static bool active;
+   };
+
+   // detection of the bulk materialization protocol of the symbolic composites (see evaluate_into
+   // in uno/symbolic): an expression that provides it is assigned in one fused pass instead of
+   // element by element through operator[]
+   template <typename Expression, typename Result, typename = void>
+   struct is_evaluable_into : std::false_type {};
+
+   template <typename Expression, typename Result>
+   struct is_evaluable_into<Expression, Result,
+         std::void_t<decltype(std::declval<const Expression&>().evaluate_into(std::declval<Result&>()))>> : std::true_type {};
+
    template <typename ElementType>
    class Vector {
+      using Storage = std::vector<ElementType, FirstTouchAllocator<ElementType>>;
+
    public:
       using value_type = ElementType;
       // iterators
-      using iterator = typename std::vector<ElementType>::iterator;
-      using const_iterator = typename std::vector<ElementType>::const_iterator;
+      using iterator = typename Storage::iterator;
+      using const_iterator = typename Storage::const_iterator;
 
       // constructors and destructor
-      explicit Vector(size_t capacity = 0): vector(capacity) { }
-      explicit Vector(size_t capacity, ElementType value): vector(capacity, value) { }
-      Vector(std::initializer_list<ElementType> initializer_list): vector(initializer_list) { }
-      Vector(const Vector<ElementType>& other) noexcept : vector(other.vector) { }
-      Vector(Vector<ElementType>&& other) noexcept : vector(std::move(other.vector)) { }
+      explicit Vector(size_t capacity = 0): storage(std::make_shared<Storage>(capacity)) { }
+      explicit Vector(size_t capacity, ElementType value): storage(std::make_shared<Storage>(capacity, value)) { }
+      Vector(std::initializer_list<ElementType> initializer_list): storage(std::make_shared<Storage>(initializer_list)) { }
+      // copy: with copy-on-write active the buffer is shared and both sides are flagged, so that
+      // whichever is mutated first detaches; otherwise a deep copy
+      Vector(const Vector<ElementType>& other) noexcept {
+         if (CopyOnWrite::active && other.storage != nullptr) {
+            this->storage = other.storage;
+            this->maybe_shared.store(true, std::memory_order_relaxed);
+            other.maybe_shared.store(true, std::memory_order_relaxed);
+         }
+         else {
+            this->storage = std::make_shared<Storage>(other.read());
+         }
+      }
+      Vector(Vector<ElementType>&& other) noexcept :
+            storage(std::move(other.storage)), maybe_shared(other.maybe_shared.load(std::memory_order_relaxed)) { }
       ~Vector() = default;
 
       // copy assignment operator
       Vector<ElementType>& operator=(const Vector<ElementType>& other) {
          if (&other != this) {
-            this->vector = other.vector;
+            if (CopyOnWrite::active && other.storage != nullptr) {
+               this->storage = other.storage;
+               this->maybe_shared.store(true, std::memory_order_relaxed);
+               other.maybe_shared.store(true, std::memory_order_relaxed);
+            }
+            else {
+               // assign into the existing buffer: the spare capacity is preserved
+               this->write() = other.read();
+            }
          }
          return *this;
       }
@@ -38,7 +84,8 @@ namespace uno {
       // move assignment operator
       Vector<ElementType>& operator=(Vector<ElementType>&& other) noexcept {
          if (&other != this) {
-            this->vector = std::move(other.vector);
+            this->storage = std::move(other.storage);
+            this->maybe_shared.store(other.maybe_shared.load(std::memory_order_relaxed), std::memory_order_relaxed);
          }
          return *this;
       }
@@ -47,8 +94,15 @@ namespace uno {
       template <typename Expression>
       Vector<ElementType>& operator=(const Expression& expression) {
          static_assert(std::is_same_v<typename Expression::value_type, ElementType>);
-         for (size_t index = 0; index < this->size(); index++) {
-            this->vector[index] = expression[index];
+         Storage& elements = this->write();
+         if constexpr (is_evaluable_into<Expression, Storage>::value) {
+            // fused bulk path: the composite writes all its components in a single pass
+            expression.evaluate_into(elements);
+         }
+         else {
+            for (size_t index = 0; index < elements.size(); index++) {
+               elements[index] = expression[index];
+            }
          }
          return *this;
       }
@@ -56,41 +110,54 @@ namespace uno {
       // sum operator
       template <typename Expression>
       Vector<ElementType>& operator+=(const Expression& expression) {
-         for (size_t index = 0; index < this->size(); index++) {
-            this->vector[index] += expression[index];
+         Storage& elements = this->write();
+         for (size_t index = 0; index < elements.size(); index++) {
+            elements[index] += expression[index];
          }
          return *this;
       }
 
       // random access
-      ElementType& operator[](size_t index) { return this->vector[index]; }
-      const ElementType& operator[](size_t index) const { return this->vector[index]; }
+      ElementType& operator[](size_t index) { return this->write()[index]; }
+      const ElementType& operator[](size_t index) const { return this->read()[index]; }
 
       // size
-      [[nodiscard]] size_t size() const { return this->vector.size(); }
+      [[nodiscard]] size_t size() const { return this->read().size(); }
       [[nodiscard]] bool empty() const { return (this->size() == 0); }
-      void resize(size_t new_size) { this->vector.resize(new_size); }
+      // resizing never shrinks the allocation: growing back within capacity does not reallocate
+      void resize(size_t new_size) { this->write().resize(new_size); }
+      void reserve(size_t capacity) { this->write().reserve(capacity); }
 
       // iterators
-      iterator begin() noexcept { return this->vector.begin(); }
-      iterator end() noexcept { return this->vector.end(); }
-      const_iterator begin() const noexcept { return this->vector.cbegin(); }
-      const_iterator end() const noexcept { return this->vector.cend(); }
+      iterator begin() noexcept { return this->write().begin(); }
+      iterator end() noexcept { return this->write().end(); }
+      const_iterator begin() const noexcept { return this->read().cbegin(); }
+      const_iterator end() const noexcept { return this->read().cend(); }
 
       void fill(ElementType value) {
-         for (size_t index = 0; index < this->size(); index++) {
-            this->vector[index] = value;
+         Storage& elements = this->write();
+         for (size_t index = 0; index < elements.size(); index++) {
+            elements[index] = value;
          }
       }
 
       void scale(ElementType factor) {
-         for (size_t index = 0; index < this->size(); index++) {
-            this->vector[index] *= factor;
+         Storage& elements = this->write();
+         // large double vectors go to the vendor BLAS (dscal), when one is available
+         if constexpr (std::is_same_v<ElementType, double>) {
+            if (use_blas(elements.size())) {
+               blas_scale(elements.size(), factor, elements.data());
+               return;
+            }
+         }
+         for (size_t index = 0; index < elements.size(); index++) {
+            elements[index] *= factor;
          }
       }
 
-      ElementType* data() { return this->vector.data(); }
-      const ElementType* data() const { return this->vector.data(); }
+      // 64-byte aligned (see FirstTouchAllocator): safe for aligned SIMD loads and BLAS fast paths
+      ElementType* data() { return this->write().data(); }
+      const ElementType* data() const { return this->read().data(); }
 
       void print(std::ostream& stream) const {
          for (const ElementType& element: *this) {
@@ -99,7 +166,41 @@ namespace uno {
       }
 
    protected:
-      std::vector<ElementType> vector;
+      // the elements live behind a shared handle (NUMA-friendly placement, see FirstTouchAllocator):
+      // a copy-on-write copy shares the buffer and each side clones upon its first mutation. Caveat
+      // of any copy-on-write scheme: an element reference or data() pointer obtained before a copy
+      // must not be written through after it (the write would reach the shared buffer)
+      std::shared_ptr<Storage> storage{};
+      // conservative sharing flag, raised on both sides of a copy-on-write copy: the cheap test
+      // that keeps the non-shared mutation paths free of atomic use-count reads. Atomic because
+      // concurrent snapshots of one source (e.g. the multistart workers copying the nominal
+      // iterate) raise the flag of that source from several threads; relaxed ordering suffices,
+      // since the shared_ptr use count provides the ordering that detach relies on
+      mutable std::atomic<bool> maybe_shared{false};
+
+      // read access (the empty fallback covers the moved-from state)
+      [[nodiscard]] const Storage& read() const {
+         static const Storage empty_storage{};
+         return (this->storage != nullptr) ? *this->storage : empty_storage;
+      }
+
+      // write access: detach from a shared buffer first
+      [[nodiscard]] Storage& write() {
+         if (this->maybe_shared.load(std::memory_order_relaxed) || this->storage == nullptr) {
+            this->detach();
+         }
+         return *this->storage;
+      }
+
+      void detach() {
+         if (this->storage == nullptr) {
+            this->storage = std::make_shared<Storage>();
+         }
+         else if (1 < this->storage.use_count()) {
+            this->storage = std::make_shared<Storage>(*this->storage);
+         }
+         this->maybe_shared.store(false, std::memory_order_relaxed);
+      }
    };
 
    // use && to allow temporaries (such as std::cout or logger DEBUG, WARNING, etc)
@@ -117,11 +218,43 @@ namespace uno {
       return stream;
    }
 
-   // subtract operator
+   // number of indices per tile of the blocked vector sweeps: cache-sized, and the natural unit of
+   // work if the tiles are later handed to a thread pool
+   constexpr size_t VECTOR_BLOCK_SIZE = 4096;
+
+   // subtract operator, traversed in cache-sized tiles
    template <typename ResultExpression, typename Expression>
    void operator-=(ResultExpression&& result, const Expression& expression) {
-      for (size_t index = 0; index < result.size(); index++) {
-         result[index] -= expression[index];
+      for (const ForwardRange block: Range(result.size()).blocks(VECTOR_BLOCK_SIZE)) {
+         for (size_t index: block) {
+            result[index] -= expression[index];
+         }
+      }
+   }
+
+   // dense axpy-like kernel: result = x + scaling_factor*y, written on raw pointers declared as
+   // non-aliasing so that the compiler emits SIMD code under -O3 with the vector instruction set of
+   // the target architecture. For very large vectors (millions of variables), this runs at memory
+   // bandwidth, unlike the generic expression assignment whose operands may alias
+   template <typename ElementType>
+   void add_vectors(const Vector<ElementType>& x, const Vector<ElementType>& y, ElementType scaling_factor, Vector<ElementType>& result) {
+      assert(result.size() <= x.size() && "add_vectors: x is shorter than the result");
+      assert(result.size() <= y.size() && "add_vectors: y is shorter than the result");
+
+      const size_t size = result.size();
+      // the in-place form result = result + a*y is exactly the BLAS daxpy; the general three-operand
+      // form stays hand-rolled, where it is a single fused pass (copy + axpy would traverse twice)
+      if constexpr (std::is_same_v<ElementType, double>) {
+         if (result.data() == x.data() && use_blas(size)) {
+            blas_axpy(size, scaling_factor, y.data(), result.data());
+            return;
+         }
+      }
+      const ElementType* __restrict__ x_data = x.data();
+      const ElementType* __restrict__ y_data = y.data();
+      ElementType* __restrict__ result_data = result.data();
+      for (size_t index = 0; index < size; index++) {
+         result_data[index] = x_data[index] + scaling_factor * y_data[index];
       }
    }
 } // namespace
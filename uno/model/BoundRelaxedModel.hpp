@@ -9,6 +9,9 @@
 #include "tools/Options.hpp"
 
 namespace uno {
+   // relax the variable bounds of the wrapped model by a small fraction of their magnitude. The
+   // relaxed bounds are computed on the fly from the wrapped model: the wrapper does not materialize
+   // any per-variable array, so stacking it costs O(1) in memory and time
    class BoundRelaxedModel: public Model {
    public:
       BoundRelaxedModel(std::unique_ptr<Model> original_model, const Options& options);
@@ -20,6 +23,23 @@ namespace uno {
       void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override {
          this->model->evaluate_constraints(x, constraints);
       }
+      void evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+            std::vector<double>& constraints) const override {
+         this->model->evaluate_constraints_subset(x, constraint_indices, constraints);
+      }
+      [[nodiscard]] bool try_evaluate_objective(const Vector<double>& x, double& objective_value) const override {
+         return this->model->try_evaluate_objective(x, objective_value);
+      }
+      [[nodiscard]] bool try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override {
+         return this->model->try_evaluate_constraints(x, constraints);
+      }
+      [[nodiscard]] bool try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+            std::vector<double>& constraints) const override {
+         return this->model->try_evaluate_objective_and_constraints(x, objective_value, constraints);
+      }
+      [[nodiscard]] std::vector<std::pair<size_t, double>> get_constraint_cost_profile() const override {
+         return this->model->get_constraint_cost_profile();
+      }
       void evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const override {
          this->model->evaluate_constraint_gradient(x, constraint_index, gradient);
       }
@@ -27,10 +47,16 @@ namespace uno {
          this->model->evaluate_constraint_jacobian(x, constraint_jacobian);
       }
       void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
-            SymmetricMatrix<size_t, double>& hessian) const override {
+            SymmetricMatrix<SparseIndex, double>& hessian) const override {
          this->model->evaluate_lagrangian_hessian(x, objective_multiplier, multipliers, hessian);
       }
 
+      [[nodiscard]] bool has_hessian_operator() const override { return this->model->has_hessian_operator(); }
+      void compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            const Vector<double>& vector, Vector<double>& result) const override {
+         this->model->compute_hessian_vector_product(x, objective_multiplier, multipliers, vector, result);
+      }
+
       // only these two functions are redefined
       [[nodiscard]] double variable_lower_bound(size_t variable_index) const override;
       [[nodiscard]] double variable_upper_bound(size_t variable_index) const override;
@@ -55,6 +81,8 @@ namespace uno {
          this->model->postprocess_solution(iterate, termination_status);
       }
 
+      [[nodiscard]] bool supports_concurrent_evaluations() const override { return this->model->supports_concurrent_evaluations(); }
+
       [[nodiscard]] size_t number_objective_gradient_nonzeros() const override { return this->model->number_objective_gradient_nonzeros(); }
       [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model->number_jacobian_nonzeros(); }
       [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model->number_hessian_nonzeros(); }
@@ -0,0 +1,166 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BOUNDTIGHTENEDMODEL_H
+#define UNO_BOUNDTIGHTENEDMODEL_H
+
+#include "Model.hpp"
+#include "optimization/Iterate.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+
+namespace uno {
+   // presolve stage: replace the declared variable bounds with bounds tightened by constraint
+   // propagation (see BoundTightening). The dimensions, functions and constraint indexing are
+   // unchanged; only the variable bound API is redefined. Since tightening may turn infinite
+   // bounds finite, the bound types and the bounded-variable index lists are recomputed
+   class BoundTightenedModel: public Model {
+   public:
+      BoundTightenedModel(std::unique_ptr<Model> original_model, std::vector<double> tightened_lower_bounds,
+            std::vector<double> tightened_upper_bounds);
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override { return this->model->evaluate_objective(x); }
+      void evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const override {
+         this->model->evaluate_objective_gradient(x, gradient);
+      }
+      void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override {
+         this->model->evaluate_constraints(x, constraints);
+      }
+      void evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+            std::vector<double>& constraints) const override {
+         this->model->evaluate_constraints_subset(x, constraint_indices, constraints);
+      }
+      [[nodiscard]] bool try_evaluate_objective(const Vector<double>& x, double& objective_value) const override {
+         return this->model->try_evaluate_objective(x, objective_value);
+      }
+      [[nodiscard]] bool try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override {
+         return this->model->try_evaluate_constraints(x, constraints);
+      }
+      [[nodiscard]] bool try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+            std::vector<double>& constraints) const override {
+         return this->model->try_evaluate_objective_and_constraints(x, objective_value, constraints);
+      }
+      [[nodiscard]] std::vector<std::pair<size_t, double>> get_constraint_cost_profile() const override {
+         return this->model->get_constraint_cost_profile();
+      }
+      void evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const override {
+         this->model->evaluate_constraint_gradient(x, constraint_index, gradient);
+      }
+      void evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const override {
+         this->model->evaluate_constraint_jacobian(x, constraint_jacobian);
+      }
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            SymmetricMatrix<SparseIndex, double>& hessian) const override {
+         this->model->evaluate_lagrangian_hessian(x, objective_multiplier, multipliers, hessian);
+      }
+
+      [[nodiscard]] bool has_hessian_operator() const override { return this->model->has_hessian_operator(); }
+      void compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            const Vector<double>& vector, Vector<double>& result) const override {
+         this->model->compute_hessian_vector_product(x, objective_multiplier, multipliers, vector, result);
+      }
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->variable_lower_bounds[variable_index]; }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->variable_upper_bounds[variable_index]; }
+      [[nodiscard]] BoundType get_variable_bound_type(size_t variable_index) const override { return this->variable_status[variable_index]; }
+      [[nodiscard]] const Collection<size_t>& get_lower_bounded_variables() const override { return this->lower_bounded_variables_collection; }
+      [[nodiscard]] const Collection<size_t>& get_upper_bounded_variables() const override { return this->upper_bounded_variables_collection; }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->model->get_slacks(); }
+      [[nodiscard]] const Collection<size_t>& get_single_lower_bounded_variables() const override {
+         return this->single_lower_bounded_variables_collection;
+      }
+      [[nodiscard]] const Collection<size_t>& get_single_upper_bounded_variables() const override {
+         return this->single_upper_bounded_variables_collection;
+      }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override { return this->model->constraint_lower_bound(constraint_index); }
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override { return this->model->constraint_upper_bound(constraint_index); }
+      [[nodiscard]] FunctionType get_constraint_type(size_t constraint_index) const override { return this->model->get_constraint_type(constraint_index); }
+      [[nodiscard]] BoundType get_constraint_bound_type(size_t constraint_index) const override { return this->model->get_constraint_bound_type(constraint_index); }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->model->get_equality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->model->get_inequality_constraints(); }
+      [[nodiscard]] const std::vector<size_t>& get_linear_constraints() const override { return this->model->get_linear_constraints(); }
+
+      // the initial point is projected onto the tightened box
+      void initial_primal_point(Vector<double>& x) const override {
+         this->model->initial_primal_point(x);
+         this->project_onto_variable_bounds(x);
+      }
+      void initial_dual_point(Vector<double>& multipliers) const override { this->model->initial_dual_point(multipliers); }
+      void postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const override {
+         this->model->postprocess_solution(iterate, termination_status);
+      }
+
+      [[nodiscard]] bool supports_concurrent_evaluations() const override { return this->model->supports_concurrent_evaluations(); }
+
+      [[nodiscard]] size_t number_objective_gradient_nonzeros() const override { return this->model->number_objective_gradient_nonzeros(); }
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model->number_jacobian_nonzeros(); }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model->number_hessian_nonzeros(); }
+
+   private:
+      const std::unique_ptr<Model> model;
+      const std::vector<double> variable_lower_bounds;
+      const std::vector<double> variable_upper_bounds;
+      std::vector<BoundType> variable_status;
+
+      // index lists of the bounded variables + corresponding collection objects
+      std::vector<size_t> lower_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> lower_bounded_variables_collection;
+      std::vector<size_t> upper_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> upper_bounded_variables_collection;
+      std::vector<size_t> single_lower_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> single_lower_bounded_variables_collection;
+      std::vector<size_t> single_upper_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> single_upper_bounded_variables_collection;
+   };
+
+   inline BoundTightenedModel::BoundTightenedModel(std::unique_ptr<Model> original_model, std::vector<double> tightened_lower_bounds,
+         std::vector<double> tightened_upper_bounds):
+         Model(original_model->name + "_boundtightened", original_model->number_variables, original_model->number_constraints,
+               original_model->objective_sign),
+         model(std::move(original_model)),
+         variable_lower_bounds(std::move(tightened_lower_bounds)),
+         variable_upper_bounds(std::move(tightened_upper_bounds)),
+         variable_status(this->number_variables),
+         lower_bounded_variables_collection(this->lower_bounded_variables),
+         upper_bounded_variables_collection(this->upper_bounded_variables),
+         single_lower_bounded_variables_collection(this->single_lower_bounded_variables),
+         single_upper_bounded_variables_collection(this->single_upper_bounded_variables) {
+      // recompute the bound types and the index lists of the bounded variables
+      for (size_t variable_index: Range(this->number_variables)) {
+         const double lower_bound = this->variable_lower_bounds[variable_index];
+         const double upper_bound = this->variable_upper_bounds[variable_index];
+         if (lower_bound == upper_bound) {
+            this->variable_status[variable_index] = EQUAL_BOUNDS;
+         }
+         else if (is_finite(lower_bound) && is_finite(upper_bound)) {
+            this->variable_status[variable_index] = BOUNDED_BOTH_SIDES;
+         }
+         else if (is_finite(lower_bound)) {
+            this->variable_status[variable_index] = BOUNDED_LOWER;
+         }
+         else if (is_finite(upper_bound)) {
+            this->variable_status[variable_index] = BOUNDED_UPPER;
+         }
+         else {
+            this->variable_status[variable_index] = UNBOUNDED;
+         }
+         const BoundType status = this->variable_status[variable_index];
+         if (status == BOUNDED_LOWER || status == BOUNDED_BOTH_SIDES) {
+            this->lower_bounded_variables.emplace_back(variable_index);
+            if (status == BOUNDED_LOWER) {
+               this->single_lower_bounded_variables.emplace_back(variable_index);
+            }
+         }
+         if (status == BOUNDED_UPPER || status == BOUNDED_BOTH_SIDES) {
+            this->upper_bounded_variables.emplace_back(variable_index);
+            if (status == BOUNDED_UPPER) {
+               this->single_upper_bounded_variables.emplace_back(variable_index);
+            }
+         }
+      }
+   }
+} // namespace
+
+#endif // UNO_BOUNDTIGHTENEDMODEL_H
@@ -0,0 +1,328 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_FIXEDVARIABLEELIMINATEDMODEL_H
+#define UNO_FIXEDVARIABLEELIMINATEDMODEL_H
+
+#include "Model.hpp"
+#include "linear_algebra/RectangularMatrix.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/Iterate.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   // presolve stage: eliminate the fixed variables (lower bound == upper bound) and substitute
+   // their values into the functions. The solver sees a reduced model whose vectors, Jacobian and
+   // KKT systems shrink accordingly; postprocess_solution reinflates the solution to the original
+   // dimension. The constraint indexing is unchanged
+   class FixedVariableEliminatedModel: public Model {
+   public:
+      explicit FixedVariableEliminatedModel(std::unique_ptr<Model> original_model);
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
+      void evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const override;
+      void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+      void evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+            std::vector<double>& constraints) const override;
+      [[nodiscard]] bool try_evaluate_objective(const Vector<double>& x, double& objective_value) const override {
+         return this->model->try_evaluate_objective(this->expand(x), objective_value);
+      }
+      [[nodiscard]] bool try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override {
+         return this->model->try_evaluate_constraints(this->expand(x), constraints);
+      }
+      [[nodiscard]] bool try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+            std::vector<double>& constraints) const override {
+         return this->model->try_evaluate_objective_and_constraints(this->expand(x), objective_value, constraints);
+      }
+      [[nodiscard]] std::vector<std::pair<size_t, double>> get_constraint_cost_profile() const override {
+         return this->model->get_constraint_cost_profile();
+      }
+      void evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const override;
+      void evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            SymmetricMatrix<SparseIndex, double>& hessian) const override;
+
+      [[nodiscard]] bool has_hessian_operator() const override { return this->model->has_hessian_operator(); }
+      void compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            const Vector<double>& vector, Vector<double>& result) const override;
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override {
+         return this->model->variable_lower_bound(this->original_of_reduced[variable_index]);
+      }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override {
+         return this->model->variable_upper_bound(this->original_of_reduced[variable_index]);
+      }
+      [[nodiscard]] BoundType get_variable_bound_type(size_t variable_index) const override {
+         return this->model->get_variable_bound_type(this->original_of_reduced[variable_index]);
+      }
+      [[nodiscard]] const Collection<size_t>& get_lower_bounded_variables() const override { return this->lower_bounded_variables_collection; }
+      [[nodiscard]] const Collection<size_t>& get_upper_bounded_variables() const override { return this->upper_bounded_variables_collection; }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->model->get_slacks(); }
+      [[nodiscard]] const Collection<size_t>& get_single_lower_bounded_variables() const override {
+         return this->single_lower_bounded_variables_collection;
+      }
+      [[nodiscard]] const Collection<size_t>& get_single_upper_bounded_variables() const override {
+         return this->single_upper_bounded_variables_collection;
+      }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override {
+         return this->model->constraint_lower_bound(constraint_index);
+      }
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override {
+         return this->model->constraint_upper_bound(constraint_index);
+      }
+      [[nodiscard]] FunctionType get_constraint_type(size_t constraint_index) const override {
+         return this->model->get_constraint_type(constraint_index);
+      }
+      [[nodiscard]] BoundType get_constraint_bound_type(size_t constraint_index) const override {
+         return this->model->get_constraint_bound_type(constraint_index);
+      }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->model->get_equality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->model->get_inequality_constraints(); }
+      [[nodiscard]] const std::vector<size_t>& get_linear_constraints() const override { return this->model->get_linear_constraints(); }
+
+      void initial_primal_point(Vector<double>& x) const override;
+      void initial_dual_point(Vector<double>& multipliers) const override { this->model->initial_dual_point(multipliers); }
+      void postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const override;
+
+      // the point expansion goes through a shared buffer
+      [[nodiscard]] bool supports_concurrent_evaluations() const override { return false; }
+
+      // upper bounds: the actual numbers of nonzeros depend on the patterns, only known at evaluation
+      [[nodiscard]] size_t number_objective_gradient_nonzeros() const override { return this->model->number_objective_gradient_nonzeros(); }
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model->number_jacobian_nonzeros(); }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model->number_hessian_nonzeros(); }
+
+      // number of fixed variables of a model (0 means that the elimination is a no-op)
+      [[nodiscard]] static size_t count_fixed_variables(const Model& model);
+      // compress an iterate expressed in the original space into the reduced space
+      void compress_initial_iterate(Iterate& initial_iterate) const;
+
+   protected:
+      const std::unique_ptr<Model> model;
+      // index maps between the original and the reduced spaces (SIZE_MAX: eliminated variable)
+      std::vector<size_t> original_of_reduced{};
+      std::vector<size_t> reduced_of_original{};
+
+      // lists of reduced variable indices + corresponding collection objects
+      std::vector<size_t> lower_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> lower_bounded_variables_collection;
+      std::vector<size_t> upper_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> upper_bounded_variables_collection;
+      std::vector<size_t> single_lower_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> single_lower_bounded_variables_collection;
+      std::vector<size_t> single_upper_bounded_variables{};
+      CollectionAdapter<std::vector<size_t>&> single_upper_bounded_variables_collection;
+
+      // staging buffers: the full-space point (the fixed entries are set once in the constructor)
+      // and the full-space derivatives, compressed into the reduced space after each evaluation
+      mutable Vector<double> full_point;
+      mutable SparseVector<double> full_gradient;
+      mutable RectangularMatrix<double> full_jacobian;
+      mutable SymmetricMatrix<SparseIndex, double> full_hessian;
+
+      [[nodiscard]] const Vector<double>& expand(const Vector<double>& x) const;
+      void compress_gradient(const SparseVector<double>& full_gradient, SparseVector<double>& gradient) const;
+   };
+
+   inline FixedVariableEliminatedModel::FixedVariableEliminatedModel(std::unique_ptr<Model> original_model):
+         Model(original_model->name + "_fixedeliminated",
+               original_model->number_variables - FixedVariableEliminatedModel::count_fixed_variables(*original_model),
+               original_model->number_constraints, original_model->objective_sign),
+         // transfer ownership of the pointer
+         model(std::move(original_model)),
+         reduced_of_original(this->model->number_variables),
+         lower_bounded_variables_collection(this->lower_bounded_variables),
+         upper_bounded_variables_collection(this->upper_bounded_variables),
+         single_lower_bounded_variables_collection(this->single_lower_bounded_variables),
+         single_upper_bounded_variables_collection(this->single_upper_bounded_variables),
+         full_point(this->model->number_variables),
+         full_gradient(this->model->number_variables),
+         full_jacobian(this->model->number_constraints, this->model->number_variables),
+         full_hessian(this->model->number_variables, this->model->number_hessian_nonzeros(), false, "COO") {
+      // index maps; the fixed entries of the full-space point are set once and for all
+      this->original_of_reduced.reserve(this->number_variables);
+      for (size_t original_index: Range(this->model->number_variables)) {
+         if (this->model->get_variable_bound_type(original_index) == EQUAL_BOUNDS) {
+            this->reduced_of_original[original_index] = SIZE_MAX;
+            this->full_point[original_index] = this->model->variable_lower_bound(original_index);
+         }
+         else {
+            this->reduced_of_original[original_index] = this->original_of_reduced.size();
+            this->original_of_reduced.emplace_back(original_index);
+         }
+      }
+      DEBUG << "Fixed-variable presolve: " << (this->model->number_variables - this->number_variables) << " variables eliminated\n";
+
+      // index lists of the bounded variables, in reduced indexing
+      for (size_t variable_index: Range(this->number_variables)) {
+         const BoundType status = this->get_variable_bound_type(variable_index);
+         if (status == BOUNDED_LOWER || status == BOUNDED_BOTH_SIDES) {
+            this->lower_bounded_variables.emplace_back(variable_index);
+            if (status == BOUNDED_LOWER) {
+               this->single_lower_bounded_variables.emplace_back(variable_index);
+            }
+         }
+         if (status == BOUNDED_UPPER || status == BOUNDED_BOTH_SIDES) {
+            this->upper_bounded_variables.emplace_back(variable_index);
+            if (status == BOUNDED_UPPER) {
+               this->single_upper_bounded_variables.emplace_back(variable_index);
+            }
+         }
+      }
+   }
+
+   inline size_t FixedVariableEliminatedModel::count_fixed_variables(const Model& model) {
+      size_t number_fixed_variables = 0;
+      for (size_t variable_index: Range(model.number_variables)) {
+         if (model.get_variable_bound_type(variable_index) == EQUAL_BOUNDS) {
+            number_fixed_variables++;
+         }
+      }
+      return number_fixed_variables;
+   }
+
+   // scatter the reduced point into the full-space buffer (the fixed entries are already set)
+   inline const Vector<double>& FixedVariableEliminatedModel::expand(const Vector<double>& x) const {
+      for (size_t variable_index: Range(this->number_variables)) {
+         this->full_point[this->original_of_reduced[variable_index]] = x[variable_index];
+      }
+      return this->full_point;
+   }
+
+   // keep the entries of the free variables, reindexed into the reduced space
+   inline void FixedVariableEliminatedModel::compress_gradient(const SparseVector<double>& full_gradient, SparseVector<double>& gradient) const {
+      gradient.clear();
+      for (const auto [original_index, derivative]: full_gradient) {
+         const size_t reduced_index = this->reduced_of_original[original_index];
+         if (reduced_index != SIZE_MAX) {
+            gradient.insert(reduced_index, derivative);
+         }
+      }
+   }
+
+   inline double FixedVariableEliminatedModel::evaluate_objective(const Vector<double>& x) const {
+      return this->model->evaluate_objective(this->expand(x));
+   }
+
+   inline void FixedVariableEliminatedModel::evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const {
+      this->model->evaluate_objective_gradient(this->expand(x), this->full_gradient);
+      this->compress_gradient(this->full_gradient, gradient);
+   }
+
+   inline void FixedVariableEliminatedModel::evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      this->model->evaluate_constraints(this->expand(x), constraints);
+   }
+
+   inline void FixedVariableEliminatedModel::evaluate_constraints_subset(const Vector<double>& x,
+         const std::vector<size_t>& constraint_indices, std::vector<double>& constraints) const {
+      this->model->evaluate_constraints_subset(this->expand(x), constraint_indices, constraints);
+   }
+
+   inline void FixedVariableEliminatedModel::evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index,
+         SparseVector<double>& gradient) const {
+      this->model->evaluate_constraint_gradient(this->expand(x), constraint_index, this->full_gradient);
+      this->compress_gradient(this->full_gradient, gradient);
+   }
+
+   inline void FixedVariableEliminatedModel::evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const {
+      this->model->evaluate_constraint_jacobian(this->expand(x), this->full_jacobian);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         this->compress_gradient(this->full_jacobian[constraint_index], constraint_jacobian[constraint_index]);
+      }
+   }
+
+   inline void FixedVariableEliminatedModel::compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier,
+         const Vector<double>& multipliers, const Vector<double>& vector, Vector<double>& result) const {
+      // scatter the reduced vector into the original space, with zeros at the fixed variables (a
+      // direction never moves them), compute the product there and gather the free components.
+      // Local vectors: the shared full_point buffer is already taken by expand(x)
+      Vector<double> full_vector(this->model->number_variables, 0.);
+      for (size_t variable_index: Range(this->number_variables)) {
+         full_vector[this->original_of_reduced[variable_index]] = vector[variable_index];
+      }
+      Vector<double> full_result(this->model->number_variables);
+      this->model->compute_hessian_vector_product(this->expand(x), objective_multiplier, multipliers, full_vector, full_result);
+      for (size_t variable_index: Range(this->number_variables)) {
+         result[variable_index] = full_result[this->original_of_reduced[variable_index]];
+      }
+   }
+
+   inline void FixedVariableEliminatedModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier,
+         const Vector<double>& multipliers, SymmetricMatrix<SparseIndex, double>& hessian) const {
+      this->model->evaluate_lagrangian_hessian(this->expand(x), objective_multiplier, multipliers, this->full_hessian);
+      // copy the entries of the free variables, reindexed and grouped by increasing (reduced) column:
+      // the original evaluation proceeds column by column, so the iteration order is already grouped
+      hessian.reset();
+      size_t current_column = 0;
+      for (const auto [original_row, original_column, element]: this->full_hessian) {
+         const size_t reduced_row = this->reduced_of_original[original_row];
+         const size_t reduced_column = this->reduced_of_original[original_column];
+         if (reduced_row == SIZE_MAX || reduced_column == SIZE_MAX) {
+            continue;
+         }
+         while (current_column < reduced_column) {
+            hessian.finalize_column(current_column);
+            current_column++;
+         }
+         hessian.insert(element, reduced_row, reduced_column);
+      }
+      while (current_column < this->number_variables) {
+         hessian.finalize_column(current_column);
+         current_column++;
+      }
+   }
+
+   inline void FixedVariableEliminatedModel::initial_primal_point(Vector<double>& x) const {
+      // evaluate the original initial point into the full-space buffer, then keep the free entries
+      // (restoring the fixed entries of the buffer afterwards)
+      this->model->initial_primal_point(this->full_point);
+      for (size_t variable_index: Range(this->number_variables)) {
+         x[variable_index] = this->full_point[this->original_of_reduced[variable_index]];
+      }
+      for (size_t original_index: Range(this->model->number_variables)) {
+         if (this->reduced_of_original[original_index] == SIZE_MAX) {
+            this->full_point[original_index] = this->model->variable_lower_bound(original_index);
+         }
+      }
+   }
+
+   inline void FixedVariableEliminatedModel::compress_initial_iterate(Iterate& initial_iterate) const {
+      // gather the free entries to the front (reduced_index <= original_index: forward order is safe)
+      for (size_t variable_index: Range(this->number_variables)) {
+         const size_t original_index = this->original_of_reduced[variable_index];
+         initial_iterate.primals[variable_index] = initial_iterate.primals[original_index];
+         initial_iterate.multipliers.lower_bounds[variable_index] = initial_iterate.multipliers.lower_bounds[original_index];
+         initial_iterate.multipliers.upper_bounds[variable_index] = initial_iterate.multipliers.upper_bounds[original_index];
+      }
+      initial_iterate.set_number_variables(this->number_variables);
+   }
+
+   inline void FixedVariableEliminatedModel::postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const {
+      // reinflate the solution to the original space (original_index >= reduced_index: backward
+      // order is safe). The eliminated variables take their fixed value and zero bound multipliers
+      iterate.set_number_variables(this->model->number_variables);
+      size_t original_index = this->model->number_variables;
+      while (0 < original_index) {
+         original_index--;
+         const size_t reduced_index = this->reduced_of_original[original_index];
+         if (reduced_index == SIZE_MAX) {
+            iterate.primals[original_index] = this->model->variable_lower_bound(original_index);
+            iterate.multipliers.lower_bounds[original_index] = 0.;
+            iterate.multipliers.upper_bounds[original_index] = 0.;
+         }
+         else {
+            iterate.primals[original_index] = iterate.primals[reduced_index];
+            iterate.multipliers.lower_bounds[original_index] = iterate.multipliers.lower_bounds[reduced_index];
+            iterate.multipliers.upper_bounds[original_index] = iterate.multipliers.upper_bounds[reduced_index];
+         }
+      }
+      this->model->postprocess_solution(iterate, termination_status);
+   }
+} // namespace
+
+#endif // UNO_FIXEDVARIABLEELIMINATEDMODEL_H
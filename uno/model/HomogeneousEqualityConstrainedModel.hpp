@@ -4,6 +4,7 @@
 #ifndef UNO_HOMOGENEOUSEQUALITYCONSTRAINEDMODEL_H
 #define UNO_HOMOGENEOUSEQUALITYCONSTRAINEDMODEL_H
 
+#include <algorithm>
 #include "Model.hpp"
 #include "linear_algebra/SymmetricMatrix.hpp"
 #include "optimization/Iterate.hpp"
@@ -24,10 +25,25 @@ namespace uno {
       [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override { return this->model->evaluate_objective(x); }
       void evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const override { this->model->evaluate_objective_gradient(x, gradient); }
       void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+      void evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+            std::vector<double>& constraints) const override;
+      [[nodiscard]] bool try_evaluate_objective(const Vector<double>& x, double& objective_value) const override {
+         return this->model->try_evaluate_objective(x, objective_value);
+      }
+      [[nodiscard]] bool try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+      [[nodiscard]] bool try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+            std::vector<double>& constraints) const override;
+      [[nodiscard]] std::vector<std::pair<size_t, double>> get_constraint_cost_profile() const override {
+         return this->model->get_constraint_cost_profile();
+      }
       void evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const override;
       void evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const override;
       void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
-            SymmetricMatrix<size_t, double>& hessian) const override;
+            SymmetricMatrix<SparseIndex, double>& hessian) const override;
+
+      [[nodiscard]] bool has_hessian_operator() const override { return this->model->has_hessian_operator(); }
+      void compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            const Vector<double>& vector, Vector<double>& result) const override;
 
       [[nodiscard]] double variable_lower_bound(size_t variable_index) const override;
       [[nodiscard]] double variable_upper_bound(size_t variable_index) const override;
@@ -46,6 +62,8 @@ namespace uno {
       [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->inequality_constraints; }
       [[nodiscard]] const std::vector<size_t>& get_linear_constraints() const override { return this->model->get_linear_constraints(); }
 
+      [[nodiscard]] bool supports_concurrent_evaluations() const override { return this->model->supports_concurrent_evaluations(); }
+
       void initial_primal_point(Vector<double>& x) const override;
       void initial_dual_point(Vector<double>& multipliers) const override { this->model->initial_dual_point(multipliers); }
       void postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const override;
@@ -62,6 +80,10 @@ namespace uno {
       ForwardRange equality_constraints;
       ForwardRange inequality_constraints;
       SparseVector<size_t> slacks;
+      // nonzero right-hand sides of the original equality constraints, cached at construction: the
+      // homogenization pass only touches these entries. Equality constraints that are already
+      // homogeneous (and models made only of them) pass through with no per-evaluation arithmetic
+      SparseVector<double> nonzero_equality_shifts;
       std::vector<size_t> lower_bounded_slacks;
       std::vector<size_t> upper_bounded_slacks;
       std::vector<size_t> single_lower_bounded_slacks;
@@ -86,12 +108,26 @@ namespace uno {
          equality_constraints(Range(this->number_constraints)),
          inequality_constraints(Range(0)),
          slacks(this->model->get_inequality_constraints().size()),
-         lower_bounded_slacks(this->slacks.size()),
-         upper_bounded_slacks(this->slacks.size()),
          lower_bounded_variables(concatenate(this->model->get_lower_bounded_variables(), adapt(this->lower_bounded_slacks))),
          upper_bounded_variables(concatenate(this->model->get_upper_bounded_variables(), adapt(this->upper_bounded_slacks))),
          single_lower_bounded_variables(concatenate(this->model->get_single_lower_bounded_variables(), adapt(this->single_lower_bounded_slacks))),
          single_upper_bounded_variables(concatenate(this->model->get_single_upper_bounded_variables(), adapt(this->single_upper_bounded_slacks))){
+      // reserve the slack lists upfront: the construction does a single pass over the inequality
+      // constraints, without reallocation. Note that the bounds themselves are never materialized:
+      // they are queried on the fly from the wrapped model (see variable_lower_bound)
+      const size_t number_inequality_constraints = this->model->get_inequality_constraints().size();
+      this->lower_bounded_slacks.reserve(number_inequality_constraints);
+      this->upper_bounded_slacks.reserve(number_inequality_constraints);
+      this->single_lower_bounded_slacks.reserve(number_inequality_constraints);
+      this->single_upper_bounded_slacks.reserve(number_inequality_constraints);
+      // cache the nonzero right-hand sides of the equality constraints (constant bounds): the
+      // per-evaluation homogenization then skips the zero ones and the virtual bound queries
+      for (const size_t constraint_index: this->model->get_equality_constraints()) {
+         const double right_hand_side = this->model->constraint_lower_bound(constraint_index);
+         if (right_hand_side != 0.) {
+            this->nonzero_equality_shifts.insert(constraint_index, right_hand_side);
+         }
+      }
       // register the inequality constraint of each slack
       size_t inequality_index = 0;
       for (const size_t constraint_index: this->model->get_inequality_constraints()) {
@@ -117,14 +153,64 @@ namespace uno {
 
    inline void HomogeneousEqualityConstrainedModel::evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
       this->model->evaluate_constraints(x, constraints);
-      // inequality constraints: add the slacks
+      // inequality constraints: add the slacks (only the genuine inequalities pay this pass)
       for (const auto [constraint_index, slack_index]: this->get_slacks()) {
          constraints[constraint_index] -= x[slack_index];
       }
 
-      // equality constraints: make sure they are homogeneous (c(x) = 0)
-      for (const size_t constraint_index: this->model->get_equality_constraints()) {
-         constraints[constraint_index] -= this->model->constraint_lower_bound(constraint_index);
+      // equality constraints: make sure they are homogeneous (c(x) = 0). Only the cached nonzero
+      // right-hand sides are subtracted; already-homogeneous equalities pass through untouched
+      for (const auto [constraint_index, right_hand_side]: this->nonzero_equality_shifts) {
+         constraints[constraint_index] -= right_hand_side;
+      }
+   }
+
+   inline bool HomogeneousEqualityConstrainedModel::try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      if (not this->model->try_evaluate_constraints(x, constraints)) {
+         return false;
+      }
+      // same slack and right-hand-side corrections as evaluate_constraints
+      for (const auto [constraint_index, slack_index]: this->get_slacks()) {
+         constraints[constraint_index] -= x[slack_index];
+      }
+      for (const auto [constraint_index, right_hand_side]: this->nonzero_equality_shifts) {
+         constraints[constraint_index] -= right_hand_side;
+      }
+      return true;
+   }
+
+   inline bool HomogeneousEqualityConstrainedModel::try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+         std::vector<double>& constraints) const {
+      if (not this->model->try_evaluate_objective_and_constraints(x, objective_value, constraints)) {
+         return false;
+      }
+      // same slack and right-hand-side corrections as evaluate_constraints
+      for (const auto [constraint_index, slack_index]: this->get_slacks()) {
+         constraints[constraint_index] -= x[slack_index];
+      }
+      for (const auto [constraint_index, right_hand_side]: this->nonzero_equality_shifts) {
+         constraints[constraint_index] -= right_hand_side;
+      }
+      return true;
+   }
+
+   inline void HomogeneousEqualityConstrainedModel::evaluate_constraints_subset(const Vector<double>& x,
+         const std::vector<size_t>& constraint_indices, std::vector<double>& constraints) const {
+      this->model->evaluate_constraints_subset(x, constraint_indices, constraints);
+      // apply the slack and right-hand-side corrections to the requested constraints only (the
+      // subsets are typically small, so the membership tests are cheap)
+      const auto in_subset = [&constraint_indices](size_t constraint_index) {
+         return std::find(constraint_indices.cbegin(), constraint_indices.cend(), constraint_index) != constraint_indices.cend();
+      };
+      for (const auto [constraint_index, slack_index]: this->get_slacks()) {
+         if (in_subset(constraint_index)) {
+            constraints[constraint_index] -= x[slack_index];
+         }
+      }
+      for (const auto [constraint_index, right_hand_side]: this->nonzero_equality_shifts) {
+         if (in_subset(constraint_index)) {
+            constraints[constraint_index] -= right_hand_side;
+         }
       }
    }
 
@@ -147,7 +233,7 @@ namespace uno {
    }
 
    inline void HomogeneousEqualityConstrainedModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier,
-         const Vector<double>& multipliers, SymmetricMatrix<size_t, double>& hessian) const {
+         const Vector<double>& multipliers, SymmetricMatrix<SparseIndex, double>& hessian) const {
       this->model->evaluate_lagrangian_hessian(x, objective_multiplier, multipliers, hessian);
       // extend the dimension of the Hessian by finalizing the remaining columns (note: the slacks do not enter the Hessian)
       for (size_t constraint_index: Range(this->model->number_variables, this->number_variables)) {
@@ -155,6 +241,15 @@ namespace uno {
       }
    }
 
+   inline void HomogeneousEqualityConstrainedModel::compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier,
+         const Vector<double>& multipliers, const Vector<double>& vector, Vector<double>& result) const {
+      this->model->compute_hessian_vector_product(x, objective_multiplier, multipliers, vector, result);
+      // the slacks do not enter the Hessian: their components of the product are zero
+      for (size_t variable_index: Range(this->model->number_variables, this->number_variables)) {
+         result[variable_index] = 0.;
+      }
+   }
+
    inline double HomogeneousEqualityConstrainedModel::variable_lower_bound(size_t variable_index) const {
       if (variable_index < this->model->number_variables) { // original variable
          return this->model->variable_lower_bound(variable_index);
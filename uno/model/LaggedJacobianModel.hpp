@@ -0,0 +1,166 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_LAGGEDJACOBIANMODEL_H
+#define UNO_LAGGEDJACOBIANMODEL_H
+
+#include "Model.hpp"
+#include "optimization/Iterate.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+
+namespace uno {
+   // lagged-derivative mode for models whose constraint Jacobian dominates the evaluation cost:
+   // the Jacobian is evaluated once and handed out unchanged for up to lagged_jacobian_max_age
+   // requests, or until the point drifts away from the evaluation point by more than
+   // lagged_jacobian_step_threshold (relative to the magnitude of the evaluation point).
+   // The constraint and objective values are always evaluated fresh, so the value-based acceptance
+   // tests of the globalization strategies are unaffected: the lag only degrades the quality of the
+   // subproblem directions, which the globalization absorbs like any other inexactness. The drift
+   // trigger bounds the staleness of the dual residuals at termination: near convergence, the
+   // iterates barely move and the cached Jacobian is accurate
+   class LaggedJacobianModel: public Model {
+   public:
+      LaggedJacobianModel(std::unique_ptr<Model> original_model, const Options& options);
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override { return this->model->evaluate_objective(x); }
+      void evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const override {
+         this->model->evaluate_objective_gradient(x, gradient);
+      }
+      void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override {
+         this->model->evaluate_constraints(x, constraints);
+      }
+      void evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+            std::vector<double>& constraints) const override {
+         this->model->evaluate_constraints_subset(x, constraint_indices, constraints);
+      }
+      [[nodiscard]] bool try_evaluate_objective(const Vector<double>& x, double& objective_value) const override {
+         return this->model->try_evaluate_objective(x, objective_value);
+      }
+      [[nodiscard]] bool try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override {
+         return this->model->try_evaluate_constraints(x, constraints);
+      }
+      [[nodiscard]] bool try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+            std::vector<double>& constraints) const override {
+         return this->model->try_evaluate_objective_and_constraints(x, objective_value, constraints);
+      }
+      [[nodiscard]] std::vector<std::pair<size_t, double>> get_constraint_cost_profile() const override {
+         return this->model->get_constraint_cost_profile();
+      }
+      void evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const override {
+         this->model->evaluate_constraint_gradient(x, constraint_index, gradient);
+      }
+      // only this function is redefined
+      void evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            SymmetricMatrix<SparseIndex, double>& hessian) const override {
+         this->model->evaluate_lagrangian_hessian(x, objective_multiplier, multipliers, hessian);
+      }
+
+      [[nodiscard]] bool has_hessian_operator() const override { return this->model->has_hessian_operator(); }
+      void compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            const Vector<double>& vector, Vector<double>& result) const override {
+         this->model->compute_hessian_vector_product(x, objective_multiplier, multipliers, vector, result);
+      }
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->model->variable_lower_bound(variable_index); }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->model->variable_upper_bound(variable_index); }
+      [[nodiscard]] BoundType get_variable_bound_type(size_t variable_index) const override { return this->model->get_variable_bound_type(variable_index); }
+      [[nodiscard]] const Collection<size_t>& get_lower_bounded_variables() const override { return this->model->get_lower_bounded_variables(); }
+      [[nodiscard]] const Collection<size_t>& get_upper_bounded_variables() const override { return this->model->get_upper_bounded_variables(); }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->model->get_slacks(); }
+      [[nodiscard]] const Collection<size_t>& get_single_lower_bounded_variables() const override { return this->model->get_single_lower_bounded_variables(); }
+      [[nodiscard]] const Collection<size_t>& get_single_upper_bounded_variables() const override { return this->model->get_single_upper_bounded_variables(); }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override { return this->model->constraint_lower_bound(constraint_index); }
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override { return this->model->constraint_upper_bound(constraint_index); }
+      [[nodiscard]] FunctionType get_constraint_type(size_t constraint_index) const override { return this->model->get_constraint_type(constraint_index); }
+      [[nodiscard]] BoundType get_constraint_bound_type(size_t constraint_index) const override { return this->model->get_constraint_bound_type(constraint_index); }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->model->get_equality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->model->get_inequality_constraints(); }
+      [[nodiscard]] const std::vector<size_t>& get_linear_constraints() const override { return this->model->get_linear_constraints(); }
+
+      void initial_primal_point(Vector<double>& x) const override { this->model->initial_primal_point(x); }
+      void initial_dual_point(Vector<double>& multipliers) const override { this->model->initial_dual_point(multipliers); }
+      void postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const override;
+
+      [[nodiscard]] bool supports_concurrent_evaluations() const override { return this->model->supports_concurrent_evaluations(); }
+
+      [[nodiscard]] size_t number_objective_gradient_nonzeros() const override { return this->model->number_objective_gradient_nonzeros(); }
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model->number_jacobian_nonzeros(); }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model->number_hessian_nonzeros(); }
+
+   private:
+      const std::unique_ptr<Model> model;
+      const size_t max_age; /*!< Maximum number of reuses of a cached Jacobian */
+      const double step_threshold; /*!< Relative drift from the evaluation point that forces a refresh */
+      // lazy cache of the last fresh Jacobian and the point at which it was evaluated
+      mutable RectangularMatrix<double> cached_jacobian;
+      mutable Vector<double> reference_point;
+      mutable size_t age{0};
+      mutable bool jacobian_cached{false};
+      // instrumentation, reported in postprocess_solution
+      mutable size_t number_fresh_evaluations{0};
+      mutable size_t number_reuses{0};
+
+      [[nodiscard]] bool refresh_needed(const Vector<double>& x) const;
+      void copy_jacobian(const RectangularMatrix<double>& source, RectangularMatrix<double>& destination) const;
+   };
+
+   inline LaggedJacobianModel::LaggedJacobianModel(std::unique_ptr<Model> original_model, const Options& options):
+         Model(original_model->name + "_lagged", original_model->number_variables, original_model->number_constraints, original_model->objective_sign),
+         model(std::move(original_model)),
+         max_age(options.get_unsigned_int("lagged_jacobian_max_age")),
+         step_threshold(options.get_double("lagged_jacobian_step_threshold")),
+         cached_jacobian(this->number_constraints, this->number_variables),
+         reference_point(this->number_variables) {
+   }
+
+   inline bool LaggedJacobianModel::refresh_needed(const Vector<double>& x) const {
+      if (not this->jacobian_cached || this->max_age <= this->age) {
+         return true;
+      }
+      // relative drift of the point from the evaluation point of the cached Jacobian
+      double drift = 0.;
+      double scale = 1.;
+      for (size_t variable_index: Range(this->number_variables)) {
+         drift = std::max(drift, std::abs(x[variable_index] - this->reference_point[variable_index]));
+         scale = std::max(scale, std::abs(this->reference_point[variable_index]));
+      }
+      return this->step_threshold * scale < drift;
+   }
+
+   // copy row by row into the existing storage of the destination, so that the reuses do not allocate
+   inline void LaggedJacobianModel::copy_jacobian(const RectangularMatrix<double>& source, RectangularMatrix<double>& destination) const {
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         destination[constraint_index].clear();
+         for (const auto [variable_index, derivative]: source[constraint_index]) {
+            destination[constraint_index].insert(variable_index, derivative);
+         }
+      }
+   }
+
+   inline void LaggedJacobianModel::evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const {
+      if (this->refresh_needed(x)) {
+         this->model->evaluate_constraint_jacobian(x, constraint_jacobian);
+         this->copy_jacobian(constraint_jacobian, this->cached_jacobian);
+         this->reference_point = x;
+         this->age = 0;
+         this->jacobian_cached = true;
+         this->number_fresh_evaluations++;
+      }
+      else {
+         DEBUG << "Lagged Jacobian: reusing the Jacobian of age " << (this->age + 1) << '\n';
+         this->copy_jacobian(this->cached_jacobian, constraint_jacobian);
+         this->age++;
+         this->number_reuses++;
+      }
+   }
+
+   inline void LaggedJacobianModel::postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const {
+      this->model->postprocess_solution(iterate, termination_status);
+      INFO << "Lagged Jacobian: " << this->number_fresh_evaluations << " fresh evaluations, " << this->number_reuses << " reuses\n";
+   }
+} // namespace
+
+#endif // UNO_LAGGEDJACOBIANMODEL_H
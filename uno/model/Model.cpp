@@ -3,9 +3,11 @@
 
 #include <cmath>
 #include <iostream>
+#include <stdexcept>
 #include <utility>
 #include "Model.hpp"
 #include "linear_algebra/Vector.hpp"
+#include "symbolic/Collection.hpp"
 
 namespace uno {
    // abstract Problem class
@@ -13,6 +15,113 @@ namespace uno {
          name(std::move(name)), number_variables(number_variables), number_constraints(number_constraints), objective_sign(objective_sign) {
    }
 
+   void Model::evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& /*constraint_indices*/,
+         std::vector<double>& constraints) const {
+      // fallback: evaluate everything
+      this->evaluate_constraints(x, constraints);
+   }
+
+   bool Model::try_evaluate_objective(const Vector<double>& x, double& objective_value) const {
+      try {
+         objective_value = this->evaluate_objective(x);
+         return true;
+      }
+      catch (const std::exception&) {
+         return false;
+      }
+   }
+
+   bool Model::try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      try {
+         this->evaluate_constraints(x, constraints);
+         return true;
+      }
+      catch (const std::exception&) {
+         return false;
+      }
+   }
+
+   bool Model::try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+         std::vector<double>& constraints) const {
+      // fallback: two separate evaluations
+      return this->try_evaluate_objective(x, objective_value) && this->try_evaluate_constraints(x, constraints);
+   }
+
+   std::vector<std::pair<size_t, double>> Model::get_constraint_cost_profile() const {
+      // fallback: no instrumentation
+      return {};
+   }
+
+   void Model::compute_hessian_vector_product(const Vector<double>& /*x*/, double /*objective_multiplier*/, const Vector<double>& /*multipliers*/,
+         const Vector<double>& /*vector*/, Vector<double>& /*result*/) const {
+      throw std::runtime_error("The model does not provide a Hessian operator. Check has_hessian_operator() before calling.");
+   }
+
+   void Model::set_variable_bounds(size_t /*variable_index*/, double /*lower_bound*/, double /*upper_bound*/) {
+      throw std::runtime_error("The model does not support bound perturbations.");
+   }
+
+   void Model::set_constraint_bounds(size_t /*constraint_index*/, double /*lower_bound*/, double /*upper_bound*/) {
+      throw std::runtime_error("The model does not support bound perturbations.");
+   }
+
+   const Bitmask& Model::get_lower_bounded_variables_mask() const {
+      std::call_once(this->membership_masks_flag, &Model::build_membership_masks, this);
+      return this->lower_bounded_variables_mask;
+   }
+
+   const Bitmask& Model::get_upper_bounded_variables_mask() const {
+      std::call_once(this->membership_masks_flag, &Model::build_membership_masks, this);
+      return this->upper_bounded_variables_mask;
+   }
+
+   const Bitmask& Model::get_single_lower_bounded_variables_mask() const {
+      std::call_once(this->membership_masks_flag, &Model::build_membership_masks, this);
+      return this->single_lower_bounded_variables_mask;
+   }
+
+   const Bitmask& Model::get_single_upper_bounded_variables_mask() const {
+      std::call_once(this->membership_masks_flag, &Model::build_membership_masks, this);
+      return this->single_upper_bounded_variables_mask;
+   }
+
+   const Bitmask& Model::get_equality_constraints_mask() const {
+      std::call_once(this->membership_masks_flag, &Model::build_membership_masks, this);
+      return this->equality_constraints_mask;
+   }
+
+   const Bitmask& Model::get_inequality_constraints_mask() const {
+      std::call_once(this->membership_masks_flag, &Model::build_membership_masks, this);
+      return this->inequality_constraints_mask;
+   }
+
+   void Model::build_membership_masks() const {
+      this->lower_bounded_variables_mask.resize(this->number_variables);
+      for (const size_t variable_index: this->get_lower_bounded_variables()) {
+         this->lower_bounded_variables_mask.insert(variable_index);
+      }
+      this->upper_bounded_variables_mask.resize(this->number_variables);
+      for (const size_t variable_index: this->get_upper_bounded_variables()) {
+         this->upper_bounded_variables_mask.insert(variable_index);
+      }
+      this->single_lower_bounded_variables_mask.resize(this->number_variables);
+      for (const size_t variable_index: this->get_single_lower_bounded_variables()) {
+         this->single_lower_bounded_variables_mask.insert(variable_index);
+      }
+      this->single_upper_bounded_variables_mask.resize(this->number_variables);
+      for (const size_t variable_index: this->get_single_upper_bounded_variables()) {
+         this->single_upper_bounded_variables_mask.insert(variable_index);
+      }
+      this->equality_constraints_mask.resize(this->number_constraints);
+      for (const size_t constraint_index: this->get_equality_constraints()) {
+         this->equality_constraints_mask.insert(constraint_index);
+      }
+      this->inequality_constraints_mask.resize(this->number_constraints);
+      for (const size_t constraint_index: this->get_inequality_constraints()) {
+         this->inequality_constraints_mask.insert(constraint_index);
+      }
+   }
+
    void Model::project_onto_variable_bounds(Vector<double>& x) const {
       for (size_t variable_index: Range(this->number_variables)) {
          x[variable_index] = std::max(std::min(x[variable_index], this->variable_upper_bound(variable_index)), this->variable_lower_bound(variable_index));
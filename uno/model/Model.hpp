@@ -4,10 +4,13 @@
 #ifndef UNO_MODEL_H
 #define UNO_MODEL_H
 
+#include <mutex>
 #include <string>
 #include <vector>
 #include "linear_algebra/Norm.hpp"
+#include "linear_algebra/SparseIndex.hpp"
 #include "optimization/TerminationStatus.hpp"
+#include "symbolic/Bitmask.hpp"
 #include "symbolic/VectorExpression.hpp"
 
 namespace uno {
@@ -50,10 +53,43 @@ namespace uno {
       [[nodiscard]] virtual double evaluate_objective(const Vector<double>& x) const = 0;
       virtual void evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const = 0;
       virtual void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const = 0;
+      // evaluate only the given subset of the constraints, writing c_j into constraints[j] for each
+      // j in constraint_indices and leaving the other entries untouched. The default implementation
+      // falls back to a full evaluation; models with per-constraint evaluations override it
+      virtual void evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+            std::vector<double>& constraints) const;
+      // non-throwing variants of the function evaluations: return false on a numerical error instead
+      // of throwing an EvaluationError. The line search tests trial points that frequently lie outside
+      // the functions' domains, so a failed evaluation is a plain branch there. Models whose backend
+      // reports errors through a flag (e.g. AMPLModel) override these; the default implementations
+      // fall back to catching the exceptions of the throwing evaluations
+      [[nodiscard]] virtual bool try_evaluate_objective(const Vector<double>& x, double& objective_value) const;
+      [[nodiscard]] virtual bool try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const;
+      // fused evaluation of the objective and the constraints at the same point (the common case
+      // when testing a trial point). The default implementation performs the two separate
+      // evaluations; models whose backend shares work between the two evaluation trees (e.g. the
+      // common subexpressions of ASL) override it with a single pass
+      [[nodiscard]] virtual bool try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+            std::vector<double>& constraints) const;
+      // per-constraint evaluation cost profile: (constraint index, accumulated seconds) pairs sorted
+      // by decreasing cost, in the index space of the original model. Empty unless the model samples
+      // its constraint evaluations (e.g. AMPLModel); the wrappers forward to the wrapped model
+      [[nodiscard]] virtual std::vector<std::pair<size_t, double>> get_constraint_cost_profile() const;
       virtual void evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const = 0;
       virtual void evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const = 0;
       virtual void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
-            SymmetricMatrix<size_t, double>& hessian) const = 0;
+            SymmetricMatrix<SparseIndex, double>& hessian) const = 0;
+
+      // Hessian operator: result = nabla^2_xx L(x, objective_multiplier, multipliers) * vector,
+      // without materializing the matrix. Models that support it (e.g. via AD Hessian-vector
+      // products) return true from has_hessian_operator; the default implementation throws
+      [[nodiscard]] virtual bool has_hessian_operator() const { return false; }
+      virtual void compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            const Vector<double>& vector, Vector<double>& result) const;
+
+      // whether the evaluation methods may be called concurrently from distinct threads (e.g. by the
+      // multistart runs). Models that evaluate on per-thread contexts return true
+      [[nodiscard]] virtual bool supports_concurrent_evaluations() const { return false; }
 
       // purely virtual functions
       [[nodiscard]] virtual double variable_lower_bound(size_t variable_index) const = 0;
@@ -73,6 +109,24 @@ namespace uno {
       [[nodiscard]] virtual const Collection<size_t>& get_inequality_constraints() const = 0;
       [[nodiscard]] virtual const std::vector<size_t>& get_linear_constraints() const = 0;
 
+      // parametric re-solve support: perturb the bounds of a retained model in place, so that a
+      // sequence of related instances can be solved without reloading anything structural. The
+      // perturbation may not change the bound type (the bounded-variable index lists and their
+      // bitmask companions are frozen). Models that do not implement the setters throw
+      virtual void set_variable_bounds(size_t variable_index, double lower_bound, double upper_bound);
+      virtual void set_constraint_bounds(size_t constraint_index, double lower_bound, double upper_bound);
+
+      // bitmask companions of the index collections above: O(1) membership tests ("is variable i
+      // lower bounded?") and iteration over the members with word-at-a-time skipping of empty
+      // regions. Built lazily (and thread-safely) from the virtual collections, so that every model
+      // and model wrapper gets them without additional overrides
+      [[nodiscard]] const Bitmask& get_lower_bounded_variables_mask() const;
+      [[nodiscard]] const Bitmask& get_upper_bounded_variables_mask() const;
+      [[nodiscard]] const Bitmask& get_single_lower_bounded_variables_mask() const;
+      [[nodiscard]] const Bitmask& get_single_upper_bounded_variables_mask() const;
+      [[nodiscard]] const Bitmask& get_equality_constraints_mask() const;
+      [[nodiscard]] const Bitmask& get_inequality_constraints_mask() const;
+
       virtual void initial_primal_point(Vector<double>& x) const = 0;
       virtual void initial_dual_point(Vector<double>& multipliers) const = 0;
       virtual void postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const = 0;
@@ -89,6 +143,18 @@ namespace uno {
       [[nodiscard]] virtual double constraint_violation(double constraint_value, size_t constraint_index) const;
       template <typename Array>
       double constraint_violation(const Array& constraints, Norm residual_norm) const;
+
+   private:
+      // bitmask companions, built on first use from the virtual collections (mutable: lazily filled
+      // by the const accessors; the once flag makes concurrent first accesses safe)
+      mutable std::once_flag membership_masks_flag{};
+      mutable Bitmask lower_bounded_variables_mask{};
+      mutable Bitmask upper_bounded_variables_mask{};
+      mutable Bitmask single_lower_bounded_variables_mask{};
+      mutable Bitmask single_upper_bounded_variables_mask{};
+      mutable Bitmask equality_constraints_mask{};
+      mutable Bitmask inequality_constraints_mask{};
+      void build_membership_masks() const;
    };
 
    // compute ||c||
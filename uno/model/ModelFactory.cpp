@@ -2,15 +2,69 @@
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
 #include "ModelFactory.hpp"
+#include "BoundTightenedModel.hpp"
+#include "FixedVariableEliminatedModel.hpp"
 #include "HomogeneousEqualityConstrainedModel.hpp"
+#include "LaggedJacobianModel.hpp"
+#include "RedundantConstraintEliminatedModel.hpp"
 #include "ScaledModel.hpp"
 #include "BoundRelaxedModel.hpp"
 #include "optimization/Iterate.hpp"
+#include "preprocessing/BoundTightening.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
 #include "tools/Options.hpp"
 
 namespace uno {
    // note: ownership of the pointer is transferred
    std::unique_ptr<Model> ModelFactory::reformulate(std::unique_ptr<Model> model, Iterate& initial_iterate, const Options& options) {
+      // optional lagged derivatives: wrap the user model (innermost, where the evaluations are
+      // expensive) so that the constraint Jacobian is reused across iterations (see LaggedJacobianModel)
+      if (0 < options.get_unsigned_int("lagged_jacobian_max_age") && model->is_constrained()) {
+         INFO << "Lagged Jacobian mode: reusing the constraint Jacobian for up to "
+              << options.get_unsigned_int("lagged_jacobian_max_age") << " iterations\n";
+         model = std::make_unique<LaggedJacobianModel>(std::move(model), options);
+      }
+
+      // optional presolve: eliminate the fixed variables and substitute their values into the functions
+      if (options.get_bool("presolve_fixed_variables")) {
+         const size_t number_fixed_variables = FixedVariableEliminatedModel::count_fixed_variables(*model);
+         if (0 < number_fixed_variables) {
+            INFO << "Presolve: eliminating " << number_fixed_variables << " fixed variables\n";
+            auto fixed_variable_eliminated_model = std::make_unique<FixedVariableEliminatedModel>(std::move(model));
+            fixed_variable_eliminated_model->compress_initial_iterate(initial_iterate);
+            model = std::move(fixed_variable_eliminated_model);
+         }
+      }
+
+      // optional presolve: eliminate the redundant linear constraints (free and duplicate rows)
+      if (options.get_bool("presolve_redundant_constraints")) {
+         const size_t number_redundant_constraints = RedundantConstraintEliminatedModel::count_redundant_linear_constraints(*model,
+               initial_iterate.primals);
+         if (0 < number_redundant_constraints) {
+            INFO << "Presolve: eliminating " << number_redundant_constraints << " redundant linear constraints\n";
+            auto redundant_constraint_eliminated_model = std::make_unique<RedundantConstraintEliminatedModel>(std::move(model),
+                  initial_iterate.primals);
+            redundant_constraint_eliminated_model->compress_initial_iterate(initial_iterate);
+            model = std::move(redundant_constraint_eliminated_model);
+         }
+      }
+
+      // optional presolve: tighten the variable bounds by propagating the linear constraints
+      if (options.get_bool("presolve_bound_tightening")) {
+         std::vector<double> tightened_lower_bounds;
+         std::vector<double> tightened_upper_bounds;
+         const size_t number_tightened_bounds = BoundTightening::tighten_bounds_with_linear_constraints(*model, initial_iterate.primals,
+               tightened_lower_bounds, tightened_upper_bounds);
+         if (0 < number_tightened_bounds) {
+            INFO << "Presolve: tightened " << number_tightened_bounds << " variable bounds\n";
+            model = std::make_unique<BoundTightenedModel>(std::move(model), std::move(tightened_lower_bounds),
+                  std::move(tightened_upper_bounds));
+            // project the initial point onto the tightened box
+            model->project_onto_variable_bounds(initial_iterate.primals);
+         }
+      }
+
       // optional: scale the problem using the evaluations at the first iterate
       // TODO create scaling *after* generating the IPM initial iterate
       if (options.get_string("scale_functions") == "yes") {
@@ -27,4 +81,29 @@ namespace uno {
       }
       return model;
    }
+
+   void ModelFactory::select_automatic_preset(const Model& model, Options& options) {
+      // cheap structure metrics, all available without any function evaluation
+      const double linear_constraint_fraction = (0 < model.number_constraints) ?
+            static_cast<double>(model.get_linear_constraints().size()) / static_cast<double>(model.number_constraints) : 0.;
+      size_t number_bounded_variables = 0;
+      for (size_t variable_index: Range(model.number_variables)) {
+         if (model.get_variable_bound_type(variable_index) != UNBOUNDED) {
+            number_bounded_variables++;
+         }
+      }
+      const double bound_density = (0 < model.number_variables) ?
+            static_cast<double>(number_bounded_variables) / static_cast<double>(model.number_variables) : 0.;
+
+      // active-set SQP shines on mostly-linear constraints of moderate size, where the working set
+      // settles quickly. Interior point is preferred for bound-dominated or large problems, whose
+      // active-set combinatorics become prohibitive
+      const bool mostly_linear = (0.75 <= linear_constraint_fraction && 0 < model.number_constraints);
+      const bool bound_dominated = (0.75 <= bound_density && model.number_constraints < model.number_variables);
+      const bool large_problem = (10000 < model.number_variables || 1000000 < model.number_hessian_nonzeros());
+      const std::string preset_name = (mostly_linear && not bound_dominated && not large_problem) ? "filtersqp" : "ipopt";
+      INFO << "Automatic preset selection: " << preset_name << " (linear constraint fraction " << linear_constraint_fraction <<
+            ", bound density " << bound_density << ", Hessian nonzeros " << model.number_hessian_nonzeros() << ")\n";
+      find_preset(preset_name, options);
+   }
 } // namespace
@@ -15,6 +15,9 @@ namespace uno {
    class ModelFactory {
    public:
       static std::unique_ptr<Model> reformulate(std::unique_ptr<Model> model, Iterate& initial_iterate, const Options& options);
+      // resolve the "auto" preset: inspect cheap structure metrics of the model and pick the
+      // ingredient stack that usually performs best on that structure
+      static void select_automatic_preset(const Model& model, Options& options);
    };
 } // namespace
 
@@ -0,0 +1,452 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_REDUNDANTCONSTRAINTELIMINATEDMODEL_H
+#define UNO_REDUNDANTCONSTRAINTELIMINATEDMODEL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include "Model.hpp"
+#include "linear_algebra/RectangularMatrix.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/Iterate.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   // presolve stage: eliminate the redundant linear constraints. Two kinds of rows are removed:
+   // free rows (both bounds infinite, or empty rows whose bounds contain 0) and duplicate rows
+   // (identical sparsity pattern and coefficients, detected with a hash), whose bounds are
+   // intersected into a single representative. The solver sees a reduced model whose Jacobian, KKT
+   // systems and m-length vectors shrink accordingly; postprocess_solution reinflates the
+   // multipliers, assigning the multiplier of a merged row to the original row that supplied the
+   // active bound. The variable indexing is unchanged
+   class RedundantConstraintEliminatedModel: public Model {
+   public:
+      RedundantConstraintEliminatedModel(std::unique_ptr<Model> original_model, const Vector<double>& x);
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override { return this->model->evaluate_objective(x); }
+      void evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const override {
+         this->model->evaluate_objective_gradient(x, gradient);
+      }
+      void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+      void evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+            std::vector<double>& constraints) const override;
+      [[nodiscard]] bool try_evaluate_objective(const Vector<double>& x, double& objective_value) const override {
+         return this->model->try_evaluate_objective(x, objective_value);
+      }
+      [[nodiscard]] bool try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+      [[nodiscard]] bool try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+            std::vector<double>& constraints) const override;
+      // the profile refers to the original index space: forward it unchanged
+      [[nodiscard]] std::vector<std::pair<size_t, double>> get_constraint_cost_profile() const override {
+         return this->model->get_constraint_cost_profile();
+      }
+      void evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const override {
+         this->model->evaluate_constraint_gradient(x, this->original_of_reduced[constraint_index], gradient);
+      }
+      void evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            SymmetricMatrix<SparseIndex, double>& hessian) const override {
+         this->model->evaluate_lagrangian_hessian(x, objective_multiplier, this->expand_multipliers(multipliers), hessian);
+      }
+
+      [[nodiscard]] bool has_hessian_operator() const override { return this->model->has_hessian_operator(); }
+      void compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            const Vector<double>& vector, Vector<double>& result) const override {
+         this->model->compute_hessian_vector_product(x, objective_multiplier, this->expand_multipliers(multipliers), vector, result);
+      }
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->model->variable_lower_bound(variable_index); }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->model->variable_upper_bound(variable_index); }
+      [[nodiscard]] BoundType get_variable_bound_type(size_t variable_index) const override { return this->model->get_variable_bound_type(variable_index); }
+      [[nodiscard]] const Collection<size_t>& get_lower_bounded_variables() const override { return this->model->get_lower_bounded_variables(); }
+      [[nodiscard]] const Collection<size_t>& get_upper_bounded_variables() const override { return this->model->get_upper_bounded_variables(); }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->model->get_slacks(); }
+      [[nodiscard]] const Collection<size_t>& get_single_lower_bounded_variables() const override {
+         return this->model->get_single_lower_bounded_variables();
+      }
+      [[nodiscard]] const Collection<size_t>& get_single_upper_bounded_variables() const override {
+         return this->model->get_single_upper_bounded_variables();
+      }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override { return this->constraint_lower_bounds[constraint_index]; }
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override { return this->constraint_upper_bounds[constraint_index]; }
+      [[nodiscard]] FunctionType get_constraint_type(size_t constraint_index) const override {
+         return this->model->get_constraint_type(this->original_of_reduced[constraint_index]);
+      }
+      [[nodiscard]] BoundType get_constraint_bound_type(size_t constraint_index) const override { return this->constraint_status[constraint_index]; }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->equality_constraints_collection; }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->inequality_constraints_collection; }
+      [[nodiscard]] const std::vector<size_t>& get_linear_constraints() const override { return this->linear_constraints; }
+
+      void initial_primal_point(Vector<double>& x) const override { this->model->initial_primal_point(x); }
+      void initial_dual_point(Vector<double>& multipliers) const override;
+      void postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const override;
+
+      // the constraint compression goes through shared buffers
+      [[nodiscard]] bool supports_concurrent_evaluations() const override { return false; }
+
+      [[nodiscard]] size_t number_objective_gradient_nonzeros() const override { return this->model->number_objective_gradient_nonzeros(); }
+      // upper bound: the removed rows still count in the original pattern
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model->number_jacobian_nonzeros(); }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model->number_hessian_nonzeros(); }
+
+      // number of redundant linear constraints of a model (0 means that the elimination is a no-op)
+      [[nodiscard]] static size_t count_redundant_linear_constraints(const Model& model, const Vector<double>& x);
+      // compress an iterate expressed in the original space into the reduced space
+      void compress_initial_iterate(Iterate& initial_iterate) const;
+
+   protected:
+      const std::unique_ptr<Model> model;
+      // index maps between the original and the reduced spaces (SIZE_MAX: eliminated constraint)
+      std::vector<size_t> original_of_reduced{};
+      std::vector<size_t> reduced_of_original{};
+      // representative (in original indexing) of each original row: itself for a kept row, the
+      // surviving duplicate for a merged row, SIZE_MAX for a free row
+      std::vector<size_t> representative_of_original{};
+      // for each kept original row, the original row that supplied each merged bound (itself when
+      // the declared bound was the tightest); used for the multiplier recovery at postsolve
+      std::vector<size_t> lower_bound_sources{};
+      std::vector<size_t> upper_bound_sources{};
+
+      // merged constraint bounds and recomputed statuses, in reduced indexing
+      std::vector<double> constraint_lower_bounds{};
+      std::vector<double> constraint_upper_bounds{};
+      std::vector<BoundType> constraint_status{};
+
+      // index lists of the constraints + corresponding collection objects, in reduced indexing
+      std::vector<size_t> equality_constraints{};
+      CollectionAdapter<std::vector<size_t>&> equality_constraints_collection;
+      std::vector<size_t> inequality_constraints{};
+      CollectionAdapter<std::vector<size_t>&> inequality_constraints_collection;
+      std::vector<size_t> linear_constraints{};
+
+      // staging buffers: full-space constraint values, subset indices and multipliers
+      mutable std::vector<double> full_constraints;
+      mutable std::vector<size_t> full_constraint_indices;
+      mutable Vector<double> full_multipliers;
+      mutable RectangularMatrix<double> full_jacobian;
+
+      // result of the duplicate/free row detection, in original indexing
+      struct RedundancyAnalysis {
+         std::vector<size_t> representative_of_original{};
+         std::vector<double> merged_lower_bounds{};
+         std::vector<double> merged_upper_bounds{};
+         std::vector<size_t> lower_bound_sources{};
+         std::vector<size_t> upper_bound_sources{};
+      };
+      static void analyze_linear_constraints(const Model& model, const Vector<double>& x, RedundancyAnalysis& analysis);
+      [[nodiscard]] static uint64_t hash_canonical_row(const std::vector<std::pair<size_t, double>>& canonical_row);
+      [[nodiscard]] const Vector<double>& expand_multipliers(const Vector<double>& multipliers) const;
+   };
+
+   inline RedundantConstraintEliminatedModel::RedundantConstraintEliminatedModel(std::unique_ptr<Model> original_model, const Vector<double>& x):
+         Model(original_model->name + "_redundanteliminated", original_model->number_variables,
+               original_model->number_constraints - RedundantConstraintEliminatedModel::count_redundant_linear_constraints(*original_model, x),
+               original_model->objective_sign),
+         // transfer ownership of the pointer
+         model(std::move(original_model)),
+         reduced_of_original(this->model->number_constraints),
+         equality_constraints_collection(this->equality_constraints),
+         inequality_constraints_collection(this->inequality_constraints),
+         full_constraints(this->model->number_constraints),
+         full_multipliers(this->model->number_constraints),
+         full_jacobian(this->model->number_constraints, this->model->number_variables) {
+      RedundancyAnalysis analysis{};
+      RedundantConstraintEliminatedModel::analyze_linear_constraints(*this->model, x, analysis);
+      this->representative_of_original = std::move(analysis.representative_of_original);
+      this->lower_bound_sources = std::move(analysis.lower_bound_sources);
+      this->upper_bound_sources = std::move(analysis.upper_bound_sources);
+
+      // index maps and merged bounds of the kept rows
+      this->original_of_reduced.reserve(this->number_constraints);
+      this->constraint_lower_bounds.reserve(this->number_constraints);
+      this->constraint_upper_bounds.reserve(this->number_constraints);
+      for (size_t original_index: Range(this->model->number_constraints)) {
+         if (this->representative_of_original[original_index] == original_index) {
+            this->reduced_of_original[original_index] = this->original_of_reduced.size();
+            this->original_of_reduced.emplace_back(original_index);
+            this->constraint_lower_bounds.emplace_back(analysis.merged_lower_bounds[original_index]);
+            this->constraint_upper_bounds.emplace_back(analysis.merged_upper_bounds[original_index]);
+         }
+         else {
+            this->reduced_of_original[original_index] = SIZE_MAX;
+         }
+      }
+      DEBUG << "Redundant-constraint presolve: " << (this->model->number_constraints - this->number_constraints) <<
+            " linear constraints eliminated\n";
+
+      // recompute the bound types (merging may change them, e.g. two one-sided rows into a
+      // two-sided one) and repartition the constraints
+      this->constraint_status.resize(this->number_constraints);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         const double lower_bound = this->constraint_lower_bounds[constraint_index];
+         const double upper_bound = this->constraint_upper_bounds[constraint_index];
+         if (lower_bound == upper_bound) {
+            this->constraint_status[constraint_index] = EQUAL_BOUNDS;
+         }
+         else if (is_finite(lower_bound) && is_finite(upper_bound)) {
+            this->constraint_status[constraint_index] = BOUNDED_BOTH_SIDES;
+         }
+         else if (is_finite(lower_bound)) {
+            this->constraint_status[constraint_index] = BOUNDED_LOWER;
+         }
+         else if (is_finite(upper_bound)) {
+            this->constraint_status[constraint_index] = BOUNDED_UPPER;
+         }
+         else {
+            this->constraint_status[constraint_index] = UNBOUNDED;
+         }
+         if (this->constraint_status[constraint_index] == EQUAL_BOUNDS) {
+            this->equality_constraints.emplace_back(constraint_index);
+         }
+         else {
+            this->inequality_constraints.emplace_back(constraint_index);
+         }
+      }
+
+      // linear constraints, reindexed into the reduced space
+      for (size_t original_index: this->model->get_linear_constraints()) {
+         if (this->reduced_of_original[original_index] != SIZE_MAX) {
+            this->linear_constraints.emplace_back(this->reduced_of_original[original_index]);
+         }
+      }
+      std::sort(this->linear_constraints.begin(), this->linear_constraints.end());
+   }
+
+   // cheap 64-bit FNV-1a hash of the raw bytes of the canonical (sorted) row
+   inline uint64_t RedundantConstraintEliminatedModel::hash_canonical_row(const std::vector<std::pair<size_t, double>>& canonical_row) {
+      uint64_t hash = 0xcbf29ce484222325;
+      const auto hash_bytes = [&hash](uint64_t bits) {
+         for (size_t byte_index: Range(sizeof(bits))) {
+            hash = (hash ^ ((bits >> (8*byte_index)) & 0xff)) * 0x100000001b3;
+         }
+      };
+      for (const auto& [variable_index, coefficient]: canonical_row) {
+         hash_bytes(static_cast<uint64_t>(variable_index));
+         uint64_t bits;
+         std::memcpy(&bits, &coefficient, sizeof(bits));
+         hash_bytes(bits);
+      }
+      return hash;
+   }
+
+   inline void RedundantConstraintEliminatedModel::analyze_linear_constraints(const Model& model, const Vector<double>& x,
+         RedundancyAnalysis& analysis) {
+      const size_t number_constraints = model.number_constraints;
+      // start from the declared rows: every row is its own representative
+      analysis.representative_of_original.resize(number_constraints);
+      analysis.merged_lower_bounds.resize(number_constraints);
+      analysis.merged_upper_bounds.resize(number_constraints);
+      analysis.lower_bound_sources.resize(number_constraints);
+      analysis.upper_bound_sources.resize(number_constraints);
+      for (size_t constraint_index: Range(number_constraints)) {
+         analysis.representative_of_original[constraint_index] = constraint_index;
+         analysis.merged_lower_bounds[constraint_index] = model.constraint_lower_bound(constraint_index);
+         analysis.merged_upper_bounds[constraint_index] = model.constraint_upper_bound(constraint_index);
+         analysis.lower_bound_sources[constraint_index] = constraint_index;
+         analysis.upper_bound_sources[constraint_index] = constraint_index;
+      }
+
+      // scan the linear rows: the gradients of linear constraints are constant
+      SparseVector<double> gradient(model.number_variables);
+      std::unordered_map<uint64_t, std::vector<size_t>> representative_buckets;
+      std::unordered_map<size_t, std::vector<std::pair<size_t, double>>> canonical_rows;
+      for (size_t constraint_index: model.get_linear_constraints()) {
+         model.evaluate_constraint_gradient(x, constraint_index, gradient);
+         // canonical form: the nonzero (index, coefficient) pairs, sorted by index
+         std::vector<std::pair<size_t, double>> canonical_row;
+         canonical_row.reserve(gradient.size());
+         for (const auto [variable_index, coefficient]: gradient) {
+            if (coefficient != 0.) {
+               canonical_row.emplace_back(variable_index, coefficient);
+            }
+         }
+         std::sort(canonical_row.begin(), canonical_row.end());
+
+         const double lower_bound = analysis.merged_lower_bounds[constraint_index];
+         const double upper_bound = analysis.merged_upper_bounds[constraint_index];
+         if (not is_finite(lower_bound) && not is_finite(upper_bound)) {
+            // free row: trivially redundant
+            analysis.representative_of_original[constraint_index] = SIZE_MAX;
+            continue;
+         }
+         if (canonical_row.empty()) {
+            // empty row: redundant iff its bounds contain 0 (otherwise, leave the infeasibility
+            // for the solver to diagnose)
+            if (lower_bound <= 0. && 0. <= upper_bound) {
+               analysis.representative_of_original[constraint_index] = SIZE_MAX;
+            }
+            continue;
+         }
+
+         // look up earlier rows with the same hash and compare exactly
+         const uint64_t hash = RedundantConstraintEliminatedModel::hash_canonical_row(canonical_row);
+         std::vector<size_t>& bucket = representative_buckets[hash];
+         bool merged = false;
+         for (size_t representative_index: bucket) {
+            if (canonical_rows[representative_index] == canonical_row) {
+               // duplicate row: intersect the bounds into the representative, unless the
+               // intersection is empty (a sign of infeasibility, left to the solver)
+               const double intersected_lower_bound = std::max(analysis.merged_lower_bounds[representative_index], lower_bound);
+               const double intersected_upper_bound = std::min(analysis.merged_upper_bounds[representative_index], upper_bound);
+               if (intersected_lower_bound <= intersected_upper_bound) {
+                  analysis.representative_of_original[constraint_index] = representative_index;
+                  if (analysis.merged_lower_bounds[representative_index] < lower_bound) {
+                     analysis.merged_lower_bounds[representative_index] = lower_bound;
+                     analysis.lower_bound_sources[representative_index] = constraint_index;
+                  }
+                  if (upper_bound < analysis.merged_upper_bounds[representative_index]) {
+                     analysis.merged_upper_bounds[representative_index] = upper_bound;
+                     analysis.upper_bound_sources[representative_index] = constraint_index;
+                  }
+                  merged = true;
+               }
+               break;
+            }
+         }
+         if (not merged && analysis.representative_of_original[constraint_index] == constraint_index) {
+            bucket.emplace_back(constraint_index);
+            canonical_rows.emplace(constraint_index, std::move(canonical_row));
+         }
+      }
+   }
+
+   inline size_t RedundantConstraintEliminatedModel::count_redundant_linear_constraints(const Model& model, const Vector<double>& x) {
+      RedundancyAnalysis analysis{};
+      RedundantConstraintEliminatedModel::analyze_linear_constraints(model, x, analysis);
+      size_t number_redundant_constraints = 0;
+      for (size_t constraint_index: Range(model.number_constraints)) {
+         if (analysis.representative_of_original[constraint_index] != constraint_index) {
+            number_redundant_constraints++;
+         }
+      }
+      return number_redundant_constraints;
+   }
+
+   inline void RedundantConstraintEliminatedModel::evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      this->model->evaluate_constraints(x, this->full_constraints);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         constraints[constraint_index] = this->full_constraints[this->original_of_reduced[constraint_index]];
+      }
+   }
+
+   inline bool RedundantConstraintEliminatedModel::try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      if (not this->model->try_evaluate_constraints(x, this->full_constraints)) {
+         return false;
+      }
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         constraints[constraint_index] = this->full_constraints[this->original_of_reduced[constraint_index]];
+      }
+      return true;
+   }
+
+   inline bool RedundantConstraintEliminatedModel::try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+         std::vector<double>& constraints) const {
+      if (not this->model->try_evaluate_objective_and_constraints(x, objective_value, this->full_constraints)) {
+         return false;
+      }
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         constraints[constraint_index] = this->full_constraints[this->original_of_reduced[constraint_index]];
+      }
+      return true;
+   }
+
+   inline void RedundantConstraintEliminatedModel::evaluate_constraints_subset(const Vector<double>& x,
+         const std::vector<size_t>& constraint_indices, std::vector<double>& constraints) const {
+      // translate the reduced indices, evaluate in the original indexing and gather the values
+      this->full_constraint_indices.clear();
+      for (size_t constraint_index: constraint_indices) {
+         this->full_constraint_indices.emplace_back(this->original_of_reduced[constraint_index]);
+      }
+      this->model->evaluate_constraints_subset(x, this->full_constraint_indices, this->full_constraints);
+      for (size_t constraint_index: constraint_indices) {
+         constraints[constraint_index] = this->full_constraints[this->original_of_reduced[constraint_index]];
+      }
+   }
+
+   inline void RedundantConstraintEliminatedModel::evaluate_constraint_jacobian(const Vector<double>& x,
+         RectangularMatrix<double>& constraint_jacobian) const {
+      this->model->evaluate_constraint_jacobian(x, this->full_jacobian);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         SparseVector<double>& row = constraint_jacobian[constraint_index];
+         row.clear();
+         for (const auto [variable_index, derivative]: this->full_jacobian[this->original_of_reduced[constraint_index]]) {
+            row.insert(variable_index, derivative);
+         }
+      }
+   }
+
+   // scatter the reduced multipliers into the original space, with zeros at the eliminated rows
+   // (they are linear and do not contribute to the Hessian anyway)
+   inline const Vector<double>& RedundantConstraintEliminatedModel::expand_multipliers(const Vector<double>& multipliers) const {
+      this->full_multipliers.fill(0.);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         this->full_multipliers[this->original_of_reduced[constraint_index]] = multipliers[constraint_index];
+      }
+      return this->full_multipliers;
+   }
+
+   inline void RedundantConstraintEliminatedModel::initial_dual_point(Vector<double>& multipliers) const {
+      // accumulate the duplicates into their representative: the rows are identical, so summing
+      // the multipliers preserves the Jacobian-transpose product
+      this->model->initial_dual_point(this->full_multipliers);
+      multipliers.fill(0.);
+      for (size_t original_index: Range(this->model->number_constraints)) {
+         const size_t representative_index = this->representative_of_original[original_index];
+         if (representative_index != SIZE_MAX) {
+            multipliers[this->reduced_of_original[representative_index]] += this->full_multipliers[original_index];
+         }
+      }
+   }
+
+   inline void RedundantConstraintEliminatedModel::compress_initial_iterate(Iterate& initial_iterate) const {
+      // same accumulation as initial_dual_point, on the multipliers carried by the iterate
+      const Vector<double> original_multipliers = initial_iterate.multipliers.constraints;
+      const Vector<double> original_feasibility_multipliers = initial_iterate.feasibility_multipliers.constraints;
+      initial_iterate.set_number_constraints(this->number_constraints);
+      initial_iterate.multipliers.constraints.fill(0.);
+      initial_iterate.feasibility_multipliers.constraints.fill(0.);
+      for (size_t original_index: Range(this->model->number_constraints)) {
+         const size_t representative_index = this->representative_of_original[original_index];
+         if (representative_index != SIZE_MAX) {
+            const size_t reduced_index = this->reduced_of_original[representative_index];
+            initial_iterate.multipliers.constraints[reduced_index] += original_multipliers[original_index];
+            initial_iterate.feasibility_multipliers.constraints[reduced_index] += original_feasibility_multipliers[original_index];
+         }
+      }
+   }
+
+   inline void RedundantConstraintEliminatedModel::postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const {
+      // reinflate the multipliers to the original space. The multiplier of a merged row goes to the
+      // original row that supplied the active bound (positive multiplier: lower bound, negative:
+      // upper bound); the other duplicates and the free rows get zero multipliers
+      const Vector<double> reduced_multipliers = iterate.multipliers.constraints;
+      const Vector<double> reduced_feasibility_multipliers = iterate.feasibility_multipliers.constraints;
+      iterate.set_number_constraints(this->model->number_constraints);
+      iterate.multipliers.constraints.fill(0.);
+      iterate.feasibility_multipliers.constraints.fill(0.);
+      for (size_t constraint_index: Range(this->original_of_reduced.size())) {
+         const size_t original_index = this->original_of_reduced[constraint_index];
+         const double multiplier = reduced_multipliers[constraint_index];
+         size_t target_index = original_index;
+         if (0. < multiplier) {
+            target_index = this->lower_bound_sources[original_index];
+         }
+         else if (multiplier < 0.) {
+            target_index = this->upper_bound_sources[original_index];
+         }
+         iterate.multipliers.constraints[target_index] = multiplier;
+         iterate.feasibility_multipliers.constraints[original_index] = reduced_feasibility_multipliers[constraint_index];
+      }
+      this->model->postprocess_solution(iterate, termination_status);
+   }
+} // namespace
+
+#endif // UNO_REDUNDANTCONSTRAINTELIMINATEDMODEL_H
@@ -4,12 +4,17 @@
 #ifndef UNO_SCALEDMODEL_H
 #define UNO_SCALEDMODEL_H
 
+#include <fstream>
 #include "Model.hpp"
 #include "optimization/Iterate.hpp"
 #include "preprocessing/Scaling.hpp"
+#include "tools/Logger.hpp"
 #include "tools/Options.hpp"
 
 namespace uno {
+   // scale the functions of the wrapped model with factors computed from the initial gradients. The
+   // scaled constraint bounds are computed on the fly from the wrapped model and the O(m) factors:
+   // the wrapper does not materialize any per-variable array
    class ScaledModel: public Model {
    public:
       ScaledModel(std::unique_ptr<Model> original_model, Iterate& initial_iterate, const Options& options);
@@ -17,10 +22,23 @@ namespace uno {
       [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
       void evaluate_objective_gradient(const Vector<double>& x, SparseVector<double>& gradient) const override;
       void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+      void evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+            std::vector<double>& constraints) const override;
+      [[nodiscard]] bool try_evaluate_objective(const Vector<double>& x, double& objective_value) const override;
+      [[nodiscard]] bool try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+      [[nodiscard]] bool try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+            std::vector<double>& constraints) const override;
+      [[nodiscard]] std::vector<std::pair<size_t, double>> get_constraint_cost_profile() const override {
+         return this->model->get_constraint_cost_profile();
+      }
       void evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const override;
       void evaluate_constraint_jacobian(const Vector<double>& x, RectangularMatrix<double>& constraint_jacobian) const override;
       void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
-            SymmetricMatrix<size_t, double>& hessian) const override;
+            SymmetricMatrix<SparseIndex, double>& hessian) const override;
+
+      [[nodiscard]] bool has_hessian_operator() const override { return this->model->has_hessian_operator(); }
+      void compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            const Vector<double>& vector, Vector<double>& result) const override;
 
       [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->model->variable_lower_bound(variable_index); }
       [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->model->variable_upper_bound(variable_index); }
@@ -39,10 +57,18 @@ namespace uno {
       [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->model->get_inequality_constraints(); }
       [[nodiscard]] const std::vector<size_t>& get_linear_constraints() const override { return this->model->get_linear_constraints(); }
 
+      // incremental rescaling at a restart point (new solve of the same model, resumed snapshot):
+      // refresh only the factors whose gradient magnitude drifted since they were computed.
+      // Not meant to be called mid-iteration, where it would invalidate the globalization state.
+      // Returns the number of refreshed factors
+      size_t rescale(Iterate& current_iterate);
+
       void initial_primal_point(Vector<double>& x) const override { this->model->initial_primal_point(x); }
       void initial_dual_point(Vector<double>& multipliers) const override { this->model->initial_dual_point(multipliers); }
       void postprocess_solution(Iterate& iterate, TerminationStatus termination_status) const override;
 
+      [[nodiscard]] bool supports_concurrent_evaluations() const override { return this->model->supports_concurrent_evaluations(); }
+
       [[nodiscard]] size_t number_objective_gradient_nonzeros() const override { return this->model->number_objective_gradient_nonzeros(); }
       [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model->number_jacobian_nonzeros(); }
       [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model->number_hessian_nonzeros(); }
@@ -50,25 +76,46 @@ namespace uno {
    private:
       const std::unique_ptr<Model> model;
       Scaling scaling;
+      const double scaling_drift_factor;
    };
 
    inline ScaledModel::ScaledModel(std::unique_ptr<Model> original_model, Iterate& initial_iterate, const Options& options):
          Model(original_model->name + "_scaled", original_model->number_variables, original_model->number_constraints, original_model->objective_sign),
          model(std::move(original_model)),
-         scaling(this->model->number_constraints, options.get_double("function_scaling_threshold")) {
+         scaling(this->model->number_constraints, options.get_double("function_scaling_threshold")),
+         scaling_drift_factor(options.get_double("function_scaling_drift_factor")) {
       if (options.get_bool("scale_functions")) {
-         // evaluate the gradients at the current point
-         initial_iterate.evaluate_objective_gradient(*this->model);
-         initial_iterate.evaluate_constraint_jacobian(*this->model);
-         this->scaling.compute(initial_iterate.evaluations.objective_gradient, initial_iterate.evaluations.constraint_jacobian);
-         // scale the gradients
-         scale(initial_iterate.evaluations.objective_gradient, this->scaling.get_objective_scaling());
-         for (size_t constraint_index: Range(this->model->number_constraints)) {
-            scale(initial_iterate.evaluations.constraint_jacobian[constraint_index], this->scaling.get_constraint_scaling(constraint_index));
+         // possibly reuse factors cached by a previous solve of the same model family, skipping the
+         // gradient evaluations they are computed from
+         const std::string& scaling_factors_file = options.get_string("function_scaling_factors_file");
+         bool factors_loaded = false;
+         if (scaling_factors_file != "none") {
+            std::ifstream stream(scaling_factors_file);
+            factors_loaded = stream.is_open() && this->scaling.read(stream);
+            if (factors_loaded) {
+               INFO << "Scaling factors read from " << scaling_factors_file << '\n';
+            }
+         }
+         if (not factors_loaded) {
+            // evaluate the gradients at the current point
+            initial_iterate.evaluate_objective_gradient(*this->model);
+            initial_iterate.evaluate_constraint_jacobian(*this->model);
+            this->scaling.compute(initial_iterate.evaluations.objective_gradient, initial_iterate.evaluations.constraint_jacobian);
+            // scale the gradients
+            scale(initial_iterate.evaluations.objective_gradient, this->scaling.get_objective_scaling());
+            for (size_t constraint_index: Range(this->model->number_constraints)) {
+               scale(initial_iterate.evaluations.constraint_jacobian[constraint_index], this->scaling.get_constraint_scaling(constraint_index));
+            }
+            // since the definition of the constraints changed, reset the evaluation flags
+            initial_iterate.is_objective_gradient_computed = false;
+            initial_iterate.is_constraint_jacobian_computed = false;
+            // cache the computed factors for later solves
+            if (scaling_factors_file != "none") {
+               std::ofstream stream(scaling_factors_file);
+               this->scaling.write(stream);
+               INFO << "Scaling factors written to " << scaling_factors_file << '\n';
+            }
          }
-         // since the definition of the constraints changed, reset the evaluation flags
-         initial_iterate.is_objective_gradient_computed = false;
-         initial_iterate.is_constraint_jacobian_computed = false;
       }
       // check the scaling factors
       assert(0 < this->scaling.get_objective_scaling() && "Objective scaling failed.");
@@ -77,6 +124,32 @@ namespace uno {
       }
    }
 
+   inline size_t ScaledModel::rescale(Iterate& current_iterate) {
+      // evaluate the unscaled gradients at the current point
+      this->model->evaluate_objective_gradient(current_iterate.primals, current_iterate.evaluations.objective_gradient);
+      this->model->evaluate_constraint_jacobian(current_iterate.primals, current_iterate.evaluations.constraint_jacobian);
+      const size_t number_updated_factors = this->scaling.update(current_iterate.evaluations.objective_gradient,
+            current_iterate.evaluations.constraint_jacobian, this->scaling_drift_factor);
+      // scale the just-evaluated gradients in place with the (possibly refreshed) factors: they are
+      // consistent with the new scaled functions and can be kept
+      scale(current_iterate.evaluations.objective_gradient, this->scaling.get_objective_scaling());
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         scale(current_iterate.evaluations.constraint_jacobian[constraint_index], this->scaling.get_constraint_scaling(constraint_index));
+      }
+      current_iterate.is_objective_gradient_computed = true;
+      current_iterate.is_constraint_jacobian_computed = true;
+      current_iterate.evaluations.objective_gradient_point_hash = Evaluations::hash_point(current_iterate.primals);
+      current_iterate.evaluations.constraint_jacobian_point_hash = current_iterate.evaluations.objective_gradient_point_hash;
+      if (0 < number_updated_factors) {
+         // the definition of the scaled functions changed: drop the cached function values
+         current_iterate.is_objective_computed = false;
+         current_iterate.are_constraints_computed = false;
+         current_iterate.evaluations.objective_point_hash = 0;
+         current_iterate.evaluations.constraints_point_hash = 0;
+      }
+      return number_updated_factors;
+   }
+
    inline double ScaledModel::evaluate_objective(const Vector<double>& x) const {
       const double objective = this->model->evaluate_objective(x);
       return this->scaling.get_objective_scaling()*objective;
@@ -94,6 +167,44 @@ namespace uno {
       }
    }
 
+   inline void ScaledModel::evaluate_constraints_subset(const Vector<double>& x, const std::vector<size_t>& constraint_indices,
+         std::vector<double>& constraints) const {
+      this->model->evaluate_constraints_subset(x, constraint_indices, constraints);
+      for (size_t constraint_index: constraint_indices) {
+         constraints[constraint_index] *= this->scaling.get_constraint_scaling(constraint_index);
+      }
+   }
+
+   inline bool ScaledModel::try_evaluate_objective(const Vector<double>& x, double& objective_value) const {
+      if (not this->model->try_evaluate_objective(x, objective_value)) {
+         return false;
+      }
+      objective_value *= this->scaling.get_objective_scaling();
+      return true;
+   }
+
+   inline bool ScaledModel::try_evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      if (not this->model->try_evaluate_constraints(x, constraints)) {
+         return false;
+      }
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         constraints[constraint_index] *= this->scaling.get_constraint_scaling(constraint_index);
+      }
+      return true;
+   }
+
+   inline bool ScaledModel::try_evaluate_objective_and_constraints(const Vector<double>& x, double& objective_value,
+         std::vector<double>& constraints) const {
+      if (not this->model->try_evaluate_objective_and_constraints(x, objective_value, constraints)) {
+         return false;
+      }
+      objective_value *= this->scaling.get_objective_scaling();
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         constraints[constraint_index] *= this->scaling.get_constraint_scaling(constraint_index);
+      }
+      return true;
+   }
+
    inline void ScaledModel::evaluate_constraint_gradient(const Vector<double>& x, size_t constraint_index, SparseVector<double>& gradient) const {
       this->model->evaluate_constraint_gradient(x, constraint_index, gradient);
       scale(gradient, this->scaling.get_constraint_scaling(constraint_index));
@@ -107,17 +218,29 @@ namespace uno {
    }
 
    inline void ScaledModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
-         SymmetricMatrix<size_t, double>& hessian) const {
+         SymmetricMatrix<SparseIndex, double>& hessian) const {
       // scale the objective and constraint multipliers
       const double scaled_objective_multiplier = objective_multiplier*this->scaling.get_objective_scaling();
-      // TODO preallocate this vector
-      static Vector<double> scaled_multipliers(this->number_constraints);
+      // local vector: a shared buffer would be a data race for concurrent callers
+      Vector<double> scaled_multipliers(this->number_constraints);
       for (size_t constraint_index: Range(this->number_constraints)) {
          scaled_multipliers[constraint_index] = this->scaling.get_constraint_scaling(constraint_index) * multipliers[constraint_index];
       }
       this->model->evaluate_lagrangian_hessian(x, scaled_objective_multiplier, scaled_multipliers, hessian);
    }
 
+   inline void ScaledModel::compute_hessian_vector_product(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         const Vector<double>& vector, Vector<double>& result) const {
+      // scale the objective and constraint multipliers, as in evaluate_lagrangian_hessian
+      const double scaled_objective_multiplier = objective_multiplier*this->scaling.get_objective_scaling();
+      // local vector: a shared buffer would be a data race for concurrent callers
+      Vector<double> scaled_multipliers(this->number_constraints);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         scaled_multipliers[constraint_index] = this->scaling.get_constraint_scaling(constraint_index) * multipliers[constraint_index];
+      }
+      this->model->compute_hessian_vector_product(x, scaled_objective_multiplier, scaled_multipliers, vector, result);
+   }
+
    inline double ScaledModel::constraint_lower_bound(size_t constraint_index) const {
       return this->scaling.get_constraint_scaling(constraint_index) * this->model->constraint_lower_bound(constraint_index);
    }
@@ -0,0 +1,16 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "EvaluationCounters.hpp"
+
+namespace uno {
+   EvaluationCounters EvaluationCounters::default_counters{};
+   thread_local EvaluationCounters* EvaluationCounters::active = &EvaluationCounters::default_counters;
+
+   void EvaluationCounters::reset() {
+      this->objective.store(0, std::memory_order_relaxed);
+      this->constraints.store(0, std::memory_order_relaxed);
+      this->objective_gradient.store(0, std::memory_order_relaxed);
+      this->jacobian.store(0, std::memory_order_relaxed);
+   }
+} // namespace
@@ -0,0 +1,41 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_EVALUATIONCOUNTERS_H
+#define UNO_EVALUATIONCOUNTERS_H
+
+#include <atomic>
+#include <cstddef>
+
+namespace uno {
+   /*! \class EvaluationCounters
+    * \brief Per-solve tallies of the model evaluations
+    *
+    * Each Uno::solve aggregates its evaluations into its own instance, so that concurrent solves
+    * (batch driver, multistart) report their own counts instead of interleaving in process-wide
+    * statics. The counters are relaxed atomics: the parallel evaluation paths (speculative line
+    * search, pipelined interior-point evaluations) count from worker threads without synchronizing
+    * the hot path, and no ordering between the counters is ever relied upon
+    */
+   class EvaluationCounters {
+   public:
+      std::atomic<size_t> objective{0};
+      std::atomic<size_t> constraints{0};
+      std::atomic<size_t> objective_gradient{0};
+      std::atomic<size_t> jacobian{0};
+
+      void increment_objective() { this->objective.fetch_add(1, std::memory_order_relaxed); }
+      void increment_constraints() { this->constraints.fetch_add(1, std::memory_order_relaxed); }
+      void increment_objective_gradient() { this->objective_gradient.fetch_add(1, std::memory_order_relaxed); }
+      void increment_jacobian() { this->jacobian.fetch_add(1, std::memory_order_relaxed); }
+      void reset();
+
+      // counters of the solve running on the current thread. Uno::solve installs its own instance;
+      // a process-wide default instance collects the evaluations performed outside of any solve
+      // (preprocessing, initial iterate generation in the drivers)
+      static EvaluationCounters default_counters;
+      static thread_local EvaluationCounters* active;
+   };
+} // namespace
+
+#endif // UNO_EVALUATIONCOUNTERS_H
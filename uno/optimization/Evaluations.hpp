@@ -4,9 +4,13 @@
 #ifndef UNO_EVALUATIONS_H
 #define UNO_EVALUATIONS_H
 
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include "linear_algebra/RectangularMatrix.hpp"
 #include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "symbolic/Range.hpp"
 #include "tools/Infinity.hpp"
 
 namespace uno {
@@ -16,11 +20,33 @@ namespace uno {
       SparseVector<double> objective_gradient; /*!< Sparse Jacobian of the objective */
       RectangularMatrix<double> constraint_jacobian; /*!< Sparse Jacobian of the constraints */
 
+      // hash of the primal point at which each evaluation was performed (0: no evaluation yet).
+      // Resetting the lazy flags of the Iterate (e.g. at a restoration phase switch) does not erase
+      // the stored values: a re-evaluation at the exact same point is recognized by its hash and skipped
+      uint64_t objective_point_hash{0};
+      uint64_t constraints_point_hash{0};
+      uint64_t objective_gradient_point_hash{0};
+      uint64_t constraint_jacobian_point_hash{0};
+
       Evaluations(size_t number_variables, size_t number_constraints):
             constraints(number_constraints),
             objective_gradient(number_variables),
             constraint_jacobian(number_constraints, number_variables) {
       }
+
+      // cheap 64-bit FNV-1a hash of the raw bytes of the primal vector. A collision between two
+      // distinct points visited by the same solve is vanishingly unlikely (~2^-64 per pair)
+      [[nodiscard]] static uint64_t hash_point(const Vector<double>& primals) {
+         uint64_t hash = 0xcbf29ce484222325;
+         for (size_t variable_index: Range(primals.size())) {
+            uint64_t bits;
+            std::memcpy(&bits, &primals[variable_index], sizeof(bits));
+            for (size_t byte_index: Range(sizeof(bits))) {
+               hash = (hash ^ ((bits >> (8*byte_index)) & 0xff)) * 0x100000001b3;
+            }
+         }
+         return hash;
+      }
    };
 } // namespace
 
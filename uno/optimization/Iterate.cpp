@@ -1,43 +1,88 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include "Iterate.hpp"
 #include "linear_algebra/RectangularMatrix.hpp"
 #include "linear_algebra/Vector.hpp"
 #include "model/Model.hpp"
 #include "optimization/EvaluationErrors.hpp"
 #include "tools/Logger.hpp"
+#include "tools/MemoryUsage.hpp"
+#include "tools/Profiler.hpp"
 
 namespace uno {
-   size_t Iterate::number_eval_objective = 0;
-   size_t Iterate::number_eval_constraints = 0;
-   size_t Iterate::number_eval_objective_gradient = 0;
-   size_t Iterate::number_eval_jacobian = 0;
-
    Iterate::Iterate(size_t number_variables, size_t number_constraints) :
          number_variables(number_variables), number_constraints(number_constraints),
          primals(number_variables), multipliers(number_variables, number_constraints), feasibility_multipliers(number_variables, number_constraints),
          evaluations(number_variables, number_constraints), residuals(number_variables), feasibility_residuals(number_variables) {
+      // footprint of a single iterate: primals, the two multiplier sets, the constraint values and
+      // the reserved evaluation structures (which may still lazily grow with the Jacobian)
+      MemoryUsage::record(MemoryUsage::ITERATE,
+            (number_variables + 2*(2*number_variables + number_constraints) + number_constraints) * sizeof(double)
+            + this->evaluations.objective_gradient.memory_footprint() + this->evaluations.constraint_jacobian.memory_footprint());
    }
 
    void Iterate::evaluate_objective(const Model& model) {
       if (not this->is_objective_computed) {
+         const uint64_t point_hash = Evaluations::hash_point(this->primals);
+         if (point_hash == this->evaluations.objective_point_hash) {
+            // the stored value was computed at this very point (the flag was merely reset)
+            this->is_objective_computed = true;
+            return;
+         }
+         const ScopedProfile profile(Profiler::EVALUATION);
+         // the objective is almost always requested together with the constraints (progress
+         // measures of a trial point): when neither is available here, a fused model evaluation
+         // shares the work between the two evaluation trees (a single ASL pass for AMPLModel)
+         if (model.is_constrained() && not this->are_constraints_computed &&
+               point_hash != this->evaluations.constraints_point_hash) {
+            this->evaluate_objective_and_constraints(model, point_hash);
+            return;
+         }
          // evaluate the objective
          this->evaluations.objective = model.evaluate_objective(this->primals);
-         Iterate::number_eval_objective++;
+         this->counters->increment_objective();
          if (not is_finite(this->evaluations.objective)) {
             throw FunctionEvaluationError();
          }
+         this->evaluations.objective_point_hash = point_hash;
          this->is_objective_computed = true;
       }
    }
 
+   // fused objective and constraint evaluation at the current point, with the finiteness checks
+   // and bookkeeping of the two separate evaluations
+   void Iterate::evaluate_objective_and_constraints(const Model& model, uint64_t point_hash) {
+      if (not model.try_evaluate_objective_and_constraints(this->primals, this->evaluations.objective, this->evaluations.constraints)) {
+         throw FunctionEvaluationError();
+      }
+      this->counters->increment_objective();
+      this->counters->increment_constraints();
+      if (not is_finite(this->evaluations.objective) ||
+            std::any_of(this->evaluations.constraints.cbegin(), this->evaluations.constraints.cend(), [](double constraint_j) {
+               return not is_finite(constraint_j);
+            })) {
+         throw FunctionEvaluationError();
+      }
+      this->evaluations.objective_point_hash = point_hash;
+      this->evaluations.constraints_point_hash = point_hash;
+      this->is_objective_computed = true;
+      this->are_constraints_computed = true;
+   }
+
    void Iterate::evaluate_constraints(const Model& model) {
       if (not this->are_constraints_computed) {
+         const uint64_t point_hash = Evaluations::hash_point(this->primals);
+         if (point_hash == this->evaluations.constraints_point_hash) {
+            this->are_constraints_computed = true;
+            return;
+         }
+         const ScopedProfile profile(Profiler::EVALUATION);
          if (model.is_constrained()) {
             // evaluate the constraints
             model.evaluate_constraints(this->primals, this->evaluations.constraints);
-            Iterate::number_eval_constraints++;
+            this->counters->increment_constraints();
             // check finiteness
             if (std::any_of(this->evaluations.constraints.cbegin(), this->evaluations.constraints.cend(), [](double constraint_j) {
                return not is_finite(constraint_j);
@@ -45,31 +90,136 @@ namespace uno {
                throw FunctionEvaluationError();
             }
          }
+         this->evaluations.constraints_point_hash = point_hash;
+         this->are_constraints_computed = true;
+      }
+   }
+
+   bool Iterate::try_evaluate_objective(const Model& model) {
+      if (this->is_objective_computed) {
+         return true;
+      }
+      const uint64_t point_hash = Evaluations::hash_point(this->primals);
+      if (point_hash == this->evaluations.objective_point_hash) {
+         // the stored value was computed at this very point (the flag was merely reset)
+         this->is_objective_computed = true;
+         return true;
+      }
+      const ScopedProfile profile(Profiler::EVALUATION);
+      // same fused evaluation as evaluate_objective, with failures reported as a return value
+      if (model.is_constrained() && not this->are_constraints_computed &&
+            point_hash != this->evaluations.constraints_point_hash) {
+         if (not model.try_evaluate_objective_and_constraints(this->primals, this->evaluations.objective, this->evaluations.constraints)) {
+            return false;
+         }
+         this->counters->increment_objective();
+         this->counters->increment_constraints();
+         if (not is_finite(this->evaluations.objective) ||
+               std::any_of(this->evaluations.constraints.cbegin(), this->evaluations.constraints.cend(), [](double constraint_j) {
+                  return not is_finite(constraint_j);
+               })) {
+            return false;
+         }
+         this->evaluations.objective_point_hash = point_hash;
+         this->evaluations.constraints_point_hash = point_hash;
+         this->is_objective_computed = true;
+         this->are_constraints_computed = true;
+         return true;
+      }
+      // evaluate the objective; a failure is reported as a return value, not an exception
+      if (not model.try_evaluate_objective(this->primals, this->evaluations.objective)) {
+         return false;
+      }
+      this->counters->increment_objective();
+      if (not is_finite(this->evaluations.objective)) {
+         return false;
+      }
+      this->evaluations.objective_point_hash = point_hash;
+      this->is_objective_computed = true;
+      return true;
+   }
+
+   bool Iterate::try_evaluate_constraints(const Model& model) {
+      if (this->are_constraints_computed) {
+         return true;
+      }
+      const uint64_t point_hash = Evaluations::hash_point(this->primals);
+      if (point_hash == this->evaluations.constraints_point_hash) {
          this->are_constraints_computed = true;
+         return true;
       }
+      const ScopedProfile profile(Profiler::EVALUATION);
+      if (model.is_constrained()) {
+         // evaluate the constraints; a failure is reported as a return value, not an exception
+         if (not model.try_evaluate_constraints(this->primals, this->evaluations.constraints)) {
+            return false;
+         }
+         this->counters->increment_constraints();
+         // check finiteness
+         if (std::any_of(this->evaluations.constraints.cbegin(), this->evaluations.constraints.cend(), [](double constraint_j) {
+            return not is_finite(constraint_j);
+         })) {
+            return false;
+         }
+      }
+      this->evaluations.constraints_point_hash = point_hash;
+      this->are_constraints_computed = true;
+      return true;
    }
 
    void Iterate::evaluate_objective_gradient(const Model& model) {
       if (not this->is_objective_gradient_computed) {
+         const uint64_t point_hash = Evaluations::hash_point(this->primals);
+         if (point_hash == this->evaluations.objective_gradient_point_hash) {
+            this->is_objective_gradient_computed = true;
+            return;
+         }
+         const ScopedProfile profile(Profiler::EVALUATION);
          this->evaluations.objective_gradient.clear();
          // evaluate the objective gradient
          model.evaluate_objective_gradient(this->primals, this->evaluations.objective_gradient);
+         this->evaluations.objective_gradient_point_hash = point_hash;
          this->is_objective_gradient_computed = true;
-         Iterate::number_eval_objective_gradient++;
+         this->counters->increment_objective_gradient();
       }
    }
 
    void Iterate::evaluate_constraint_jacobian(const Model& model) {
       if (not this->is_constraint_jacobian_computed) {
+         const uint64_t point_hash = Evaluations::hash_point(this->primals);
+         if (point_hash == this->evaluations.constraint_jacobian_point_hash) {
+            this->is_constraint_jacobian_computed = true;
+            return;
+         }
+         const ScopedProfile profile(Profiler::EVALUATION);
          this->evaluations.constraint_jacobian.clear();
          if (model.is_constrained()) {
             model.evaluate_constraint_jacobian(this->primals, this->evaluations.constraint_jacobian);
-            Iterate::number_eval_jacobian++;
+            this->counters->increment_jacobian();
          }
+         this->evaluations.constraint_jacobian_point_hash = point_hash;
          this->is_constraint_jacobian_computed = true;
       }
    }
 
+   // reserve the storage of the largest variable space visited during the solve (e.g. the model
+   // variables plus the elastics of l1RelaxedProblem), so that the phase transitions of
+   // FeasibilityRestoration and l1Relaxation resize within capacity instead of reallocating
+   // megabytes at every switch
+   void Iterate::reserve(size_t maximum_number_variables) {
+      this->reserved_number_variables = std::max(this->reserved_number_variables, maximum_number_variables);
+      this->primals.reserve(maximum_number_variables);
+      this->multipliers.lower_bounds.reserve(maximum_number_variables);
+      this->multipliers.upper_bounds.reserve(maximum_number_variables);
+      this->feasibility_multipliers.lower_bounds.reserve(maximum_number_variables);
+      this->feasibility_multipliers.upper_bounds.reserve(maximum_number_variables);
+      this->evaluations.objective_gradient.reserve(maximum_number_variables);
+      this->residuals.lagrangian_gradient.reserve(maximum_number_variables);
+      this->feasibility_residuals.lagrangian_gradient.reserve(maximum_number_variables);
+   }
+
+   // never shrinks the allocations (std::vector semantics): exiting a phase is O(1) and re-entering
+   // it resizes within the reserved capacity
    void Iterate::set_number_variables(size_t new_number_variables) {
       this->number_variables = new_number_variables;
       this->primals.resize(new_number_variables);
@@ -79,6 +229,19 @@ namespace uno {
       this->residuals.lagrangian_gradient.resize(new_number_variables);
    }
 
+   void Iterate::set_number_constraints(size_t new_number_constraints) {
+      this->number_constraints = new_number_constraints;
+      this->multipliers.constraints.resize(new_number_constraints);
+      this->feasibility_multipliers.constraints.resize(new_number_constraints);
+      this->evaluations.constraints.resize(new_number_constraints);
+      // the stored constraint evaluations refer to the previous constraint set: invalidate them,
+      // including the point hashes (the primal point itself did not change)
+      this->evaluations.constraints_point_hash = 0;
+      this->evaluations.constraint_jacobian_point_hash = 0;
+      this->are_constraints_computed = false;
+      this->is_constraint_jacobian_computed = false;
+   }
+
    std::ostream& operator<<(std::ostream& stream, const Iterate& iterate) {
       stream << "Primal variables: " << iterate.primals << '\n';
       stream << "            ┌ Constraint: " << iterate.multipliers.constraints << '\n';
@@ -5,6 +5,7 @@
 #define UNO_ITERATE_H
 
 #include "Evaluations.hpp"
+#include "EvaluationCounters.hpp"
 #include "TerminationStatus.hpp"
 #include "ingredients/globalization_strategies/ProgressMeasures.hpp"
 #include "optimization/Multipliers.hpp"
@@ -23,6 +24,9 @@ namespace uno {
 
       size_t number_variables;
       size_t number_constraints;
+      // largest variable space reserved so far (see reserve): copies of the iterate are re-reserved
+      // to it, since vector copies do not carry the spare capacity over
+      size_t reserved_number_variables{0};
       Vector<double> primals;
       Multipliers multipliers; /*!< \f$\mathbb{R}^n\f$ Lagrange multipliers/dual variables */
       Multipliers feasibility_multipliers; /*!< \f$\mathbb{R}^n\f$ Lagrange multipliers/dual variables */
@@ -30,10 +34,10 @@ namespace uno {
 
       // evaluations
       Evaluations evaluations;
-      static size_t number_eval_objective;
-      static size_t number_eval_constraints;
-      static size_t number_eval_objective_gradient;
-      static size_t number_eval_jacobian;
+      // per-solve evaluation tallies: Uno::solve points its iterates (and their copies, e.g. the
+      // trial iterate) to its own instance, so that evaluations dispatched to worker threads are
+      // counted in the right solve. The default is the counters active on the constructing thread
+      EvaluationCounters* counters{EvaluationCounters::active};
       // lazy evaluation flags
       bool is_objective_computed{false};
       bool are_constraints_computed{false};
@@ -53,10 +57,20 @@ namespace uno {
 
       void evaluate_objective(const Model& model);
       void evaluate_constraints(const Model& model);
+      void evaluate_objective_and_constraints(const Model& model, uint64_t point_hash);
+      // non-throwing counterparts: return false on an evaluation error or a non-finite value instead
+      // of throwing a FunctionEvaluationError (used by the line search, where a failed trial
+      // evaluation is a plain branch to a shorter step)
+      [[nodiscard]] bool try_evaluate_objective(const Model& model);
+      [[nodiscard]] bool try_evaluate_constraints(const Model& model);
       void evaluate_objective_gradient(const Model& model);
       void evaluate_constraint_jacobian(const Model& model);
 
+      // reserve the storage of the largest variable space visited during the solve, so that the
+      // phase transitions of the constraint relaxation strategies resize within capacity
+      void reserve(size_t maximum_number_variables);
       void set_number_variables(size_t number_variables);
+      void set_number_constraints(size_t number_constraints);
 
       friend std::ostream& operator<<(std::ostream& stream, const Iterate& iterate);
    };
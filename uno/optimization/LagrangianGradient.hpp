@@ -24,6 +24,7 @@ namespace uno {
       [[nodiscard]] size_t size() const;
       [[nodiscard]] ElementType operator[](size_t variable_index) const;
       void resize(size_t number_variables);
+      void reserve(size_t capacity);
    };
 
    template <typename ElementType>
@@ -49,6 +50,12 @@ namespace uno {
       this->constraints_contribution.resize(number_variables);
    }
 
+   template <typename ElementType>
+   void LagrangianGradient<ElementType>::reserve(size_t capacity) {
+      this->objective_contribution.reserve(capacity);
+      this->constraints_contribution.reserve(capacity);
+   }
+
    template <typename ElementType>
    std::ostream& operator<<(std::ostream& stream, const LagrangianGradient<ElementType>& gradient) {
       for (size_t variable_index: Range(gradient.constraints_contribution.size())) {
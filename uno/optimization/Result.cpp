@@ -1,10 +1,15 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
 #include <iomanip>
 #include "Result.hpp"
 #include "TerminationStatus.hpp"
+#include "symbolic/Range.hpp"
 #include "symbolic/VectorView.hpp"
+#include "tools/Profiler.hpp"
 
 namespace uno {
    void Result::print(bool print_primal_dual_solution) const {
@@ -27,6 +32,9 @@ namespace uno {
       else if (this->solution.status == TerminationStatus::UNBOUNDED) {
          std::cout << "Terminated with unbounded problem\n";
       }
+      else if (this->solution.status == TerminationStatus::FEASIBLE_ACCEPTABLE_POINT) {
+         std::cout << "Converged with feasible KKT point at the acceptable tolerance\n";
+      }
       else {
          std::cout << "Failed with suboptimal point\n";
       }
@@ -67,5 +75,101 @@ namespace uno {
       std::cout << "Jacobian evaluations:\t\t\t" << this->jacobian_evaluations << '\n';
       std::cout << "Hessian evaluations:\t\t\t" << this->hessian_evaluations << '\n';
       std::cout << "Number of subproblems solved:\t\t" << this->number_subproblems_solved << '\n';
+
+      const double megabyte = 1024. * 1024.;
+      std::cout << "Peak resident memory (MB):\t\t" << static_cast<double>(this->peak_resident_set_bytes) / megabyte << '\n';
+      std::cout << "Memory high-water marks (MB):\n";
+      for (size_t gauge_index: Range(MemoryUsage::NUMBER_GAUGES)) {
+         const auto gauge = static_cast<MemoryUsage::Gauge>(gauge_index);
+         std::cout << "- " << MemoryUsage::gauge_name(gauge) << ":\t" << static_cast<double>(this->structure_bytes[gauge_index]) / megabyte << '\n';
+      }
+
+      if (not this->constraint_cost_profile.empty()) {
+         // the profile is sorted by decreasing cost: report the dominant constraints
+         const size_t number_reported = std::min(size_t(10), this->constraint_cost_profile.size());
+         std::cout << "Most expensive constraints (sampled time in s):\n";
+         for (size_t rank: Range(number_reported)) {
+            const auto& [constraint_index, seconds] = this->constraint_cost_profile[rank];
+            std::cout << "- constraint " << constraint_index << ":\t" << seconds << '\n';
+         }
+      }
+
+      if (Profiler::enabled) {
+         std::cout << "Time profile (s):\n";
+         for (size_t bucket_index: Range(Profiler::NUMBER_BUCKETS)) {
+            const auto bucket = static_cast<Profiler::Bucket>(bucket_index);
+            std::cout << "- " << Profiler::bucket_name(bucket) << ":\t" << Profiler::get_duration(bucket) << '\n';
+         }
+         if (Profiler::counters_enabled) {
+            std::cout << "Hardware counter profile:\n";
+            for (size_t bucket_index: Range(Profiler::NUMBER_BUCKETS)) {
+               const auto bucket = static_cast<Profiler::Bucket>(bucket_index);
+               std::cout << "- " << Profiler::bucket_name(bucket) << ':';
+               for (size_t counter_index: Range(Profiler::NUMBER_COUNTERS)) {
+                  const auto counter = static_cast<Profiler::Counter>(counter_index);
+                  std::cout << ' ' << Profiler::counter_name(counter) << ' ' << Profiler::get_counter(bucket, counter);
+               }
+               std::cout << '\n';
+            }
+         }
+      }
+   }
+
+   void Result::write_binary(const std::string& file_name) const {
+      // assemble the whole record in memory, then perform a single buffered write
+      std::vector<char> buffer;
+      buffer.reserve(64 + 8*(4*this->number_variables + 2*this->number_constraints));
+      const auto append_bytes = [&buffer](const void* data, size_t size) {
+         const char* bytes = static_cast<const char*>(data);
+         buffer.insert(buffer.end(), bytes, bytes + size);
+      };
+      const auto append_scalar = [&append_bytes](auto value) {
+         append_bytes(&value, sizeof(value));
+      };
+      const auto append_vector = [&append_bytes](const auto& vector, size_t size) {
+         for (size_t index: Range(size)) {
+            const double value = vector[index];
+            append_bytes(&value, sizeof(value));
+         }
+      };
+
+      // header: magic, format version and sizes
+      append_bytes("UNOB", 4);
+      append_scalar(uint32_t(2));
+      append_scalar(uint64_t(this->number_variables));
+      append_scalar(uint64_t(this->number_constraints));
+      append_scalar(uint8_t(this->solution.status));
+      // objective, feasibility and dual residuals (optimality and feasibility measures)
+      append_scalar(this->solution.evaluations.objective);
+      append_scalar(this->solution.objective_multiplier);
+      append_scalar(this->solution.primal_feasibility);
+      append_scalar(this->solution.residuals.stationarity);
+      append_scalar(this->solution.residuals.complementarity);
+      append_scalar(this->solution.feasibility_residuals.stationarity);
+      append_scalar(this->solution.feasibility_residuals.complementarity);
+      // effort counters
+      append_scalar(this->cpu_time);
+      append_scalar(uint64_t(this->iteration));
+      append_scalar(uint64_t(this->objective_evaluations));
+      append_scalar(uint64_t(this->constraint_evaluations));
+      append_scalar(uint64_t(this->objective_gradient_evaluations));
+      append_scalar(uint64_t(this->jacobian_evaluations));
+      append_scalar(uint64_t(this->hessian_evaluations));
+      append_scalar(uint64_t(this->number_subproblems_solved));
+      // memory instrumentation (format version 2): peak resident set size, then the gauge count and
+      // the high-water marks of the structures, in bytes
+      append_scalar(uint64_t(this->peak_resident_set_bytes));
+      append_scalar(uint64_t(MemoryUsage::NUMBER_GAUGES));
+      for (size_t gauge_index: Range(MemoryUsage::NUMBER_GAUGES)) {
+         append_scalar(uint64_t(this->structure_bytes[gauge_index]));
+      }
+      // primal-dual solution
+      append_vector(this->solution.primals, this->number_variables);
+      append_vector(this->solution.multipliers.constraints, this->number_constraints);
+      append_vector(this->solution.multipliers.lower_bounds, this->number_variables);
+      append_vector(this->solution.multipliers.upper_bounds, this->number_variables);
+
+      std::ofstream stream(file_name, std::ios::binary);
+      stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
    }
 } // namespace
@@ -4,7 +4,9 @@
 #ifndef UNO_RESULT_H
 #define UNO_RESULT_H
 
+#include <array>
 #include "Iterate.hpp"
+#include "tools/MemoryUsage.hpp"
 
 namespace uno {
    struct Result {
@@ -21,8 +23,19 @@ namespace uno {
       size_t jacobian_evaluations;
       size_t hessian_evaluations;
       size_t number_subproblems_solved;
+      // memory instrumentation, in bytes: peak resident set size of the process and the high-water
+      // marks of the dominant structures (see MemoryUsage)
+      size_t peak_resident_set_bytes;
+      std::array<size_t, MemoryUsage::NUMBER_GAUGES> structure_bytes;
+      // per-constraint evaluation cost profile sampled by the model (constraint index, accumulated
+      // seconds), sorted by decreasing cost. Empty unless the instrumentation was enabled
+      std::vector<std::pair<size_t, double>> constraint_cost_profile;
 
       void print(bool print_primal_dual_solution) const;
+      // compact binary record (native endianness, single buffered write): "UNOB" magic and format
+      // version, sizes, termination status, objective, residuals, evaluation counters and the
+      // primal-dual solution. Meant for high-volume deployments that parse results downstream
+      void write_binary(const std::string& file_name) const;
    };
 } // namespace
 
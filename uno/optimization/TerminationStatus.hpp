@@ -12,7 +12,8 @@ namespace uno {
       INFEASIBLE_STATIONARY_POINT, /* infeasible stationary point of constraint violation */
       FEASIBLE_SMALL_STEP,
       INFEASIBLE_SMALL_STEP,
-      UNBOUNDED
+      UNBOUNDED,
+      FEASIBLE_ACCEPTABLE_POINT /* KKT point at the loose (acceptable) tolerance, on a plateaued solve */
    };
 } // namespace
 
@@ -0,0 +1,159 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include "BoundTightening.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/Model.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   const size_t BoundTightening::maximum_number_sweeps = 10;
+   // accepted implied bounds are relaxed by this relative margin, so that a tightened bound never
+   // cuts off a point that satisfies the linear constraints up to rounding errors
+   const double BoundTightening::tightening_margin = 1e-8;
+
+   namespace {
+      // contribution of variable variable_index to the minimal (resp. maximal) activity of a row
+      double minimal_term(double coefficient, double lower_bound, double upper_bound) {
+         return (0. < coefficient) ? coefficient * lower_bound : coefficient * upper_bound;
+      }
+
+      double maximal_term(double coefficient, double lower_bound, double upper_bound) {
+         return (0. < coefficient) ? coefficient * upper_bound : coefficient * lower_bound;
+      }
+   } // namespace
+
+   size_t BoundTightening::tighten_bounds_with_linear_constraints(const Model& model, const Vector<double>& x,
+         std::vector<double>& variable_lower_bounds, std::vector<double>& variable_upper_bounds) {
+      // start from the declared bounds
+      variable_lower_bounds.resize(model.number_variables);
+      variable_upper_bounds.resize(model.number_variables);
+      for (size_t variable_index: Range(model.number_variables)) {
+         variable_lower_bounds[variable_index] = model.variable_lower_bound(variable_index);
+         variable_upper_bounds[variable_index] = model.variable_upper_bound(variable_index);
+      }
+      const std::vector<size_t>& linear_constraints = model.get_linear_constraints();
+      if (linear_constraints.empty()) {
+         return 0;
+      }
+
+      // gather the linear rows once: the gradients of linear constraints are constant
+      std::vector<SparseVector<double>> rows;
+      rows.reserve(linear_constraints.size());
+      std::vector<double> row_lower_bounds;
+      std::vector<double> row_upper_bounds;
+      row_lower_bounds.reserve(linear_constraints.size());
+      row_upper_bounds.reserve(linear_constraints.size());
+      for (size_t constraint_index: linear_constraints) {
+         SparseVector<double> gradient(model.number_variables);
+         model.evaluate_constraint_gradient(x, constraint_index, gradient);
+         rows.emplace_back(std::move(gradient));
+         row_lower_bounds.emplace_back(model.constraint_lower_bound(constraint_index));
+         row_upper_bounds.emplace_back(model.constraint_upper_bound(constraint_index));
+      }
+
+      size_t number_tightened_bounds = 0;
+      for (size_t sweep: Range(BoundTightening::maximum_number_sweeps)) {
+         bool bounds_changed = false;
+         for (size_t row_index: Range(rows.size())) {
+            const SparseVector<double>& row = rows[row_index];
+            // activity range of the row, keeping track of infinite contributions so that a single
+            // infinite term can still be "subtracted out" for its own variable
+            double finite_minimal_activity = 0.;
+            double finite_maximal_activity = 0.;
+            size_t number_infinite_minimal_terms = 0;
+            size_t number_infinite_maximal_terms = 0;
+            for (const auto [variable_index, coefficient]: row) {
+               const double min_term = minimal_term(coefficient, variable_lower_bounds[variable_index], variable_upper_bounds[variable_index]);
+               const double max_term = maximal_term(coefficient, variable_lower_bounds[variable_index], variable_upper_bounds[variable_index]);
+               if (is_finite(min_term)) {
+                  finite_minimal_activity += min_term;
+               }
+               else {
+                  number_infinite_minimal_terms++;
+               }
+               if (is_finite(max_term)) {
+                  finite_maximal_activity += max_term;
+               }
+               else {
+                  number_infinite_maximal_terms++;
+               }
+            }
+
+            for (const auto [variable_index, coefficient]: row) {
+               if (coefficient == 0.) {
+                  continue;
+               }
+               const double min_term = minimal_term(coefficient, variable_lower_bounds[variable_index], variable_upper_bounds[variable_index]);
+               const double max_term = maximal_term(coefficient, variable_lower_bounds[variable_index], variable_upper_bounds[variable_index]);
+               // activity range of the other variables of the row
+               double residual_minimal_activity = -INF<double>;
+               if (number_infinite_minimal_terms == 0) {
+                  residual_minimal_activity = finite_minimal_activity - min_term;
+               }
+               else if (number_infinite_minimal_terms == 1 && not is_finite(min_term)) {
+                  residual_minimal_activity = finite_minimal_activity;
+               }
+               double residual_maximal_activity = INF<double>;
+               if (number_infinite_maximal_terms == 0) {
+                  residual_maximal_activity = finite_maximal_activity - max_term;
+               }
+               else if (number_infinite_maximal_terms == 1 && not is_finite(max_term)) {
+                  residual_maximal_activity = finite_maximal_activity;
+               }
+
+               // implied bounds on the variable
+               double implied_lower_bound = -INF<double>;
+               double implied_upper_bound = INF<double>;
+               if (0. < coefficient) {
+                  if (is_finite(row_upper_bounds[row_index]) && is_finite(residual_minimal_activity)) {
+                     implied_upper_bound = (row_upper_bounds[row_index] - residual_minimal_activity) / coefficient;
+                  }
+                  if (is_finite(row_lower_bounds[row_index]) && is_finite(residual_maximal_activity)) {
+                     implied_lower_bound = (row_lower_bounds[row_index] - residual_maximal_activity) / coefficient;
+                  }
+               }
+               else {
+                  if (is_finite(row_upper_bounds[row_index]) && is_finite(residual_minimal_activity)) {
+                     implied_lower_bound = (row_upper_bounds[row_index] - residual_minimal_activity) / coefficient;
+                  }
+                  if (is_finite(row_lower_bounds[row_index]) && is_finite(residual_maximal_activity)) {
+                     implied_upper_bound = (row_lower_bounds[row_index] - residual_maximal_activity) / coefficient;
+                  }
+               }
+               // relax the implied bounds by a small margin (see above)
+               if (is_finite(implied_lower_bound)) {
+                  implied_lower_bound -= BoundTightening::tightening_margin * std::max(1., std::abs(implied_lower_bound));
+               }
+               if (is_finite(implied_upper_bound)) {
+                  implied_upper_bound += BoundTightening::tightening_margin * std::max(1., std::abs(implied_upper_bound));
+               }
+
+               // accept a tightening only when the implied interval still contains points: crossed
+               // implied bounds signal (local) infeasibility, which the globalization machinery is
+               // better equipped to diagnose than a presolve pass
+               if (variable_lower_bounds[variable_index] < implied_lower_bound && implied_lower_bound <= variable_upper_bounds[variable_index]) {
+                  variable_lower_bounds[variable_index] = implied_lower_bound;
+                  number_tightened_bounds++;
+                  bounds_changed = true;
+               }
+               if (implied_upper_bound < variable_upper_bounds[variable_index] && variable_lower_bounds[variable_index] <= implied_upper_bound) {
+                  variable_upper_bounds[variable_index] = implied_upper_bound;
+                  number_tightened_bounds++;
+                  bounds_changed = true;
+               }
+            }
+         }
+         if (not bounds_changed) {
+            DEBUG << "Bound tightening reached a fixed point after " << (sweep + 1) << " sweep(s)\n";
+            break;
+         }
+      }
+      return number_tightened_bounds;
+   }
+} // namespace
@@ -0,0 +1,32 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BOUNDTIGHTENING_H
+#define UNO_BOUNDTIGHTENING_H
+
+#include <cstddef>
+#include <vector>
+
+namespace uno {
+   // forward declarations
+   class Model;
+   template <typename ElementType>
+   class Vector;
+
+   class BoundTightening {
+   public:
+      // propagate the linear constraint rows through the variable bounds (interval arithmetic):
+      // for each linear constraint and each of its variables, the activity range of the remaining
+      // variables implies a bound on that variable, which may be tighter than the declared one.
+      // The sweeps stop at a fixed point (or after maximum_number_sweeps). The routine fills the
+      // tightened bound vectors and returns the number of bounds that were strictly tightened
+      static size_t tighten_bounds_with_linear_constraints(const Model& model, const Vector<double>& x,
+            std::vector<double>& variable_lower_bounds, std::vector<double>& variable_upper_bounds);
+
+   protected:
+      const static size_t maximum_number_sweeps;
+      const static double tightening_margin;
+   };
+} // namespace
+
+#endif // UNO_BOUNDTIGHTENING_H
@@ -3,6 +3,7 @@
 
 #include "Preprocessing.hpp"
 #include "ingredients/subproblems/Direction.hpp"
+#include "linear_algebra/SymmetricIndefiniteLinearSystem.hpp"
 #include "linear_algebra/SymmetricMatrix.hpp"
 #include "linear_algebra/CSCSparseStorage.hpp"
 #include "linear_algebra/RectangularMatrix.hpp"
@@ -14,15 +15,21 @@
 #include "symbolic/VectorView.hpp"
 
 namespace uno {
-   // compute a least-square approximation of the multipliers by solving a linear system
-   void Preprocessing::compute_least_square_multipliers(const Model& model, SymmetricMatrix<size_t, double>& matrix, Vector<double>& rhs,
-         DirectSymmetricIndefiniteLinearSolver<size_t, double>& linear_solver, Iterate& current_iterate, Vector<double>& multipliers,
+   // compute a least-square approximation of the multipliers by solving a linear system. The system
+   // is assembled in the subproblem's augmented system and factorized by the subproblem's linear
+   // solver: no solver- or system-sized workspace is allocated here, and a solver that caches its
+   // analyses (e.g. MA57) reuses the symbolic factorization across repeated estimations
+   void Preprocessing::compute_least_square_multipliers(const Model& model, SymmetricIndefiniteLinearSystem<double>& augmented_system,
+         DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>& linear_solver, Iterate& current_iterate, Vector<double>& multipliers,
          double multiplier_max_norm) {
       current_iterate.evaluate_objective_gradient(model);
       current_iterate.evaluate_constraint_jacobian(model);
       DEBUG << "Computing least-square multipliers\n";
       DEBUG2 << "Current primals: " << current_iterate.primals << '\n';
 
+      SymmetricMatrix<SparseIndex, double>& matrix = augmented_system.matrix;
+      Vector<double>& rhs = augmented_system.rhs;
+
       /* generate the right-hand side */
       rhs.fill(0.);
       // objective gradient
@@ -43,7 +50,11 @@ namespace uno {
       }
 
       /* build the symmetric matrix */
+      matrix.set_dimension(model.number_variables + model.number_constraints);
       matrix.reset();
+      // the matrix is assembled outside of the incremental assembly of the augmented system: the
+      // next KKT assembly must rebuild its pattern instead of updating the values in place
+      augmented_system.invalidate_pattern();
       // identity block
       for (size_t variable_index: Range(model.number_variables)) {
          matrix.insert(1., variable_index, variable_index);
@@ -59,12 +70,11 @@ namespace uno {
       DEBUG2 << "Matrix for least-square multipliers:\n" << matrix << '\n';
 
       /* solve the system */
-      Vector<double> solution(matrix.dimension());
       linear_solver.factorize(matrix);
-      linear_solver.solve_indefinite_system(matrix, rhs, solution);
+      linear_solver.solve_indefinite_system(matrix, rhs, augmented_system.solution);
 
       // if least-square multipliers too big, discard them. Otherwise, keep them
-      const auto trial_multipliers = view(solution, model.number_variables, model.number_variables + model.number_constraints);
+      const auto trial_multipliers = view(augmented_system.solution, model.number_variables, model.number_variables + model.number_constraints);
       DEBUG2 << "Trial multipliers: "; print_vector(DEBUG2, trial_multipliers);
       if (norm_inf(trial_multipliers) <= multiplier_max_norm) {
          multipliers = trial_multipliers;
@@ -75,45 +85,69 @@ namespace uno {
       DEBUG << '\n';
    }
 
-   size_t count_infeasible_linear_constraints(const Model& model, const std::vector<double>& constraint_values) {
+   size_t count_infeasible_linear_constraints(const Model& model, const std::vector<double>& constraint_values, double tolerance) {
       size_t infeasible_linear_constraints = 0;
       for (size_t constraint_index: model.get_linear_constraints()) {
-         if (constraint_values[constraint_index] < model.constraint_lower_bound(constraint_index) ||
-             model.constraint_upper_bound(constraint_index) < constraint_values[constraint_index]) {
+         if (constraint_values[constraint_index] < model.constraint_lower_bound(constraint_index) - tolerance ||
+             model.constraint_upper_bound(constraint_index) + tolerance < constraint_values[constraint_index]) {
             infeasible_linear_constraints++;
          }
       }
       return infeasible_linear_constraints;
    }
 
-   void Preprocessing::enforce_linear_constraints(const Model& model, Vector<double>& x, Multipliers& multipliers, QPSolver& qp_solver) {
+   void Preprocessing::enforce_linear_constraints(const Model& model, Vector<double>& x, Multipliers& multipliers, QPSolver& qp_solver,
+         double tolerance) {
       const auto& linear_constraints = model.get_linear_constraints();
       INFO << "Preprocessing phase: the problem has " << linear_constraints.size() << " linear constraints\n";
       if (not linear_constraints.empty()) {
          // evaluate the constraints
          std::vector<double> constraints(model.number_constraints);
          model.evaluate_constraints(x, constraints);
-         const size_t infeasible_linear_constraints = count_infeasible_linear_constraints(model, constraints);
+         const size_t infeasible_linear_constraints = count_infeasible_linear_constraints(model, constraints, tolerance);
          INFO << "There are " << infeasible_linear_constraints << " infeasible linear constraints at the initial point\n";
          if (0 < infeasible_linear_constraints) {
-            // Hessian
-            SymmetricMatrix<size_t, double> hessian(model.number_variables, model.number_variables, false, "CSC");
-            for (size_t row_index: Range(model.number_variables)) {
-               hessian.insert(1., row_index, row_index);
-               hessian.finalize_column(row_index);
-            }
-            // constraint Jacobian
+            // constraint Jacobian, in the full variable space
             RectangularMatrix<double> constraint_jacobian(linear_constraints.size(), model.number_variables);
             for (size_t linear_constraint_index: Range(linear_constraints.size())) {
                const size_t constraint_index = linear_constraints[linear_constraint_index];
                model.evaluate_constraint_gradient(x, constraint_index, constraint_jacobian[linear_constraint_index]);
             }
+            // restrict the projection to the variables that appear in the linear constraints: the
+            // other variables do not move, so the QP dimension is the size of the sparsity pattern
+            const size_t absent = model.number_variables; // sentinel
+            std::vector<size_t> compact_indices(model.number_variables, absent);
+            std::vector<size_t> active_variables; // compact index -> original index
+            for (size_t linear_constraint_index: Range(linear_constraints.size())) {
+               for (const auto [variable_index, _]: constraint_jacobian[linear_constraint_index]) {
+                  if (compact_indices[variable_index] == absent) {
+                     compact_indices[variable_index] = active_variables.size();
+                     active_variables.push_back(variable_index);
+                  }
+               }
+            }
+            const size_t number_active_variables = active_variables.size();
+            INFO << "The projection involves " << number_active_variables << " of the " << model.number_variables << " variables\n";
+            // remap the Jacobian into the compact variable space
+            RectangularMatrix<double> compact_jacobian(linear_constraints.size(), number_active_variables);
+            for (size_t linear_constraint_index: Range(linear_constraints.size())) {
+               for (const auto [variable_index, derivative]: constraint_jacobian[linear_constraint_index]) {
+                  compact_jacobian[linear_constraint_index].insert(compact_indices[variable_index], derivative);
+               }
+            }
+            // Hessian
+            SymmetricMatrix<SparseIndex, double> hessian(number_active_variables, number_active_variables, false, "CSC");
+            for (size_t row_index: Range(number_active_variables)) {
+               hessian.insert(1., row_index, row_index);
+               hessian.finalize_column(row_index);
+            }
             // variable bounds
-            std::vector<double> variables_lower_bounds(model.number_variables);
-            std::vector<double> variables_upper_bounds(model.number_variables);
-            for (size_t variable_index: Range(model.number_variables)) {
-               variables_lower_bounds[variable_index] = model.variable_lower_bound(variable_index) - x[variable_index];
-               variables_upper_bounds[variable_index] = model.variable_upper_bound(variable_index) - x[variable_index];
+            std::vector<double> variables_lower_bounds(number_active_variables);
+            std::vector<double> variables_upper_bounds(number_active_variables);
+            for (size_t compact_index: Range(number_active_variables)) {
+               const size_t variable_index = active_variables[compact_index];
+               variables_lower_bounds[compact_index] = model.variable_lower_bound(variable_index) - x[variable_index];
+               variables_upper_bounds[compact_index] = model.variable_upper_bound(variable_index) - x[variable_index];
             }
             // constraint bounds
             std::vector<double> constraints_lower_bounds(linear_constraints.size());
@@ -125,20 +159,24 @@ namespace uno {
             }
 
             // solve the strictly convex QP
-            Vector<double> d0(model.number_variables); // = 0
+            Vector<double> d0(number_active_variables); // = 0
             SparseVector<double> linear_objective; // empty
             WarmstartInformation warmstart_information{true, true, true, true};
-            Direction direction(model.number_variables, model.number_constraints);
-            qp_solver.solve_QP(model.number_variables, linear_constraints.size(), variables_lower_bounds, variables_upper_bounds, constraints_lower_bounds,
-                  constraints_upper_bounds, linear_objective, constraint_jacobian, hessian, d0, direction, warmstart_information);
+            Direction direction(number_active_variables, linear_constraints.size());
+            qp_solver.solve_QP(number_active_variables, linear_constraints.size(), variables_lower_bounds, variables_upper_bounds,
+                  constraints_lower_bounds, constraints_upper_bounds, linear_objective, compact_jacobian, hessian, d0, direction,
+                  warmstart_information);
             if (direction.status == SubproblemStatus::INFEASIBLE) {
                throw std::runtime_error("Linear constraints cannot be satisfied at the initial point.");
             }
 
-            // take the step
-            x += direction.primals;
-            multipliers.lower_bounds += direction.multipliers.lower_bounds;
-            multipliers.upper_bounds += direction.multipliers.upper_bounds;
+            // take the step, scattered back into the full variable space
+            for (size_t compact_index: Range(number_active_variables)) {
+               const size_t variable_index = active_variables[compact_index];
+               x[variable_index] += direction.primals[compact_index];
+               multipliers.lower_bounds[variable_index] += direction.multipliers.lower_bounds[compact_index];
+               multipliers.upper_bounds[variable_index] += direction.multipliers.upper_bounds[compact_index];
+            }
             for (size_t linear_constraint_index: Range(linear_constraints.size())) {
                const size_t constraint_index = linear_constraints[linear_constraint_index];
                multipliers.constraints[constraint_index] += direction.multipliers.constraints[linear_constraint_index];
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <vector>
+#include "linear_algebra/SparseIndex.hpp"
 
 namespace uno {
    // forward declarations
@@ -15,17 +16,21 @@ namespace uno {
    class QPSolver;
    template <typename IndexType, typename ElementType>
    class DirectSymmetricIndefiniteLinearSolver;
-   template <typename IndexType, typename ElementType>
-   class SymmetricMatrix;
+   template <typename ElementType>
+   class SymmetricIndefiniteLinearSystem;
    template <typename ElementType>
    class Vector;
 
    class Preprocessing {
    public:
-      static void compute_least_square_multipliers(const Model& model, SymmetricMatrix<size_t, double>& matrix, Vector<double>& rhs,
-            DirectSymmetricIndefiniteLinearSolver<size_t, double>& linear_solver, Iterate& current_iterate, Vector<double>& multipliers,
+      // the least-squares system is assembled in the subproblem's augmented system and factorized by
+      // the subproblem's linear solver: the workspaces (matrix, rhs, solution) are shared with the
+      // iterations and the solver can retain the analysis for later estimations of the same pattern
+      static void compute_least_square_multipliers(const Model& model, SymmetricIndefiniteLinearSystem<double>& augmented_system,
+            DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>& linear_solver, Iterate& current_iterate, Vector<double>& multipliers,
             double multiplier_max_norm);
-      static void enforce_linear_constraints(const Model& model, Vector<double>& x, Multipliers& multipliers, QPSolver& qp_solver);
+      static void enforce_linear_constraints(const Model& model, Vector<double>& x, Multipliers& multipliers, QPSolver& qp_solver,
+            double tolerance);
    };
 } // namespace
 
@@ -1,6 +1,9 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <istream>
+#include <ostream>
+#include <string>
 #include "Scaling.hpp"
 #include "linear_algebra/Norm.hpp"
 #include "linear_algebra/RectangularMatrix.hpp"
@@ -9,21 +12,50 @@
 
 namespace uno {
    Scaling::Scaling(size_t number_constraints, double gradient_threshold):
-         gradient_threshold(gradient_threshold), objective_scaling(1.), constraint_scaling(number_constraints, 1.) {
+         gradient_threshold(gradient_threshold), objective_scaling(1.), constraint_scaling(number_constraints, 1.),
+         reference_gradient_norms(number_constraints, 0.) {
    }
 
    void Scaling::compute(const SparseVector<double>& objective_gradient, const RectangularMatrix<double>& constraint_jacobian) {
       // objective
-      this->objective_scaling = std::min(1., this->gradient_threshold / norm_inf(objective_gradient));
+      this->reference_objective_norm = norm_inf(objective_gradient);
+      this->objective_scaling = std::min(1., this->gradient_threshold / this->reference_objective_norm);
 
       // constraints
       for (size_t constraint_index: Range(this->constraint_scaling.size())) {
-         this->constraint_scaling[constraint_index] = std::min(1., this->gradient_threshold / norm_inf(constraint_jacobian[constraint_index]));
+         this->reference_gradient_norms[constraint_index] = norm_inf(constraint_jacobian[constraint_index]);
+         this->constraint_scaling[constraint_index] = std::min(1., this->gradient_threshold / this->reference_gradient_norms[constraint_index]);
       }
       DEBUG2 << "Objective scaling: " << this->objective_scaling << '\n';
       DEBUG2 << "Constraint scaling: "; print_vector(DEBUG2, this->constraint_scaling);
    }
 
+   bool Scaling::drifted(double gradient_norm, double reference_norm, double drift_factor) {
+      return (reference_norm * drift_factor < gradient_norm) || (gradient_norm * drift_factor < reference_norm);
+   }
+
+   size_t Scaling::update(const SparseVector<double>& objective_gradient, const RectangularMatrix<double>& constraint_jacobian, double drift_factor) {
+      size_t number_updated_factors = 0;
+      // objective
+      const double objective_norm = norm_inf(objective_gradient);
+      if (Scaling::drifted(objective_norm, this->reference_objective_norm, drift_factor)) {
+         this->objective_scaling = std::min(1., this->gradient_threshold / objective_norm);
+         this->reference_objective_norm = objective_norm;
+         number_updated_factors++;
+      }
+      // constraints: one sweep detects the drifted rows, only those get a new factor
+      for (size_t constraint_index: Range(this->constraint_scaling.size())) {
+         const double gradient_norm = norm_inf(constraint_jacobian[constraint_index]);
+         if (Scaling::drifted(gradient_norm, this->reference_gradient_norms[constraint_index], drift_factor)) {
+            this->constraint_scaling[constraint_index] = std::min(1., this->gradient_threshold / gradient_norm);
+            this->reference_gradient_norms[constraint_index] = gradient_norm;
+            number_updated_factors++;
+         }
+      }
+      DEBUG << "Incremental rescaling: " << number_updated_factors << " factors refreshed\n";
+      return number_updated_factors;
+   }
+
    double Scaling::get_objective_scaling() const {
       return this->objective_scaling;
    }
@@ -32,4 +64,39 @@ namespace uno {
       assert(constraint_index < this->constraint_scaling.size() && "The constraint index is not valid.");
       return this->constraint_scaling[constraint_index];
    }
+
+   void Scaling::write(std::ostream& stream) const {
+      stream << "uno_scaling " << this->constraint_scaling.size() << '\n';
+      stream << this->objective_scaling << '\n';
+      for (const double factor: this->constraint_scaling) {
+         stream << factor << '\n';
+      }
+   }
+
+   bool Scaling::read(std::istream& stream) {
+      std::string tag{};
+      size_t number_constraints = 0;
+      stream >> tag >> number_constraints;
+      if (tag != "uno_scaling" || number_constraints != this->constraint_scaling.size()) {
+         return false;
+      }
+      // read into copies first, so that a truncated or corrupted file leaves the factors intact
+      double new_objective_scaling = 0.;
+      std::vector<double> new_constraint_scaling(number_constraints, 0.);
+      stream >> new_objective_scaling;
+      for (double& factor: new_constraint_scaling) {
+         stream >> factor;
+      }
+      if (stream.fail() || new_objective_scaling <= 0.) {
+         return false;
+      }
+      for (const double factor: new_constraint_scaling) {
+         if (factor <= 0.) {
+            return false;
+         }
+      }
+      this->objective_scaling = new_objective_scaling;
+      this->constraint_scaling = std::move(new_constraint_scaling);
+      return true;
+   }
 } // namespace
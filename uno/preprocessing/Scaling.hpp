@@ -4,6 +4,7 @@
 #ifndef UNO_SCALING_H
 #define UNO_SCALING_H
 
+#include <iosfwd>
 #include <vector>
 #include <cstddef>
 
@@ -18,13 +19,28 @@ namespace uno {
    public:
       Scaling(size_t number_constraints, double gradient_threshold);
       void compute(const SparseVector<double>& objective_gradient, const RectangularMatrix<double>& constraint_jacobian);
+      // incremental rescaling: refresh only the factors whose gradient magnitude drifted by more
+      // than drift_factor (in ratio) since they were computed, and keep the others. The update work
+      // is proportional to the number of drifted rows. Returns the number of refreshed factors
+      size_t update(const SparseVector<double>& objective_gradient, const RectangularMatrix<double>& constraint_jacobian, double drift_factor);
       [[nodiscard]] double get_objective_scaling() const;
       [[nodiscard]] double get_constraint_scaling(size_t constraint_index) const;
 
+      // cached factors: write to/read from a plain text stream, so that repeated solves of the same
+      // family of models can skip the gradient evaluations that the factors are computed from.
+      // read returns false (and leaves the factors untouched) if the stream does not hold usable factors
+      void write(std::ostream& stream) const;
+      [[nodiscard]] bool read(std::istream& stream);
+
    protected:
       const double gradient_threshold;
       double objective_scaling;
       std::vector<double> constraint_scaling;
+      // gradient magnitudes the factors were computed from, used to detect drift
+      double reference_objective_norm{0.};
+      std::vector<double> reference_gradient_norms;
+
+      [[nodiscard]] static bool drifted(double gradient_norm, double reference_norm, double drift_factor);
    };
 } // namespace
 
@@ -18,7 +18,7 @@ namespace uno {
       void evaluate_objective_gradient(Iterate& iterate, SparseVector<double>& objective_gradient) const override;
       void evaluate_constraints(Iterate& iterate, std::vector<double>& constraints) const override;
       void evaluate_constraint_jacobian(Iterate& iterate, RectangularMatrix<double>& constraint_jacobian) const override;
-      void evaluate_lagrangian_hessian(const Vector<double>& x, const Vector<double>& multipliers, SymmetricMatrix<size_t, double>& hessian) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, const Vector<double>& multipliers, SymmetricMatrix<SparseIndex, double>& hessian) const override;
 
       [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->model.variable_lower_bound(variable_index); }
       [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->model.variable_upper_bound(variable_index); }
@@ -37,6 +37,22 @@ namespace uno {
       void evaluate_lagrangian_gradient(LagrangianGradient<double>& lagrangian_gradient, Iterate& iterate, const Multipliers& multipliers) const override;
       [[nodiscard]] double complementarity_error(const Vector<double>& primals, const std::vector<double>& constraints,
             const Multipliers& multipliers, double shift_value, Norm residual_norm) const override;
+
+   protected:
+      // incremental re-assembly state: at a fixed point, the Lagrangian gradient is linear in the
+      // multipliers, so a multiplier-only change (dual step, restoration hand-off) is applied as
+      // J^T delta_y on the cached assembly instead of a full O(nnz + n) recomputation
+      // (mutable: the cache is internal state filled by the const evaluation)
+      mutable bool has_assembled_gradient{false};
+      mutable uint64_t assembled_point_hash{0};
+      mutable LagrangianGradient<double> assembled_gradient{0};
+      mutable Vector<double> assembled_constraint_multipliers{};
+      mutable Vector<double> assembled_lower_bound_multipliers{};
+      mutable Vector<double> assembled_upper_bound_multipliers{};
+
+      [[nodiscard]] bool apply_multiplier_deltas(LagrangianGradient<double>& lagrangian_gradient, const Iterate& iterate,
+            const Multipliers& multipliers, uint64_t point_hash) const;
+      void snapshot_assembly(const LagrangianGradient<double>& lagrangian_gradient, const Multipliers& multipliers, uint64_t point_hash) const;
    };
 
    inline OptimalityProblem::OptimalityProblem(const Model& model): OptimizationProblem(model, model.number_variables, model.number_constraints) {
@@ -60,13 +76,19 @@ namespace uno {
    }
 
    inline void OptimalityProblem::evaluate_lagrangian_hessian(const Vector<double>& x, const Vector<double>& multipliers,
-         SymmetricMatrix<size_t, double>& hessian) const {
+         SymmetricMatrix<SparseIndex, double>& hessian) const {
       this->model.evaluate_lagrangian_hessian(x, this->get_objective_multiplier(), multipliers, hessian);
    }
 
    // Lagrangian gradient split in two parts: objective contribution and constraints' contribution
    inline void OptimalityProblem::evaluate_lagrangian_gradient(LagrangianGradient<double>& lagrangian_gradient, Iterate& iterate,
          const Multipliers& multipliers) const {
+      // multiplier-only change at an unchanged point: update the cached assembly incrementally
+      const uint64_t point_hash = Evaluations::hash_point(iterate.primals);
+      if (this->apply_multiplier_deltas(lagrangian_gradient, iterate, multipliers, point_hash)) {
+         return;
+      }
+
       lagrangian_gradient.objective_contribution.fill(0.);
       lagrangian_gradient.constraints_contribution.fill(0.);
 
@@ -75,20 +97,71 @@ namespace uno {
          lagrangian_gradient.objective_contribution[variable_index] += derivative;
       }
 
-      // constraints
+      // constraints: J^T y through the transposed mirror (sequential writes into the contribution)
+      iterate.evaluations.constraint_jacobian.subtract_transposed_product(multipliers.constraints,
+            lagrangian_gradient.constraints_contribution);
+
+      // bound constraints of original variables
+      for (size_t variable_index: Range(this->number_variables)) {
+         lagrangian_gradient.constraints_contribution[variable_index] -= (multipliers.lower_bounds[variable_index] +
+            multipliers.upper_bounds[variable_index]);
+      }
+
+      this->snapshot_assembly(lagrangian_gradient, multipliers, point_hash);
+   }
+
+   // incremental path of evaluate_lagrangian_gradient: when the point is the one of the cached
+   // assembly, only the multiplier changes are applied (J^T delta_y row by row plus the bound
+   // multiplier deltas), which costs O(nnz of the changed rows) instead of a full re-assembly.
+   // Returns false when no valid cached assembly exists for this point
+   inline bool OptimalityProblem::apply_multiplier_deltas(LagrangianGradient<double>& lagrangian_gradient, const Iterate& iterate,
+         const Multipliers& multipliers, uint64_t point_hash) const {
+      if (not this->has_assembled_gradient || point_hash != this->assembled_point_hash ||
+            this->assembled_gradient.size() != lagrangian_gradient.size() || not iterate.is_constraint_jacobian_computed) {
+         return false;
+      }
+      // constraint multipliers: apply the delta of each changed row through its Jacobian row
       for (size_t constraint_index: Range(this->number_constraints)) {
-         if (multipliers.constraints[constraint_index] != 0.) {
-            for (auto [variable_index, derivative]: iterate.evaluations.constraint_jacobian[constraint_index]) {
-               lagrangian_gradient.constraints_contribution[variable_index] -= multipliers.constraints[constraint_index] * derivative;
+         const double multiplier_change = multipliers.constraints[constraint_index] - this->assembled_constraint_multipliers[constraint_index];
+         if (multiplier_change != 0.) {
+            for (const auto [variable_index, derivative]: iterate.evaluations.constraint_jacobian[constraint_index]) {
+               this->assembled_gradient.constraints_contribution[variable_index] -= derivative * multiplier_change;
             }
+            this->assembled_constraint_multipliers[constraint_index] = multipliers.constraints[constraint_index];
+         }
+      }
+      // bound multipliers: direct per-variable deltas
+      for (size_t variable_index: Range(this->number_variables)) {
+         const double bound_multiplier_change = (multipliers.lower_bounds[variable_index] - this->assembled_lower_bound_multipliers[variable_index])
+               + (multipliers.upper_bounds[variable_index] - this->assembled_upper_bound_multipliers[variable_index]);
+         if (bound_multiplier_change != 0.) {
+            this->assembled_gradient.constraints_contribution[variable_index] -= bound_multiplier_change;
+            this->assembled_lower_bound_multipliers[variable_index] = multipliers.lower_bounds[variable_index];
+            this->assembled_upper_bound_multipliers[variable_index] = multipliers.upper_bounds[variable_index];
          }
       }
+      lagrangian_gradient.objective_contribution = this->assembled_gradient.objective_contribution;
+      lagrangian_gradient.constraints_contribution = this->assembled_gradient.constraints_contribution;
+      return true;
+   }
 
-      // bound constraints of original variables
+   inline void OptimalityProblem::snapshot_assembly(const LagrangianGradient<double>& lagrangian_gradient, const Multipliers& multipliers,
+         uint64_t point_hash) const {
+      this->assembled_gradient.resize(lagrangian_gradient.size());
+      this->assembled_gradient.objective_contribution = lagrangian_gradient.objective_contribution;
+      this->assembled_gradient.constraints_contribution = lagrangian_gradient.constraints_contribution;
+      this->assembled_constraint_multipliers.resize(this->number_constraints);
+      this->assembled_lower_bound_multipliers.resize(this->number_variables);
+      this->assembled_upper_bound_multipliers.resize(this->number_variables);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         this->assembled_constraint_multipliers[constraint_index] = multipliers.constraints[constraint_index];
+      }
       for (size_t variable_index: Range(this->number_variables)) {
-         lagrangian_gradient.constraints_contribution[variable_index] -= (multipliers.lower_bounds[variable_index] +
-            multipliers.upper_bounds[variable_index]);
+         this->assembled_lower_bound_multipliers[variable_index] = multipliers.lower_bounds[variable_index];
+         this->assembled_upper_bound_multipliers[variable_index] = multipliers.upper_bounds[variable_index];
       }
+      this->assembled_point_hash = point_hash;
+      this->has_assembled_gradient = true;
    }
 
    inline double OptimalityProblem::complementarity_error(const Vector<double>& primals, const std::vector<double>& constraints,
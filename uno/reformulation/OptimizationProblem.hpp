@@ -6,6 +6,7 @@
 
 #include <vector>
 #include "linear_algebra/Norm.hpp"
+#include "linear_algebra/SparseIndex.hpp"
 #include "model/Model.hpp"
 #include "optimization/LagrangianGradient.hpp"
 #include "symbolic/Expression.hpp"
@@ -40,7 +41,7 @@ namespace uno {
       virtual void evaluate_objective_gradient(Iterate& iterate, SparseVector<double>& objective_gradient) const = 0;
       virtual void evaluate_constraints(Iterate& iterate, std::vector<double>& constraints) const = 0;
       virtual void evaluate_constraint_jacobian(Iterate& iterate, RectangularMatrix<double>& constraint_jacobian) const = 0;
-      virtual void evaluate_lagrangian_hessian(const Vector<double>& x, const Vector<double>& multipliers, SymmetricMatrix<size_t, double>& hessian) const = 0;
+      virtual void evaluate_lagrangian_hessian(const Vector<double>& x, const Vector<double>& multipliers, SymmetricMatrix<SparseIndex, double>& hessian) const = 0;
 
       [[nodiscard]] size_t get_number_original_variables() const;
       [[nodiscard]] virtual double variable_lower_bound(size_t variable_index) const = 0;
@@ -52,6 +53,11 @@ namespace uno {
       [[nodiscard]] virtual const Collection<size_t>& get_single_lower_bounded_variables() const = 0;
       [[nodiscard]] virtual const Collection<size_t>& get_single_upper_bounded_variables() const = 0;
 
+      // variables that appear in a single constraint and, in the Lagrangian Hessian, only on their
+      // diagonal (slacks, elastic variables): the interior-point subproblem may eliminate them from the
+      // augmented system before factorization. Maps a constraint index onto such a variable
+      [[nodiscard]] virtual const SparseVector<size_t>& get_condensable_variables() const;
+
       [[nodiscard]] virtual size_t number_objective_gradient_nonzeros() const = 0;
       [[nodiscard]] virtual size_t number_jacobian_nonzeros() const = 0;
       [[nodiscard]] virtual size_t number_hessian_nonzeros() const = 0;
@@ -79,6 +85,11 @@ namespace uno {
       return this->model.number_variables;
    }
 
+   inline const SparseVector<size_t>& OptimizationProblem::get_condensable_variables() const {
+      // by default, only the slacks of the model qualify
+      return this->model.get_slacks();
+   }
+
    inline double OptimizationProblem::stationarity_error(const LagrangianGradient<double>& lagrangian_gradient, double objective_multiplier,
          Norm residual_norm) {
       // norm of the scaled Lagrangian gradient
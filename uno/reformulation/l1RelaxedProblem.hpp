@@ -26,7 +26,7 @@ namespace uno {
       void evaluate_objective_gradient(Iterate& iterate, SparseVector<double>& objective_gradient) const override;
       void evaluate_constraints(Iterate& iterate, std::vector<double>& constraints) const override;
       void evaluate_constraint_jacobian(Iterate& iterate, RectangularMatrix<double>& constraint_jacobian) const override;
-      void evaluate_lagrangian_hessian(const Vector<double>& x, const Vector<double>& multipliers, SymmetricMatrix<size_t, double>& hessian) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, const Vector<double>& multipliers, SymmetricMatrix<SparseIndex, double>& hessian) const override;
 
       [[nodiscard]] double variable_lower_bound(size_t variable_index) const override;
       [[nodiscard]] double variable_upper_bound(size_t variable_index) const override;
@@ -38,6 +38,8 @@ namespace uno {
       [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override;
       [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override;
 
+      [[nodiscard]] const SparseVector<size_t>& get_condensable_variables() const override;
+
       [[nodiscard]] size_t number_objective_gradient_nonzeros() const override;
       [[nodiscard]] size_t number_jacobian_nonzeros() const override;
       [[nodiscard]] size_t number_hessian_nonzeros() const override;
@@ -59,6 +61,7 @@ namespace uno {
       double proximal_coefficient;
       double const* proximal_center;
       ElasticVariables elastic_variables;
+      SparseVector<size_t> condensable_variables; // model slacks + elastic variables
       const Concatenation<const Collection<size_t>&, ForwardRange> lower_bounded_variables; // model variables + elastic variables
       const Concatenation<const Collection<size_t>&, ForwardRange> single_lower_bounded_variables; // model variables + elastic variables
 
@@ -83,11 +86,23 @@ namespace uno {
          proximal_coefficient(proximal_coefficient),
          proximal_center(proximal_center),
          elastic_variables(std::forward<ElasticVariables>(elastic_variables)),
+         condensable_variables(model.get_slacks().size() + this->elastic_variables.size()),
          // lower bounded variables are the model variables + the elastic variables
          lower_bounded_variables(concatenate(this->model.get_lower_bounded_variables(), Range(model.number_variables,
                model.number_variables + this->elastic_variables.size()))),
          single_lower_bounded_variables(concatenate(this->model.get_single_lower_bounded_variables(),
                Range(model.number_variables, model.number_variables + this->elastic_variables.size()))) {
+      // the elastic variables have identity-structured columns: like the slacks, they qualify for the
+      // condensed assembly of the augmented system
+      for (const auto [constraint_index, slack_index]: model.get_slacks()) {
+         this->condensable_variables.insert(constraint_index, slack_index);
+      }
+      for (const auto [constraint_index, elastic_index]: this->elastic_variables.positive) {
+         this->condensable_variables.insert(constraint_index, elastic_index);
+      }
+      for (const auto [constraint_index, elastic_index]: this->elastic_variables.negative) {
+         this->condensable_variables.insert(constraint_index, elastic_index);
+      }
    }
 
    inline double l1RelaxedProblem::get_objective_multiplier() const {
@@ -150,7 +165,7 @@ namespace uno {
    }
 
    inline void l1RelaxedProblem::evaluate_lagrangian_hessian(const Vector<double>& x, const Vector<double>& multipliers,
-         SymmetricMatrix<size_t, double>& hessian) const {
+         SymmetricMatrix<SparseIndex, double>& hessian) const {
       this->model.evaluate_lagrangian_hessian(x, this->objective_multiplier, multipliers, hessian);
 
       // proximal contribution
@@ -179,19 +194,25 @@ namespace uno {
          lagrangian_gradient.objective_contribution[variable_index] += derivative;
       }
 
-      // constraints
-      for (size_t constraint_index: Range(this->number_constraints)) {
-         if (multipliers.constraints[constraint_index] != 0.) {
-            for (auto [variable_index, derivative]: iterate.evaluations.constraint_jacobian[constraint_index]) {
-               lagrangian_gradient.constraints_contribution[variable_index] -= multipliers.constraints[constraint_index] * derivative;
-            }
+      // constraints: J^T y through the transposed mirror (sequential writes into the contribution)
+      iterate.evaluations.constraint_jacobian.subtract_transposed_product(multipliers.constraints,
+            lagrangian_gradient.constraints_contribution);
+
+      // bound constraints of original variables, fused with the proximal contribution: a single
+      // sweep over the model variables instead of two
+      if (this->proximal_center != nullptr && this->proximal_coefficient != 0.) {
+         for (size_t variable_index: Range(this->model.number_variables)) {
+            const double scaling = std::min(1., 1./std::abs(this->proximal_center[variable_index]));
+            const double proximal_term = this->proximal_coefficient * scaling * scaling;
+            lagrangian_gradient.constraints_contribution[variable_index] += proximal_term * (iterate.primals[variable_index] -
+               this->proximal_center[variable_index]) - (multipliers.lower_bounds[variable_index] + multipliers.upper_bounds[variable_index]);
          }
       }
-
-      // bound constraints of original variables
-      for (size_t variable_index: Range(this->model.number_variables)) {
-         lagrangian_gradient.constraints_contribution[variable_index] -= (multipliers.lower_bounds[variable_index] +
-            multipliers.upper_bounds[variable_index]);
+      else {
+         for (size_t variable_index: Range(this->model.number_variables)) {
+            lagrangian_gradient.constraints_contribution[variable_index] -= (multipliers.lower_bounds[variable_index] +
+               multipliers.upper_bounds[variable_index]);
+         }
       }
 
       // elastic variables
@@ -203,16 +224,6 @@ namespace uno {
          lagrangian_gradient.constraints_contribution[elastic_index] += this->constraint_violation_coefficient -
                multipliers.constraints[constraint_index] - multipliers.lower_bounds[elastic_index];
       }
-
-      // proximal contribution
-      if (this->proximal_center != nullptr && this->proximal_coefficient != 0.) {
-         for (size_t variable_index: Range(this->model.number_variables)) {
-            const double scaling = std::min(1., 1./std::abs(this->proximal_center[variable_index]));
-            const double proximal_term = this->proximal_coefficient * scaling * scaling;
-            lagrangian_gradient.constraints_contribution[variable_index] += proximal_term * (iterate.primals[variable_index] -
-               this->proximal_center[variable_index]);
-         }
-      }
    }
 
    // complementary slackness error: expression for violated constraints depends on the definition of the relaxed problem
@@ -273,6 +284,10 @@ namespace uno {
       return this->model.constraint_upper_bound(constraint_index);
    }
 
+   inline const SparseVector<size_t>& l1RelaxedProblem::get_condensable_variables() const {
+      return this->condensable_variables;
+   }
+
    inline const Collection<size_t>& l1RelaxedProblem::get_lower_bounded_variables() const {
       return this->lower_bounded_variables;
    }
@@ -9,6 +9,7 @@
 #include "linear_algebra/SymmetricMatrix.hpp"
 #include "linear_algebra/Vector.hpp"
 #include "optimization/WarmstartInformation.hpp"
+#include "tools/Deadline.hpp"
 #include "tools/Infinity.hpp"
 #include "tools/Logger.hpp"
 #include "tools/Options.hpp"
@@ -63,7 +64,7 @@ namespace uno {
    void BQPDSolver::solve_QP(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
          const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
          const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
-         const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<size_t, double>& hessian, const Vector<double>& initial_point,
+         const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<SparseIndex, double>& hessian, const Vector<double>& initial_point,
          Direction& direction, const WarmstartInformation& warmstart_information) {
       if (warmstart_information.objective_changed || warmstart_information.constraints_changed) {
          this->save_hessian_to_local_format(hessian);
@@ -93,6 +94,8 @@ namespace uno {
          const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
          const RectangularMatrix<double>& constraint_jacobian, const Vector<double>& initial_point, Direction& direction,
          const WarmstartInformation& warmstart_information) {
+      // last cancellation point before entering BQPD, which cannot be interrupted
+      Deadline::check();
       // initialize wsc_ common block (Hessian & workspace for BQPD)
       // setting the common block here ensures that several instances of BQPD can run simultaneously
       wsc_.kk = static_cast<int>(this->number_hessian_nonzeros);
@@ -139,41 +142,109 @@ namespace uno {
       const int m = static_cast<int>(number_constraints);
 
       const BQPDMode mode = this->determine_mode(warmstart_information);
-      const int mode_integer = static_cast<int>(mode);
+      int mode_integer = static_cast<int>(mode);
 
       // solve the LP/QP
       bqpd_(&n, &m, &this->k, &this->kmax, this->jacobian.data(), this->jacobian_sparsity.data(), direction.primals.data(), this->lb.data(),
             this->ub.data(), &direction.subproblem_objective, &this->fmin, this->gradient_solution.data(), this->residuals.data(), this->w.data(),
             this->e.data(), this->active_set.data(), this->alp.data(), this->lp.data(), &this->mlp, &this->peq_solution, this->hessian_values.data(),
             this->hessian_sparsity.data(), &mode_integer, &this->ifail, this->info.data(), &this->iprint, &this->nout);
-      const BQPDStatus bqpd_status = BQPDSolver::bqpd_status_from_int(this->ifail);
-      direction.status = BQPDSolver::status_from_bqpd_status(bqpd_status);
+      BQPDStatus bqpd_status = BQPDSolver::bqpd_status_from_int(this->ifail);
       this->number_calls++;
 
+      // an incremental resolve may fail when the reused factors turned stale: fall back to a single cold start
+      if (mode != BQPDMode::ACTIVE_SET_EQUALITIES && BQPDSolver::status_from_bqpd_status(bqpd_status) == SubproblemStatus::ERROR) {
+         DEBUG << "BQPD warm start failed (ifail = " << this->ifail << "), solving from scratch\n";
+         direction.primals = initial_point;
+         mode_integer = static_cast<int>(BQPDMode::ACTIVE_SET_EQUALITIES);
+         bqpd_(&n, &m, &this->k, &this->kmax, this->jacobian.data(), this->jacobian_sparsity.data(), direction.primals.data(), this->lb.data(),
+               this->ub.data(), &direction.subproblem_objective, &this->fmin, this->gradient_solution.data(), this->residuals.data(), this->w.data(),
+               this->e.data(), this->active_set.data(), this->alp.data(), this->lp.data(), &this->mlp, &this->peq_solution, this->hessian_values.data(),
+               this->hessian_sparsity.data(), &mode_integer, &this->ifail, this->info.data(), &this->iprint, &this->nout);
+         bqpd_status = BQPDSolver::bqpd_status_from_int(this->ifail);
+         this->number_calls++;
+      }
+      this->previous_solve_succeeded = (bqpd_status == BQPDStatus::OPTIMAL);
+      this->working_set_estimate_loaded = false;
+      direction.status = BQPDSolver::status_from_bqpd_status(bqpd_status);
+
       // project solution into bounds
       for (size_t variable_index: Range(number_variables)) {
          direction.primals[variable_index] = std::min(std::max(direction.primals[variable_index], variables_lower_bounds[variable_index]),
                variables_upper_bounds[variable_index]);
       }
+
+      // sparse view of the direction: late active-set iterations often move only a small fraction of
+      // the variables (the rest stays at its bounds), and the dense downstream sweeps (trial-point
+      // assembly, step norm) can then visit the moved entries only
+      direction.moved_variables.reset();
+      size_t number_moved_variables = 0;
+      for (size_t variable_index: Range(number_variables)) {
+         if (direction.primals[variable_index] != 0.) {
+            number_moved_variables++;
+         }
+      }
+      if (static_cast<double>(number_moved_variables) <=
+            BQPDSolver::moved_variables_density_threshold * static_cast<double>(number_variables)) {
+         direction.moved_variables.emplace();
+         direction.moved_variables->reserve(number_moved_variables);
+         for (size_t variable_index: Range(number_variables)) {
+            if (direction.primals[variable_index] != 0.) {
+               direction.moved_variables->push_back(variable_index);
+            }
+         }
+      }
       this->categorize_constraints(number_variables, direction);
    }
 
    BQPDMode BQPDSolver::determine_mode(const WarmstartInformation& warmstart_information) const {
       BQPDMode mode = (this->number_calls == 0) ? BQPDMode::ACTIVE_SET_EQUALITIES : BQPDMode::USER_DEFINED;
-      // if problem changed, use cold start
-      if (warmstart_information.problem_changed) {
-         mode = BQPDMode::ACTIVE_SET_EQUALITIES;
+      // if the problem changed or the previous solve did not terminate cleanly, the factorizations have to be
+      // rebuilt. A cached working set estimate, if available, still seeds the combinatorial search
+      if (warmstart_information.problem_changed || not this->previous_solve_succeeded) {
+         mode = this->working_set_estimate_loaded ? BQPDMode::USER_DEFINED : BQPDMode::ACTIVE_SET_EQUALITIES;
       }
-         // if only the variable bounds changed, reuse the active set estimate and the Jacobian information
+         // if only the variable bounds changed (e.g. a trust-region radius update), resolve incrementally: the
+         // objective, Jacobian and Hessian are untouched, so the factorizations of the active-set basis and of
+         // the reduced Hessian from the previous call are still valid and can be reused as they are
       else if (warmstart_information.variable_bounds_changed && not warmstart_information.objective_changed &&
                not warmstart_information.constraints_changed && not warmstart_information.constraint_bounds_changed) {
-         mode = BQPDMode::UNCHANGED_ACTIVE_SET_AND_JACOBIAN;
+         mode = BQPDMode::UNCHANGED_ACTIVE_SET_AND_JACOBIAN_AND_REDUCED_HESSIAN;
       }
       return mode;
    }
 
+   void BQPDSolver::get_working_set(std::vector<int>& working_set) const {
+      working_set.assign(this->active_set.cbegin(), this->active_set.cend());
+   }
+
+   void BQPDSolver::load_working_set_estimate(const std::vector<int>& working_set) {
+      // only accept an estimate recorded from a problem with the same layout
+      if (working_set.size() == this->active_set.size()) {
+         std::copy(working_set.cbegin(), working_set.cend(), this->active_set.begin());
+         this->working_set_estimate_loaded = true;
+      }
+   }
+
    // save Hessian (in arbitrary format) to a "weak" CSC format: compressed columns but row indices are not sorted, nor unique
-   void BQPDSolver::save_hessian_to_local_format(const SymmetricMatrix<size_t, double>& hessian) {
+   void BQPDSolver::save_hessian_to_local_format(const SymmetricMatrix<SparseIndex, double>& hessian) {
+      // fast path: the index shift is deterministic given the pattern. When the pattern is unchanged
+      // from the previous call (the usual case across SQP iterations), the cached destination slots
+      // are reused and only the values are refreshed, in a single pass
+      if (this->hessian_pattern_cached && hessian.number_nonzeros() == this->cached_hessian_rows.size()) {
+         size_t nonzero_index = 0;
+         bool pattern_unchanged = true;
+         hessian.for_each([&](SparseIndex row_index, SparseIndex column_index, double element) {
+            pattern_unchanged = pattern_unchanged && row_index == this->cached_hessian_rows[nonzero_index] &&
+               column_index == this->cached_hessian_columns[nonzero_index];
+            this->hessian_values[static_cast<size_t>(this->hessian_slot_of_nonzero[nonzero_index])] = element;
+            nonzero_index++;
+         });
+         if (pattern_unchanged) {
+            return;
+         }
+         DEBUG << "BQPD: the Hessian pattern changed, rebuilding the local format\n";
+      }
       const size_t header_size = 1;
       // pointers withing the single array
       int* row_indices = &this->hessian_sparsity[header_size];
@@ -193,9 +264,12 @@ namespace uno {
          column_starts[column_index - 1] += this->fortran_shift;
       }
       column_starts[hessian.dimension()] += this->fortran_shift;
-      // copy the entries
-      //std::vector<int> current_indices(hessian.dimension());
+      // copy the entries and record the translated pattern for the fast path of the next calls
+      this->hessian_slot_of_nonzero.resize(hessian.number_nonzeros());
+      this->cached_hessian_rows.resize(hessian.number_nonzeros());
+      this->cached_hessian_columns.resize(hessian.number_nonzeros());
       this->current_hessian_indices.fill(0);
+      size_t nonzero_index = 0;
       for (const auto [row_index, column_index, element]: hessian) {
          const size_t index = static_cast<size_t>(column_starts[column_index] + this->current_hessian_indices[column_index] - this->fortran_shift);
          assert(index <= static_cast<size_t>(column_starts[column_index + 1]) &&
@@ -203,7 +277,12 @@ namespace uno {
          this->hessian_values[index] = element;
          row_indices[index] = static_cast<int>(row_index) + this->fortran_shift;
          this->current_hessian_indices[column_index]++;
+         this->hessian_slot_of_nonzero[nonzero_index] = static_cast<int>(index);
+         this->cached_hessian_rows[nonzero_index] = row_index;
+         this->cached_hessian_columns[nonzero_index] = column_index;
+         nonzero_index++;
       }
+      this->hessian_pattern_cached = true;
    }
 
    void BQPDSolver::save_gradients_to_local_format(size_t number_constraints, const SparseVector<double>& linear_objective,
@@ -39,7 +39,7 @@ namespace uno {
 
    enum class BQPDProblemType {LP, QP};
 
-   class BQPDSolver : public QPSolver {
+   class BQPDSolver final : public QPSolver {
    public:
       BQPDSolver(size_t number_variables, size_t number_constraints, size_t number_objective_gradient_nonzeros, size_t number_jacobian_nonzeros,
             size_t number_hessian_nonzeros, BQPDProblemType problem_type, const Options& options);
@@ -53,9 +53,12 @@ namespace uno {
       void solve_QP(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
             const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
             const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
-            const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<size_t, double>& hessian, const Vector<double>& initial_point,
+            const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<SparseIndex, double>& hessian, const Vector<double>& initial_point,
             Direction& direction, const WarmstartInformation& warmstart_information) override;
 
+      void get_working_set(std::vector<int>& working_set) const override;
+      void load_working_set_estimate(const std::vector<int>& working_set) override;
+
    private:
       const size_t number_hessian_nonzeros;
       std::vector<double> lb{}, ub{}; // lower and upper bounds of variables and constraints
@@ -79,9 +82,23 @@ namespace uno {
       int peq_solution{0}, ifail{0};
       const int fortran_shift{1};
       Vector<int> current_hessian_indices{};
+      // cached Fortran translation of the Hessian pattern: destination slot of every nonzero (in
+      // iteration order) and the (row, column) pair it was computed for. As long as the pattern is
+      // unchanged from one call to the next, only the values are refreshed
+      std::vector<int> hessian_slot_of_nonzero{};
+      std::vector<SparseIndex> cached_hessian_rows{}, cached_hessian_columns{};
+      bool hessian_pattern_cached{false};
 
       size_t number_calls{0};
+      // whether the previous call terminated cleanly, i.e. whether its basis and reduced-Hessian
+      // factorizations can be reused for an incremental resolve
+      bool previous_solve_succeeded{false};
+      // whether a working set estimate was loaded since the last call, via load_working_set_estimate()
+      bool working_set_estimate_loaded{false};
       const bool print_subproblem;
+      // the sparse view of the direction is produced only when it is genuinely sparse: below this
+      // fraction of moved variables, the downstream sweeps are worth restricting to the moved entries
+      static constexpr double moved_variables_density_threshold{0.1};
 
       void solve_subproblem(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
             const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
@@ -89,7 +106,7 @@ namespace uno {
             const RectangularMatrix<double>& constraint_jacobian, const Vector<double>& initial_point, Direction& direction,
             const WarmstartInformation& warmstart_information);
       void categorize_constraints(size_t number_variables, Direction& direction);
-      void save_hessian_to_local_format(const SymmetricMatrix<size_t, double>& hessian);
+      void save_hessian_to_local_format(const SymmetricMatrix<SparseIndex, double>& hessian);
       void save_gradients_to_local_format(size_t number_constraints, const SparseVector<double>& linear_objective,
             const RectangularMatrix<double>& constraint_jacobian);
       [[nodiscard]] BQPDMode determine_mode(const WarmstartInformation& warmstart_information) const;
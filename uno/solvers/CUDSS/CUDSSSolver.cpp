@@ -0,0 +1,196 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include "CUDSSSolver.hpp"
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   namespace {
+      void check_cuda(cudaError_t status, const char* operation) {
+         if (status != cudaSuccess) {
+            throw std::runtime_error(std::string("CUDSSSolver: CUDA error in ") + operation + ": " + cudaGetErrorString(status));
+         }
+      }
+
+      void check_cudss(cudssStatus_t status, const char* operation) {
+         if (status != CUDSS_STATUS_SUCCESS) {
+            throw std::runtime_error(std::string("CUDSSSolver: cuDSS error in ") + operation + " (status " +
+                  std::to_string(static_cast<int>(status)) + ")");
+         }
+      }
+   }
+
+   CUDSSSolver::CUDSSSolver(size_t dimension, size_t number_nonzeros) : DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>(dimension),
+         row_starts(dimension + 1) {
+      this->column_indices.reserve(number_nonzeros);
+      this->values.reserve(number_nonzeros);
+
+      // device buffers at the maximal sizes, allocated once
+      check_cuda(cudaMalloc(reinterpret_cast<void**>(&this->device_row_starts), (dimension + 1) * sizeof(int)), "cudaMalloc");
+      check_cuda(cudaMalloc(reinterpret_cast<void**>(&this->device_column_indices), std::max<size_t>(number_nonzeros, 1) * sizeof(int)), "cudaMalloc");
+      check_cuda(cudaMalloc(reinterpret_cast<void**>(&this->device_values), std::max<size_t>(number_nonzeros, 1) * sizeof(double)), "cudaMalloc");
+      check_cuda(cudaMalloc(reinterpret_cast<void**>(&this->device_rhs), std::max<size_t>(dimension, 1) * sizeof(double)), "cudaMalloc");
+      check_cuda(cudaMalloc(reinterpret_cast<void**>(&this->device_solution), std::max<size_t>(dimension, 1) * sizeof(double)), "cudaMalloc");
+
+      check_cudss(cudssCreate(&this->handle), "cudssCreate");
+      check_cudss(cudssConfigCreate(&this->config), "cudssConfigCreate");
+      check_cudss(cudssDataCreate(this->handle, &this->data), "cudssDataCreate");
+   }
+
+   CUDSSSolver::~CUDSSSolver() {
+      if (this->matrix_handles_created) {
+         cudssMatrixDestroy(this->matrix_handle);
+         cudssMatrixDestroy(this->rhs_handle);
+         cudssMatrixDestroy(this->solution_handle);
+      }
+      cudssDataDestroy(this->handle, this->data);
+      cudssConfigDestroy(this->config);
+      cudssDestroy(this->handle);
+      cudaFree(this->device_row_starts);
+      cudaFree(this->device_column_indices);
+      cudaFree(this->device_values);
+      cudaFree(this->device_rhs);
+      cudaFree(this->device_solution);
+   }
+
+   void CUDSSSolver::factorize(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      this->do_symbolic_factorization(matrix);
+      this->do_numerical_factorization(matrix);
+   }
+
+   void CUDSSSolver::do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      assert(matrix.dimension() <= this->dimension && "CUDSSSolver: the dimension of the matrix is larger than the preallocated size");
+      assert(matrix.number_nonzeros() <= this->column_indices.capacity() &&
+             "CUDSSSolver: the number of nonzeros of the matrix is larger than the preallocated size");
+
+      this->build_csr(matrix);
+      this->upload_pattern_and_create_handles();
+
+      check_cudss(cudssExecute(this->handle, CUDSS_PHASE_ANALYSIS, this->config, this->data, this->matrix_handle, this->solution_handle,
+            this->rhs_handle), "cudssExecute(analysis)");
+   }
+
+   void CUDSSSolver::do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      assert(static_cast<int>(matrix.number_nonzeros()) == this->current_nnz && "CUDSSSolver: the numbers of nonzeros do not match");
+
+      // refresh the values with the same scatter as build_csr (the pattern is unchanged since the analysis)
+      const size_t n = static_cast<size_t>(this->current_n);
+      std::vector<int> row_offsets(this->row_starts.begin(), this->row_starts.begin() + static_cast<long>(n));
+      matrix.for_each([&](size_t row_index, size_t column_index, double element) {
+         const size_t lower_row = std::max(row_index, column_index);
+         this->values[static_cast<size_t>(row_offsets[lower_row])] = element;
+         row_offsets[lower_row]++;
+      });
+      this->upload_values();
+
+      this->factorization_failed = false;
+      const cudssStatus_t status = cudssExecute(this->handle, CUDSS_PHASE_FACTORIZATION, this->config, this->data, this->matrix_handle,
+            this->solution_handle, this->rhs_handle);
+      if (status != CUDSS_STATUS_SUCCESS) {
+         WARNING << "CUDSSSolver: the numerical factorization failed (status " << static_cast<int>(status) << ")\n";
+         this->factorization_failed = true;
+         return;
+      }
+      this->query_inertia();
+   }
+
+   void CUDSSSolver::solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs, Vector<double>& result) {
+      assert(not this->factorization_failed && "CUDSSSolver: solving against a failed factorization");
+      const size_t n = matrix.dimension();
+
+      check_cuda(cudaMemcpy(this->device_rhs, rhs.data(), n * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy(rhs)");
+      check_cudss(cudssExecute(this->handle, CUDSS_PHASE_SOLVE, this->config, this->data, this->matrix_handle, this->solution_handle,
+            this->rhs_handle), "cudssExecute(solve)");
+      check_cuda(cudaMemcpy(result.data(), this->device_solution, n * sizeof(double), cudaMemcpyDeviceToHost), "cudaMemcpy(solution)");
+   }
+
+   std::tuple<size_t, size_t, size_t> CUDSSSolver::get_inertia() const {
+      const size_t number_positive_eigenvalues = static_cast<size_t>(this->inertia[0]);
+      const size_t number_negative_eigenvalues = static_cast<size_t>(this->inertia[1]);
+      const size_t number_zero_eigenvalues = static_cast<size_t>(this->current_n) - number_positive_eigenvalues - number_negative_eigenvalues;
+      return std::make_tuple(number_positive_eigenvalues, number_negative_eigenvalues, number_zero_eigenvalues);
+   }
+
+   size_t CUDSSSolver::number_negative_eigenvalues() const {
+      return static_cast<size_t>(this->inertia[1]);
+   }
+
+   bool CUDSSSolver::matrix_is_singular() const {
+      return this->factorization_failed || this->rank() < static_cast<size_t>(this->current_n);
+   }
+
+   size_t CUDSSSolver::rank() const {
+      return static_cast<size_t>(this->inertia[0] + this->inertia[1]);
+   }
+
+   // convert the lower triangle from the assembly format to CSR (rows sorted, columns within a row
+   // in increasing order). cuDSS interprets (row, column) with column <= row as the lower view
+   void CUDSSSolver::build_csr(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      const size_t n = matrix.dimension();
+      const size_t nnz = matrix.number_nonzeros();
+      this->current_n = static_cast<int>(n);
+      this->current_nnz = static_cast<int>(nnz);
+
+      // count the entries of each row (entries are stored in the lower triangle: row >= column)
+      std::fill(this->row_starts.begin(), this->row_starts.begin() + static_cast<long>(n) + 1, 0);
+      matrix.for_each([&](size_t row_index, size_t column_index, double /*element*/) {
+         const size_t lower_row = std::max(row_index, column_index);
+         this->row_starts[lower_row + 1]++;
+      });
+      for (size_t row_index = 0; row_index < n; row_index++) {
+         this->row_starts[row_index + 1] += this->row_starts[row_index];
+      }
+      // scatter the entries into their rows
+      this->column_indices.resize(nnz);
+      this->values.resize(nnz);
+      std::vector<int> row_offsets(this->row_starts.begin(), this->row_starts.begin() + static_cast<long>(n));
+      matrix.for_each([&](size_t row_index, size_t column_index, double element) {
+         const size_t lower_row = std::max(row_index, column_index);
+         const size_t lower_column = std::min(row_index, column_index);
+         const int position = row_offsets[lower_row];
+         this->column_indices[static_cast<size_t>(position)] = static_cast<int>(lower_column);
+         this->values[static_cast<size_t>(position)] = element;
+         row_offsets[lower_row]++;
+      });
+   }
+
+   void CUDSSSolver::upload_pattern_and_create_handles() {
+      const size_t n = static_cast<size_t>(this->current_n);
+      const size_t nnz = static_cast<size_t>(this->current_nnz);
+      check_cuda(cudaMemcpy(this->device_row_starts, this->row_starts.data(), (n + 1) * sizeof(int), cudaMemcpyHostToDevice),
+            "cudaMemcpy(row starts)");
+      check_cuda(cudaMemcpy(this->device_column_indices, this->column_indices.data(), nnz * sizeof(int), cudaMemcpyHostToDevice),
+            "cudaMemcpy(column indices)");
+
+      // (re)create the matrix handles: the dimensions may have changed between phases
+      if (this->matrix_handles_created) {
+         cudssMatrixDestroy(this->matrix_handle);
+         cudssMatrixDestroy(this->rhs_handle);
+         cudssMatrixDestroy(this->solution_handle);
+      }
+      check_cudss(cudssMatrixCreateCsr(&this->matrix_handle, this->current_n, this->current_n, this->current_nnz, this->device_row_starts,
+            nullptr, this->device_column_indices, this->device_values, CUDA_R_32I, CUDA_R_64F, CUDSS_MTYPE_SYMMETRIC, CUDSS_MVIEW_LOWER,
+            CUDSS_BASE_ZERO), "cudssMatrixCreateCsr");
+      check_cudss(cudssMatrixCreateDn(&this->rhs_handle, this->current_n, 1, this->current_n, this->device_rhs, CUDA_R_64F,
+            CUDSS_LAYOUT_COL_MAJOR), "cudssMatrixCreateDn(rhs)");
+      check_cudss(cudssMatrixCreateDn(&this->solution_handle, this->current_n, 1, this->current_n, this->device_solution, CUDA_R_64F,
+            CUDSS_LAYOUT_COL_MAJOR), "cudssMatrixCreateDn(solution)");
+      this->matrix_handles_created = true;
+   }
+
+   void CUDSSSolver::upload_values() {
+      check_cuda(cudaMemcpy(this->device_values, this->values.data(), static_cast<size_t>(this->current_nnz) * sizeof(double),
+            cudaMemcpyHostToDevice), "cudaMemcpy(values)");
+   }
+
+   void CUDSSSolver::query_inertia() const {
+      size_t size_written = 0;
+      check_cudss(cudssDataGet(this->handle, this->data, CUDSS_DATA_INERTIA, this->inertia.data(), sizeof(this->inertia), &size_written),
+            "cudssDataGet(inertia)");
+   }
+} // namespace
@@ -0,0 +1,79 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_CUDSSSOLVER_H
+#define UNO_CUDSSSOLVER_H
+
+#include <array>
+#include <vector>
+#include <cuda_runtime.h>
+#include <cudss.h>
+#include "solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+
+namespace uno {
+   // forward declaration
+   template <typename ElementType>
+   class Vector;
+
+   /*! \class CUDSSSolver
+    * \brief Interface for NVIDIA cuDSS
+    *
+    * GPU-offloaded symmetric indefinite factorization and triangular solves. The lower triangle of
+    * the KKT matrix is converted to CSR on the host and uploaded to the device; analysis,
+    * factorization and solves run on the GPU
+    */
+   class CUDSSSolver final : public DirectSymmetricIndefiniteLinearSolver<SparseIndex, double> {
+   public:
+      CUDSSSolver(size_t dimension, size_t number_nonzeros);
+      ~CUDSSSolver() override;
+
+      // no copies: the instance owns device allocations and library handles
+      CUDSSSolver(const CUDSSSolver&) = delete;
+      CUDSSSolver& operator=(const CUDSSSolver&) = delete;
+
+      void factorize(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs, Vector<double>& result) override;
+
+      [[nodiscard]] std::tuple<size_t, size_t, size_t> get_inertia() const override;
+      [[nodiscard]] size_t number_negative_eigenvalues() const override;
+      [[nodiscard]] bool matrix_is_singular() const override;
+      [[nodiscard]] size_t rank() const override;
+
+   private:
+      // host CSR representation of the lower triangle
+      std::vector<int> row_starts;
+      std::vector<int> column_indices;
+      std::vector<double> values;
+      int current_n{0};
+      int current_nnz{0};
+
+      // device buffers (preallocated at the maximal sizes)
+      int* device_row_starts{nullptr};
+      int* device_column_indices{nullptr};
+      double* device_values{nullptr};
+      double* device_rhs{nullptr};
+      double* device_solution{nullptr};
+
+      // cuDSS handles
+      cudssHandle_t handle{};
+      cudssConfig_t config{};
+      cudssData_t data{};
+      cudssMatrix_t matrix_handle{};
+      cudssMatrix_t rhs_handle{};
+      cudssMatrix_t solution_handle{};
+      bool matrix_handles_created{false};
+
+      // inertia of the last factorization: (positive, negative) eigenvalue counts
+      mutable std::array<int64_t, 2> inertia{};
+      bool factorization_failed{false};
+
+      void build_csr(const SymmetricMatrix<SparseIndex, double>& matrix);
+      void upload_pattern_and_create_handles();
+      void upload_values();
+      void query_inertia() const;
+   };
+} // namespace
+
+#endif // UNO_CUDSSSOLVER_H
@@ -4,7 +4,9 @@
 #ifndef UNO_DIRECTSYMMETRICINDEFINITELINEARSOLVER_H
 #define UNO_DIRECTSYMMETRICINDEFINITELINEARSOLVER_H
 
+#include "linear_algebra/Vector.hpp"
 #include "solvers/SymmetricIndefiniteLinearSolver.hpp"
+#include "symbolic/Range.hpp"
 
 namespace uno {
    template <typename IndexType, typename ElementType>
@@ -17,6 +19,53 @@ namespace uno {
       virtual void do_symbolic_factorization(const SymmetricMatrix<IndexType, ElementType>& matrix) = 0;
       virtual void do_numerical_factorization(const SymmetricMatrix<IndexType, ElementType>& matrix) = 0;
 
+      // numerical refactorization after a diagonal-only update (regularization shift): the sparsity
+      // pattern is unchanged, so the analysis of the previous factorization is reused and the pattern
+      // is not saved again. Solvers that keep a local copy of the values override this method
+      virtual void factorize_with_shift(const SymmetricMatrix<IndexType, ElementType>& matrix) {
+         this->do_numerical_factorization(matrix);
+      }
+
+      // solve several right-hand sides against the same factorization. The blocks are stored column by
+      // column: the i-th system occupies the entries [i*dimension, (i+1)*dimension) of each block.
+      // Generic version: one solve per column. Solvers that support blocked solves (a single pass over
+      // the triangular factors for all the right-hand sides) override this method
+      virtual void solve_indefinite_systems(const SymmetricMatrix<IndexType, ElementType>& matrix, const Vector<ElementType>& rhs_block,
+            Vector<ElementType>& result_block, size_t number_systems) {
+         Vector<ElementType> rhs(this->dimension);
+         Vector<ElementType> result(this->dimension);
+         for (size_t system_index: Range(number_systems)) {
+            const size_t offset = system_index * this->dimension;
+            for (size_t row_index: Range(this->dimension)) {
+               rhs[row_index] = rhs_block[offset + row_index];
+            }
+            this->solve_indefinite_system(matrix, rhs, result);
+            for (size_t row_index: Range(this->dimension)) {
+               result_block[offset + row_index] = result[row_index];
+            }
+         }
+      }
+
+      // forecast of the number of entries in the factors, available after the symbolic
+      // factorization. Solvers whose analysis does not report a prediction return 0
+      [[nodiscard]] virtual size_t expected_number_factor_entries() const {
+         return 0;
+      }
+
+      // forecast of the factorization memory in bytes, available after the symbolic factorization.
+      // Used to size the workspace once and to abort with a clear diagnostic before a factorization
+      // that cannot fit in memory, rather than OOM mid-solve. The generic version covers the real
+      // factor storage only; solvers whose analysis reports a fuller estimate override it
+      [[nodiscard]] virtual size_t expected_factor_memory_bytes() const {
+         return this->expected_number_factor_entries() * sizeof(ElementType);
+      }
+
+      // requested accuracy of the solves: direct factorizations solve to machine precision and
+      // ignore it, the iterative solvers (MINRES) stop at the given residual tolerance
+      virtual void set_solve_tolerance(ElementType /*tolerance*/) {
+         // do nothing
+      }
+
       [[nodiscard]] virtual std::tuple<size_t, size_t, size_t> get_inertia() const = 0;
       [[nodiscard]] virtual size_t number_negative_eigenvalues() const = 0;
       // [[nodiscard]] virtual bool matrix_is_positive_definite() const = 0;
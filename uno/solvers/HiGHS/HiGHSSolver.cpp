@@ -0,0 +1,231 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cassert>
+#include "HiGHSSolver.hpp"
+#include "ingredients/subproblems/Direction.hpp"
+#include "linear_algebra/RectangularMatrix.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/WarmstartInformation.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+#include "interfaces/highs_c_api.h"
+
+namespace uno {
+   // bounds beyond the HiGHS infinite_bound threshold are treated as infinite
+   #define HIGHS_INFINITY 1e30
+
+   HiGHSSolver::HiGHSSolver(size_t number_variables, size_t number_constraints, size_t number_objective_gradient_nonzeros,
+         size_t number_jacobian_nonzeros, const Options& options):
+         LPSolver(),
+         column_costs(number_variables),
+         column_lower_bounds(number_variables),
+         column_upper_bounds(number_variables),
+         row_lower_bounds(number_constraints),
+         row_upper_bounds(number_constraints),
+         column_basis(number_variables),
+         row_basis(number_constraints),
+         print_subproblem(options.get_bool("BQPD_print_subproblem")) {
+      this->column_starts.reserve(number_variables + 1);
+      this->row_indices.reserve(number_jacobian_nonzeros + number_objective_gradient_nonzeros);
+      this->matrix_entries.reserve(number_jacobian_nonzeros + number_objective_gradient_nonzeros);
+
+      this->highs = Highs_create();
+      Highs_setBoolOptionValue(this->highs, "output_flag", 0);
+      // LP subproblems: dual simplex, the method that exploits the basis warm starts best
+      Highs_setStringOptionValue(this->highs, "solver", "simplex");
+   }
+
+   HiGHSSolver::~HiGHSSolver() {
+      Highs_destroy(this->highs);
+   }
+
+   void HiGHSSolver::solve_LP(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
+         const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
+         const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
+         const RectangularMatrix<double>& constraint_jacobian, const Vector<double>& /*initial_point*/, Direction& direction,
+         const WarmstartInformation& warmstart_information) {
+      if (this->print_subproblem) {
+         DEBUG << "LP (HiGHS):\n";
+         DEBUG << "objective gradient: " << linear_objective;
+      }
+
+      // copy the bounds, mapping infinite values to the HiGHS convention
+      if (warmstart_information.variable_bounds_changed) {
+         for (size_t variable_index: Range(number_variables)) {
+            this->column_lower_bounds[variable_index] = (variables_lower_bounds[variable_index] == -INF<double>) ? -HIGHS_INFINITY :
+               variables_lower_bounds[variable_index];
+            this->column_upper_bounds[variable_index] = (variables_upper_bounds[variable_index] == INF<double>) ? HIGHS_INFINITY :
+               variables_upper_bounds[variable_index];
+         }
+      }
+      if (warmstart_information.constraint_bounds_changed) {
+         for (size_t constraint_index: Range(number_constraints)) {
+            this->row_lower_bounds[constraint_index] = (constraints_lower_bounds[constraint_index] == -INF<double>) ? -HIGHS_INFINITY :
+               constraints_lower_bounds[constraint_index];
+            this->row_upper_bounds[constraint_index] = (constraints_upper_bounds[constraint_index] == INF<double>) ? HIGHS_INFINITY :
+               constraints_upper_bounds[constraint_index];
+         }
+      }
+
+      const bool dimensions_changed = (number_variables != this->loaded_number_variables) ||
+         (number_constraints != this->loaded_number_constraints);
+      if (dimensions_changed || warmstart_information.problem_changed || warmstart_information.constraints_changed) {
+         // the Jacobian changed: rebuild the column-wise copy and pass the whole model again. The
+         // basis of the previous solve is restored afterwards, so the warm start survives the repass
+         this->pass_model(number_variables, number_constraints, linear_objective, constraint_jacobian);
+         if (this->basis_available && not dimensions_changed) {
+            Highs_setBasis(this->highs, this->column_basis.data(), this->row_basis.data());
+         }
+      }
+      else {
+         // incremental updates that preserve the factorization held by HiGHS
+         if (warmstart_information.objective_changed) {
+            for (size_t variable_index: Range(number_variables)) {
+               this->column_costs[variable_index] = 0.;
+            }
+            for (const auto [variable_index, derivative]: linear_objective) {
+               this->column_costs[variable_index] = derivative;
+            }
+            Highs_changeColsCostByRange(this->highs, 0, static_cast<int>(number_variables) - 1, this->column_costs.data());
+         }
+         if (warmstart_information.variable_bounds_changed) {
+            Highs_changeColsBoundsByRange(this->highs, 0, static_cast<int>(number_variables) - 1, this->column_lower_bounds.data(),
+                  this->column_upper_bounds.data());
+         }
+         if (warmstart_information.constraint_bounds_changed) {
+            Highs_changeRowsBoundsByRange(this->highs, 0, static_cast<int>(number_constraints) - 1, this->row_lower_bounds.data(),
+                  this->row_upper_bounds.data());
+         }
+      }
+
+      // solve the LP
+      Highs_run(this->highs);
+      const int model_status = Highs_getModelStatus(this->highs);
+      switch (model_status) {
+         case kHighsModelStatusOptimal:
+            direction.status = SubproblemStatus::OPTIMAL;
+            break;
+         case kHighsModelStatusInfeasible:
+            direction.status = SubproblemStatus::INFEASIBLE;
+            break;
+         case kHighsModelStatusUnbounded:
+         case kHighsModelStatusUnboundedOrInfeasible:
+            direction.status = SubproblemStatus::UNBOUNDED_PROBLEM;
+            break;
+         default:
+            DEBUG << YELLOW << "HiGHS terminated with model status " << model_status << '\n' << RESET;
+            direction.status = SubproblemStatus::ERROR;
+            break;
+      }
+
+      // retrieve the basis for the warm start of the next solve
+      this->column_basis.resize(number_variables);
+      this->row_basis.resize(number_constraints);
+      Highs_getBasis(this->highs, this->column_basis.data(), this->row_basis.data());
+      this->basis_available = (direction.status == SubproblemStatus::OPTIMAL);
+
+      this->set_direction(number_variables, number_constraints, variables_lower_bounds, variables_upper_bounds, direction);
+   }
+
+   void HiGHSSolver::get_working_set(std::vector<int>& working_set) const {
+      // concatenate the column and row basis statuses
+      working_set.assign(this->column_basis.cbegin(), this->column_basis.cend());
+      working_set.insert(working_set.end(), this->row_basis.cbegin(), this->row_basis.cend());
+   }
+
+   void HiGHSSolver::load_working_set_estimate(const std::vector<int>& working_set) {
+      // only accept an estimate recorded from a problem with the same layout
+      if (working_set.size() == this->column_basis.size() + this->row_basis.size()) {
+         std::copy(working_set.cbegin(), working_set.cbegin() + static_cast<long>(this->column_basis.size()), this->column_basis.begin());
+         std::copy(working_set.cbegin() + static_cast<long>(this->column_basis.size()), working_set.cend(), this->row_basis.begin());
+         this->basis_available = true;
+      }
+   }
+
+   // assemble the column-wise (CSC) copy of the Jacobian from its row-wise sparse representation and
+   // load the complete model into the HiGHS instance
+   void HiGHSSolver::pass_model(size_t number_variables, size_t number_constraints, const SparseVector<double>& linear_objective,
+         const RectangularMatrix<double>& constraint_jacobian) {
+      this->column_costs.resize(number_variables);
+      for (size_t variable_index: Range(number_variables)) {
+         this->column_costs[variable_index] = 0.;
+      }
+      for (const auto [variable_index, derivative]: linear_objective) {
+         this->column_costs[variable_index] = derivative;
+      }
+
+      // count the entries in each column
+      this->column_starts.assign(number_variables + 1, 0);
+      for (size_t constraint_index: Range(number_constraints)) {
+         for (const auto [variable_index, derivative]: constraint_jacobian[constraint_index]) {
+            if (variable_index < number_variables) {
+               this->column_starts[variable_index + 1]++;
+            }
+         }
+      }
+      // carry over the column starts
+      for (size_t variable_index: Range(1, number_variables + 1)) {
+         this->column_starts[variable_index] += this->column_starts[variable_index - 1];
+      }
+      const size_t number_nonzeros = static_cast<size_t>(this->column_starts[number_variables]);
+      this->row_indices.resize(number_nonzeros);
+      this->matrix_entries.resize(number_nonzeros);
+      // fill the entries column by column, using the starts as running insertion positions
+      std::vector<int> current_positions(this->column_starts.cbegin(), this->column_starts.cend() - 1);
+      for (size_t constraint_index: Range(number_constraints)) {
+         for (const auto [variable_index, derivative]: constraint_jacobian[constraint_index]) {
+            if (variable_index < number_variables) {
+               const size_t position = static_cast<size_t>(current_positions[variable_index]);
+               this->row_indices[position] = static_cast<int>(constraint_index);
+               this->matrix_entries[position] = derivative;
+               current_positions[variable_index]++;
+            }
+         }
+      }
+
+      Highs_passLp(this->highs, static_cast<int>(number_variables), static_cast<int>(number_constraints),
+            static_cast<int>(number_nonzeros), kHighsMatrixFormatColwise, kHighsObjSenseMinimize, 0. /* offset */,
+            this->column_costs.data(), this->column_lower_bounds.data(), this->column_upper_bounds.data(),
+            this->row_lower_bounds.data(), this->row_upper_bounds.data(), this->column_starts.data(), this->row_indices.data(),
+            this->matrix_entries.data());
+      this->loaded_number_variables = number_variables;
+      this->loaded_number_constraints = number_constraints;
+   }
+
+   void HiGHSSolver::set_direction(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
+         const std::vector<double>& variables_upper_bounds, Direction& direction) {
+      std::vector<double> row_values(number_constraints);
+      std::vector<double> column_duals(number_variables);
+      std::vector<double> row_duals(number_constraints);
+      direction.primals.resize(number_variables);
+      Highs_getSolution(this->highs, direction.primals.data(), column_duals.data(), row_values.data(), row_duals.data());
+      direction.subproblem_objective = Highs_getObjectiveValue(this->highs);
+
+      // project solution into bounds
+      for (size_t variable_index: Range(number_variables)) {
+         direction.primals[variable_index] = std::min(std::max(direction.primals[variable_index], variables_lower_bounds[variable_index]),
+               variables_upper_bounds[variable_index]);
+      }
+
+      // multipliers: the HiGHS sign convention (nonnegative reduced cost at an active lower bound for
+      // a minimization, nonpositive at an active upper bound) coincides with the Uno convention
+      direction.multipliers.reset();
+      for (size_t constraint_index: Range(number_constraints)) {
+         direction.multipliers.constraints[constraint_index] = row_duals[constraint_index];
+      }
+      for (size_t variable_index: Range(number_variables)) {
+         if (this->column_basis[variable_index] == kHighsBasisStatusLower) {
+            direction.multipliers.lower_bounds[variable_index] = column_duals[variable_index];
+            direction.active_bounds.at_lower_bound.emplace_back(variable_index);
+         }
+         else if (this->column_basis[variable_index] == kHighsBasisStatusUpper) {
+            direction.multipliers.upper_bounds[variable_index] = column_duals[variable_index];
+            direction.active_bounds.at_upper_bound.emplace_back(variable_index);
+         }
+      }
+   }
+} // namespace
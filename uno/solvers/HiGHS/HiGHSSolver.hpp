@@ -0,0 +1,70 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_HIGHSSOLVER_H
+#define UNO_HIGHSSOLVER_H
+
+#include <vector>
+#include "solvers/LPSolver.hpp"
+
+namespace uno {
+   // forward declaration
+   class Options;
+
+   /*! \class HiGHSSolver
+    * \brief Interface to the HiGHS dual simplex for the LP subproblems
+    *
+    * The model is kept inside the HiGHS instance across calls: the WarmstartInformation flags drive
+    * incremental bound and cost updates, and the simplex basis of the previous solve seeds the next
+    * one, so that consecutive LP subproblems are resolved in a handful of iterations
+    */
+   class HiGHSSolver : public LPSolver {
+   public:
+      HiGHSSolver(size_t number_variables, size_t number_constraints, size_t number_objective_gradient_nonzeros,
+            size_t number_jacobian_nonzeros, const Options& options);
+      ~HiGHSSolver() override;
+
+      void solve_LP(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
+            const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
+            const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
+            const RectangularMatrix<double>& constraint_jacobian, const Vector<double>& initial_point, Direction& direction,
+            const WarmstartInformation& warmstart_information) override;
+
+      // the simplex basis plays the role of the working set: callers may cache it across outer
+      // iterations and seed later solves with it
+      void get_working_set(std::vector<int>& working_set) const override;
+      void load_working_set_estimate(const std::vector<int>& working_set) override;
+
+   protected:
+      // opaque HiGHS instance (C API), so that the HiGHS headers are confined to the translation unit
+      void* highs{nullptr};
+
+      // local column-wise copy of the LP
+      std::vector<double> column_costs;
+      std::vector<double> column_lower_bounds;
+      std::vector<double> column_upper_bounds;
+      std::vector<double> row_lower_bounds;
+      std::vector<double> row_upper_bounds;
+      std::vector<int> column_starts;
+      std::vector<int> row_indices;
+      std::vector<double> matrix_entries;
+
+      // basis of the previous solve (HiGHS basis statuses), restored whenever the model is re-passed
+      std::vector<int> column_basis;
+      std::vector<int> row_basis;
+      bool basis_available{false};
+
+      // dimensions of the model currently loaded in the HiGHS instance
+      size_t loaded_number_variables{0};
+      size_t loaded_number_constraints{0};
+
+      const bool print_subproblem;
+
+      void pass_model(size_t number_variables, size_t number_constraints, const SparseVector<double>& linear_objective,
+            const RectangularMatrix<double>& constraint_jacobian);
+      void set_direction(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
+            const std::vector<double>& variables_upper_bounds, Direction& direction);
+   };
+} // namespace
+
+#endif // UNO_HIGHSSOLVER_H
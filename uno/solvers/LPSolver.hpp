@@ -31,6 +31,15 @@ namespace uno {
             const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
             const RectangularMatrix<double>& constraint_jacobian, const Vector<double>& initial_point, Direction& direction,
             const WarmstartInformation& warmstart_information) = 0;
+
+      // working-set memory: active-set solvers may expose their working set, so that callers can cache
+      // it across outer iterations and seed later solves with an active-set prediction
+      virtual void get_working_set(std::vector<int>& working_set) const {
+         working_set.clear();
+      }
+      virtual void load_working_set_estimate(const std::vector<int>& /*working_set*/) {
+         // do nothing by default
+      }
    };
 } // namespace
 
@@ -10,6 +10,9 @@
 #ifdef HAS_BQPD
 #include "solvers/BQPD/BQPDSolver.hpp"
 #endif
+#ifdef HAS_HIGHS
+#include "solvers/HiGHS/HiGHSSolver.hpp"
+#endif
 
 namespace uno {
    class LPSolverFactory {
@@ -22,6 +25,12 @@ namespace uno {
             return std::make_unique<BQPDSolver>(number_variables, number_constraints, number_objective_gradient_nonzeros,
                   number_jacobian_nonzeros, 0, BQPDProblemType::LP, options);
          }
+#endif
+#ifdef HAS_HIGHS
+         if (LP_solver_name == "HiGHS") {
+            return std::make_unique<HiGHSSolver>(number_variables, number_constraints, number_objective_gradient_nonzeros,
+                  number_jacobian_nonzeros, options);
+         }
 #endif
          throw std::invalid_argument("LP solver not found");
       }
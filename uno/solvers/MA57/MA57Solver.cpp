@@ -1,12 +1,17 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
-#include <iostream>
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <fstream>
+#include <iostream>
 #include "MA57Solver.hpp"
 #include "linear_algebra/SymmetricMatrix.hpp"
 #include "linear_algebra/Vector.hpp"
+#include "tools/Infinity.hpp"
 #include "tools/Logger.hpp"
+#include "tools/MemoryUsage.hpp"
 
 namespace uno {
    extern "C" {
@@ -26,41 +31,126 @@ namespace uno {
    void ma57dd_(const int* job, const int* n, int* ne, const double a[], const int irn[], const int jcn[], double fact[], int* lfact, int ifact[], int*
    lifact, const double rhs[], double x[], double resid[], double work[], int iwork[], int icntl[],
          double cntl[], int info[], double rinfo[]);
+
+   // single-precision entry points (HSL naming: no trailing d), used by the mixed-precision mode
+   // default values of controlling parameters
+   void ma57i_(float cntl[], int icntl[]);
+   // symbolic factorization
+   void ma57a_(const int* n, const int* ne, const int irn[], const int jcn[], const int* lkeep, int keep[], int iwork[], int icntl[], int info[],
+         float rinfo[]);
+   // numerical factorization
+   void ma57b_(const int* n, int* ne, const float a[], /* out */ float fact[], const int* lfact, /* out */ int ifact[], const int* lifact,
+         const int* lkeep, const int keep[], int iwork[], int icntl[], float cntl[], /* out */ int info[], /* out */ float rinfo[]);
+   // linear system solve
+   void ma57c_(const int* job, const int* n, float fact[], int* lfact, int ifact[], int* lifact, const int* nrhs, float rhs[], const int* lrhs,
+         float work[], int* lwork, int iwork[], int icntl[], int info[]);
    }
 
-   MA57Solver::MA57Solver(size_t dimension, size_t number_nonzeros) : DirectSymmetricIndefiniteLinearSolver<size_t, double>(dimension),
+   MA57Solver::MA57Solver(size_t dimension, size_t number_nonzeros, bool mixed_precision, const std::string& ordering,
+         const std::string& ordering_file) :
+         DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>(dimension),
          lkeep(static_cast<int>(5 * dimension + number_nonzeros + std::max(dimension, number_nonzeros) + 42)),
          keep(static_cast<size_t>(lkeep)),
          iwork(5 * dimension),
          lwork(static_cast<int>(1.2 * static_cast<double>(dimension))),
-         work(static_cast<size_t>(this->lwork)), residuals(dimension) {
+         work(static_cast<size_t>(this->lwork)), residuals(dimension),
+         ordering_file(ordering_file),
+         mixed_precision_requested(mixed_precision) {
       this->row_indices.reserve(number_nonzeros);
       this->column_indices.reserve(number_nonzeros);
       // set the default values of the controlling parameters
       ma57id_(this->cntl.data(), this->icntl.data());
       // suppress warning messages
       this->icntl[4] = 0;
-      // iterative refinement enabled
-      this->icntl[8] = 1;
+      // fill-reducing ordering (ICNTL(6)): 2 = approximate minimum degree, 4 = METIS nested
+      // dissection, 5 = automatic choice between the two (the MA57 default)
+      if (ordering == "AMD") {
+         this->icntl[5] = 2;
+      }
+      else if (ordering == "METIS") {
+         this->icntl[5] = 4;
+      }
+      else if (ordering != "automatic") {
+         WARNING << "The MA57 ordering " << ordering << " is unknown, the automatic choice is kept\n";
+      }
+      this->configured_ordering = this->icntl[5];
+      // ICNTL(9): ceiling on the refinement steps applied by MA57DD when the adaptive solve path
+      // asks for them; the refinement stops earlier as soon as the backward error satisfies CNTL(3)
+      this->icntl[8] = static_cast<int>(MA57Solver::maximum_refinement_steps);
+      // possibly reuse the pivot order cached by a previous solve of the same model family
+      if (this->ordering_file != "none") {
+         this->load_pivot_order();
+      }
+
+      if (this->mixed_precision_requested) {
+         // single-precision workspaces of the mixed-precision mode
+         this->single_matrix_values.reserve(number_nonzeros);
+         this->keep_single.resize(static_cast<size_t>(this->lkeep));
+         this->single_rhs.resize(dimension);
+         this->single_lwork = this->lwork;
+         this->single_work.resize(static_cast<size_t>(this->single_lwork));
+         this->refinement_residual.resize(dimension);
+         ma57i_(this->single_cntl.data(), this->single_icntl.data());
+         this->single_icntl[4] = 0;
+         // same ordering choice on the single-precision side
+         this->single_icntl[5] = this->icntl[5];
+      }
    }
 
    // general factorization method: symbolic factorization and numerical factorization
-   void MA57Solver::factorize(const SymmetricMatrix<size_t, double>& matrix) {
+   void MA57Solver::factorize(const SymmetricMatrix<SparseIndex, double>& matrix) {
       this->do_symbolic_factorization(matrix);
       this->do_numerical_factorization(matrix);
    }
 
-   void MA57Solver::do_symbolic_factorization(const SymmetricMatrix<size_t, double>& matrix) {
+   void MA57Solver::do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
       assert(matrix.dimension() <= this->dimension && "MA57Solver: the dimension of the matrix is larger than the preallocated size");
       assert(matrix.number_nonzeros() <= this->row_indices.capacity() &&
              "MA57Solver: the number of nonzeros of the matrix is larger than the preallocated size");
 
-      // build the internal matrix representation
+      // the converted (1-based, int) copy of the pattern is rebuilt only when the structure of the
+      // matrix changed; after a values-only update, the conversion, the fingerprint and the analysis
+      // are all still valid and the handoff to the factorization is zero-copy
+      if (matrix.structure_version() == this->converted_structure_version &&
+            matrix.dimension() == static_cast<size_t>(this->factorization.n) &&
+            matrix.number_nonzeros() == static_cast<size_t>(this->factorization.nnz)) {
+         this->pattern_reuses++;
+         DEBUG << "MA57: structure unchanged, pattern conversion and symbolic factorization skipped\n";
+         return;
+      }
       this->save_sparsity_pattern_internally(matrix);
+      this->converted_structure_version = matrix.structure_version();
+
+      // if the pattern is identical to the one currently installed, the analysis remains valid as is
+      const size_t fingerprint = this->compute_pattern_fingerprint(matrix.dimension(), matrix.number_nonzeros());
+      if (fingerprint == this->analyzed_pattern_fingerprint) {
+         this->pattern_reuses++;
+         DEBUG << "MA57: symbolic factorization reused (" << this->pattern_reuses << " reuses so far)\n";
+         return;
+      }
+      // otherwise, the pattern may be one of the last few analyzed patterns (alternating phases)
+      if (this->restore_cached_analysis(fingerprint)) {
+         this->pattern_reuses++;
+         DEBUG << "MA57: cached symbolic factorization restored (" << this->pattern_reuses << " reuses so far)\n";
+         return;
+      }
 
       const int n = static_cast<int>(matrix.dimension());
       const int nnz = static_cast<int>(matrix.number_nonzeros());
 
+      // a pivot order imported from a previous solve of the same model family short-circuits the
+      // (possibly expensive, e.g. METIS) fill-reducing ordering: ICNTL(6) = 0 reads it from KEEP
+      const bool use_imported_pivot_order = (this->imported_pivot_order.size() == static_cast<size_t>(n));
+      if (use_imported_pivot_order) {
+         DEBUG << "MA57: reusing the pivot order imported from " << this->ordering_file << '\n';
+         std::copy(this->imported_pivot_order.begin(), this->imported_pivot_order.end(), this->keep.begin());
+         this->icntl[5] = 0;
+         if (this->mixed_precision_requested) {
+            std::copy(this->imported_pivot_order.begin(), this->imported_pivot_order.end(), this->keep_single.begin());
+            this->single_icntl[5] = 0;
+         }
+      }
+
       // symbolic factorization
       ma57ad_(/* const */ &n,
             /* const */ &nnz,
@@ -78,20 +168,89 @@ namespace uno {
          WARNING << "MA57 has issued a warning: info(1) = " << info[0] << '\n';
       }
 
-      // get LFACT and LIFACT and resize FACT and IFACT (no effect if resized to <= size)
-      int lfact = 2 * this->info[8];
-      int lifact = 2 * this->info[9];
-      this->fact.resize(static_cast<size_t>(lfact));
-      this->ifact.resize(static_cast<size_t>(lifact));
+      // workspace sizes suggested by the analysis
+      const size_t suggested_lfact = 2 * static_cast<size_t>(this->info[8]);
+      const size_t suggested_lifact = 2 * static_cast<size_t>(this->info[9]);
+      // FACT and IFACT retain the largest workspace seen so far and grow geometrically: across
+      // iterations the suggested sizes are stable, so steady-state factorizations never allocate
+      if (this->fact.size() < suggested_lfact) {
+         this->fact.resize(std::max(suggested_lfact, (3*this->fact.size())/2));
+      }
+      if (this->ifact.size() < suggested_lifact) {
+         this->ifact.resize(std::max(suggested_lifact, (3*this->ifact.size())/2));
+      }
+
+      MemoryUsage::record(MemoryUsage::FACTORS, this->fact.size() * sizeof(double) + this->ifact.size() * sizeof(int));
 
-      // store the sizes of the symbolic factorization
-      this->factorization = {n, nnz, lfact, lifact};
+      // store the sizes of the symbolic factorization (MA57 may use the whole retained workspace)
+      this->factorization = {n, nnz, static_cast<int>(this->fact.size()), static_cast<int>(this->ifact.size())};
+      this->analyzed_pattern_fingerprint = fingerprint;
+
+      // analyze the single-precision side as well, so that the mixed-precision factorizations can run
+      if (this->mixed_precision_requested) {
+         this->analyze_single_precision(n, nnz);
+      }
+
+      if (use_imported_pivot_order) {
+         // restore the configured ordering for the analyses of other patterns
+         this->icntl[5] = this->configured_ordering;
+         this->single_icntl[5] = this->configured_ordering;
+      }
+      else if (this->ordering_file != "none" && this->imported_pivot_order.empty()) {
+         // cache the pivot order chosen by this analysis (held in KEEP(1:N) on exit) for later solves
+         // of the same model family; it is kept internally as well, so that further analyses of the
+         // same dimension reuse it instead of recomputing the ordering
+         this->imported_pivot_order.assign(this->keep.begin(), this->keep.begin() + n);
+         this->save_pivot_order(n);
+      }
+
+      // cache this analysis (KEEP snapshot) for when the solver comes back to this pattern
+      if (MA57Solver::maximum_cached_analyses <= this->analysis_cache.size()) {
+         // evict the oldest entry
+         this->analysis_cache.erase(this->analysis_cache.begin());
+      }
+      this->analysis_cache.push_back({fingerprint, this->factorization, this->keep, this->single_factorization, this->keep_single});
+   }
+
+   // symbolic factorization of the single-precision routines (the integer analysis is run by the
+   // matching precision, as the HSL documentation requires)
+   void MA57Solver::analyze_single_precision(int n, int nnz) {
+      ma57a_(&n, &nnz, this->row_indices.data(), this->column_indices.data(), &this->lkeep, this->keep_single.data(), this->iwork.data(),
+            this->single_icntl.data(), this->single_info.data(), this->single_rinfo.data());
+      if (this->single_info[0] < 0) {
+         WARNING << "MA57: the single-precision symbolic factorization failed, mixed precision is disabled\n";
+         this->mixed_precision_active = false;
+         return;
+      }
+      // workspace sizes suggested by the analysis, with the same retain-largest policy as the double side
+      const size_t suggested_lfact = 2 * static_cast<size_t>(this->single_info[8]);
+      const size_t suggested_lifact = 2 * static_cast<size_t>(this->single_info[9]);
+      if (this->single_fact.size() < suggested_lfact) {
+         this->single_fact.resize(std::max(suggested_lfact, (3*this->single_fact.size())/2));
+      }
+      if (this->single_ifact.size() < suggested_lifact) {
+         this->single_ifact.resize(std::max(suggested_lifact, (3*this->single_ifact.size())/2));
+      }
+      MemoryUsage::record(MemoryUsage::FACTORS, this->single_fact.size() * sizeof(float) + this->single_ifact.size() * sizeof(int));
+      this->single_factorization = {n, nnz, static_cast<int>(this->single_fact.size()), static_cast<int>(this->single_ifact.size())};
+      this->mixed_precision_active = true;
    }
 
-   void MA57Solver::do_numerical_factorization(const SymmetricMatrix<size_t, double>& matrix) {
+   void MA57Solver::do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
       assert(matrix.dimension() <= this->dimension && "MA57Solver: the dimension of the matrix is larger than the preallocated size");
       assert(this->factorization.nnz == static_cast<int>(matrix.number_nonzeros()) && "MA57Solver: the numbers of nonzeros do not match");
 
+      // mixed precision: factorize in single precision (half the factor bandwidth), keep the double
+      // factorization path as fallback when the single factorization fails
+      if (this->mixed_precision_active) {
+         if (this->factorize_single_precision(matrix)) {
+            return;
+         }
+         WARNING << "MA57: the single-precision factorization failed, falling back to double precision\n";
+         this->mixed_precision_active = false;
+         this->mixed_precision_requested = false;
+      }
+
       const int n = static_cast<int>(matrix.dimension());
       int nnz = static_cast<int>(matrix.number_nonzeros());
 
@@ -109,27 +268,188 @@ namespace uno {
             /* out */ this->rinfo.data());
    }
 
-   void MA57Solver::solve_indefinite_system(const SymmetricMatrix<size_t, double>& matrix, const Vector<double>& rhs, Vector<double>& result) {
+   // numerical factorization of the single-precision routines; returns whether it succeeded
+   bool MA57Solver::factorize_single_precision(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      const int n = static_cast<int>(matrix.dimension());
+      int nnz = static_cast<int>(matrix.number_nonzeros());
+
+      // cast the matrix values down to single precision
+      this->single_matrix_values.resize(matrix.number_nonzeros());
+      const double* values = matrix.data_pointer();
+      for (size_t nonzero_index: Range(matrix.number_nonzeros())) {
+         this->single_matrix_values[nonzero_index] = static_cast<float>(values[nonzero_index]);
+      }
+
+      ma57b_(&n,
+            &nnz,
+            /* const */ this->single_matrix_values.data(),
+            /* out */ this->single_fact.data(),
+            /* const */ &this->single_factorization.lfact,
+            /* out */ this->single_ifact.data(),
+            /* const */ &this->single_factorization.lifact,
+            /* const */ &this->lkeep,
+            /* const */ this->keep_single.data(), this->iwork.data(), this->single_icntl.data(), this->single_cntl.data(),
+            /* out */ this->single_info.data(),
+            /* out */ this->single_rinfo.data());
+      if (this->single_info[0] < 0) {
+         return false;
+      }
+      // expose the inertia and rank of the single factorization through the usual INFO queries
+      this->info = this->single_info;
+      return true;
+   }
+
+   // correction solves in single precision, residuals accumulated in double precision; returns false
+   // when the refinement stagnates (the single factorization is too inaccurate for this system)
+   bool MA57Solver::solve_with_refinement(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs, Vector<double>& result) {
+      const int n = static_cast<int>(matrix.dimension());
+      const int lrhs = n;
+
+      result.fill(0.);
+      double rhs_norm = 0.;
+      for (size_t row_index: Range(matrix.dimension())) {
+         this->refinement_residual[row_index] = rhs[row_index];
+         rhs_norm = std::max(rhs_norm, std::abs(rhs[row_index]));
+      }
+      double previous_residual_norm = INF<double>;
+      for (size_t iteration: Range(MA57Solver::maximum_refinement_iterations)) {
+         // single-precision correction solve: d = A^{-1} r
+         for (size_t row_index: Range(matrix.dimension())) {
+            this->single_rhs[row_index] = static_cast<float>(this->refinement_residual[row_index]);
+         }
+         ma57c_(&this->job, &n, this->single_fact.data(), &this->single_factorization.lfact, this->single_ifact.data(),
+               &this->single_factorization.lifact, &this->nrhs, this->single_rhs.data(), &lrhs, this->single_work.data(), &this->single_lwork,
+               this->iwork.data(), this->single_icntl.data(), this->single_info.data());
+         for (size_t row_index: Range(matrix.dimension())) {
+            result[row_index] += static_cast<double>(this->single_rhs[row_index]);
+         }
+
+         // double-precision residual r = b - A x
+         for (size_t row_index: Range(matrix.dimension())) {
+            this->refinement_residual[row_index] = rhs[row_index];
+         }
+         matrix.for_each([&](size_t row_index, size_t column_index, double element) {
+            this->refinement_residual[row_index] -= element * result[column_index];
+            if (row_index != column_index) {
+               this->refinement_residual[column_index] -= element * result[row_index];
+            }
+         });
+         double residual_norm = 0.;
+         for (size_t row_index: Range(matrix.dimension())) {
+            residual_norm = std::max(residual_norm, std::abs(this->refinement_residual[row_index]));
+         }
+         DEBUG << "MA57 mixed precision: refinement iteration " << iteration << ", residual " << residual_norm << '\n';
+         if (residual_norm <= MA57Solver::refinement_tolerance * (1. + rhs_norm)) {
+            return true;
+         }
+         // stagnation: the residual no longer contracts
+         if (MA57Solver::stagnation_factor * previous_residual_norm <= residual_norm) {
+            return false;
+         }
+         previous_residual_norm = residual_norm;
+      }
+      return false;
+   }
+
+   void MA57Solver::solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs, Vector<double>& result) {
+      if (this->mixed_precision_active) {
+         if (this->solve_with_refinement(matrix, rhs, result)) {
+            return;
+         }
+         // the refinement stagnated: fall back to full double precision for the rest of the solve
+         WARNING << "MA57: the mixed-precision refinement stagnated, falling back to double precision\n";
+         this->mixed_precision_active = false;
+         this->mixed_precision_requested = false;
+         this->do_numerical_factorization(matrix);
+      }
       // solve
       const int n = static_cast<int>(matrix.dimension());
       int nnz = static_cast<int>(matrix.number_nonzeros());
       const int lrhs = n; // integer, length of rhs
 
-      // solve the linear system
-      if (this->use_iterative_refinement) {
-         ma57dd_(&this->job, &n, &nnz, matrix.data_pointer(), this->row_indices.data(), this->column_indices.data(),
-               this->fact.data(), &this->factorization.lfact, this->ifact.data(), &this->factorization.lifact,
-               rhs.data(), result.data(), this->residuals.data(), this->work.data(), this->iwork.data(), this->icntl.data(),
-               this->cntl.data(), this->info.data(), this->rinfo.data());
+      // cheap triangular solves first, without refinement; copy rhs into result (overwritten by MA57)
+      result = rhs;
+      ma57cd_(&this->job, &n, this->fact.data(), &this->factorization.lfact, this->ifact.data(),
+            &this->factorization.lifact, &this->nrhs, result.data(), &lrhs, this->work.data(), &this->lwork, this->iwork.data(),
+            this->icntl.data(), this->info.data());
+
+      // measure the actual residual: the well-conditioned systems (most iterations) stop here with
+      // zero refinement steps
+      double rhs_norm = 0.;
+      for (size_t row_index: Range(matrix.dimension())) {
+         rhs_norm = std::max(rhs_norm, std::abs(rhs[row_index]));
       }
-      else {
-         // copy rhs into result (overwritten by MA57)
-         result = rhs;
+      const double residual_norm = this->compute_residual_norm(matrix, rhs, result);
+      if (residual_norm <= MA57Solver::refinement_tolerance * (1. + rhs_norm)) {
+         return;
+      }
+
+      // ill-conditioned system: refine the solution in place with MA57DD (JOB = 2), which applies
+      // up to ICNTL(9) refinement steps and stops as soon as the backward error drops below CNTL(3)
+      DEBUG << "MA57: residual " << residual_norm << ", applying iterative refinement\n";
+      const int refinement_job = 2;
+      ma57dd_(&refinement_job, &n, &nnz, matrix.data_pointer(), this->row_indices.data(), this->column_indices.data(),
+            this->fact.data(), &this->factorization.lfact, this->ifact.data(), &this->factorization.lifact,
+            rhs.data(), result.data(), this->residuals.data(), this->work.data(), this->iwork.data(), this->icntl.data(),
+            this->cntl.data(), this->info.data(), this->rinfo.data());
+   }
 
-         ma57cd_(&this->job, &n, this->fact.data(), &this->factorization.lfact, this->ifact.data(),
-               &this->factorization.lifact, &this->nrhs, result.data(), &lrhs, this->work.data(), &this->lwork, this->iwork.data(),
-               this->icntl.data(), this->info.data());
+   // infinity norm of b - A x, computed in the residuals buffer
+   double MA57Solver::compute_residual_norm(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs,
+         const Vector<double>& result) {
+      for (size_t row_index: Range(matrix.dimension())) {
+         this->residuals[row_index] = rhs[row_index];
       }
+      matrix.for_each([&](size_t row_index, size_t column_index, double element) {
+         this->residuals[row_index] -= element * result[column_index];
+         if (row_index != column_index) {
+            this->residuals[column_index] -= element * result[row_index];
+         }
+      });
+      double residual_norm = 0.;
+      for (size_t row_index: Range(matrix.dimension())) {
+         residual_norm = std::max(residual_norm, std::abs(this->residuals[row_index]));
+      }
+      return residual_norm;
+   }
+
+   void MA57Solver::solve_indefinite_systems(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs_block,
+         Vector<double>& result_block, size_t number_systems) {
+      // the mixed-precision refinement handles a single right-hand side at a time: fall back to the
+      // column-by-column version
+      if (this->mixed_precision_active) {
+         DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>::solve_indefinite_systems(matrix, rhs_block, result_block, number_systems);
+         return;
+      }
+      const int n = static_cast<int>(matrix.dimension());
+      const int nrhs = static_cast<int>(number_systems);
+      const int lrhs = static_cast<int>(this->dimension); // leading dimension of the blocks
+
+      // the workspace of the blocked solve grows with the number of right-hand sides (LWORK >= N*NRHS)
+      const size_t minimum_workspace_size = matrix.dimension() * number_systems;
+      if (this->work.size() < minimum_workspace_size) {
+         this->work.resize(minimum_workspace_size);
+         this->lwork = static_cast<int>(minimum_workspace_size);
+      }
+
+      // copy the right-hand sides into the result block (overwritten by MA57)
+      result_block = rhs_block;
+
+      // single pass over the triangular factors for all the right-hand sides
+      ma57cd_(&this->job, &n, this->fact.data(), &this->factorization.lfact, this->ifact.data(),
+            &this->factorization.lifact, &nrhs, result_block.data(), &lrhs, this->work.data(), &this->lwork, this->iwork.data(),
+            this->icntl.data(), this->info.data());
+   }
+
+   size_t MA57Solver::expected_number_factor_entries() const {
+      // INFO(9): forecast of the real factor storage, reported by the analysis
+      return static_cast<size_t>(this->info[8]);
+   }
+
+   size_t MA57Solver::expected_factor_memory_bytes() const {
+      // real (INFO(9)) and integer (INFO(10)) forecasts, doubled to match the FACT/IFACT sizing
+      // policy of do_symbolic_factorization: this is what the factorization will actually allocate
+      return 2 * (static_cast<size_t>(this->info[8]) * sizeof(double) + static_cast<size_t>(this->info[9]) * sizeof(int));
    }
 
    std::tuple<size_t, size_t, size_t> MA57Solver::get_inertia() const {
@@ -161,7 +481,84 @@ namespace uno {
       return static_cast<size_t>(this->info[24]);
    }
 
-   void MA57Solver::save_sparsity_pattern_internally(const SymmetricMatrix<size_t, double>& matrix) {
+   size_t MA57Solver::number_pattern_reuses() const {
+      return this->pattern_reuses;
+   }
+
+   bool MA57Solver::restore_cached_analysis(size_t fingerprint) {
+      for (const CachedAnalysis& cached_analysis: this->analysis_cache) {
+         if (cached_analysis.fingerprint == fingerprint) {
+            // reinstall the analysis: MA57BD reads KEEP but never modifies it, so the snapshot is valid
+            this->keep = cached_analysis.keep;
+            // FACT and IFACT only grow: let MA57 use the whole retained workspace
+            this->factorization = {cached_analysis.factorization.n, cached_analysis.factorization.nnz,
+                  static_cast<int>(this->fact.size()), static_cast<int>(this->ifact.size())};
+            // reinstall the single-precision side of the analysis as well
+            if (this->mixed_precision_requested && not cached_analysis.keep_single.empty()) {
+               this->keep_single = cached_analysis.keep_single;
+               this->single_factorization = {cached_analysis.single_factorization.n, cached_analysis.single_factorization.nnz,
+                     static_cast<int>(this->single_fact.size()), static_cast<int>(this->single_ifact.size())};
+               this->mixed_precision_active = true;
+            }
+            else {
+               this->mixed_precision_active = false;
+            }
+            this->analyzed_pattern_fingerprint = fingerprint;
+            return true;
+         }
+      }
+      return false;
+   }
+
+   size_t MA57Solver::compute_pattern_fingerprint(size_t dimension, size_t number_nonzeros) const {
+      // combine the dimension, the number of nonzeros and a hash of the index arrays
+      size_t fingerprint = dimension;
+      fingerprint = fingerprint * 31 + number_nonzeros;
+      for (size_t nonzero_index = 0; nonzero_index < number_nonzeros; nonzero_index++) {
+         fingerprint = fingerprint * 31 + static_cast<size_t>(this->row_indices[nonzero_index]);
+         fingerprint = fingerprint * 31 + static_cast<size_t>(this->column_indices[nonzero_index]);
+      }
+      // reserve 0 to mean "no pattern analyzed yet"
+      return (fingerprint == 0) ? 1 : fingerprint;
+   }
+
+   // sidecar file of the pivot order, in the same spirit as the scaling factors file: the dimension,
+   // then the 1-based pivot sequence, one entry per line
+   void MA57Solver::load_pivot_order() {
+      std::ifstream stream(this->ordering_file);
+      if (not stream.is_open()) {
+         return;
+      }
+      size_t order_size{0};
+      if (not (stream >> order_size) || this->keep.size() < order_size) {
+         WARNING << "The MA57 pivot order in " << this->ordering_file << " is invalid and is ignored\n";
+         return;
+      }
+      this->imported_pivot_order.resize(order_size);
+      for (size_t index: Range(order_size)) {
+         if (not (stream >> this->imported_pivot_order[index])) {
+            WARNING << "The MA57 pivot order in " << this->ordering_file << " is invalid and is ignored\n";
+            this->imported_pivot_order.clear();
+            return;
+         }
+      }
+      INFO << "MA57 pivot order read from " << this->ordering_file << '\n';
+   }
+
+   void MA57Solver::save_pivot_order(int n) const {
+      std::ofstream stream(this->ordering_file);
+      if (not stream.is_open()) {
+         WARNING << "The MA57 pivot order could not be written to " << this->ordering_file << '\n';
+         return;
+      }
+      stream << n << '\n';
+      for (size_t index: Range(static_cast<size_t>(n))) {
+         stream << this->keep[index] << '\n';
+      }
+      INFO << "MA57 pivot order written to " << this->ordering_file << '\n';
+   }
+
+   void MA57Solver::save_sparsity_pattern_internally(const SymmetricMatrix<SparseIndex, double>& matrix) {
       // build the internal matrix representation
       this->row_indices.clear();
       this->column_indices.clear();
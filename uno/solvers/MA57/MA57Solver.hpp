@@ -5,7 +5,10 @@
 #define UNO_MA57SOLVER_H
 
 #include <array>
+#include <cstdint>
+#include <string>
 #include <vector>
+#include "linear_algebra/FirstTouchAllocator.hpp"
 #include "solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
 
 namespace uno {
@@ -28,21 +31,28 @@ namespace uno {
     *
     *  Interface to the symmetric indefinite linear solver MA57
     */
-   class MA57Solver : public DirectSymmetricIndefiniteLinearSolver<size_t, double> {
+   class MA57Solver final : public DirectSymmetricIndefiniteLinearSolver<SparseIndex, double> {
    public:
-      MA57Solver(size_t dimension, size_t number_nonzeros);
+      MA57Solver(size_t dimension, size_t number_nonzeros, bool mixed_precision = false, const std::string& ordering = "automatic",
+            const std::string& ordering_file = "none");
       ~MA57Solver() override = default;
 
-      void factorize(const SymmetricMatrix<size_t, double>& matrix) override;
-      void do_symbolic_factorization(const SymmetricMatrix<size_t, double>& matrix) override;
-      void do_numerical_factorization(const SymmetricMatrix<size_t, double>& matrix) override;
-      void solve_indefinite_system(const SymmetricMatrix<size_t, double>& matrix, const Vector<double>& rhs, Vector<double>& result) override;
+      void factorize(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs, Vector<double>& result) override;
+      void solve_indefinite_systems(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs_block, Vector<double>& result_block,
+            size_t number_systems) override;
 
+      [[nodiscard]] size_t expected_number_factor_entries() const override;
+      [[nodiscard]] size_t expected_factor_memory_bytes() const override;
       [[nodiscard]] std::tuple<size_t, size_t, size_t> get_inertia() const override;
       [[nodiscard]] size_t number_negative_eigenvalues() const override;
       // [[nodiscard]] bool matrix_is_positive_definite() const override;
       [[nodiscard]] bool matrix_is_singular() const override;
       [[nodiscard]] size_t rank() const override;
+      // number of times the symbolic analysis was skipped because the sparsity pattern was unchanged
+      [[nodiscard]] size_t number_pattern_reuses() const;
 
    private:
       // internal matrix representation
@@ -51,8 +61,10 @@ namespace uno {
 
       // factorization
       MA57Factorization factorization{};
-      std::vector<double> fact{0}; // do not initialize, resize at every iteration
-      std::vector<int> ifact{0}; // do not initialize, resize at every iteration
+      // the factor workspaces span gigabytes on the large models: route them through the
+      // first-touch allocator (alignment, NUMA placement and optional huge pages)
+      std::vector<double, FirstTouchAllocator<double>> fact{0}; // do not initialize, resize at every iteration
+      std::vector<int, FirstTouchAllocator<int>> ifact{0}; // do not initialize, resize at every iteration
       const int lkeep;
       std::vector<int> keep{};
       std::vector<int> iwork{};
@@ -70,8 +82,69 @@ namespace uno {
       std::vector<double> residuals;
       const size_t fortran_shift{1};
 
-      bool use_iterative_refinement{false};
-      void save_sparsity_pattern_internally(const SymmetricMatrix<size_t, double>& matrix);
+      // adaptive iterative refinement: the cheap triangular solves run first and the measured
+      // residual decides. Most systems are well conditioned and stop there (zero refinement steps);
+      // the others receive up to maximum_refinement_steps MA57DD steps, which converge per CNTL(3)
+      static constexpr size_t maximum_refinement_steps{3};
+      [[nodiscard]] double compute_residual_norm(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs,
+            const Vector<double>& result);
+      // fingerprint (dimension + number of nonzeros + hash of the index arrays) of the currently
+      // installed sparsity pattern, so that repeated analyses of an identical pattern become cache hits
+      size_t analyzed_pattern_fingerprint{0};
+      size_t pattern_reuses{0};
+      // structure version of the matrix whose pattern is currently converted into the index arrays:
+      // as long as it is unchanged (values-only updates), the conversion, the fingerprint and the
+      // analysis are all still valid and the symbolic factorization returns immediately
+      size_t converted_structure_version{SIZE_MAX};
+      // analyses of the last few distinct patterns (the KEEP array holds the whole analysis). A solver
+      // alternating between a handful of patterns (e.g. the optimality and restoration phases of a
+      // feasibility restoration strategy) then restores the matching analysis instead of re-running it
+      struct CachedAnalysis {
+         size_t fingerprint{0};
+         MA57Factorization factorization{};
+         std::vector<int> keep{};
+         // single-precision side of the analysis (empty when mixed precision is off)
+         MA57Factorization single_factorization{};
+         std::vector<int> keep_single{};
+      };
+      static constexpr size_t maximum_cached_analyses{4};
+      std::vector<CachedAnalysis> analysis_cache{};
+      // fill-reducing ordering: ICNTL(6) choice configured through the options, and an optional
+      // sidecar file holding the pivot order of a previous solve of the same model family (the
+      // expensive orderings, e.g. METIS, are then computed once per family instead of once per solve)
+      int configured_ordering;
+      const std::string ordering_file;
+      std::vector<int> imported_pivot_order{};
+      void load_pivot_order();
+      void save_pivot_order(int n) const;
+      [[nodiscard]] bool restore_cached_analysis(size_t fingerprint);
+      void save_sparsity_pattern_internally(const SymmetricMatrix<SparseIndex, double>& matrix);
+      [[nodiscard]] size_t compute_pattern_fingerprint(size_t dimension, size_t number_nonzeros) const;
+
+      // mixed precision: factorize in single precision and recover double accuracy with iterative
+      // refinement, falling back to full double precision when the refinement stagnates
+      bool mixed_precision_requested;
+      bool mixed_precision_active{false};
+      MA57Factorization single_factorization{};
+      std::vector<float> single_matrix_values{};
+      std::vector<float, FirstTouchAllocator<float>> single_fact{};
+      std::vector<int, FirstTouchAllocator<int>> single_ifact{};
+      std::vector<int> keep_single{};
+      std::vector<float> single_rhs{};
+      std::vector<float> single_work{};
+      int single_lwork{0};
+      std::vector<double> refinement_residual{};
+      std::array<float, 5> single_cntl{};
+      std::array<int, 20> single_icntl{};
+      std::array<float, 20> single_rinfo{};
+      std::array<int, 40> single_info{};
+      static constexpr size_t maximum_refinement_iterations{10};
+      static constexpr double refinement_tolerance{1e-11};
+      static constexpr double stagnation_factor{0.5};
+
+      void analyze_single_precision(int n, int nnz);
+      [[nodiscard]] bool factorize_single_precision(const SymmetricMatrix<SparseIndex, double>& matrix);
+      [[nodiscard]] bool solve_with_refinement(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs, Vector<double>& result);
    };
 } // namespace
 
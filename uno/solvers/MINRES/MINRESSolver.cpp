@@ -0,0 +1,185 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <cassert>
+#include <cmath>
+#include "MINRESSolver.hpp"
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "tools/Deadline.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   MINRESSolver::MINRESSolver(size_t dimension, size_t max_iterations, double tolerance) :
+         DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>(dimension),
+         max_iterations(max_iterations),
+         tolerance(tolerance),
+         diagonal(dimension),
+         inverse_preconditioner(dimension),
+         v_old(dimension), v_current(dimension), v_new(dimension),
+         z_current(dimension), z_new(dimension),
+         w_old(dimension), w_current(dimension), w_new(dimension),
+         matrix_vector(dimension) {
+   }
+
+   void MINRESSolver::factorize(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      this->do_symbolic_factorization(matrix);
+      this->do_numerical_factorization(matrix);
+   }
+
+   void MINRESSolver::do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& /*matrix*/) {
+      // no analysis phase: the matrix is only applied through matrix-vector products
+   }
+
+   void MINRESSolver::do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      assert(matrix.dimension() <= this->dimension && "MINRESSolver: the dimension of the matrix is larger than the preallocated size");
+
+      // gather the diagonal of the matrix
+      const size_t n = matrix.dimension();
+      for (size_t index: Range(n)) {
+         this->diagonal[index] = 0.;
+      }
+      matrix.for_each([&](size_t row_index, size_t column_index, double element) {
+         if (row_index == column_index) {
+            this->diagonal[row_index] += element;
+         }
+      });
+
+      // build the Jacobi preconditioner (the absolute value keeps it positive definite) and
+      // estimate the inertia from the signs of the diagonal entries
+      this->factorized_dimension = n;
+      this->estimated_negative_eigenvalues = 0;
+      this->estimated_zero_eigenvalues = 0;
+      for (size_t index: Range(n)) {
+         const double entry = this->diagonal[index];
+         if (entry < 0.) {
+            this->estimated_negative_eigenvalues++;
+         }
+         else if (entry == 0.) {
+            this->estimated_zero_eigenvalues++;
+         }
+         this->inverse_preconditioner[index] = (entry != 0.) ? 1. / std::abs(entry) : 1.;
+      }
+   }
+
+   void MINRESSolver::solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs, Vector<double>& result) {
+      const size_t n = matrix.dimension();
+
+      // preconditioned MINRES (see Elman, Silvester & Wathen, Algorithm 2.4)
+      for (size_t index: Range(n)) {
+         result[index] = 0.;
+         this->v_old[index] = 0.;
+         this->v_current[index] = rhs[index];
+         this->w_old[index] = 0.;
+         this->w_current[index] = 0.;
+         this->z_current[index] = this->inverse_preconditioner[index] * rhs[index];
+      }
+      double gamma_old = 1.;
+      double gamma_current = 0.;
+      for (size_t index: Range(n)) {
+         gamma_current += this->z_current[index] * this->v_current[index];
+      }
+      gamma_current = std::sqrt(std::max(0., gamma_current));
+      if (gamma_current == 0.) {
+         // zero right-hand side
+         return;
+      }
+      const double residual_reference = gamma_current;
+      double eta = gamma_current;
+      double s_old = 0., s_current = 0.;
+      double c_old = 1., c_current = 1.;
+
+      for (size_t iteration: Range(this->max_iterations)) {
+         // cancellation point: on huge systems, a full Krylov sweep may outlive the time budget
+         Deadline::check();
+         // normalize the current Lanczos vector
+         for (size_t index: Range(n)) {
+            this->z_current[index] /= gamma_current;
+         }
+         this->matrix_vector_product(matrix, this->z_current, this->matrix_vector);
+         double delta = 0.;
+         for (size_t index: Range(n)) {
+            delta += this->matrix_vector[index] * this->z_current[index];
+         }
+         // next Lanczos vector
+         for (size_t index: Range(n)) {
+            this->v_new[index] = this->matrix_vector[index] - (delta / gamma_current) * this->v_current[index]
+                                 - (gamma_current / gamma_old) * this->v_old[index];
+            this->z_new[index] = this->inverse_preconditioner[index] * this->v_new[index];
+         }
+         double gamma_new = 0.;
+         for (size_t index: Range(n)) {
+            gamma_new += this->z_new[index] * this->v_new[index];
+         }
+         gamma_new = std::sqrt(std::max(0., gamma_new));
+
+         // Givens rotation
+         const double alpha0 = c_current * delta - c_old * s_current * gamma_current;
+         const double alpha1 = std::sqrt(alpha0 * alpha0 + gamma_new * gamma_new);
+         const double alpha2 = s_current * delta + c_old * c_current * gamma_current;
+         const double alpha3 = s_old * gamma_current;
+         if (alpha1 == 0.) {
+            // breakdown: the exact solution was reached
+            break;
+         }
+         const double c_new = alpha0 / alpha1;
+         const double s_new = gamma_new / alpha1;
+
+         // update the solution
+         for (size_t index: Range(n)) {
+            this->w_new[index] = (this->z_current[index] - alpha3 * this->w_old[index] - alpha2 * this->w_current[index]) / alpha1;
+            result[index] += c_new * eta * this->w_new[index];
+         }
+         eta = -s_new * eta;
+
+         // shift the recurrences
+         std::swap(this->v_old, this->v_current);
+         std::swap(this->v_current, this->v_new);
+         std::swap(this->z_current, this->z_new);
+         std::swap(this->w_old, this->w_current);
+         std::swap(this->w_current, this->w_new);
+         gamma_old = gamma_current;
+         gamma_current = gamma_new;
+         s_old = s_current;
+         s_current = s_new;
+         c_old = c_current;
+         c_current = c_new;
+
+         if (std::abs(eta) <= this->tolerance * residual_reference || gamma_current == 0.) {
+            DEBUG << "MINRES converged in " << (iteration + 1) << " iterations\n";
+            break;
+         }
+      }
+   }
+
+   std::tuple<size_t, size_t, size_t> MINRESSolver::get_inertia() const {
+      const size_t number_negative_eigenvalues = this->number_negative_eigenvalues();
+      const size_t number_zero_eigenvalues = this->estimated_zero_eigenvalues;
+      const size_t number_positive_eigenvalues = this->factorized_dimension - (number_negative_eigenvalues + number_zero_eigenvalues);
+      return std::make_tuple(number_positive_eigenvalues, number_negative_eigenvalues, number_zero_eigenvalues);
+   }
+
+   size_t MINRESSolver::number_negative_eigenvalues() const {
+      return this->estimated_negative_eigenvalues;
+   }
+
+   bool MINRESSolver::matrix_is_singular() const {
+      return (this->estimated_zero_eigenvalues > 0);
+   }
+
+   size_t MINRESSolver::rank() const {
+      return this->factorized_dimension - this->estimated_zero_eigenvalues;
+   }
+
+   void MINRESSolver::matrix_vector_product(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& x, Vector<double>& result) {
+      for (size_t index: Range(matrix.dimension())) {
+         result[index] = 0.;
+      }
+      // the matrix stores one triangle: off-diagonal entries contribute twice
+      matrix.for_each([&](size_t row_index, size_t column_index, double element) {
+         result[row_index] += element * x[column_index];
+         if (row_index != column_index) {
+            result[column_index] += element * x[row_index];
+         }
+      });
+   }
+} // namespace
@@ -0,0 +1,60 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_MINRESSOLVER_H
+#define UNO_MINRESSOLVER_H
+
+#include "solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   /*! \class MINRESSolver
+    * \brief Iterative solver for symmetric indefinite systems
+    *
+    * Preconditioned MINRES (Paige & Saunders) with a positive diagonal (Jacobi) preconditioner.
+    * Unlike the direct solvers, it never forms a factorization, which makes it suitable for
+    * systems too large for MA57 or MUMPS to factor in memory.
+    * The inertia information required by the interface is estimated from the signs of the
+    * diagonal entries of the matrix, which is exact for sufficiently regularized KKT systems
+    */
+   class MINRESSolver final : public DirectSymmetricIndefiniteLinearSolver<SparseIndex, double> {
+   public:
+      MINRESSolver(size_t dimension, size_t max_iterations, double tolerance);
+      ~MINRESSolver() override = default;
+
+      void factorize(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs, Vector<double>& result) override;
+
+      [[nodiscard]] std::tuple<size_t, size_t, size_t> get_inertia() const override;
+      [[nodiscard]] size_t number_negative_eigenvalues() const override;
+      [[nodiscard]] bool matrix_is_singular() const override;
+      [[nodiscard]] size_t rank() const override;
+
+      // inexact solves: relax or tighten the residual tolerance of the iterations
+      void set_solve_tolerance(double new_tolerance) override { this->tolerance = new_tolerance; }
+
+   private:
+      const size_t max_iterations;
+      double tolerance;
+
+      // diagonal of the matrix and inverse diagonal preconditioner
+      Vector<double> diagonal;
+      Vector<double> inverse_preconditioner;
+      // diagonal-sign estimates of the inertia
+      size_t factorized_dimension{0};
+      size_t estimated_negative_eigenvalues{0};
+      size_t estimated_zero_eigenvalues{0};
+
+      // MINRES workspace, preallocated once
+      Vector<double> v_old, v_current, v_new;
+      Vector<double> z_current, z_new;
+      Vector<double> w_old, w_current, w_new;
+      Vector<double> matrix_vector;
+
+      static void matrix_vector_product(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& x, Vector<double>& result);
+   };
+} // namespace
+
+#endif // UNO_MINRESSOLVER_H
@@ -1,33 +1,74 @@
 // Copyright (c) 2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
+#include <cstring>
 #include "MUMPSSolver.hpp"
 #include "linear_algebra/SymmetricMatrix.hpp"
+#include "tools/Deadline.hpp"
+#include "tools/Logger.hpp"
+#include "tools/MemoryUsage.hpp"
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 #if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
 #include "mpi.h"
 #endif
 
-#define USE_COMM_WORLD -987654
-
 namespace uno {
-   MUMPSSolver::MUMPSSolver(size_t dimension, size_t number_nonzeros) : DirectSymmetricIndefiniteLinearSolver<size_t, double>(dimension),
-         COO_matrix(dimension, number_nonzeros, false) {
+   MUMPSSolver::MUMPSSolver(size_t dimension, size_t number_nonzeros, size_t number_threads, int fortran_communicator,
+         const std::string& out_of_core, const std::string& out_of_core_directory, size_t maximum_memory_MB) :
+         DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>(dimension),
+         COO_matrix(dimension, number_nonzeros, false),
+         out_of_core(out_of_core), maximum_memory_MB(maximum_memory_MB) {
       this->mumps_structure.sym = MUMPSSolver::GENERAL_SYMMETRIC;
 #if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
-      // TODO load number of processes from option file
+      // the host participates in the factorization
       this->mumps_structure.par = 1;
+      // distributed-entry mode engages automatically when the communicator spans several ranks
+      // (e.g. mpirun -n 4): the matrix no longer has to fit in one node's RAM
+      const MPI_Comm communicator = (fortran_communicator == MUMPSSolver::WORLD_COMMUNICATOR) ? MPI_COMM_WORLD :
+            MPI_Comm_f2c(fortran_communicator);
+      MPI_Comm_rank(communicator, &this->mpi_rank);
+      MPI_Comm_size(communicator, &this->number_mpi_processes);
+      this->distributed = (1 < this->number_mpi_processes);
 #endif
 #ifdef MUMPS_SEQUENTIAL
       this->mumps_structure.par = 1;
 #endif
       this->mumps_structure.job = MUMPSSolver::JOB_INIT;
-      this->mumps_structure.comm_fortran = USE_COMM_WORLD;
+      this->mumps_structure.comm_fortran = fortran_communicator;
       dmumps_c(&this->mumps_structure);
       // control parameters
       this->mumps_structure.icntl[0] = -1;
       this->mumps_structure.icntl[1] = -1;
       this->mumps_structure.icntl[2] = -1;
       this->mumps_structure.icntl[3] = 0;
+      // ICNTL(10): adaptive iterative refinement, at most 3 steps; a positive value makes MUMPS
+      // stop as soon as the scaled residual satisfies CNTL(2), so the well-conditioned systems
+      // (most iterations) pay no refinement at all
+      this->mumps_structure.icntl[9] = 3;
+      // ICNTL(16): number of OpenMP threads used within the node-level parallel factorization
+      this->mumps_structure.icntl[15] = static_cast<int>(number_threads);
+      if (this->distributed) {
+         // ICNTL(18) = 3: the entries are provided by all the ranks through irn_loc/jcn_loc/a_loc
+         this->mumps_structure.icntl[17] = 3;
+      }
+      // out-of-core factor storage: on the largest models the factors exceed RAM, which makes the
+      // factorization slow instead of impossible. ICNTL(22) is read at factorization time, so the
+      // "auto" policy can still flip it on after the analysis reported its memory estimate
+      if (this->out_of_core == "yes") {
+         this->mumps_structure.icntl[21] = 1;
+         this->out_of_core_active = true;
+      }
+      if (not out_of_core_directory.empty() && out_of_core_directory != "none") {
+         std::strncpy(this->mumps_structure.ooc_tmpdir, out_of_core_directory.c_str(), sizeof(this->mumps_structure.ooc_tmpdir) - 1);
+         this->mumps_structure.ooc_tmpdir[sizeof(this->mumps_structure.ooc_tmpdir) - 1] = '\0';
+      }
+      if (0 < this->maximum_memory_MB) {
+         // ICNTL(23): ceiling on the working memory per processor, in MB
+         this->mumps_structure.icntl[22] = static_cast<int>(this->maximum_memory_MB);
+      }
    }
 
    MUMPSSolver::~MUMPSSolver() {
@@ -35,34 +76,141 @@ namespace uno {
       dmumps_c(&this->mumps_structure);
    }
 
-   void MUMPSSolver::factorize(const SymmetricMatrix<size_t, double>& matrix) {
+   void MUMPSSolver::factorize(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      // last cancellation point before entering MUMPS, which cannot be interrupted
+      Deadline::check();
       // general factorization method: symbolic factorization and numerical factorization
       this->do_symbolic_factorization(matrix);
       this->do_numerical_factorization(matrix);
    }
 
-   void MUMPSSolver::do_symbolic_factorization(const SymmetricMatrix<size_t, double>& matrix) {
-      this->save_matrix_to_local_format(matrix);
+   void MUMPSSolver::do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      // the pattern (1-based, int indices) is converted only when the structure of the matrix
+      // changed; the values are picked up at factorization time, straight from the matrix storage
+      if (matrix.structure_version() != this->converted_structure_version) {
+         this->save_matrix_to_local_format(matrix);
+         this->converted_structure_version = matrix.structure_version();
+      }
+      // the analysis phase only has to be performed when the sparsity pattern changes
+      if (this->analyzed_dimension == matrix.dimension() && this->analyzed_number_nonzeros == matrix.number_nonzeros()) {
+         return;
+      }
       this->mumps_structure.n = static_cast<int>(matrix.dimension());
-      this->mumps_structure.nnz = static_cast<int>(matrix.number_nonzeros());
       this->mumps_structure.job = MUMPSSolver::JOB_ANALYSIS;
       // connect the local COO matrix with the pointers in the structure
-      this->mumps_structure.irn = this->COO_matrix.row_indices_pointer();
-      this->mumps_structure.jcn = this->COO_matrix.column_indices_pointer();
+      if (this->distributed) {
+         this->mumps_structure.nnz_loc = static_cast<int64_t>(this->local_number_nonzeros);
+         this->mumps_structure.irn_loc = this->COO_matrix.row_indices_pointer();
+         this->mumps_structure.jcn_loc = this->COO_matrix.column_indices_pointer();
+      }
+      else {
+         this->mumps_structure.nnz = static_cast<int>(matrix.number_nonzeros());
+         this->mumps_structure.irn = this->COO_matrix.row_indices_pointer();
+         this->mumps_structure.jcn = this->COO_matrix.column_indices_pointer();
+      }
       dmumps_c(&this->mumps_structure);
+      this->analyzed_dimension = matrix.dimension();
+      this->analyzed_number_nonzeros = matrix.number_nonzeros();
+      // INFOG(20): estimated number of entries in the factors (a negative value is in millions)
+      const long long factor_entries = (0 <= this->mumps_structure.infog[19]) ? this->mumps_structure.infog[19] :
+            -static_cast<long long>(this->mumps_structure.infog[19]) * 1000000;
+      MemoryUsage::record(MemoryUsage::FACTORS, static_cast<size_t>(factor_entries) * sizeof(double));
+      this->configure_out_of_core_after_analysis();
    }
 
-   void MUMPSSolver::do_numerical_factorization(const SymmetricMatrix<size_t, double>& /*matrix*/) {
+   // "auto" out-of-core policy: compare the in-core memory estimated by the analysis (INFOG(16),
+   // max over the processors, in MB) against the ceiling (the MUMPS_memory_limit_MB option, or the
+   // physical memory when no ceiling was given) and enable ICNTL(22) before the factorization would
+   // run out of memory, rather than after
+   void MUMPSSolver::configure_out_of_core_after_analysis() {
+      if (this->out_of_core != "auto" || this->out_of_core_active) {
+         return;
+      }
+      const size_t estimated_memory_MB = static_cast<size_t>(std::max(0, this->mumps_structure.infog[15]));
+      const size_t memory_ceiling_MB = (0 < this->maximum_memory_MB) ? this->maximum_memory_MB : MUMPSSolver::available_memory_MB();
+      if (0 < memory_ceiling_MB && memory_ceiling_MB < estimated_memory_MB) {
+         WARNING << "MUMPS: the estimated factorization memory (" << estimated_memory_MB << " MB) exceeds the ceiling ("
+               << memory_ceiling_MB << " MB), switching to out-of-core factor storage\n";
+         this->mumps_structure.icntl[21] = 1;
+         this->out_of_core_active = true;
+      }
+   }
+
+   // physical memory of the machine, in MB (0 when it cannot be determined)
+   size_t MUMPSSolver::available_memory_MB() {
+#ifndef _WIN32
+      const long number_pages = sysconf(_SC_PHYS_PAGES);
+      const long page_size = sysconf(_SC_PAGE_SIZE);
+      if (0 < number_pages && 0 < page_size) {
+         return static_cast<size_t>(number_pages) * static_cast<size_t>(page_size) / (1024 * 1024);
+      }
+#endif
+      return 0;
+   }
+
+   void MUMPSSolver::do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
       this->mumps_structure.job = MUMPSSolver::JOB_FACTORIZATION;
-      this->mumps_structure.a = this->COO_matrix.data_pointer();
+      if (this->distributed) {
+         // refresh the local slice of the values: the entries of the matrix storage follow the
+         // traversal order in which the indices were converted
+         const double* values = matrix.data_pointer();
+         std::copy(values + this->local_entry_offset, values + this->local_entry_offset + this->local_number_nonzeros,
+               this->COO_matrix.data_pointer());
+         this->mumps_structure.a_loc = this->COO_matrix.data_pointer();
+      }
+      else {
+         // zero-copy handoff: MUMPS reads the values directly from the matrix storage
+         this->mumps_structure.a = const_cast<double*>(matrix.data_pointer());
+      }
       dmumps_c(&this->mumps_structure);
    }
 
-   void MUMPSSolver::solve_indefinite_system(const SymmetricMatrix<size_t, double>& /*matrix*/, const Vector<double>& rhs, Vector<double>& result) {
+   void MUMPSSolver::factorize_with_shift(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      // cancellation point: the inertia correction may chain many refactorizations
+      Deadline::check();
+      // only the values changed: refactorize numerically against the existing analysis, reading the
+      // values straight from the matrix storage (the converted pattern is untouched)
+      this->do_numerical_factorization(matrix);
+   }
+
+   void MUMPSSolver::solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& /*matrix*/, const Vector<double>& rhs, Vector<double>& result) {
       result = rhs;
+      // the right-hand side is centralized: only significant on rank 0, which drives the iterations
       this->mumps_structure.rhs = result.data();
       this->mumps_structure.job = MUMPSSolver::JOB_SOLVE;
       dmumps_c(&this->mumps_structure);
+      this->broadcast_solution(result, 1);
+   }
+
+   void MUMPSSolver::solve_indefinite_systems(const SymmetricMatrix<SparseIndex, double>& /*matrix*/, const Vector<double>& rhs_block,
+         Vector<double>& result_block, size_t number_systems) {
+      // copy the right-hand sides into the result block (overwritten by MUMPS)
+      result_block = rhs_block;
+      this->mumps_structure.rhs = result_block.data();
+      this->mumps_structure.nrhs = static_cast<int>(number_systems);
+      this->mumps_structure.lrhs = static_cast<int>(this->dimension); // leading dimension of the blocks
+      this->mumps_structure.job = MUMPSSolver::JOB_SOLVE;
+      dmumps_c(&this->mumps_structure);
+      // restore the single right-hand side default
+      this->mumps_structure.nrhs = 1;
+      this->broadcast_solution(result_block, number_systems);
+   }
+
+   size_t MUMPSSolver::expected_number_factor_entries() const {
+      // INFOG(20): estimated number of entries in the factors, reported by the analysis (a
+      // negative value gives the count in millions)
+      const int estimate = this->mumps_structure.infog[19];
+      return (0 <= estimate) ? static_cast<size_t>(estimate) : static_cast<size_t>(-estimate) * 1000000;
+   }
+
+   size_t MUMPSSolver::expected_factor_memory_bytes() const {
+      // out-of-core factor storage fits by construction: report no in-core requirement so that the
+      // upfront memory guard does not abort a solve that the out-of-core policy already rescued
+      if (this->out_of_core_active) {
+         return 0;
+      }
+      // INFOG(16): estimated in-core working memory (max over the processors), in MB
+      return static_cast<size_t>(std::max(0, this->mumps_structure.infog[15])) * 1000000;
    }
 
    std::tuple<size_t, size_t, size_t> MUMPSSolver::get_inertia() const {
@@ -90,11 +238,40 @@ namespace uno {
       return this->dimension - this->number_zero_eigenvalues();
    }
 
-   void MUMPSSolver::save_matrix_to_local_format(const SymmetricMatrix<size_t, double>& matrix) {
-      // build the internal matrix representation
+   void MUMPSSolver::save_matrix_to_local_format(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      // build the internal matrix representation. In distributed mode, each rank keeps a contiguous
+      // slice of the entries (every rank assembles the same matrix, so the slices partition it)
+      size_t slice_start = 0;
+      size_t slice_end = matrix.number_nonzeros();
+      if (this->distributed) {
+         const size_t number_nonzeros = matrix.number_nonzeros();
+         const size_t number_processes = static_cast<size_t>(this->number_mpi_processes);
+         const size_t rank = static_cast<size_t>(this->mpi_rank);
+         slice_start = (rank * number_nonzeros) / number_processes;
+         slice_end = ((rank + 1) * number_nonzeros) / number_processes;
+         this->local_entry_offset = slice_start;
+         this->local_number_nonzeros = slice_end - slice_start;
+      }
       this->COO_matrix.reset();
+      size_t entry_index = 0;
       for (const auto [row_index, column_index, element]: matrix) {
-         this->COO_matrix.insert(element, static_cast<int>(row_index + this->fortran_shift), static_cast<int>(column_index + this->fortran_shift));
+         if (slice_start <= entry_index && entry_index < slice_end) {
+            this->COO_matrix.insert(element, static_cast<int>(row_index + this->fortran_shift),
+                  static_cast<int>(column_index + this->fortran_shift));
+         }
+         entry_index++;
       }
    }
+
+   // in distributed mode, MUMPS centralizes the solution on rank 0: share it with the other ranks
+   // so that every rank carries consistent iterates
+   void MUMPSSolver::broadcast_solution([[maybe_unused]] Vector<double>& result, [[maybe_unused]] size_t number_systems) {
+#if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+      if (this->distributed) {
+         const MPI_Comm communicator = (this->mumps_structure.comm_fortran == MUMPSSolver::WORLD_COMMUNICATOR) ? MPI_COMM_WORLD :
+               MPI_Comm_f2c(this->mumps_structure.comm_fortran);
+         MPI_Bcast(result.data(), static_cast<int>(this->dimension * number_systems), MPI_DOUBLE, 0, communicator);
+      }
+#endif
+   }
 } // namespace
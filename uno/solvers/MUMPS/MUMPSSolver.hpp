@@ -4,22 +4,34 @@
 #ifndef UNO_MUMPSSOLVER_H
 #define UNO_MUMPSSOLVER_H
 
+#include <cstdint>
+#include <string>
 #include "solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
 #include "linear_algebra/COOSparseStorage.hpp"
 #include "dmumps_c.h"
 
 namespace uno {
-   class MUMPSSolver : public DirectSymmetricIndefiniteLinearSolver<size_t, double> {
+   class MUMPSSolver final : public DirectSymmetricIndefiniteLinearSolver<SparseIndex, double> {
    public:
-      explicit MUMPSSolver(size_t dimension, size_t number_nonzeros);
+      // MUMPS encoding of MPI_COMM_WORLD (the default communicator)
+      static const int WORLD_COMMUNICATOR = -987654;
+
+      explicit MUMPSSolver(size_t dimension, size_t number_nonzeros, size_t number_threads = 1,
+            int fortran_communicator = MUMPSSolver::WORLD_COMMUNICATOR, const std::string& out_of_core = "no",
+            const std::string& out_of_core_directory = "", size_t maximum_memory_MB = 0);
       ~MUMPSSolver() override;
 
-      void factorize(const SymmetricMatrix<size_t, double>& matrix) override;
-      void do_symbolic_factorization(const SymmetricMatrix<size_t, double>& matrix) override;
-      void do_numerical_factorization(const SymmetricMatrix<size_t, double>& matrix) override;
-      void solve_indefinite_system(const SymmetricMatrix<size_t, double>& matrix, const Vector<double>& rhs,
+      void factorize(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void factorize_with_shift(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs,
             Vector<double>& result) override;
+      void solve_indefinite_systems(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs_block,
+            Vector<double>& result_block, size_t number_systems) override;
 
+      [[nodiscard]] size_t expected_number_factor_entries() const override;
+      [[nodiscard]] size_t expected_factor_memory_bytes() const override;
       [[nodiscard]] std::tuple<size_t, size_t, size_t> get_inertia() const override;
       [[nodiscard]] size_t number_negative_eigenvalues() const override;
       [[nodiscard]] size_t number_zero_eigenvalues() const;
@@ -40,7 +52,30 @@ namespace uno {
       static const int GENERAL_SYMMETRIC = 2;
 
       const size_t fortran_shift{1};
-      void save_matrix_to_local_format(const SymmetricMatrix<size_t, double>& row_index);
+      // distributed-entry mode (several MPI ranks): each rank holds a contiguous slice of the matrix
+      // entries and passes it through irn_loc/jcn_loc/a_loc; the right-hand side and the solution
+      // stay centralized on rank 0 and the solution is broadcast after each solve
+      bool distributed{false};
+      int mpi_rank{0};
+      int number_mpi_processes{1};
+      size_t local_entry_offset{0};
+      size_t local_number_nonzeros{0};
+      // pattern of the last analysis, to avoid re-running it on an identical sparsity pattern
+      size_t analyzed_dimension{0};
+      size_t analyzed_number_nonzeros{0};
+      // structure version of the matrix whose pattern is currently converted into the local COO copy:
+      // as long as it is unchanged (values-only updates), the conversion is skipped and the
+      // factorization reads the values straight from the matrix storage
+      size_t converted_structure_version{SIZE_MAX};
+      // out-of-core factor storage (ICNTL(22)): "no", "yes", or "auto" (enabled when the factor
+      // memory estimated by the analysis exceeds the memory ceiling)
+      const std::string out_of_core;
+      const size_t maximum_memory_MB;
+      bool out_of_core_active{false};
+      void configure_out_of_core_after_analysis();
+      [[nodiscard]] static size_t available_memory_MB();
+      void save_matrix_to_local_format(const SymmetricMatrix<SparseIndex, double>& row_index);
+      void broadcast_solution(Vector<double>& result, size_t number_systems);
    };
 } // namespace
 
@@ -0,0 +1,297 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cassert>
+#include <tuple>
+#include "OSQPSolver.hpp"
+#include "ingredients/subproblems/Direction.hpp"
+#include "linear_algebra/RectangularMatrix.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/WarmstartInformation.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+
+namespace uno {
+   OSQPSolver::OSQPSolver(size_t number_variables, size_t number_constraints, size_t number_objective_gradient_nonzeros,
+         size_t number_jacobian_nonzeros, size_t number_hessian_nonzeros, const Options& /*options*/):
+         QPSolver(),
+         linear_cost(number_variables),
+         lower_bounds(number_constraints + number_variables),
+         upper_bounds(number_constraints + number_variables) {
+      this->hessian_column_starts.reserve(number_variables + 1);
+      this->hessian_row_indices.reserve(number_hessian_nonzeros);
+      this->hessian_values.reserve(number_hessian_nonzeros);
+      // the identity block for the variable bounds adds one entry per column
+      this->jacobian_column_starts.reserve(number_variables + 1);
+      this->jacobian_row_indices.reserve(number_jacobian_nonzeros + number_objective_gradient_nonzeros + number_variables);
+      this->jacobian_values.reserve(number_jacobian_nonzeros + number_objective_gradient_nonzeros + number_variables);
+
+      osqp_set_default_settings(&this->settings);
+      this->settings.verbose = 0;
+      // polishing recovers an accurate active set and multipliers from the first-order solution
+      this->settings.polish = 1;
+      // warm start from the primal-dual solution of the previous call
+      this->settings.warm_start = 1;
+   }
+
+   OSQPSolver::~OSQPSolver() {
+      if (this->workspace != nullptr) {
+         osqp_cleanup(this->workspace);
+      }
+   }
+
+   void OSQPSolver::solve_LP(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
+         const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
+         const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
+         const RectangularMatrix<double>& constraint_jacobian, const Vector<double>& initial_point, Direction& direction,
+         const WarmstartInformation& warmstart_information) {
+      // an LP is a QP with a zero Hessian
+      this->solve_subproblem(number_variables, number_constraints, variables_lower_bounds, variables_upper_bounds, constraints_lower_bounds,
+            constraints_upper_bounds, linear_objective, constraint_jacobian, nullptr, initial_point, direction, warmstart_information);
+   }
+
+   void OSQPSolver::solve_QP(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
+         const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
+         const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
+         const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<SparseIndex, double>& hessian,
+         const Vector<double>& initial_point, Direction& direction, const WarmstartInformation& warmstart_information) {
+      this->solve_subproblem(number_variables, number_constraints, variables_lower_bounds, variables_upper_bounds, constraints_lower_bounds,
+            constraints_upper_bounds, linear_objective, constraint_jacobian, &hessian, initial_point, direction, warmstart_information);
+   }
+
+   // assemble the upper triangle of the Hessian (P) and the stacked Jacobian/identity (A) in CSC
+   // format with sorted, unique row indices, as OSQP requires. The previous patterns are compared on
+   // the fly, so that the caller knows whether the cached workspace factorizations are still valid
+   void OSQPSolver::save_matrices_to_local_format(size_t number_variables, size_t number_constraints,
+         const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<SparseIndex, double>* hessian,
+         bool& hessian_pattern_changed, bool& jacobian_pattern_changed) {
+      // P: gather the entries of the upper triangle, sort them by (column, row) and merge duplicates
+      std::vector<std::tuple<c_int, c_int, c_float>> hessian_triplets;
+      if (hessian != nullptr) {
+         hessian_triplets.reserve(hessian->number_nonzeros());
+         hessian->for_each([&](SparseIndex row_index, SparseIndex column_index, double element) {
+            const c_int upper_row = static_cast<c_int>(std::min(row_index, column_index));
+            const c_int upper_column = static_cast<c_int>(std::max(row_index, column_index));
+            hessian_triplets.emplace_back(upper_row, upper_column, element);
+         });
+         std::sort(hessian_triplets.begin(), hessian_triplets.end(), [](const auto& triplet1, const auto& triplet2) {
+            return std::tie(std::get<1>(triplet1), std::get<0>(triplet1)) < std::tie(std::get<1>(triplet2), std::get<0>(triplet2));
+         });
+      }
+      std::vector<c_int> new_hessian_column_starts(number_variables + 1, 0);
+      std::vector<c_int> new_hessian_row_indices;
+      std::vector<c_float> new_hessian_values;
+      new_hessian_row_indices.reserve(hessian_triplets.size());
+      new_hessian_values.reserve(hessian_triplets.size());
+      c_int previous_row_index = -1;
+      c_int previous_column_index = -1;
+      for (const auto& [row_index, column_index, element]: hessian_triplets) {
+         if (row_index == previous_row_index && column_index == previous_column_index) {
+            // duplicate entry: merge it
+            new_hessian_values.back() += element;
+         }
+         else {
+            new_hessian_row_indices.emplace_back(row_index);
+            new_hessian_values.emplace_back(element);
+            previous_row_index = row_index;
+            previous_column_index = column_index;
+         }
+         new_hessian_column_starts[static_cast<size_t>(column_index) + 1] = static_cast<c_int>(new_hessian_values.size());
+      }
+      // carry the column starts over the empty columns
+      for (size_t column_index: Range(1, number_variables + 1)) {
+         new_hessian_column_starts[column_index] = std::max(new_hessian_column_starts[column_index],
+               new_hessian_column_starts[column_index - 1]);
+      }
+      hessian_pattern_changed = (new_hessian_column_starts != this->hessian_column_starts) ||
+         (new_hessian_row_indices != this->hessian_row_indices);
+      this->hessian_column_starts = std::move(new_hessian_column_starts);
+      this->hessian_row_indices = std::move(new_hessian_row_indices);
+      this->hessian_values = std::move(new_hessian_values);
+
+      // A: count the Jacobian entries in each column, plus one identity entry per column
+      std::vector<c_int> new_jacobian_column_starts(number_variables + 1, 0);
+      for (size_t constraint_index: Range(number_constraints)) {
+         for (const auto [variable_index, derivative]: constraint_jacobian[constraint_index]) {
+            if (variable_index < number_variables) {
+               new_jacobian_column_starts[variable_index + 1]++;
+            }
+         }
+      }
+      for (size_t variable_index: Range(1, number_variables + 1)) {
+         // +1 for the identity entry of column variable_index - 1
+         new_jacobian_column_starts[variable_index] += new_jacobian_column_starts[variable_index - 1] + 1;
+      }
+      const size_t number_nonzeros = static_cast<size_t>(new_jacobian_column_starts[number_variables]);
+      std::vector<c_int> new_jacobian_row_indices(number_nonzeros);
+      std::vector<c_float> new_jacobian_values(number_nonzeros);
+      // fill the Jacobian entries column by column: the row-by-row traversal yields increasing row
+      // indices within each column
+      std::vector<c_int> current_positions(new_jacobian_column_starts.cbegin(), new_jacobian_column_starts.cend() - 1);
+      for (size_t constraint_index: Range(number_constraints)) {
+         for (const auto [variable_index, derivative]: constraint_jacobian[constraint_index]) {
+            if (variable_index < number_variables) {
+               const size_t position = static_cast<size_t>(current_positions[variable_index]);
+               new_jacobian_row_indices[position] = static_cast<c_int>(constraint_index);
+               new_jacobian_values[position] = derivative;
+               current_positions[variable_index]++;
+            }
+         }
+      }
+      // append the identity entry at the bottom of each column
+      for (size_t variable_index: Range(number_variables)) {
+         const size_t position = static_cast<size_t>(current_positions[variable_index]);
+         new_jacobian_row_indices[position] = static_cast<c_int>(number_constraints + variable_index);
+         new_jacobian_values[position] = 1.;
+      }
+      jacobian_pattern_changed = (new_jacobian_column_starts != this->jacobian_column_starts) ||
+         (new_jacobian_row_indices != this->jacobian_row_indices);
+      this->jacobian_column_starts = std::move(new_jacobian_column_starts);
+      this->jacobian_row_indices = std::move(new_jacobian_row_indices);
+      this->jacobian_values = std::move(new_jacobian_values);
+   }
+
+   void OSQPSolver::solve_subproblem(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
+         const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
+         const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
+         const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<SparseIndex, double>* hessian,
+         const Vector<double>& /*initial_point*/, Direction& direction, const WarmstartInformation& warmstart_information) {
+      // linear cost
+      this->linear_cost.resize(number_variables);
+      for (size_t variable_index: Range(number_variables)) {
+         this->linear_cost[variable_index] = 0.;
+      }
+      for (const auto [variable_index, derivative]: linear_objective) {
+         this->linear_cost[variable_index] = derivative;
+      }
+      // bounds: the constraints come first, then the variables (matching the stacked A)
+      this->lower_bounds.resize(number_constraints + number_variables);
+      this->upper_bounds.resize(number_constraints + number_variables);
+      for (size_t constraint_index: Range(number_constraints)) {
+         this->lower_bounds[constraint_index] = (constraints_lower_bounds[constraint_index] == -INF<double>) ? -OSQP_INFTY :
+            constraints_lower_bounds[constraint_index];
+         this->upper_bounds[constraint_index] = (constraints_upper_bounds[constraint_index] == INF<double>) ? OSQP_INFTY :
+            constraints_upper_bounds[constraint_index];
+      }
+      for (size_t variable_index: Range(number_variables)) {
+         this->lower_bounds[number_constraints + variable_index] = (variables_lower_bounds[variable_index] == -INF<double>) ? -OSQP_INFTY :
+            variables_lower_bounds[variable_index];
+         this->upper_bounds[number_constraints + variable_index] = (variables_upper_bounds[variable_index] == INF<double>) ? OSQP_INFTY :
+            variables_upper_bounds[variable_index];
+      }
+
+      bool hessian_pattern_changed = false;
+      bool jacobian_pattern_changed = false;
+      this->save_matrices_to_local_format(number_variables, number_constraints, constraint_jacobian, hessian, hessian_pattern_changed,
+            jacobian_pattern_changed);
+
+      const bool dimensions_changed = (number_variables != this->loaded_number_variables) ||
+         (number_constraints != this->loaded_number_constraints);
+      if (this->workspace == nullptr || dimensions_changed || hessian_pattern_changed || jacobian_pattern_changed) {
+         // the patterns changed: set the workspace up from scratch
+         if (this->workspace != nullptr) {
+            osqp_cleanup(this->workspace);
+            this->workspace = nullptr;
+         }
+         csc hessian_matrix{};
+         hessian_matrix.m = static_cast<c_int>(number_variables);
+         hessian_matrix.n = static_cast<c_int>(number_variables);
+         hessian_matrix.nzmax = static_cast<c_int>(this->hessian_values.size());
+         hessian_matrix.p = this->hessian_column_starts.data();
+         hessian_matrix.i = this->hessian_row_indices.data();
+         hessian_matrix.x = this->hessian_values.data();
+         hessian_matrix.nz = -1;
+         csc jacobian_matrix{};
+         jacobian_matrix.m = static_cast<c_int>(number_constraints + number_variables);
+         jacobian_matrix.n = static_cast<c_int>(number_variables);
+         jacobian_matrix.nzmax = static_cast<c_int>(this->jacobian_values.size());
+         jacobian_matrix.p = this->jacobian_column_starts.data();
+         jacobian_matrix.i = this->jacobian_row_indices.data();
+         jacobian_matrix.x = this->jacobian_values.data();
+         jacobian_matrix.nz = -1;
+
+         OSQPData data{};
+         data.n = static_cast<c_int>(number_variables);
+         data.m = static_cast<c_int>(number_constraints + number_variables);
+         data.P = &hessian_matrix;
+         data.q = this->linear_cost.data();
+         data.A = &jacobian_matrix;
+         data.l = this->lower_bounds.data();
+         data.u = this->upper_bounds.data();
+         const c_int setup_status = osqp_setup(&this->workspace, &data, &this->settings);
+         if (setup_status != 0) {
+            DEBUG << YELLOW << "OSQP setup failed with status " << setup_status << '\n' << RESET;
+            direction.status = SubproblemStatus::ERROR;
+            return;
+         }
+         this->loaded_number_variables = number_variables;
+         this->loaded_number_constraints = number_constraints;
+      }
+      else {
+         // the patterns are unchanged: update the cached workspace in place and let OSQP warm start
+         // from the primal-dual solution of the previous call
+         if (warmstart_information.objective_changed || warmstart_information.constraints_changed) {
+            osqp_update_P(this->workspace, this->hessian_values.data(), OSQP_NULL, static_cast<c_int>(this->hessian_values.size()));
+            osqp_update_A(this->workspace, this->jacobian_values.data(), OSQP_NULL, static_cast<c_int>(this->jacobian_values.size()));
+            osqp_update_lin_cost(this->workspace, this->linear_cost.data());
+         }
+         if (warmstart_information.variable_bounds_changed || warmstart_information.constraint_bounds_changed) {
+            osqp_update_bounds(this->workspace, this->lower_bounds.data(), this->upper_bounds.data());
+         }
+      }
+
+      // solve the QP
+      osqp_solve(this->workspace);
+      switch (this->workspace->info->status_val) {
+         case OSQP_SOLVED:
+         case OSQP_SOLVED_INACCURATE:
+            direction.status = SubproblemStatus::OPTIMAL;
+            break;
+         case OSQP_PRIMAL_INFEASIBLE:
+         case OSQP_PRIMAL_INFEASIBLE_INACCURATE:
+            direction.status = SubproblemStatus::INFEASIBLE;
+            break;
+         case OSQP_DUAL_INFEASIBLE:
+         case OSQP_DUAL_INFEASIBLE_INACCURATE:
+            direction.status = SubproblemStatus::UNBOUNDED_PROBLEM;
+            break;
+         default:
+            DEBUG << YELLOW << "OSQP terminated with status " << this->workspace->info->status << '\n' << RESET;
+            direction.status = SubproblemStatus::ERROR;
+            break;
+      }
+      if (direction.status == SubproblemStatus::OPTIMAL) {
+         this->set_direction(number_variables, number_constraints, direction);
+      }
+   }
+
+   void OSQPSolver::set_direction(size_t number_variables, size_t number_constraints, Direction& direction) {
+      direction.primals.resize(number_variables);
+      for (size_t variable_index: Range(number_variables)) {
+         direction.primals[variable_index] = this->workspace->solution->x[variable_index];
+      }
+      direction.subproblem_objective = this->workspace->info->obj_val;
+
+      // multipliers: the OSQP convention (stationarity Pd + q + A'y = 0) is the opposite of the Uno
+      // convention (positive multiplier at an active lower bound), hence the sign flips
+      direction.multipliers.reset();
+      for (size_t constraint_index: Range(number_constraints)) {
+         direction.multipliers.constraints[constraint_index] = -this->workspace->solution->y[constraint_index];
+      }
+      for (size_t variable_index: Range(number_variables)) {
+         const double bound_multiplier = -this->workspace->solution->y[number_constraints + variable_index];
+         if (0. < bound_multiplier) {
+            direction.multipliers.lower_bounds[variable_index] = bound_multiplier;
+            direction.active_bounds.at_lower_bound.emplace_back(variable_index);
+         }
+         else if (bound_multiplier < 0.) {
+            direction.multipliers.upper_bounds[variable_index] = bound_multiplier;
+            direction.active_bounds.at_upper_bound.emplace_back(variable_index);
+         }
+      }
+   }
+} // namespace
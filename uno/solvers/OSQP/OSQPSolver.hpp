@@ -0,0 +1,75 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_OSQPSOLVER_H
+#define UNO_OSQPSOLVER_H
+
+#include <vector>
+#include "solvers/QPSolver.hpp"
+#include "osqp.h"
+
+namespace uno {
+   // forward declaration
+   class Options;
+
+   /*! \class OSQPSolver
+    * \brief Interface to the OSQP first-order solver for the QP subproblems
+    *
+    * OSQP solves min 1/2 d'Pd + q'd s.t. l <= Ad <= u, where A stacks the constraint Jacobian and
+    * the identity (for the variable bounds). The workspace is kept across calls: when the sparsity
+    * patterns are unchanged (the usual case across SQP iterations), only the matrix values, the cost
+    * and the bounds are updated, and OSQP warm starts from the previous primal-dual solution
+    */
+   class OSQPSolver : public QPSolver {
+   public:
+      OSQPSolver(size_t number_variables, size_t number_constraints, size_t number_objective_gradient_nonzeros,
+            size_t number_jacobian_nonzeros, size_t number_hessian_nonzeros, const Options& options);
+      ~OSQPSolver() override;
+
+      void solve_LP(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
+            const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
+            const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
+            const RectangularMatrix<double>& constraint_jacobian, const Vector<double>& initial_point, Direction& direction,
+            const WarmstartInformation& warmstart_information) override;
+
+      void solve_QP(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
+            const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
+            const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
+            const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<SparseIndex, double>& hessian,
+            const Vector<double>& initial_point, Direction& direction, const WarmstartInformation& warmstart_information) override;
+
+   protected:
+      OSQPWorkspace* workspace{nullptr};
+      OSQPSettings settings;
+
+      // local CSC copies of the matrices, in the OSQP integer and floating-point types
+      // P: upper triangle of the Hessian
+      std::vector<c_int> hessian_column_starts;
+      std::vector<c_int> hessian_row_indices;
+      std::vector<c_float> hessian_values;
+      // A: constraint Jacobian stacked on top of the identity
+      std::vector<c_int> jacobian_column_starts;
+      std::vector<c_int> jacobian_row_indices;
+      std::vector<c_float> jacobian_values;
+      // cost and bounds
+      std::vector<c_float> linear_cost;
+      std::vector<c_float> lower_bounds;
+      std::vector<c_float> upper_bounds;
+
+      // dimensions of the problem currently loaded in the workspace
+      size_t loaded_number_variables{0};
+      size_t loaded_number_constraints{0};
+
+      void save_matrices_to_local_format(size_t number_variables, size_t number_constraints,
+            const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<SparseIndex, double>* hessian,
+            bool& hessian_pattern_changed, bool& jacobian_pattern_changed);
+      void solve_subproblem(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
+            const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
+            const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
+            const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<SparseIndex, double>* hessian,
+            const Vector<double>& initial_point, Direction& direction, const WarmstartInformation& warmstart_information);
+      void set_direction(size_t number_variables, size_t number_constraints, Direction& direction);
+   };
+} // namespace
+
+#endif // UNO_OSQPSOLVER_H
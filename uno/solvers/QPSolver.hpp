@@ -5,6 +5,7 @@
 #define UNO_QPSOLVER_H
 
 #include <vector>
+#include "linear_algebra/SparseIndex.hpp"
 #include "solvers/LPSolver.hpp"
 
 namespace uno {
@@ -36,7 +37,7 @@ namespace uno {
       virtual void solve_QP(size_t number_variables, size_t number_constraints, const std::vector<double>& variables_lower_bounds,
             const std::vector<double>& variables_upper_bounds, const std::vector<double>& constraints_lower_bounds,
             const std::vector<double>& constraints_upper_bounds, const SparseVector<double>& linear_objective,
-            const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<size_t, double>& hessian, const Vector<double>& initial_point,
+            const RectangularMatrix<double>& constraint_jacobian, const SymmetricMatrix<SparseIndex, double>& hessian, const Vector<double>& initial_point,
             Direction& direction, const WarmstartInformation& warmstart_information) = 0;
    };
 
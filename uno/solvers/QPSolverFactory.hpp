@@ -10,6 +10,9 @@
 #ifdef HAS_BQPD
 #include "solvers/BQPD/BQPDSolver.hpp"
 #endif
+#ifdef HAS_OSQP
+#include "solvers/OSQP/OSQPSolver.hpp"
+#endif
 
 namespace uno {
    class QPSolverFactory {
@@ -23,6 +26,12 @@ namespace uno {
             return std::make_unique<BQPDSolver>(number_variables, number_constraints, number_objective_gradient_nonzeros, number_jacobian_nonzeros,
                number_hessian_nonzeros, BQPDProblemType::QP, options);
          }
+#endif
+#ifdef HAS_OSQP
+         if (QP_solver_name == "OSQP") {
+            return std::make_unique<OSQPSolver>(number_variables, number_constraints, number_objective_gradient_nonzeros,
+               number_jacobian_nonzeros, number_hessian_nonzeros, options);
+         }
 #endif
          throw std::invalid_argument("QP solver name is unknown");
       }
@@ -32,6 +41,9 @@ namespace uno {
          std::vector<std::string> solvers{};
 #ifdef HAS_BQPD
          solvers.emplace_back("BQPD");
+#endif
+#ifdef HAS_OSQP
+         solvers.emplace_back("OSQP");
 #endif
          return solvers;
       }
@@ -0,0 +1,149 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <utility>
+#include "RacingLinearSolver.hpp"
+#include "tools/Logger.hpp"
+#include "tools/TaskScheduler.hpp"
+
+namespace uno {
+   RacingLinearSolver::RacingLinearSolver(size_t dimension,
+         std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> primary_solver, std::string primary_name,
+         std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> rival_solver, std::string rival_name,
+         size_t race_factorizations):
+         DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>(dimension),
+         primary(std::move(primary_solver)), primary_name(std::move(primary_name)),
+         rival(std::move(rival_solver)), rival_name(std::move(rival_name)),
+         race_factorizations(std::max(size_t(1), race_factorizations)) {
+   }
+
+   void RacingLinearSolver::race(const std::function<void(DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>&)>& task) {
+      // the matrix is only read by the factorizations, so both backends can work on it concurrently.
+      // Wall (not CPU) time is measured: a backend that burns more threads for a faster answer wins
+      double rival_elapsed = 0.;
+      const auto rival_task = [&]() {
+         const auto rival_start_time = std::chrono::steady_clock::now();
+         task(*this->rival);
+         rival_elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - rival_start_time).count();
+      };
+      // the rival runs on the shared task scheduler when it has workers (global thread budget,
+      // critical priority since the race blocks on it); otherwise on a dedicated thread, since
+      // running it inline on the submitter would serialize the race
+      TaskScheduler& scheduler = TaskScheduler::global();
+      std::future<void> rival_future = (0 < scheduler.number_workers()) ?
+            scheduler.submit(TaskScheduler::Priority::CRITICAL, CancellationToken(), rival_task) :
+            std::async(std::launch::async, rival_task);
+      const auto start_time = std::chrono::steady_clock::now();
+      task(*this->primary);
+      this->primary_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+      rival_future.get();
+      this->rival_time += rival_elapsed;
+   }
+
+   void RacingLinearSolver::adopt_winner() {
+      if (this->rival_time < this->primary_time) {
+         DEBUG << "Linear solver race: adopting " << this->rival_name << " (" << this->rival_time << "s vs " <<
+            this->primary_time << "s for " << this->primary_name << ")\n";
+         this->primary = std::move(this->rival);
+         this->primary_name = this->rival_name;
+      }
+      else {
+         DEBUG << "Linear solver race: keeping " << this->primary_name << " (" << this->primary_time << "s vs " <<
+            this->rival_time << "s for " << this->rival_name << ")\n";
+      }
+      // tear down the loser and turn the wrapper into a plain forwarding layer
+      this->rival.reset();
+   }
+
+   void RacingLinearSolver::factorize(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      this->do_symbolic_factorization(matrix);
+      this->do_numerical_factorization(matrix);
+   }
+
+   void RacingLinearSolver::do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      if (this->rival != nullptr) {
+         this->race([&](DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>& solver) {
+            solver.do_symbolic_factorization(matrix);
+         });
+      }
+      else {
+         this->primary->do_symbolic_factorization(matrix);
+      }
+   }
+
+   void RacingLinearSolver::do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      if (this->rival != nullptr) {
+         this->race([&](DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>& solver) {
+            solver.do_numerical_factorization(matrix);
+         });
+         this->number_raced_factorizations++;
+         if (this->race_factorizations <= this->number_raced_factorizations) {
+            this->adopt_winner();
+         }
+      }
+      else {
+         this->primary->do_numerical_factorization(matrix);
+      }
+   }
+
+   void RacingLinearSolver::factorize_with_shift(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      // regularization shifts count as raced factorizations: a backend that refactorizes shifted
+      // systems quickly is exactly what the regularization loop needs
+      if (this->rival != nullptr) {
+         this->race([&](DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>& solver) {
+            solver.factorize_with_shift(matrix);
+         });
+         this->number_raced_factorizations++;
+         if (this->race_factorizations <= this->number_raced_factorizations) {
+            this->adopt_winner();
+         }
+      }
+      else {
+         this->primary->factorize_with_shift(matrix);
+      }
+   }
+
+   void RacingLinearSolver::solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs,
+         Vector<double>& result) {
+      this->primary->solve_indefinite_system(matrix, rhs, result);
+   }
+
+   void RacingLinearSolver::solve_indefinite_systems(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs_block,
+         Vector<double>& result_block, size_t number_systems) {
+      this->primary->solve_indefinite_systems(matrix, rhs_block, result_block, number_systems);
+   }
+
+   size_t RacingLinearSolver::expected_number_factor_entries() const {
+      return this->primary->expected_number_factor_entries();
+   }
+
+   size_t RacingLinearSolver::expected_factor_memory_bytes() const {
+      return this->primary->expected_factor_memory_bytes();
+   }
+
+   void RacingLinearSolver::set_solve_tolerance(double tolerance) {
+      this->primary->set_solve_tolerance(tolerance);
+      if (this->rival != nullptr) {
+         this->rival->set_solve_tolerance(tolerance);
+      }
+   }
+
+   std::tuple<size_t, size_t, size_t> RacingLinearSolver::get_inertia() const {
+      return this->primary->get_inertia();
+   }
+
+   size_t RacingLinearSolver::number_negative_eigenvalues() const {
+      return this->primary->number_negative_eigenvalues();
+   }
+
+   bool RacingLinearSolver::matrix_is_singular() const {
+      return this->primary->matrix_is_singular();
+   }
+
+   size_t RacingLinearSolver::rank() const {
+      return this->primary->rank();
+   }
+} // namespace
@@ -0,0 +1,67 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_RACINGLINEARSOLVER_H
+#define UNO_RACINGLINEARSOLVER_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include "solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+
+namespace uno {
+   /*! \class RacingLinearSolver
+    * \brief First-finished-wins race between two direct solver backends
+    *
+    * The relative performance of the factorization backends (MA57 vs MUMPS in particular) varies
+    * wildly from one instance to the next and cannot be predicted from the structure alone. This
+    * wrapper runs the first few factorizations of a solve on both backends concurrently, adopts
+    * the backend with the smaller cumulative wall time for the remainder of the solve and tears
+    * down the loser. Solves and inertia queries are answered by the requested backend until the
+    * decision is made, so the racing phase is bitwise identical to a non-raced solve
+    */
+   class RacingLinearSolver final : public DirectSymmetricIndefiniteLinearSolver<SparseIndex, double> {
+   public:
+      RacingLinearSolver(size_t dimension, std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> primary_solver,
+            std::string primary_name, std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> rival_solver,
+            std::string rival_name, size_t race_factorizations);
+      ~RacingLinearSolver() override = default;
+
+      void factorize(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void factorize_with_shift(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs, Vector<double>& result) override;
+      void solve_indefinite_systems(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs_block,
+            Vector<double>& result_block, size_t number_systems) override;
+
+      [[nodiscard]] size_t expected_number_factor_entries() const override;
+      [[nodiscard]] size_t expected_factor_memory_bytes() const override;
+      void set_solve_tolerance(double tolerance) override;
+
+      [[nodiscard]] std::tuple<size_t, size_t, size_t> get_inertia() const override;
+      [[nodiscard]] size_t number_negative_eigenvalues() const override;
+      [[nodiscard]] bool matrix_is_singular() const override;
+      [[nodiscard]] size_t rank() const override;
+
+   private:
+      // primary is the requested backend; once the race is decided, the winner moves into primary
+      // and rival becomes empty, which turns the wrapper into a plain forwarding layer
+      std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> primary;
+      std::string primary_name;
+      std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> rival;
+      std::string rival_name;
+      // number of factorizations raced before the faster backend is adopted
+      const size_t race_factorizations;
+      size_t number_raced_factorizations{0};
+      // cumulative wall time of the raced factorizations, per backend
+      double primary_time{0.};
+      double rival_time{0.};
+
+      // run the task on both backends concurrently and accumulate their wall times
+      void race(const std::function<void(DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>&)>& task);
+      void adopt_winner();
+   };
+} // namespace
+
+#endif // UNO_RACINGLINEARSOLVER_H
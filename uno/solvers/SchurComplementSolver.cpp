@@ -0,0 +1,474 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cassert>
+#include <future>
+#include <numeric>
+#include <utility>
+#include "SchurComplementSolver.hpp"
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   SchurComplementSolver::SchurComplementSolver(size_t dimension, size_t number_nonzeros, InnerSolverFactory inner_solver_factory,
+         double max_linking_fraction):
+         DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>(dimension),
+         number_nonzeros(number_nonzeros), inner_solver_factory(std::move(inner_solver_factory)),
+         max_linking_fraction(max_linking_fraction) {
+   }
+
+   SchurComplementSolver::~SchurComplementSolver() = default;
+
+   void SchurComplementSolver::factorize(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      this->do_symbolic_factorization(matrix);
+      this->do_numerical_factorization(matrix);
+   }
+
+   // detect a block-angular partition of the indices from the sparsity pattern: the linking
+   // variables are the few highest-degree vertices of the adjacency graph whose removal splits it
+   // into at least two connected components (the scenario blocks). Candidates that turn out not to
+   // separate anything (all their neighbors in a single component) are returned to that component
+   bool SchurComplementSolver::detect_block_angular_structure(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      const size_t n = matrix.dimension();
+      if (n < 3) {
+         return false;
+      }
+      // adjacency lists of the off-diagonal pattern
+      std::vector<std::vector<size_t>> adjacency(n);
+      matrix.for_each([&](SparseIndex row_index, SparseIndex column_index, double /*element*/) {
+         if (row_index != column_index) {
+            adjacency[static_cast<size_t>(row_index)].push_back(static_cast<size_t>(column_index));
+            adjacency[static_cast<size_t>(column_index)].push_back(static_cast<size_t>(row_index));
+         }
+      });
+
+      // candidate linking set: the vertices with the largest degrees, up to the admissible fraction
+      const size_t linking_ceiling = std::max(size_t(1), static_cast<size_t>(this->max_linking_fraction * static_cast<double>(n)));
+      std::vector<size_t> order(n);
+      std::iota(order.begin(), order.end(), size_t(0));
+      std::sort(order.begin(), order.end(), [&](size_t i, size_t j) {
+         return adjacency[i].size() > adjacency[j].size() || (adjacency[i].size() == adjacency[j].size() && i < j);
+      });
+      std::vector<bool> is_linking(n, false);
+      for (size_t rank_index: Range(linking_ceiling)) {
+         is_linking[order[rank_index]] = true;
+      }
+
+      // connected components of the graph restricted to the non-linking vertices (union-find)
+      std::vector<size_t> parent(n);
+      std::iota(parent.begin(), parent.end(), size_t(0));
+      const std::function<size_t(size_t)> find_root = [&](size_t vertex) {
+         while (parent[vertex] != vertex) {
+            parent[vertex] = parent[parent[vertex]];
+            vertex = parent[vertex];
+         }
+         return vertex;
+      };
+      for (size_t vertex: Range(n)) {
+         if (not is_linking[vertex]) {
+            for (size_t neighbor: adjacency[vertex]) {
+               if (not is_linking[neighbor]) {
+                  parent[find_root(vertex)] = find_root(neighbor);
+               }
+            }
+         }
+      }
+      // refinement, from the least-connected candidate up: a candidate whose non-linking neighbors
+      // all lie in one component does not separate anything and is returned to that component
+      for (size_t rank_index: Range(linking_ceiling)) {
+         const size_t candidate = order[linking_ceiling - 1 - rank_index];
+         size_t component_root = n; // sentinel: no neighbor component seen yet
+         bool separates = false;
+         for (size_t neighbor: adjacency[candidate]) {
+            if (not is_linking[neighbor]) {
+               const size_t root = find_root(neighbor);
+               if (component_root == n) {
+                  component_root = root;
+               }
+               else if (root != component_root) {
+                  separates = true;
+                  break;
+               }
+            }
+         }
+         if (not separates) {
+            is_linking[candidate] = false;
+            if (component_root != n) {
+               parent[find_root(candidate)] = component_root;
+            }
+         }
+      }
+
+      // collect the components into blocks; the singleton components (indices with no remaining
+      // off-diagonal coupling) are merged into a single residual block
+      std::vector<size_t> component_block(n, SchurComplementSolver::LINKING);
+      std::vector<size_t> component_size(n, 0);
+      for (size_t vertex: Range(n)) {
+         if (not is_linking[vertex]) {
+            component_size[find_root(vertex)]++;
+         }
+      }
+      this->block_variables.clear();
+      size_t singleton_block = SchurComplementSolver::LINKING;
+      for (size_t vertex: Range(n)) {
+         if (not is_linking[vertex]) {
+            const size_t root = find_root(vertex);
+            if (component_block[root] == SchurComplementSolver::LINKING) {
+               if (1 < component_size[root]) {
+                  component_block[root] = this->block_variables.size();
+                  this->block_variables.emplace_back();
+               }
+               else {
+                  if (singleton_block == SchurComplementSolver::LINKING) {
+                     singleton_block = this->block_variables.size();
+                     this->block_variables.emplace_back();
+                  }
+                  component_block[root] = singleton_block;
+               }
+            }
+         }
+      }
+      if (this->block_variables.size() < 2) {
+         // a single block (or none): the matrix is not block angular, nothing to gain
+         this->block_variables.clear();
+         return false;
+      }
+
+      // fill the index sets and the membership maps
+      this->linking_variables.clear();
+      this->membership.resize(n);
+      this->local_index.resize(n);
+      for (size_t vertex: Range(n)) {
+         if (is_linking[vertex]) {
+            this->membership[vertex] = SchurComplementSolver::LINKING;
+            this->local_index[vertex] = this->linking_variables.size();
+            this->linking_variables.push_back(vertex);
+         }
+         else {
+            const size_t block_index = component_block[find_root(vertex)];
+            this->membership[vertex] = block_index;
+            this->local_index[vertex] = this->block_variables[block_index].size();
+            this->block_variables[block_index].push_back(vertex);
+         }
+      }
+      return true;
+   }
+
+   void SchurComplementSolver::allocate_blocks(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      const size_t number_blocks = this->block_variables.size();
+      const size_t number_linking = this->linking_variables.size();
+      // count the entries of each diagonal block
+      std::vector<size_t> block_nonzeros(number_blocks, 0);
+      matrix.for_each([&](SparseIndex row_index, SparseIndex column_index, double /*element*/) {
+         const size_t row_block = this->membership[static_cast<size_t>(row_index)];
+         const size_t column_block = this->membership[static_cast<size_t>(column_index)];
+         if (row_block == column_block && row_block != SchurComplementSolver::LINKING) {
+            block_nonzeros[row_block]++;
+         }
+      });
+
+      this->block_matrices.clear();
+      this->block_solvers.clear();
+      this->coupling_columns.clear();
+      this->solved_coupling_columns.clear();
+      this->block_rhs.clear();
+      this->block_solution.clear();
+      for (size_t block_index: Range(number_blocks)) {
+         const size_t block_dimension = this->block_variables[block_index].size();
+         // spare capacity for the diagonal entries that a later regularization may add
+         const size_t block_capacity = block_nonzeros[block_index] + block_dimension;
+         this->block_matrices.emplace_back(std::make_unique<SymmetricMatrix<SparseIndex, double>>(block_dimension, block_capacity, false, "COO"));
+         this->block_solvers.emplace_back(this->inner_solver_factory(block_dimension, block_capacity));
+         if (this->solve_tolerance_set) {
+            this->block_solvers.back()->set_solve_tolerance(this->solve_tolerance);
+         }
+         this->coupling_columns.emplace_back(Vector<double>(block_dimension * number_linking));
+         this->solved_coupling_columns.emplace_back(Vector<double>(block_dimension * number_linking));
+         this->block_rhs.emplace_back(Vector<double>(block_dimension));
+         this->block_solution.emplace_back(Vector<double>(block_dimension));
+      }
+      this->linking_values.assign(number_linking * number_linking, 0.);
+      this->linking_rhs.resize(number_linking);
+      this->linking_solution.resize(number_linking);
+      if (0 < number_linking) {
+         const size_t schur_capacity = number_linking * (number_linking + 1) / 2;
+         this->schur_matrix = std::make_unique<SymmetricMatrix<SparseIndex, double>>(number_linking, schur_capacity, false, "COO");
+         this->schur_solver = this->inner_solver_factory(number_linking, schur_capacity);
+         if (this->solve_tolerance_set) {
+            this->schur_solver->set_solve_tolerance(this->solve_tolerance);
+         }
+      }
+      else {
+         this->schur_matrix.reset();
+         this->schur_solver.reset();
+      }
+   }
+
+   // scatter the entries of the assembled matrix into the diagonal blocks A_b, the dense coupling
+   // columns B_b and the dense linking block C
+   void SchurComplementSolver::dispatch_values(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      const size_t number_linking = this->linking_variables.size();
+      for (size_t block_index: Range(this->block_variables.size())) {
+         this->block_matrices[block_index]->reset();
+         this->coupling_columns[block_index].fill(0.);
+      }
+      std::fill(this->linking_values.begin(), this->linking_values.end(), 0.);
+      matrix.for_each([&](SparseIndex row_index, SparseIndex column_index, double element) {
+         const size_t row = static_cast<size_t>(row_index);
+         const size_t column = static_cast<size_t>(column_index);
+         const size_t row_block = this->membership[row];
+         const size_t column_block = this->membership[column];
+         if (row_block != SchurComplementSolver::LINKING && row_block == column_block) {
+            this->block_matrices[row_block]->insert(element, this->local_index[row], this->local_index[column]);
+         }
+         else if (row_block == SchurComplementSolver::LINKING && column_block == SchurComplementSolver::LINKING) {
+            // store the lower triangle of C
+            const size_t i = std::max(this->local_index[row], this->local_index[column]);
+            const size_t j = std::min(this->local_index[row], this->local_index[column]);
+            this->linking_values[i * number_linking + j] += element;
+         }
+         else {
+            // coupling entry: one index in a block, the other in the linking set
+            const size_t block_index = (row_block != SchurComplementSolver::LINKING) ? row_block : column_block;
+            const size_t block_local = (row_block != SchurComplementSolver::LINKING) ? this->local_index[row] : this->local_index[column];
+            const size_t linking_local = (row_block != SchurComplementSolver::LINKING) ? this->local_index[column] : this->local_index[row];
+            const size_t block_dimension = this->block_variables[block_index].size();
+            this->coupling_columns[block_index][linking_local * block_dimension + block_local] += element;
+         }
+      });
+   }
+
+   // factorize one diagonal block and solve A_b X_b = B_b against the fresh factorization: the
+   // blocks are independent, so these tasks run concurrently
+   void SchurComplementSolver::factorize_block(size_t block_index) {
+      this->block_solvers[block_index]->factorize(*this->block_matrices[block_index]);
+      const size_t number_linking = this->linking_variables.size();
+      if (0 < number_linking && not this->block_solvers[block_index]->matrix_is_singular()) {
+         this->block_solvers[block_index]->solve_indefinite_systems(*this->block_matrices[block_index],
+               this->coupling_columns[block_index], this->solved_coupling_columns[block_index], number_linking);
+      }
+   }
+
+   void SchurComplementSolver::assemble_and_factorize_schur_complement() {
+      const size_t number_linking = this->linking_variables.size();
+      this->schur_matrix->reset();
+      // lower triangle of S = C - sum_b B_b^T X_b
+      for (size_t column_index: Range(number_linking)) {
+         for (size_t row_index: Range(column_index, number_linking)) {
+            double element = this->linking_values[row_index * number_linking + column_index];
+            for (size_t block_index: Range(this->block_variables.size())) {
+               const size_t block_dimension = this->block_variables[block_index].size();
+               const double* coupling = this->coupling_columns[block_index].data();
+               const double* solved = this->solved_coupling_columns[block_index].data();
+               double dot_product = 0.;
+               for (size_t entry_index: Range(block_dimension)) {
+                  dot_product += coupling[row_index * block_dimension + entry_index] * solved[column_index * block_dimension + entry_index];
+               }
+               element -= dot_product;
+            }
+            this->schur_matrix->insert(element, row_index, column_index);
+         }
+         this->schur_matrix->finalize_column(column_index);
+      }
+      this->schur_solver->factorize(*this->schur_matrix);
+      if (this->schur_solver->matrix_is_singular()) {
+         this->factorization_singular = true;
+      }
+   }
+
+   void SchurComplementSolver::do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      // tear down any previous structure: a new pattern may admit a different partition
+      this->monolithic.reset();
+      if (this->detect_block_angular_structure(matrix)) {
+         this->allocate_blocks(matrix);
+         DEBUG << "Schur complement solver: " << this->block_variables.size() << " diagonal blocks, " <<
+            this->linking_variables.size() << " linking variables\n";
+      }
+      else {
+         DEBUG << "Schur complement solver: no block-angular structure detected, falling back to a monolithic factorization\n";
+         this->monolithic = this->inner_solver_factory(matrix.dimension(), this->number_nonzeros);
+         if (this->solve_tolerance_set) {
+            this->monolithic->set_solve_tolerance(this->solve_tolerance);
+         }
+         this->monolithic->do_symbolic_factorization(matrix);
+      }
+   }
+
+   void SchurComplementSolver::do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) {
+      if (this->monolithic != nullptr) {
+         this->monolithic->do_numerical_factorization(matrix);
+         return;
+      }
+      this->dispatch_values(matrix);
+      this->factorization_singular = false;
+      // embarrassingly parallel block factorizations: one task per additional block, the first
+      // block on this thread. The blocks share no state, only the assembled matrix is read
+      const size_t number_blocks = this->block_variables.size();
+      std::vector<std::future<void>> futures;
+      futures.reserve(number_blocks - 1);
+      for (size_t block_index: Range(1, number_blocks)) {
+         futures.emplace_back(std::async(std::launch::async, [this, block_index]() {
+            this->factorize_block(block_index);
+         }));
+      }
+      this->factorize_block(0);
+      for (std::future<void>& future: futures) {
+         future.get();
+      }
+      for (size_t block_index: Range(number_blocks)) {
+         if (this->block_solvers[block_index]->matrix_is_singular()) {
+            this->factorization_singular = true;
+         }
+      }
+      if (not this->factorization_singular && this->schur_solver != nullptr) {
+         this->assemble_and_factorize_schur_complement();
+      }
+   }
+
+   void SchurComplementSolver::solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs,
+         Vector<double>& result) {
+      if (this->monolithic != nullptr) {
+         this->monolithic->solve_indefinite_system(matrix, rhs, result);
+         return;
+      }
+      const size_t number_blocks = this->block_variables.size();
+      const size_t number_linking = this->linking_variables.size();
+      // scatter the right-hand side and solve the blocks: y_b = A_b^{-1} r_b
+      for (size_t block_index: Range(number_blocks)) {
+         const std::vector<size_t>& variables = this->block_variables[block_index];
+         for (size_t entry_index: Range(variables.size())) {
+            this->block_rhs[block_index][entry_index] = rhs[variables[entry_index]];
+         }
+         this->block_solvers[block_index]->solve_indefinite_system(*this->block_matrices[block_index], this->block_rhs[block_index],
+               this->block_solution[block_index]);
+      }
+      if (0 < number_linking) {
+         // reduced right-hand side r_S = r_L - sum_b B_b^T y_b, solved against the Schur complement
+         for (size_t linking_local: Range(number_linking)) {
+            double value = rhs[this->linking_variables[linking_local]];
+            for (size_t block_index: Range(number_blocks)) {
+               const size_t block_dimension = this->block_variables[block_index].size();
+               const double* coupling = this->coupling_columns[block_index].data();
+               for (size_t entry_index: Range(block_dimension)) {
+                  value -= coupling[linking_local * block_dimension + entry_index] * this->block_solution[block_index][entry_index];
+               }
+            }
+            this->linking_rhs[linking_local] = value;
+         }
+         this->schur_solver->solve_indefinite_system(*this->schur_matrix, this->linking_rhs, this->linking_solution);
+         // back substitution x_b = y_b - X_b z, reusing the X_b computed at factorization time
+         for (size_t block_index: Range(number_blocks)) {
+            const size_t block_dimension = this->block_variables[block_index].size();
+            const double* solved = this->solved_coupling_columns[block_index].data();
+            for (size_t linking_local: Range(number_linking)) {
+               const double z = this->linking_solution[linking_local];
+               if (z != 0.) {
+                  for (size_t entry_index: Range(block_dimension)) {
+                     this->block_solution[block_index][entry_index] -= solved[linking_local * block_dimension + entry_index] * z;
+                  }
+               }
+            }
+         }
+         for (size_t linking_local: Range(number_linking)) {
+            result[this->linking_variables[linking_local]] = this->linking_solution[linking_local];
+         }
+      }
+      // gather the block solutions
+      for (size_t block_index: Range(number_blocks)) {
+         const std::vector<size_t>& variables = this->block_variables[block_index];
+         for (size_t entry_index: Range(variables.size())) {
+            result[variables[entry_index]] = this->block_solution[block_index][entry_index];
+         }
+      }
+   }
+
+   size_t SchurComplementSolver::expected_number_factor_entries() const {
+      if (this->monolithic != nullptr) {
+         return this->monolithic->expected_number_factor_entries();
+      }
+      size_t total = (this->schur_solver != nullptr) ? this->schur_solver->expected_number_factor_entries() : 0;
+      for (const auto& block_solver: this->block_solvers) {
+         total += block_solver->expected_number_factor_entries();
+      }
+      return total;
+   }
+
+   size_t SchurComplementSolver::expected_factor_memory_bytes() const {
+      if (this->monolithic != nullptr) {
+         return this->monolithic->expected_factor_memory_bytes();
+      }
+      size_t total = (this->schur_solver != nullptr) ? this->schur_solver->expected_factor_memory_bytes() : 0;
+      for (const auto& block_solver: this->block_solvers) {
+         total += block_solver->expected_factor_memory_bytes();
+      }
+      return total;
+   }
+
+   void SchurComplementSolver::set_solve_tolerance(double tolerance) {
+      this->solve_tolerance = tolerance;
+      this->solve_tolerance_set = true;
+      if (this->monolithic != nullptr) {
+         this->monolithic->set_solve_tolerance(tolerance);
+      }
+      for (const auto& block_solver: this->block_solvers) {
+         block_solver->set_solve_tolerance(tolerance);
+      }
+      if (this->schur_solver != nullptr) {
+         this->schur_solver->set_solve_tolerance(tolerance);
+      }
+   }
+
+   // the inertia of [A B; B^T C] with A nonsingular is the sum of the inertias of A and of the
+   // Schur complement S = C - B^T A^{-1} B (Haynsworth additivity)
+   std::tuple<size_t, size_t, size_t> SchurComplementSolver::get_inertia() const {
+      if (this->monolithic != nullptr) {
+         return this->monolithic->get_inertia();
+      }
+      size_t number_positive = 0;
+      size_t number_negative = 0;
+      size_t number_zero = 0;
+      for (const auto& block_solver: this->block_solvers) {
+         const auto [block_positive, block_negative, block_zero] = block_solver->get_inertia();
+         number_positive += block_positive;
+         number_negative += block_negative;
+         number_zero += block_zero;
+      }
+      if (this->schur_solver != nullptr) {
+         const auto [schur_positive, schur_negative, schur_zero] = this->schur_solver->get_inertia();
+         number_positive += schur_positive;
+         number_negative += schur_negative;
+         number_zero += schur_zero;
+      }
+      return {number_positive, number_negative, number_zero};
+   }
+
+   size_t SchurComplementSolver::number_negative_eigenvalues() const {
+      if (this->monolithic != nullptr) {
+         return this->monolithic->number_negative_eigenvalues();
+      }
+      size_t number_negative = (this->schur_solver != nullptr) ? this->schur_solver->number_negative_eigenvalues() : 0;
+      for (const auto& block_solver: this->block_solvers) {
+         number_negative += block_solver->number_negative_eigenvalues();
+      }
+      return number_negative;
+   }
+
+   bool SchurComplementSolver::matrix_is_singular() const {
+      if (this->monolithic != nullptr) {
+         return this->monolithic->matrix_is_singular();
+      }
+      return this->factorization_singular;
+   }
+
+   size_t SchurComplementSolver::rank() const {
+      if (this->monolithic != nullptr) {
+         return this->monolithic->rank();
+      }
+      size_t total_rank = (this->schur_solver != nullptr) ? this->schur_solver->rank() : 0;
+      for (const auto& block_solver: this->block_solvers) {
+         total_rank += block_solver->rank();
+      }
+      return total_rank;
+   }
+} // namespace
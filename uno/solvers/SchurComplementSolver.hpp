@@ -0,0 +1,95 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_SCHURCOMPLEMENTSOLVER_H
+#define UNO_SCHURCOMPLEMENTSOLVER_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include "solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+
+namespace uno {
+   /*! \class SchurComplementSolver
+    * \brief Schur-complement factorization of block-angular (scenario-structured) systems
+    *
+    * Scenario-structured models (stochastic programs) produce KKT matrices that are block diagonal
+    * up to a thin set of linking variables: K = [A B; B^T C] with A block diagonal. A monolithic
+    * factorization cannot see this structure. This wrapper detects it from the sparsity pattern at
+    * analysis time (the linking variables are the few high-degree columns whose removal splits the
+    * adjacency graph), factorizes the scenario blocks independently -- in parallel -- with inner
+    * solvers created by the configured backend, and factorizes the small Schur complement
+    * S = C - B^T A^{-1} B of the linking variables. The inertia of the system is recovered exactly
+    * as the sum of the block inertias and the inertia of S (Haynsworth additivity). When no
+    * block-angular structure is found, the wrapper degenerates into a plain forwarding layer
+    * around a single monolithic inner solver
+    */
+   class SchurComplementSolver final : public DirectSymmetricIndefiniteLinearSolver<SparseIndex, double> {
+   public:
+      // creates an inner solver for a given dimension and number of nonzeros
+      using InnerSolverFactory = std::function<std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>>(size_t, size_t)>;
+
+      SchurComplementSolver(size_t dimension, size_t number_nonzeros, InnerSolverFactory inner_solver_factory, double max_linking_fraction);
+      ~SchurComplementSolver() override;
+
+      void factorize(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_symbolic_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void do_numerical_factorization(const SymmetricMatrix<SparseIndex, double>& matrix) override;
+      void solve_indefinite_system(const SymmetricMatrix<SparseIndex, double>& matrix, const Vector<double>& rhs, Vector<double>& result) override;
+
+      [[nodiscard]] size_t expected_number_factor_entries() const override;
+      [[nodiscard]] size_t expected_factor_memory_bytes() const override;
+      void set_solve_tolerance(double tolerance) override;
+
+      [[nodiscard]] std::tuple<size_t, size_t, size_t> get_inertia() const override;
+      [[nodiscard]] size_t number_negative_eigenvalues() const override;
+      [[nodiscard]] bool matrix_is_singular() const override;
+      [[nodiscard]] size_t rank() const override;
+
+   private:
+      const size_t number_nonzeros;
+      const InnerSolverFactory inner_solver_factory;
+      // largest admissible fraction of linking variables: beyond it, the Schur complement is not
+      // small anymore and the monolithic factorization is the better strategy
+      const double max_linking_fraction;
+      double solve_tolerance{0.};
+      bool solve_tolerance_set{false};
+
+      // monolithic fallback when no block-angular structure was detected
+      std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> monolithic{};
+
+      // detected structure: a partition of the indices into scenario blocks and linking variables
+      static constexpr size_t LINKING = static_cast<size_t>(-1);
+      std::vector<std::vector<size_t>> block_variables{}; // original indices of each block
+      std::vector<size_t> linking_variables{}; // original indices of the linking variables
+      std::vector<size_t> membership{}; // block index of each original index, or LINKING
+      std::vector<size_t> local_index{}; // position within its block (or within the linking list)
+
+      // per-block data: matrix A_b, its solver, the dense coupling B_b and X_b = A_b^{-1} B_b
+      // (both column-major with one column per linking variable)
+      std::vector<std::unique_ptr<SymmetricMatrix<SparseIndex, double>>> block_matrices{};
+      std::vector<std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>>> block_solvers{};
+      std::vector<Vector<double>> coupling_columns{};
+      std::vector<Vector<double>> solved_coupling_columns{};
+      // linking data: the dense block C and the assembled Schur complement S = C - sum_b B_b^T X_b
+      std::vector<double> linking_values{};
+      std::unique_ptr<SymmetricMatrix<SparseIndex, double>> schur_matrix{};
+      std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> schur_solver{};
+
+      // per-solve scratch
+      std::vector<Vector<double>> block_rhs{};
+      std::vector<Vector<double>> block_solution{};
+      Vector<double> linking_rhs{};
+      Vector<double> linking_solution{};
+
+      bool factorization_singular{false};
+
+      [[nodiscard]] bool detect_block_angular_structure(const SymmetricMatrix<SparseIndex, double>& matrix);
+      void allocate_blocks(const SymmetricMatrix<SparseIndex, double>& matrix);
+      void dispatch_values(const SymmetricMatrix<SparseIndex, double>& matrix);
+      void factorize_block(size_t block_index);
+      void assemble_and_factorize_schur_complement();
+   };
+} // namespace
+
+#endif // UNO_SCHURCOMPLEMENTSOLVER_H
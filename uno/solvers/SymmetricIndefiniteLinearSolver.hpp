@@ -5,6 +5,7 @@
 #define UNO_SYMMETRICINDEFINITELINEARSOLVER_H
 
 #include <cstddef>
+#include "linear_algebra/SparseIndex.hpp"
 #include <tuple>
 
 namespace uno {
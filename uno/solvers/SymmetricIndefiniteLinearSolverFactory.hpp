@@ -6,6 +6,7 @@
 
 #include <memory>
 #include "DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "tools/Options.hpp"
 
 #ifdef HAS_MA57
 #include "solvers/MA57/MA57Solver.hpp"
@@ -15,21 +16,70 @@
 #include "solvers/MUMPS/MUMPSSolver.hpp"
 #endif
 
+#ifdef HAS_CUDSS
+#include "solvers/CUDSS/CUDSSSolver.hpp"
+#endif
+
+#include "solvers/MINRES/MINRESSolver.hpp"
+#include "solvers/RacingLinearSolver.hpp"
+#include "solvers/SchurComplementSolver.hpp"
+
 namespace uno {
    class SymmetricIndefiniteLinearSolverFactory {
    public:
-      static std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<size_t, double>> create([[maybe_unused]] const std::string& linear_solver_name,
-            [[maybe_unused]] size_t dimension, [[maybe_unused]] size_t number_nonzeros) {
+      static std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> create(const std::string& linear_solver_name,
+            size_t dimension, size_t number_nonzeros, const Options& options) {
+         // Schur-complement mode for block-angular (scenario-structured) systems: the wrapper
+         // detects the structure at analysis time, factorizes the diagonal blocks in parallel with
+         // inner solvers of the requested backend and solves the small linking system (see
+         // SchurComplementSolver). Without detectable structure, it degenerates into a plain
+         // forwarding layer around a single backend instance
+         if (options.get_bool("schur_complement_solver")) {
+            return std::make_unique<SchurComplementSolver>(dimension, number_nonzeros,
+                  [&options, linear_solver_name](size_t block_dimension, size_t block_number_nonzeros) {
+                     return SymmetricIndefiniteLinearSolverFactory::create_single(linear_solver_name, block_dimension,
+                           block_number_nonzeros, options);
+                  }, options.get_double("schur_complement_max_linking_fraction"));
+         }
+         // racing mode: run the requested backend and a rival concurrently for the first
+         // factorizations and keep the faster one (see RacingLinearSolver)
+         const std::string& rival_name = options.get_string("linear_solver_race");
+         if (rival_name != "none" && rival_name != linear_solver_name) {
+            return std::make_unique<RacingLinearSolver>(dimension,
+                  SymmetricIndefiniteLinearSolverFactory::create_single(linear_solver_name, dimension, number_nonzeros, options),
+                  linear_solver_name,
+                  SymmetricIndefiniteLinearSolverFactory::create_single(rival_name, dimension, number_nonzeros, options),
+                  rival_name, options.get_unsigned_int("linear_solver_race_factorizations"));
+         }
+         return SymmetricIndefiniteLinearSolverFactory::create_single(linear_solver_name, dimension, number_nonzeros, options);
+      }
+
+      static std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> create_single(
+            [[maybe_unused]] const std::string& linear_solver_name, [[maybe_unused]] size_t dimension,
+            [[maybe_unused]] size_t number_nonzeros, [[maybe_unused]] const Options& options) {
 #ifdef HAS_MA57
          if (linear_solver_name == "MA57") {
-            return std::make_unique<MA57Solver>(dimension, number_nonzeros);
+            return std::make_unique<MA57Solver>(dimension, number_nonzeros, options.get_bool("linear_solver_mixed_precision"),
+                  options.get_string("MA57_ordering"), options.get_string("MA57_ordering_file"));
          }
 #endif
 #ifdef HAS_MUMPS
          if (linear_solver_name == "MUMPS") {
-            return std::make_unique<MUMPSSolver>(dimension, number_nonzeros);
+            return std::make_unique<MUMPSSolver>(dimension, number_nonzeros, options.get_unsigned_int("linear_solver_number_threads"),
+                  MUMPSSolver::WORLD_COMMUNICATOR, options.get_string("MUMPS_out_of_core"),
+                  options.get_string("MUMPS_out_of_core_directory"), options.get_unsigned_int("MUMPS_memory_limit_MB"));
+         }
+#endif
+#ifdef HAS_CUDSS
+         if (linear_solver_name == "cuDSS") {
+            return std::make_unique<CUDSSSolver>(dimension, number_nonzeros);
          }
 #endif
+         // iterative solver (matrix-free, no external library required)
+         if (linear_solver_name == "MINRES") {
+            return std::make_unique<MINRESSolver>(dimension, options.get_unsigned_int("MINRES_max_iterations"),
+                  options.get_double("MINRES_tolerance"));
+         }
          throw std::invalid_argument("Linear solver name is unknown");
       }
 
@@ -39,6 +89,10 @@ namespace uno {
 #ifdef HAS_MA57
          solvers.emplace_back("MA57");
 #endif
+#ifdef HAS_CUDSS
+         solvers.emplace_back("cuDSS");
+#endif
+         solvers.emplace_back("MINRES");
          return solvers;
       }
    };
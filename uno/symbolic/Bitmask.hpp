@@ -0,0 +1,112 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BITMASK_H
+#define UNO_BITMASK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace uno {
+   // position of the lowest set bit of a nonzero 64-bit word
+   inline size_t index_of_lowest_set_bit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+      return static_cast<size_t>(__builtin_ctzll(word));
+#else
+      size_t bit_index = 0;
+      while ((word & 1) == 0) {
+         word >>= 1;
+         bit_index++;
+      }
+      return bit_index;
+#endif
+   }
+
+   // dense set of indices in [0, capacity), stored one bit per index. Membership tests are O(1) and
+   // iteration over the members proceeds in increasing order, skipping empty 64-bit words. The
+   // bitmask is the companion of the index vectors behind CollectionAdapter for the code paths that
+   // ask "does the set contain this index?" or sweep a sparse subset of a dense range
+   class Bitmask {
+   public:
+      Bitmask() = default;
+      explicit Bitmask(size_t capacity): number_indices(capacity), words((capacity + 63)/64, 0) { }
+
+      // clear the set and make room for indices in [0, capacity)
+      void resize(size_t capacity) {
+         this->number_indices = capacity;
+         this->number_members = 0;
+         this->words.assign((capacity + 63)/64, 0);
+      }
+
+      void insert(size_t index) {
+         const uint64_t bit = uint64_t(1) << (index % 64);
+         if ((this->words[index / 64] & bit) == 0) {
+            this->words[index / 64] |= bit;
+            this->number_members++;
+         }
+      }
+
+      [[nodiscard]] bool contains(size_t index) const {
+         return (this->words[index / 64] >> (index % 64)) & 1;
+      }
+
+      [[nodiscard]] size_t size() const { return this->number_members; }
+      [[nodiscard]] size_t capacity() const { return this->number_indices; }
+      [[nodiscard]] bool is_empty() const { return this->number_members == 0; }
+
+      // iterator over the members in increasing order. The bits of the current word are consumed one
+      // at a time (lowest first); exhausted and empty words are skipped in a single comparison each
+      class iterator {
+      public:
+         iterator(const std::vector<uint64_t>& words, size_t word_index, uint64_t current_word):
+               words(words), word_index(word_index), current_word(current_word) {
+            this->skip_empty_words();
+         }
+
+         size_t operator*() const {
+            return 64*this->word_index + index_of_lowest_set_bit(this->current_word);
+         }
+
+         iterator& operator++() {
+            // clear the lowest set bit
+            this->current_word &= this->current_word - 1;
+            this->skip_empty_words();
+            return *this;
+         }
+
+         friend bool operator!=(const iterator& first, const iterator& second) {
+            return first.word_index != second.word_index || first.current_word != second.current_word;
+         }
+
+      protected:
+         const std::vector<uint64_t>& words;
+         size_t word_index;
+         uint64_t current_word;
+
+         void skip_empty_words() {
+            while (this->current_word == 0 && this->word_index + 1 < this->words.size()) {
+               this->word_index++;
+               this->current_word = this->words[this->word_index];
+            }
+            if (this->current_word == 0) {
+               this->word_index = this->words.size();
+            }
+         }
+      };
+
+      [[nodiscard]] iterator begin() const {
+         return {this->words, 0, this->words.empty() ? 0 : this->words[0]};
+      }
+      [[nodiscard]] iterator end() const {
+         return {this->words, this->words.size(), 0};
+      }
+
+   protected:
+      size_t number_indices{0}; // capacity
+      size_t number_members{0}; // number of set bits
+      std::vector<uint64_t> words{};
+   };
+} // namespace
+
+#endif // UNO_BITMASK_H
@@ -47,6 +47,15 @@ namespace uno {
       [[nodiscard]] iterator begin() const { return iterator(*this, 0); }
       [[nodiscard]] iterator end() const { return iterator(*this, this->size()); }
 
+      // partition-aware iteration: apply the function to every element. Composite collections
+      // (e.g. Concatenation) override it to traverse each part in its own tight loop, without
+      // the per-element dispatch that the generic iterators pay to locate the active part
+      virtual void for_each(const std::function<void(ElementType)>& f) const {
+         for (size_t index = 0; index < this->size(); index++) {
+            f(this->dereference_iterator(index));
+         }
+      }
+
       [[nodiscard]] virtual ElementType dereference_iterator(size_t index) const = 0;
       virtual void increment_iterator(size_t& index) const = 0;
    };
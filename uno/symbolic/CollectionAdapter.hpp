@@ -14,6 +14,13 @@ namespace uno {
       explicit CollectionAdapter(const Array& array);
       [[nodiscard]] size_t size() const override;
 
+      // tight loop over the underlying array, without the virtual dereference per element
+      void for_each(const std::function<void(typename CollectionAdapter::value_type)>& f) const override {
+         for (size_t index = 0; index < this->array.size(); index++) {
+            f(this->array[index]);
+         }
+      }
+
       [[nodiscard]] typename CollectionAdapter::value_type dereference_iterator(size_t index) const override;
       void increment_iterator(size_t& index) const override;
 
@@ -15,6 +15,12 @@ namespace uno {
       Concatenation(Collection1&& collection1, Collection2&& collection2);
       [[nodiscard]] size_t size() const override;
 
+      // each part is traversed in its own loop: no per-element test of the active part
+      void for_each(const std::function<void(typename Concatenation::value_type)>& f) const override {
+         this->collection1.for_each(f);
+         this->collection2.for_each(f);
+      }
+
       typename Concatenation::value_type dereference_iterator(size_t index) const override {
          const size_t collection1_size = this->collection1.size();
          if (index < collection1_size) {
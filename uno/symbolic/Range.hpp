@@ -4,6 +4,7 @@
 #ifndef UNO_RANGE_H
 #define UNO_RANGE_H
 
+#include <algorithm>
 #include <stdexcept>
 #include "Collection.hpp"
 
@@ -13,6 +14,8 @@ namespace uno {
       FORWARD, BACKWARD
    };
 
+   class BlockedRange;
+
    // Default direction is FORWARD (increasing)
    template <RangeDirection direction = FORWARD>
    class Range: public Collection<size_t> {
@@ -25,9 +28,27 @@ namespace uno {
       // iterable functions
       [[nodiscard]] size_t size() const override;
 
+      // tight loop over the contiguous indices, without the virtual dereference per element
+      void for_each(const std::function<void(size_t)>& f) const override {
+         if constexpr (direction == FORWARD) {
+            for (size_t value = this->start_value; value < this->end_value; value++) {
+               f(value);
+            }
+         }
+         else {
+            for (size_t value = this->start_value; value > this->end_value; value--) {
+               f(value);
+            }
+         }
+      }
+
       [[nodiscard]] size_t dereference_iterator(size_t index) const override;
       void increment_iterator(size_t& index) const override;
 
+      // partition into contiguous tiles of at most block_size indices (the last tile may be
+      // shorter), for cache-blocked traversals and per-tile dispatch to a thread pool
+      [[nodiscard]] BlockedRange blocks(size_t block_size) const;
+
    protected:
       const size_t start_value;
       const size_t end_value;
@@ -75,6 +96,43 @@ namespace uno {
 
    using ForwardRange = Range<FORWARD>;
    using BackwardRange = Range<BACKWARD>;
+
+   // collection of the tiles of a forward range: each element is itself a forward Range of at most
+   // block_size contiguous indices
+   class BlockedRange: public Collection<Range<FORWARD>> {
+   public:
+      BlockedRange(size_t start_value, size_t end_value, size_t block_size):
+            Collection<Range<FORWARD>>(), start_value(start_value), end_value(end_value), block_size(block_size) {
+         if (block_size == 0) {
+            throw std::runtime_error("Blocked range: the block size is zero\n");
+         }
+      }
+
+      // number of tiles
+      [[nodiscard]] size_t size() const override {
+         return (this->end_value - this->start_value + this->block_size - 1) / this->block_size;
+      }
+
+      [[nodiscard]] Range<FORWARD> dereference_iterator(size_t index) const override {
+         const size_t block_start = this->start_value + index * this->block_size;
+         return {block_start, std::min(block_start + this->block_size, this->end_value)};
+      }
+
+      void increment_iterator(size_t& index) const override {
+         index++;
+      }
+
+   protected:
+      const size_t start_value;
+      const size_t end_value;
+      const size_t block_size;
+   };
+
+   template <RangeDirection direction>
+   BlockedRange Range<direction>::blocks(size_t block_size) const {
+      static_assert(direction == FORWARD, "Range::blocks is only available on forward ranges");
+      return {this->start_value, this->end_value, block_size};
+   }
 } // namespace
 
 #endif // UNO_RANGE_H
@@ -18,6 +18,23 @@ namespace uno {
          return (this->factor == value_type(0)) ? value_type(0) : this->factor * this->expression[index];
       }
 
+      // bulk materialization protocol (see the dispatch in Vector::operator=): the zero-factor test
+      // is hoisted out of the loop, which leaves a vectorizable inner loop
+      template <typename Result>
+      void evaluate_into(Result& result) const {
+         const size_t size = result.size();
+         if (this->factor == value_type(0)) {
+            for (size_t index = 0; index < size; index++) {
+               result[index] = value_type(0);
+            }
+         }
+         else {
+            for (size_t index = 0; index < size; index++) {
+               result[index] = this->factor * this->expression[index];
+            }
+         }
+      }
+
    protected:
       const value_type factor;
       Expression expression;
@@ -4,6 +4,8 @@
 #ifndef UNO_SUM_H
 #define UNO_SUM_H
 
+#include "UnaryNegation.hpp"
+
 namespace uno {
    // stores the expression (expression1 + expression2) symbolically
    // limited to types that possess value_type
@@ -19,6 +21,16 @@ namespace uno {
       [[nodiscard]] constexpr size_t size() const { return this->expression1.size(); }
       [[nodiscard]] typename Sum::value_type operator[](size_t index) const { return this->expression1[index] + this->expression2[index]; }
 
+      // bulk materialization protocol (see the dispatch in Vector::operator=): one fused pass with
+      // a vectorizable inner loop, instead of an element-wise assignment
+      template <typename Result>
+      void evaluate_into(Result& result) const {
+         const size_t size = result.size();
+         for (size_t index = 0; index < size; index++) {
+            result[index] = this->expression1[index] + this->expression2[index];
+         }
+      }
+
    protected:
       const E1 expression1;
       const E2 expression2;
@@ -29,6 +41,15 @@ namespace uno {
    inline Sum<E1, E2> operator+(E1&& expression1, E2&& expression2) {
       return {std::forward<E1>(expression1), std::forward<E2>(expression2)};
    }
+
+   // free function: stores the difference (expression1 - expression2) symbolically as a sum
+   // (the size() requirement rules out element types such as iterators, which define their own subtraction)
+   template <typename E1, typename E2,
+      typename std::enable_if_t<std::is_same_v<typename std::remove_reference_t<E1>::value_type, typename std::remove_reference_t<E2>::value_type>, int> = 0,
+      typename = std::void_t<decltype(std::declval<const std::remove_reference_t<E1>&>().size()), decltype(std::declval<const std::remove_reference_t<E2>&>().size())>>
+   inline Sum<E1, UnaryNegation<E2>> operator-(E1&& expression1, E2&& expression2) {
+      return {std::forward<E1>(expression1), UnaryNegation<E2>(std::forward<E2>(expression2))};
+   }
 } // namespace
 
 #endif // UNO_SUM_H
@@ -18,6 +18,15 @@ namespace uno {
       [[nodiscard]] constexpr size_t size() const { return this->expression.size(); }
       [[nodiscard]] typename UnaryNegation::value_type operator[](size_t index) const { return -this->expression[index]; }
 
+      // bulk materialization protocol (see the dispatch in Vector::operator=)
+      template <typename Result>
+      void evaluate_into(Result& result) const {
+         const size_t size = result.size();
+         for (size_t index = 0; index < size; index++) {
+            result[index] = -this->expression[index];
+         }
+      }
+
    protected:
       Expression expression;
    };
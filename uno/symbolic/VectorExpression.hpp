@@ -42,6 +42,10 @@ namespace uno {
       VectorExpression(const Indices& indices, Callable&& component_function);
       [[nodiscard]] size_t size() const { return this->indices.size(); }
       [[nodiscard]] double operator[](size_t index) const;
+      // bulk materialization protocol (see the dispatch in Vector::operator=): writes all the
+      // components into the destination in a single fused pass
+      template <typename Result>
+      void evaluate_into(Result& result) const;
 
       iterator begin() const { return iterator(*this, 0); }
       iterator end() const { return iterator(*this, this->size()); }
@@ -60,6 +64,15 @@ namespace uno {
    double VectorExpression<Indices, Callable>::operator[](size_t index) const {
       return this->component_function(index);
    }
+
+   template <typename Indices, typename Callable>
+   template <typename Result>
+   void VectorExpression<Indices, Callable>::evaluate_into(Result& result) const {
+      const size_t size = result.size();
+      for (size_t index = 0; index < size; index++) {
+         result[index] = this->component_function(index);
+      }
+   }
 } // namespace
 
 #endif // UNO_VECTOREXPRESSION_H
@@ -44,6 +44,16 @@ namespace uno {
       [[nodiscard]] value_type operator[](size_t index) const noexcept { return this->expression[this->start + index]; }
       [[nodiscard]] size_t size() const noexcept { return this->end - this->start; }
 
+      // bulk materialization protocol (see the dispatch in Vector::operator=): a straight copy of
+      // the viewed span
+      template <typename Result>
+      void evaluate_into(Result& result) const {
+         const size_t size = result.size();
+         for (size_t index = 0; index < size; index++) {
+            result[index] = this->expression[this->start + index];
+         }
+      }
+
       // [[nodiscard]] iterator begin() const noexcept { return iterator(*this, 0); }
       // [[nodiscard]] iterator end() const noexcept { return iterator(*this, this->length); }
 
@@ -0,0 +1,9 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "AllocationTracker.hpp"
+
+namespace uno {
+   bool AllocationTracker::active = false;
+   std::atomic<size_t> AllocationTracker::number_allocations{0};
+} // namespace
@@ -0,0 +1,45 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_ALLOCATIONTRACKER_H
+#define UNO_ALLOCATIONTRACKER_H
+
+#include <atomic>
+#include <cstddef>
+
+namespace uno {
+   /*
+    * Heap allocation counter for the zero-allocation steady state
+    *
+    * The iteration path of the solver is designed to stop allocating once the workspaces have
+    * reached their final sizes. Every allocation of the solver containers funnels through
+    * FirstTouchAllocator, which reports here when tracking is active; Uno shows the per-iteration
+    * count in the statistics table and can turn any allocation after a given iteration into a hard
+    * failure (allocation_assert_iteration option). An allocation regression then shows up as a
+    * failing run instead of a heaptrack session.
+    */
+   class AllocationTracker {
+   public:
+      // runtime switch, set once at startup from the options
+      static bool active;
+
+      static void record() {
+         if (AllocationTracker::active) {
+            AllocationTracker::number_allocations.fetch_add(1, std::memory_order_relaxed);
+         }
+      }
+
+      [[nodiscard]] static size_t count() {
+         return AllocationTracker::number_allocations.load(std::memory_order_relaxed);
+      }
+
+      static void reset() {
+         AllocationTracker::number_allocations.store(0, std::memory_order_relaxed);
+      }
+
+   private:
+      static std::atomic<size_t> number_allocations;
+   };
+} // namespace
+
+#endif // UNO_ALLOCATIONTRACKER_H
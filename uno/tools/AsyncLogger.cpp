@@ -0,0 +1,105 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include "AsyncLogger.hpp"
+
+namespace uno {
+   AsyncLogBuffer::AsyncLogBuffer(std::streambuf* downstream):
+         downstream(downstream), ring(CAPACITY) {
+      this->consumer = std::thread(&AsyncLogBuffer::drain, this);
+   }
+
+   AsyncLogBuffer::~AsyncLogBuffer() {
+      this->running.store(false, std::memory_order_release);
+      if (this->consumer.joinable()) {
+         this->consumer.join();
+      }
+   }
+
+   std::streamsize AsyncLogBuffer::xsputn(const char* data, std::streamsize size) {
+      this->push(data, static_cast<size_t>(size));
+      return size;
+   }
+
+   int AsyncLogBuffer::overflow(int character) {
+      if (character != traits_type::eof()) {
+         const char single_character = static_cast<char>(character);
+         this->push(&single_character, 1);
+      }
+      return character;
+   }
+
+   int AsyncLogBuffer::sync() {
+      // wait until the background thread caught up, then flush downstream
+      while (this->read_position.load(std::memory_order_acquire) < this->write_position.load(std::memory_order_acquire)) {
+         std::this_thread::yield();
+      }
+      return this->downstream->pubsync();
+   }
+
+   void AsyncLogBuffer::push(const char* data, size_t size) {
+      const std::lock_guard<std::mutex> lock(this->producer_mutex);
+      while (0 < size) {
+         // wait for free space (only happens if the producer outran the consumer by the whole capacity)
+         size_t free_space;
+         while ((free_space = CAPACITY - (this->write_position.load(std::memory_order_relaxed) -
+               this->read_position.load(std::memory_order_acquire))) == 0) {
+            std::this_thread::yield();
+         }
+         const size_t current_write = this->write_position.load(std::memory_order_relaxed);
+         const size_t ring_index = current_write & (CAPACITY - 1);
+         // copy a chunk, possibly limited by the wrap-around point
+         const size_t chunk_size = std::min({size, free_space, CAPACITY - ring_index});
+         std::memcpy(&this->ring[ring_index], data, chunk_size);
+         this->write_position.store(current_write + chunk_size, std::memory_order_release);
+         data += chunk_size;
+         size -= chunk_size;
+      }
+   }
+
+   void AsyncLogBuffer::drain() {
+      while (true) {
+         const size_t current_read = this->read_position.load(std::memory_order_relaxed);
+         const size_t available = this->write_position.load(std::memory_order_acquire) - current_read;
+         if (available == 0) {
+            if (not this->running.load(std::memory_order_acquire)) {
+               return;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            continue;
+         }
+         const size_t ring_index = current_read & (CAPACITY - 1);
+         // write a contiguous chunk, possibly limited by the wrap-around point
+         const size_t chunk_size = std::min(available, CAPACITY - ring_index);
+         this->downstream->sputn(&this->ring[ring_index], static_cast<std::streamsize>(chunk_size));
+         this->read_position.store(current_read + chunk_size, std::memory_order_release);
+      }
+   }
+
+   std::unique_ptr<AsyncLogBuffer> AsyncLogger::buffer{};
+   std::streambuf* AsyncLogger::original_cout_buffer{nullptr};
+
+   void AsyncLogger::start() {
+      if (AsyncLogger::buffer == nullptr) {
+         AsyncLogger::original_cout_buffer = std::cout.rdbuf();
+         AsyncLogger::buffer = std::make_unique<AsyncLogBuffer>(AsyncLogger::original_cout_buffer);
+         std::cout.rdbuf(AsyncLogger::buffer.get());
+         // make sure the pipeline is drained and std::cout restored at program exit
+         std::atexit([]() {
+            AsyncLogger::stop();
+         });
+      }
+   }
+
+   void AsyncLogger::stop() {
+      if (AsyncLogger::buffer != nullptr) {
+         std::cout.rdbuf(AsyncLogger::original_cout_buffer);
+         // the destructor joins the background thread once the buffer is drained
+         AsyncLogger::buffer.reset();
+      }
+   }
+} // namespace
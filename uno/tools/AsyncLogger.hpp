@@ -0,0 +1,67 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_ASYNCLOGGER_H
+#define UNO_ASYNCLOGGER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+namespace uno {
+   /*
+    * Asynchronous logging pipeline
+    *
+    * When enabled (logger_async option), std::cout is redirected through a ring buffer drained by a
+    * background thread: the solver thread only copies formatted bytes into the buffer and never
+    * performs blocking I/O, so full DEBUG tracing costs little on the solver thread. Since all the
+    * logging (Logger levels, statistics table) goes through std::cout, no call site changes.
+    * The consumer side is lock-free (atomic positions); concurrent producers (e.g. batch mode with
+    * several threads) are serialized by a mutex, which is uncontended in the usual single-solver case.
+    * If the buffer fills up (producer outruns the terminal by its whole capacity), the producer spins
+    * until space is available rather than dropping log lines.
+    */
+   class AsyncLogBuffer: public std::streambuf {
+   public:
+      explicit AsyncLogBuffer(std::streambuf* downstream);
+      ~AsyncLogBuffer() override;
+
+   protected:
+      std::streamsize xsputn(const char* data, std::streamsize size) override;
+      int overflow(int character) override;
+      int sync() override;
+
+   private:
+      // power of two, so that positions are reduced with a mask
+      static constexpr size_t CAPACITY = size_t(1) << 20;
+
+      std::streambuf* downstream;
+      std::vector<char> ring;
+      // cumulative byte counts (reduced modulo CAPACITY when indexing the ring)
+      std::atomic<size_t> write_position{0};
+      std::atomic<size_t> read_position{0};
+      std::mutex producer_mutex{};
+      std::atomic<bool> running{true};
+      std::thread consumer;
+
+      void push(const char* data, size_t size);
+      void drain();
+   };
+
+   class AsyncLogger {
+   public:
+      // redirect std::cout through a background logging thread
+      static void start();
+      // drain the buffer, join the background thread and restore std::cout
+      static void stop();
+
+   private:
+      static std::unique_ptr<AsyncLogBuffer> buffer;
+      static std::streambuf* original_cout_buffer;
+   };
+} // namespace
+
+#endif // UNO_ASYNCLOGGER_H
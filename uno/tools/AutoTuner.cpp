@@ -0,0 +1,78 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cassert>
+#include "AutoTuner.hpp"
+#include "Logger.hpp"
+#include "Options.hpp"
+
+namespace uno {
+   AutoTuner::AutoTuner(const Options& options) {
+      // whitelisted numeric options and their candidate factors on the documented default. The
+      // factors keep every candidate in the valid range of its option (ratios stay below 1)
+      const auto add_option = [&](const std::string& name, std::vector<double> factors) {
+         TunedOption tuned_option;
+         tuned_option.name = name;
+         tuned_option.default_value = options.get_double(name);
+         tuned_option.factors = std::move(factors);
+         tuned_option.total_time.assign(tuned_option.factors.size(), 0.);
+         tuned_option.number_trials.assign(tuned_option.factors.size(), 0);
+         this->tuned_options.push_back(std::move(tuned_option));
+      };
+      add_option("TR_radius", {0.1, 1., 10.});
+      add_option("barrier_k_mu", {0.5, 1., 2.});
+      add_option("LS_backtracking_ratio", {0.5, 1., 1.5});
+   }
+
+   std::vector<size_t> AutoTuner::apply(Options& options) {
+      const std::lock_guard<std::mutex> lock(this->mutex);
+      std::vector<size_t> selection;
+      selection.reserve(this->tuned_options.size());
+      for (TunedOption& tuned_option: this->tuned_options) {
+         const size_t arm = this->draw_arm(tuned_option);
+         selection.push_back(arm);
+         options[tuned_option.name] = std::to_string(tuned_option.default_value * tuned_option.factors[arm]);
+      }
+      return selection;
+   }
+
+   void AutoTuner::report(const std::vector<size_t>& selection, double solve_time, bool solved) {
+      assert(selection.size() == this->tuned_options.size() && "AutoTuner.report: the selection does not match the tuned options");
+      const std::lock_guard<std::mutex> lock(this->mutex);
+      this->worst_observed_time = std::max(this->worst_observed_time, solve_time);
+      const double charged_time = solved ? solve_time : AutoTuner::failure_penalty_factor * this->worst_observed_time;
+      for (size_t option_index = 0; option_index < this->tuned_options.size(); option_index++) {
+         TunedOption& tuned_option = this->tuned_options[option_index];
+         const size_t arm = selection[option_index];
+         tuned_option.total_time[arm] += charged_time;
+         tuned_option.number_trials[arm]++;
+         DEBUG << "Auto-tuner: " << tuned_option.name << " arm " << tuned_option.factors[arm] << "x charged " << charged_time << "s\n";
+      }
+   }
+
+   size_t AutoTuner::draw_arm(TunedOption& tuned_option) {
+      // untried arms first, so that every arm gets an estimate before exploitation starts
+      for (size_t arm = 0; arm < tuned_option.factors.size(); arm++) {
+         if (tuned_option.number_trials[arm] == 0) {
+            return arm;
+         }
+      }
+      // epsilon-greedy: explore a uniformly drawn arm, otherwise exploit the best mean time
+      std::uniform_real_distribution<double> unit_interval(0., 1.);
+      if (unit_interval(this->generator) < AutoTuner::exploration_probability) {
+         std::uniform_int_distribution<size_t> uniform_arm(0, tuned_option.factors.size() - 1);
+         return uniform_arm(this->generator);
+      }
+      size_t best_arm = 0;
+      double best_mean_time = tuned_option.total_time[0] / static_cast<double>(tuned_option.number_trials[0]);
+      for (size_t arm = 1; arm < tuned_option.factors.size(); arm++) {
+         const double mean_time = tuned_option.total_time[arm] / static_cast<double>(tuned_option.number_trials[arm]);
+         if (mean_time < best_mean_time) {
+            best_mean_time = mean_time;
+            best_arm = arm;
+         }
+      }
+      return best_arm;
+   }
+} // namespace
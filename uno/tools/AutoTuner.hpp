@@ -0,0 +1,60 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_AUTOTUNER_H
+#define UNO_AUTOTUNER_H
+
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace uno {
+   // forward declaration
+   class Options;
+
+   /*
+    * Online option auto-tuner across a solve sequence
+    *
+    * Complements the tuning cache (which seeds solver-internal parameters from history): across the
+    * solves of a batch, the auto-tuner adjusts a whitelisted set of numeric options — the initial
+    * trust-region radius, the barrier decrease factor and the line-search backtracking ratio — with
+    * an epsilon-greedy bandit per option over the observed solve times. Each solve draws one arm
+    * (a multiplicative factor on the documented default) per option; the observed time rewards the
+    * drawn arms, failures being charged a penalized time. The bandits are independent per option,
+    * which trades interaction effects for a sample budget that a 1500-instance batch can actually
+    * cover.
+    */
+   class AutoTuner {
+   public:
+      explicit AutoTuner(const Options& options);
+
+      // draw one arm per tuned option, write the tuned values into the options, and return the
+      // drawn arm indices (to be passed back to report by the same caller)
+      [[nodiscard]] std::vector<size_t> apply(Options& options);
+      // reward the drawn arms with the outcome of the solve
+      void report(const std::vector<size_t>& selection, double solve_time, bool solved);
+
+   protected:
+      struct TunedOption {
+         std::string name;
+         double default_value;
+         std::vector<double> factors;
+         // per-arm statistics
+         std::vector<double> total_time;
+         std::vector<size_t> number_trials;
+      };
+      std::vector<TunedOption> tuned_options;
+      std::mutex mutex{};
+      // deterministic exploration: the arm sequence only depends on the solve order
+      std::mt19937 generator{0};
+      static constexpr double exploration_probability{0.1};
+      // failures are charged this multiple of the worst observed time of the arm set
+      static constexpr double failure_penalty_factor{10.};
+      double worst_observed_time{0.};
+
+      [[nodiscard]] size_t draw_arm(TunedOption& tuned_option);
+   };
+} // namespace
+
+#endif // UNO_AUTOTUNER_H
@@ -0,0 +1,36 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "Deadline.hpp"
+#include "Infinity.hpp"
+
+namespace uno {
+   std::atomic<bool> Deadline::armed{false};
+   std::chrono::steady_clock::time_point Deadline::expiry{};
+
+   void Deadline::arm(double seconds_from_now) {
+      if (0. < seconds_from_now && is_finite(seconds_from_now)) {
+         const auto budget = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+               std::chrono::duration<double>(seconds_from_now));
+         Deadline::expiry = std::chrono::steady_clock::now() + budget;
+         Deadline::armed.store(true);
+      }
+      else {
+         Deadline::disarm();
+      }
+   }
+
+   void Deadline::disarm() {
+      Deadline::armed.store(false);
+   }
+
+   bool Deadline::expired() {
+      return Deadline::armed.load(std::memory_order_relaxed) && Deadline::expiry <= std::chrono::steady_clock::now();
+   }
+
+   void Deadline::check() {
+      if (Deadline::expired()) {
+         throw TimeLimitReached();
+      }
+   }
+} // namespace
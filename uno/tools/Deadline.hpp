@@ -0,0 +1,43 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_DEADLINE_H
+#define UNO_DEADLINE_H
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+
+namespace uno {
+   // thrown at a cooperative cancellation point once the deadline has passed. Caught by the main
+   // loop of Uno::solve, which terminates cleanly with the best iterate found so far
+   struct TimeLimitReached : std::exception {
+      [[nodiscard]] const char* what() const noexcept override { return "time limit reached"; }
+   };
+
+   /*
+    * Process-wide wall-clock deadline for cooperative time-limit enforcement
+    *
+    * The outer loop only compares the elapsed time against the time_limit option between major
+    * iterations, so a single long-running subproblem operation (a large factorization, a
+    * backtracking cascade) can overrun the budget arbitrarily. Uno::solve arms the deadline at the
+    * start of the solve; the inner globalization loops and the solver wrappers call check() at
+    * their natural yield points, which throws TimeLimitReached once the deadline has passed. A
+    * disarmed deadline (the default) makes the checks a single relaxed atomic load
+    */
+   class Deadline {
+   public:
+      // arm the deadline this many (wall-clock) seconds from now; a nonpositive or infinite budget disarms
+      static void arm(double seconds_from_now);
+      static void disarm();
+      [[nodiscard]] static bool expired();
+      // cancellation point: throws TimeLimitReached when the deadline has passed
+      static void check();
+
+   private:
+      static std::atomic<bool> armed;
+      static std::chrono::steady_clock::time_point expiry;
+   };
+} // namespace
+
+#endif // UNO_DEADLINE_H
@@ -0,0 +1,99 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "MemoryUsage.hpp"
+#ifdef __linux__
+#include <fstream>
+#include <string>
+#endif
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace uno {
+   std::array<std::atomic<size_t>, MemoryUsage::NUMBER_GAUGES> MemoryUsage::high_water_marks{};
+
+   void MemoryUsage::reset() {
+      for (std::atomic<size_t>& high_water_mark: MemoryUsage::high_water_marks) {
+         high_water_mark.store(0, std::memory_order_relaxed);
+      }
+   }
+
+   void MemoryUsage::record(Gauge gauge, size_t number_bytes) {
+      std::atomic<size_t>& high_water_mark = MemoryUsage::high_water_marks[gauge];
+      size_t current_mark = high_water_mark.load(std::memory_order_relaxed);
+      while (current_mark < number_bytes &&
+             not high_water_mark.compare_exchange_weak(current_mark, number_bytes, std::memory_order_relaxed)) {
+      }
+   }
+
+   size_t MemoryUsage::get_bytes(Gauge gauge) {
+      return MemoryUsage::high_water_marks[gauge].load(std::memory_order_relaxed);
+   }
+
+   std::array<size_t, MemoryUsage::NUMBER_GAUGES> MemoryUsage::get_all_bytes() {
+      std::array<size_t, MemoryUsage::NUMBER_GAUGES> bytes{};
+      for (size_t gauge_index = 0; gauge_index < MemoryUsage::NUMBER_GAUGES; gauge_index++) {
+         bytes[gauge_index] = MemoryUsage::high_water_marks[gauge_index].load(std::memory_order_relaxed);
+      }
+      return bytes;
+   }
+
+   std::string_view MemoryUsage::gauge_name(Gauge gauge) {
+      switch (gauge) {
+         case MemoryUsage::HESSIAN:
+            return "Hessian storage";
+         case MemoryUsage::JACOBIAN:
+            return "Jacobian storage";
+         case MemoryUsage::KKT_MATRIX:
+            return "KKT matrix";
+         case MemoryUsage::FACTORS:
+            return "factors";
+         case MemoryUsage::ITERATE:
+            return "iterate";
+         default:
+            return "unknown";
+      }
+   }
+
+   size_t MemoryUsage::peak_resident_set_bytes() {
+#ifndef _WIN32
+      rusage usage{};
+      getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+      // ru_maxrss is in bytes on macOS
+      return static_cast<size_t>(usage.ru_maxrss);
+#else
+      // ... and in kilobytes on Linux
+      return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+      return 0;
+#endif
+   }
+
+   size_t MemoryUsage::available_system_bytes() {
+#ifdef __linux__
+      // MemAvailable accounts for the reclaimable caches: the actual headroom before swapping
+      std::ifstream meminfo("/proc/meminfo");
+      std::string token;
+      while (meminfo >> token) {
+         if (token == "MemAvailable:") {
+            size_t kilobytes = 0;
+            meminfo >> kilobytes;
+            return kilobytes * 1024;
+         }
+      }
+#endif
+#ifndef _WIN32
+      // fallback: the physical memory of the machine
+      const long number_pages = sysconf(_SC_PHYS_PAGES);
+      const long page_size = sysconf(_SC_PAGE_SIZE);
+      if (0 < number_pages && 0 < page_size) {
+         return static_cast<size_t>(number_pages) * static_cast<size_t>(page_size);
+      }
+#endif
+      return 0;
+   }
+} // namespace
@@ -0,0 +1,42 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_MEMORYUSAGE_H
+#define UNO_MEMORYUSAGE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <string_view>
+
+namespace uno {
+   /*! \class MemoryUsage
+    * \brief High-water marks of the dominant data structures of the solver
+    *
+    * The existing allocation sites report the byte size of the structure they just sized; each
+    * gauge keeps the largest value seen. Recording is a single atomic maximum, cheap enough to
+    * remain always enabled
+    */
+   class MemoryUsage {
+   public:
+      enum Gauge: size_t {HESSIAN = 0, JACOBIAN, KKT_MATRIX, FACTORS, ITERATE, NUMBER_GAUGES};
+
+      static void reset();
+      static void record(Gauge gauge, size_t number_bytes);
+      [[nodiscard]] static size_t get_bytes(Gauge gauge);
+      [[nodiscard]] static std::array<size_t, MemoryUsage::NUMBER_GAUGES> get_all_bytes();
+      [[nodiscard]] static std::string_view gauge_name(Gauge gauge);
+      // peak resident set size of the process, as reported by the operating system (0 if unavailable)
+      [[nodiscard]] static size_t peak_resident_set_bytes();
+      // memory currently available to the process without swapping (0 if unavailable); used to
+      // abort upfront when a predicted allocation cannot fit on the node
+      [[nodiscard]] static size_t available_system_bytes();
+
+   private:
+      // high-water marks in bytes, updated with an atomic compare-and-swap maximum so that
+      // concurrent solves (e.g. the multistart workers) can share the gauges
+      static std::array<std::atomic<size_t>, MemoryUsage::NUMBER_GAUGES> high_water_marks;
+   };
+} // namespace
+
+#endif // UNO_MEMORYUSAGE_H
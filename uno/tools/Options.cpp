@@ -1,14 +1,235 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include "Options.hpp"
 #include "Logger.hpp"
+#include "symbolic/Range.hpp"
 
 namespace uno {
+   const std::array<Options::OptionDescription, static_cast<size_t>(OptionKey::UNKNOWN_OPTION)> Options::option_registry{{
+         {"AMPL_constraint_profiling_interval", OptionType::UNSIGNED_INTEGER},
+         {"AMPL_number_evaluation_threads", OptionType::UNSIGNED_INTEGER},
+         {"AMPL_parallel_constraint_evaluation", OptionType::BOOLEAN},
+         {"AMPL_shared_structure", OptionType::BOOLEAN},
+         {"AMPL_structure_cache", OptionType::BOOLEAN},
+         {"BFGS_memory_size", OptionType::UNSIGNED_INTEGER},
+         {"BQPD_kmax", OptionType::INTEGER},
+         {"BQPD_print_subproblem", OptionType::BOOLEAN},
+         {"IPM_pipeline", OptionType::BOOLEAN},
+         {"KKT_capture_file", OptionType::STRING},
+         {"KKT_capture_interval", OptionType::UNSIGNED_INTEGER},
+         {"LP_solver", OptionType::STRING},
+         {"LS_backtracking_ratio", OptionType::REAL},
+         {"LS_min_step_length", OptionType::REAL},
+         {"LS_scale_duals_with_step_length", OptionType::BOOLEAN},
+         {"LS_second_order_correction", OptionType::BOOLEAN},
+         {"LS_speculative_evaluations", OptionType::BOOLEAN},
+         {"LS_watchdog_max_relaxed_iterations", OptionType::UNSIGNED_INTEGER},
+         {"MA57_ordering", OptionType::STRING},
+         {"MA57_ordering_file", OptionType::STRING},
+         {"MINRES_max_iterations", OptionType::UNSIGNED_INTEGER},
+         {"MINRES_tolerance", OptionType::REAL},
+         {"MUMPS_memory_limit_MB", OptionType::UNSIGNED_INTEGER},
+         {"MUMPS_out_of_core", OptionType::STRING},
+         {"MUMPS_out_of_core_directory", OptionType::STRING},
+         {"NUMA_first_touch_interleave", OptionType::BOOLEAN},
+         {"QP_initial_LP_phase", OptionType::BOOLEAN},
+         {"QP_solver", OptionType::STRING},
+         {"SR1_memory_size", OptionType::UNSIGNED_INTEGER},
+         {"TR_activity_tolerance", OptionType::REAL},
+         {"TR_aggressive_decrease_factor", OptionType::REAL},
+         {"TR_decrease_factor", OptionType::REAL},
+         {"TR_increase_factor", OptionType::REAL},
+         {"TR_min_radius", OptionType::REAL},
+         {"TR_radius", OptionType::REAL},
+         {"TR_radius_reset_threshold", OptionType::REAL},
+         {"TR_speculative_radius", OptionType::BOOLEAN},
+         {"acceleration_memory", OptionType::UNSIGNED_INTEGER},
+         {"allocation_assert_iteration", OptionType::UNSIGNED_INTEGER},
+         {"allocation_tracking", OptionType::BOOLEAN},
+         {"armijo_decrease_fraction", OptionType::REAL},
+         {"armijo_tolerance", OptionType::REAL},
+         {"auto_tune", OptionType::BOOLEAN},
+         {"barrier_condense_slacks", OptionType::BOOLEAN},
+         {"barrier_crossover", OptionType::BOOLEAN},
+         {"barrier_damping_factor", OptionType::REAL},
+         {"barrier_default_multiplier", OptionType::REAL},
+         {"barrier_initial_parameter", OptionType::REAL},
+         {"barrier_k_epsilon", OptionType::REAL},
+         {"barrier_k_mu", OptionType::REAL},
+         {"barrier_k_sigma", OptionType::REAL},
+         {"barrier_max_consecutive_small_steps", OptionType::UNSIGNED_INTEGER},
+         {"barrier_parameter_update_strategy", OptionType::STRING},
+         {"barrier_push_variable_to_interior_k1", OptionType::REAL},
+         {"barrier_push_variable_to_interior_k2", OptionType::REAL},
+         {"barrier_regularization_exponent", OptionType::REAL},
+         {"barrier_small_direction_factor", OptionType::REAL},
+         {"barrier_tau_min", OptionType::REAL},
+         {"barrier_theta_mu", OptionType::REAL},
+         {"barrier_update_fraction", OptionType::REAL},
+         {"batch_claim_directory", OptionType::STRING},
+         {"batch_number_threads", OptionType::UNSIGNED_INTEGER},
+         {"batch_report_file", OptionType::STRING},
+         {"batch_time_limit", OptionType::REAL},
+         {"constraint_relaxation_strategy", OptionType::STRING},
+         {"convexify_QP", OptionType::BOOLEAN},
+         {"copy_on_write_vectors", OptionType::BOOLEAN},
+         {"deterministic_parallel", OptionType::BOOLEAN},
+         {"divergence_iteration_threshold", OptionType::UNSIGNED_INTEGER},
+         {"divergence_objective_threshold", OptionType::REAL},
+         {"dual_regularization_fraction", OptionType::REAL},
+         {"enforce_linear_constraints", OptionType::BOOLEAN},
+         {"extended_precision_residuals", OptionType::BOOLEAN},
+         {"extended_precision_threshold", OptionType::REAL},
+         {"filter_beta", OptionType::REAL},
+         {"filter_capacity", OptionType::UNSIGNED_INTEGER},
+         {"filter_fact", OptionType::REAL},
+         {"filter_gamma", OptionType::REAL},
+         {"filter_sufficient_infeasibility_decrease_factor", OptionType::REAL},
+         {"filter_type", OptionType::STRING},
+         {"filter_ubd", OptionType::REAL},
+         {"flight_recorder_file", OptionType::STRING},
+         {"flight_recorder_length", OptionType::UNSIGNED_INTEGER},
+         {"function_scaling_drift_factor", OptionType::REAL},
+         {"function_scaling_factors_file", OptionType::STRING},
+         {"function_scaling_threshold", OptionType::REAL},
+         {"funnel_adaptive_contraction", OptionType::BOOLEAN},
+         {"funnel_beta", OptionType::REAL},
+         {"funnel_fact", OptionType::REAL},
+         {"funnel_gamma", OptionType::REAL},
+         {"funnel_kappa", OptionType::REAL},
+         {"funnel_max_consecutive_rejections", OptionType::UNSIGNED_INTEGER},
+         {"funnel_relaxation_factor", OptionType::REAL},
+         {"funnel_require_acceptance_wrt_current_iterate", OptionType::BOOLEAN},
+         {"funnel_ubd", OptionType::REAL},
+         {"funnel_update_strategy", OptionType::INTEGER},
+         {"globalization_mechanism", OptionType::STRING},
+         {"globalization_strategy", OptionType::STRING},
+         {"hessian_compaction_iterations", OptionType::UNSIGNED_INTEGER},
+         {"hessian_compaction_threshold", OptionType::REAL},
+         {"hessian_model", OptionType::STRING},
+         {"huge_pages", OptionType::BOOLEAN},
+         {"inertia_free_curvature_fraction", OptionType::REAL},
+         {"inertia_free_curvature_test", OptionType::BOOLEAN},
+         {"l1_constraint_violation_coefficient", OptionType::REAL},
+         {"l1_relaxation_decrease_factor", OptionType::REAL},
+         {"l1_relaxation_epsilon1", OptionType::REAL},
+         {"l1_relaxation_epsilon2", OptionType::REAL},
+         {"l1_relaxation_fixed_parameter", OptionType::BOOLEAN},
+         {"l1_relaxation_initial_parameter", OptionType::REAL},
+         {"l1_relaxation_residual_small_threshold", OptionType::REAL},
+         {"l1_relaxation_steering_stable_iteration_threshold", OptionType::UNSIGNED_INTEGER},
+         {"l1_small_duals_threshold", OptionType::REAL},
+         {"lagged_hessian_max_age", OptionType::UNSIGNED_INTEGER},
+         {"lagged_jacobian_max_age", OptionType::UNSIGNED_INTEGER},
+         {"lagged_jacobian_step_threshold", OptionType::REAL},
+         {"least_square_multiplier_max_norm", OptionType::REAL},
+         {"linear_solver", OptionType::STRING},
+         {"linear_solver_mixed_precision", OptionType::BOOLEAN},
+         {"linear_solver_number_threads", OptionType::UNSIGNED_INTEGER},
+         {"linear_solver_race", OptionType::STRING},
+         {"linear_solver_race_factorizations", OptionType::UNSIGNED_INTEGER},
+         {"logger", OptionType::STRING},
+         {"logger_async", OptionType::BOOLEAN},
+         {"loose_tolerance", OptionType::REAL},
+         {"loose_tolerance_consecutive_iteration_threshold", OptionType::UNSIGNED_INTEGER},
+         {"max_iterations", OptionType::UNSIGNED_INTEGER},
+         {"multistart_number_points", OptionType::UNSIGNED_INTEGER},
+         {"multistart_number_threads", OptionType::UNSIGNED_INTEGER},
+         {"multistart_perturbation_amplitude", OptionType::REAL},
+         {"nonmonotone_filter_number_dominated_entries", OptionType::UNSIGNED_INTEGER},
+         {"option_overlay_file", OptionType::STRING},
+         {"preset", OptionType::STRING},
+         {"presolve_bound_tightening", OptionType::BOOLEAN},
+         {"presolve_fixed_variables", OptionType::BOOLEAN},
+         {"presolve_redundant_constraints", OptionType::BOOLEAN},
+         {"primal_regularization_decrease_factor", OptionType::REAL},
+         {"primal_regularization_fast_increase_factor", OptionType::REAL},
+         {"primal_regularization_initial_factor", OptionType::REAL},
+         {"primal_regularization_lb", OptionType::REAL},
+         {"primal_regularization_slow_increase_factor", OptionType::REAL},
+         {"print_solution", OptionType::BOOLEAN},
+         {"print_summary", OptionType::BOOLEAN},
+         {"profiler", OptionType::BOOLEAN},
+         {"profiler_hardware_counters", OptionType::BOOLEAN},
+         {"progress_norm", OptionType::STRING},
+         {"protect_actual_reduction_against_roundoff", OptionType::BOOLEAN},
+         {"reduction_number_threads", OptionType::UNSIGNED_INTEGER},
+         {"regularization_failure_threshold", OptionType::REAL},
+         {"regularization_increase_factor", OptionType::REAL},
+         {"regularization_initial_value", OptionType::REAL},
+         {"residual_norm", OptionType::STRING},
+         {"residual_scaling_threshold", OptionType::REAL},
+         {"restart_max_attempts", OptionType::UNSIGNED_INTEGER},
+         {"restart_perturbation_amplitude", OptionType::REAL},
+         {"restart_stall_iteration_threshold", OptionType::UNSIGNED_INTEGER},
+         {"result_file", OptionType::STRING},
+         {"scale_functions", OptionType::BOOLEAN},
+         {"scheduler_number_threads", OptionType::UNSIGNED_INTEGER},
+         {"schur_complement_max_linking_fraction", OptionType::REAL},
+         {"schur_complement_solver", OptionType::BOOLEAN},
+         {"snapshot_file", OptionType::STRING},
+         {"snapshot_interval", OptionType::UNSIGNED_INTEGER},
+         {"sparse_format", OptionType::STRING},
+         {"sparse_format_KKT", OptionType::STRING},
+         {"sparse_format_hessian", OptionType::STRING},
+         {"statistics_LS_step_length_column_order", OptionType::INTEGER},
+         {"statistics_TR_radius_column_order", OptionType::INTEGER},
+         {"statistics_active_set_hits_column_order", OptionType::INTEGER},
+         {"statistics_allocations_column_order", OptionType::INTEGER},
+         {"statistics_barrier_parameter_column_order", OptionType::INTEGER},
+         {"statistics_complementarity_column_order", OptionType::INTEGER},
+         {"statistics_funnel_width_column_order", OptionType::INTEGER},
+         {"statistics_history_file", OptionType::STRING},
+         {"statistics_major_column_order", OptionType::INTEGER},
+         {"statistics_minor_column_order", OptionType::INTEGER},
+         {"statistics_objective_column_order", OptionType::INTEGER},
+         {"statistics_penalty_parameter_column_order", OptionType::INTEGER},
+         {"statistics_primal_feasibility_column_order", OptionType::INTEGER},
+         {"statistics_print_header_every_iterations", OptionType::UNSIGNED_INTEGER},
+         {"statistics_probe_solves_column_order", OptionType::INTEGER},
+         {"statistics_regularization_column_order", OptionType::INTEGER},
+         {"statistics_restoration_phase_column_order", OptionType::INTEGER},
+         {"statistics_stationarity_column_order", OptionType::INTEGER},
+         {"statistics_status_column_order", OptionType::INTEGER},
+         {"statistics_step_norm_column_order", OptionType::INTEGER},
+         {"statistics_stream_endpoint", OptionType::STRING},
+         {"subproblem", OptionType::STRING},
+         {"subproblem_inexact_max_tolerance", OptionType::REAL},
+         {"subproblem_inexact_solves", OptionType::BOOLEAN},
+         {"subproblem_inexact_tolerance_factor", OptionType::REAL},
+         {"switch_to_optimality_requires_linearized_feasibility", OptionType::BOOLEAN},
+         {"switching_delta", OptionType::REAL},
+         {"switching_infeasibility_exponent", OptionType::REAL},
+         {"threshold_unsuccessful_attempts", OptionType::UNSIGNED_INTEGER},
+         {"time_limit", OptionType::REAL},
+         {"tolerance", OptionType::REAL},
+         {"tuning_cache", OptionType::BOOLEAN},
+         {"unbounded_objective_threshold", OptionType::REAL},
+         {"warm_start_ingredient_state", OptionType::BOOLEAN},
+   }};
+
+   OptionKey Options::find_option_key(const std::string& name) {
+      const auto iterator = std::lower_bound(Options::option_registry.cbegin(), Options::option_registry.cend(), name,
+            [](const OptionDescription& description, const std::string& name) {
+         return description.name < name;
+      });
+      if (iterator != Options::option_registry.cend() && iterator->name == name) {
+         return static_cast<OptionKey>(iterator - Options::option_registry.cbegin());
+      }
+      return OptionKey::UNKNOWN_OPTION;
+   }
+
    std::string& Options::operator[](const std::string& key) {
+      // a raw write invalidates the resolved value, which will be re-parsed at the next read
+      const OptionKey option_key = Options::find_option_key(key);
+      if (option_key != OptionKey::UNKNOWN_OPTION) {
+         this->typed_values[static_cast<size_t>(option_key)].is_resolved = false;
+      }
       return this->options[key];
    }
 
@@ -23,34 +244,121 @@ namespace uno {
       }
    }
 
+   // parse the raw text into the typed value, according to the registered type of the option
+   void Options::parse(const OptionDescription& description, const std::string& text, TypedValue& value) {
+      try {
+         switch (description.type) {
+            case OptionType::REAL:
+               value.real_value = std::stod(text);
+               break;
+            case OptionType::INTEGER:
+               value.integer_value = std::stoi(text);
+               break;
+            case OptionType::UNSIGNED_INTEGER:
+               value.unsigned_integer_value = std::stoul(text);
+               break;
+            case OptionType::BOOLEAN:
+               // strict yes/no: anything else (e.g. "true") would silently resolve to false
+               if (text != "yes" && text != "no") {
+                  throw std::invalid_argument("boolean");
+               }
+               value.boolean_value = (text == "yes");
+               break;
+            case OptionType::STRING:
+               break;
+         }
+      }
+      catch (const std::invalid_argument&) {
+         throw std::runtime_error("The value " + text + " of the option " + std::string(description.name) + " does not have the expected type");
+      }
+      catch (const std::out_of_range&) {
+         throw std::runtime_error("The value " + text + " of the option " + std::string(description.name) + " is out of range");
+      }
+      value.is_resolved = true;
+   }
+
+   const Options::TypedValue& Options::resolved_value(OptionKey key) const {
+      const size_t index = static_cast<size_t>(key);
+      TypedValue& value = this->typed_values[index];
+      if (not value.is_resolved) {
+         const OptionDescription& description = Options::option_registry[index];
+         Options::parse(description, this->at(std::string(description.name)), value);
+      }
+      this->typed_value_used[index] = true;
+      return value;
+   }
+
+   // parse all the registered options present in the raw map, so that type errors surface at load
+   // time rather than at the first read
+   void Options::resolve() {
+      for (size_t index: Range(Options::option_registry.size())) {
+         const OptionDescription& description = Options::option_registry[index];
+         const auto iterator = this->options.find(std::string(description.name));
+         if (iterator != this->options.end()) {
+            Options::parse(description, iterator->second, this->typed_values[index]);
+         }
+      }
+   }
+
    const std::string& Options::get_string(const std::string& key) const {
       return this->at(key);
    }
 
    double Options::get_double(const std::string& key) const {
-      const std::string& entry = this->at(key);
-      return std::stod(entry);
+      const OptionKey option_key = Options::find_option_key(key);
+      if (option_key != OptionKey::UNKNOWN_OPTION && Options::option_registry[static_cast<size_t>(option_key)].type == OptionType::REAL) {
+         return this->resolved_value(option_key).real_value;
+      }
+      return std::stod(this->at(key));
    }
 
    int Options::get_int(const std::string& key) const {
-      const std::string& entry = this->at(key);
-      return std::stoi(entry);
+      const OptionKey option_key = Options::find_option_key(key);
+      if (option_key != OptionKey::UNKNOWN_OPTION && Options::option_registry[static_cast<size_t>(option_key)].type == OptionType::INTEGER) {
+         return this->resolved_value(option_key).integer_value;
+      }
+      return std::stoi(this->at(key));
    }
 
    size_t Options::get_unsigned_int(const std::string& key) const {
-      const std::string& entry = this->at(key);
-      return std::stoul(entry);
+      const OptionKey option_key = Options::find_option_key(key);
+      if (option_key != OptionKey::UNKNOWN_OPTION && Options::option_registry[static_cast<size_t>(option_key)].type == OptionType::UNSIGNED_INTEGER) {
+         return this->resolved_value(option_key).unsigned_integer_value;
+      }
+      return std::stoul(this->at(key));
    }
 
    bool Options::get_bool(const std::string& key) const {
-      const std::string& entry = this->at(key);
-      return entry == "yes";
+      const OptionKey option_key = Options::find_option_key(key);
+      if (option_key != OptionKey::UNKNOWN_OPTION && Options::option_registry[static_cast<size_t>(option_key)].type == OptionType::BOOLEAN) {
+         return this->resolved_value(option_key).boolean_value;
+      }
+      return this->at(key) == "yes";
+   }
+
+   double Options::get_double(OptionKey key) const {
+      return this->resolved_value(key).real_value;
+   }
+
+   int Options::get_int(OptionKey key) const {
+      return this->resolved_value(key).integer_value;
+   }
+
+   size_t Options::get_unsigned_int(OptionKey key) const {
+      return this->resolved_value(key).unsigned_integer_value;
+   }
+
+   bool Options::get_bool(OptionKey key) const {
+      return this->resolved_value(key).boolean_value;
    }
 
    void Options::print(bool only_used) const {
       std::cout << "Options:\n";
       for (const auto& [key, value]: this->options) {
-         if (not only_used || this->is_used[key]) {
+         const OptionKey option_key = Options::find_option_key(key);
+         const bool used = this->is_used[key] ||
+               (option_key != OptionKey::UNKNOWN_OPTION && this->typed_value_used[static_cast<size_t>(option_key)]);
+         if (not only_used || used) {
             std::cout << "- " << key << " = " << value << '\n';
          }
       }
@@ -67,20 +375,41 @@ namespace uno {
          Options options;
          std::string key, value;
          std::string line;
+         std::vector<std::pair<std::string, std::string>> file_entries;
          while (std::getline(file, line)) {
             if (not line.empty() && line.find('#') != 0) {
                std::istringstream iss;
                iss.str(line);
                iss >> key >> value;
+               file_entries.emplace_back(key, value);
                options[key] = value;
             }
          }
          file.close();
+         // expand a preset selected in the option file itself: the bundle is layered under the
+         // explicit entries of the file, which are re-applied on top and therefore win ("auto" is
+         // deferred until the model structure is known)
+         for (const auto& [entry_key, entry_value]: file_entries) {
+            if (entry_key == "preset" && entry_value != "none" && entry_value != "auto") {
+               find_preset(entry_value, options);
+               for (const auto& [override_key, override_value]: file_entries) {
+                  options[override_key] = override_value;
+               }
+               break;
+            }
+         }
+         // resolve the typed registry once, right after loading
+         options.resolve();
          return options;
       }
    }
 
    void find_preset(const std::string& preset_name, Options& options) {
+      options["preset"] = preset_name;
+      // the choice of an automatic preset is deferred until the model structure is known
+      if (preset_name == "auto") {
+         return;
+      }
       // shortcuts for state-of-the-art combinations
       if (preset_name == "ipopt") {
          options["constraint_relaxation_strategy"] = "feasibility_restoration";
@@ -174,6 +503,39 @@ namespace uno {
          options["funnel_switching_infeasibility_exponent"] = "2";
          options["funnel_update_strategy"] = "2";
       }
+      // curated performance bundles, layered on the ingredient presets above: they capture the
+      // configurations that keep resurfacing in tuning campaigns, so that a single option value
+      // yields the fast path. User overrides (command line, AMPL options) still apply on top
+      else if (preset_name == "large-sparse-ipm") {
+         // interior-point stack for large sparse instances: condensed KKT systems, mixed-precision
+         // factorizations with double-accuracy refinement, and the regularization/barrier memory
+         // shared across related instances of a batch
+         find_preset("ipopt", options);
+         options["preset"] = preset_name;
+         options["barrier_condense_slacks"] = "yes";
+         options["linear_solver_mixed_precision"] = "yes";
+         options["hessian_compaction_iterations"] = "10";
+         options["tuning_cache"] = "yes";
+      }
+      else if (preset_name == "fast-sqp-warm") {
+         // trust-region SQP tuned for warm-started and repeated solves: cheap LP steps while they
+         // are accepted, ingredient state carried over between Uno::solve calls, and the cached
+         // regularization seeds of previous instances of the same family
+         find_preset("filtersqp", options);
+         options["preset"] = preset_name;
+         options["QP_initial_LP_phase"] = "yes";
+         options["warm_start_ingredient_state"] = "yes";
+         options["tuning_cache"] = "yes";
+      }
+      else if (preset_name == "robust-nonconvex") {
+         // funnel SQP hardened for nonconvex instances: convexified subproblems, perturbed restarts
+         // out of stalls, and compensated residual accumulation in the convergence tail
+         find_preset("funnelsqp", options);
+         options["preset"] = preset_name;
+         options["convexify_QP"] = "yes";
+         options["restart_max_attempts"] = "2";
+         options["extended_precision_residuals"] = "yes";
+      }
       else {
          throw std::runtime_error("The preset " + preset_name + " is not known.");
       }
@@ -203,5 +565,7 @@ namespace uno {
             i++;
          }
       }
+      // re-resolve the typed registry, so that mistyped command-line values are caught at startup
+      this->resolve();
    }
 } // namespace
@@ -4,35 +4,285 @@
 #ifndef UNO_OPTIONS_H
 #define UNO_OPTIONS_H
 
+#include <array>
 #include <map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace uno {
+   // typed keys of the known options, in alphabetical order. Reads through these keys are direct
+   // array accesses into the typed registry, with no string lookup or parsing
+   enum class OptionKey: size_t {
+      AMPL_constraint_profiling_interval,
+      AMPL_number_evaluation_threads,
+      AMPL_parallel_constraint_evaluation,
+      AMPL_shared_structure,
+      AMPL_structure_cache,
+      BFGS_memory_size,
+      BQPD_kmax,
+      BQPD_print_subproblem,
+      IPM_pipeline,
+      KKT_capture_file,
+      KKT_capture_interval,
+      LP_solver,
+      LS_backtracking_ratio,
+      LS_min_step_length,
+      LS_scale_duals_with_step_length,
+      LS_second_order_correction,
+      LS_speculative_evaluations,
+      LS_watchdog_max_relaxed_iterations,
+      MA57_ordering,
+      MA57_ordering_file,
+      MINRES_max_iterations,
+      MINRES_tolerance,
+      MUMPS_memory_limit_MB,
+      MUMPS_out_of_core,
+      MUMPS_out_of_core_directory,
+      NUMA_first_touch_interleave,
+      QP_initial_LP_phase,
+      QP_solver,
+      SR1_memory_size,
+      TR_activity_tolerance,
+      TR_aggressive_decrease_factor,
+      TR_decrease_factor,
+      TR_increase_factor,
+      TR_min_radius,
+      TR_radius,
+      TR_radius_reset_threshold,
+      TR_speculative_radius,
+      acceleration_memory,
+      allocation_assert_iteration,
+      allocation_tracking,
+      armijo_decrease_fraction,
+      armijo_tolerance,
+      auto_tune,
+      barrier_condense_slacks,
+      barrier_crossover,
+      barrier_damping_factor,
+      barrier_default_multiplier,
+      barrier_initial_parameter,
+      barrier_k_epsilon,
+      barrier_k_mu,
+      barrier_k_sigma,
+      barrier_max_consecutive_small_steps,
+      barrier_parameter_update_strategy,
+      barrier_push_variable_to_interior_k1,
+      barrier_push_variable_to_interior_k2,
+      barrier_regularization_exponent,
+      barrier_small_direction_factor,
+      barrier_tau_min,
+      barrier_theta_mu,
+      barrier_update_fraction,
+      batch_claim_directory,
+      batch_number_threads,
+      batch_report_file,
+      batch_time_limit,
+      constraint_relaxation_strategy,
+      convexify_QP,
+      copy_on_write_vectors,
+      deterministic_parallel,
+      divergence_iteration_threshold,
+      divergence_objective_threshold,
+      dual_regularization_fraction,
+      enforce_linear_constraints,
+      extended_precision_residuals,
+      extended_precision_threshold,
+      filter_beta,
+      filter_capacity,
+      filter_fact,
+      filter_gamma,
+      filter_sufficient_infeasibility_decrease_factor,
+      filter_type,
+      filter_ubd,
+      flight_recorder_file,
+      flight_recorder_length,
+      function_scaling_drift_factor,
+      function_scaling_factors_file,
+      function_scaling_threshold,
+      funnel_adaptive_contraction,
+      funnel_beta,
+      funnel_fact,
+      funnel_gamma,
+      funnel_kappa,
+      funnel_max_consecutive_rejections,
+      funnel_relaxation_factor,
+      funnel_require_acceptance_wrt_current_iterate,
+      funnel_ubd,
+      funnel_update_strategy,
+      globalization_mechanism,
+      globalization_strategy,
+      hessian_compaction_iterations,
+      hessian_compaction_threshold,
+      hessian_model,
+      huge_pages,
+      inertia_free_curvature_fraction,
+      inertia_free_curvature_test,
+      l1_constraint_violation_coefficient,
+      l1_relaxation_decrease_factor,
+      l1_relaxation_epsilon1,
+      l1_relaxation_epsilon2,
+      l1_relaxation_fixed_parameter,
+      l1_relaxation_initial_parameter,
+      l1_relaxation_residual_small_threshold,
+      l1_relaxation_steering_stable_iteration_threshold,
+      l1_small_duals_threshold,
+      lagged_hessian_max_age,
+      lagged_jacobian_max_age,
+      lagged_jacobian_step_threshold,
+      least_square_multiplier_max_norm,
+      linear_solver,
+      linear_solver_mixed_precision,
+      linear_solver_number_threads,
+      linear_solver_race,
+      linear_solver_race_factorizations,
+      logger,
+      logger_async,
+      loose_tolerance,
+      loose_tolerance_consecutive_iteration_threshold,
+      max_iterations,
+      multistart_number_points,
+      multistart_number_threads,
+      multistart_perturbation_amplitude,
+      nonmonotone_filter_number_dominated_entries,
+      option_overlay_file,
+      preset,
+      presolve_bound_tightening,
+      presolve_fixed_variables,
+      presolve_redundant_constraints,
+      primal_regularization_decrease_factor,
+      primal_regularization_fast_increase_factor,
+      primal_regularization_initial_factor,
+      primal_regularization_lb,
+      primal_regularization_slow_increase_factor,
+      print_solution,
+      print_summary,
+      profiler,
+      profiler_hardware_counters,
+      progress_norm,
+      protect_actual_reduction_against_roundoff,
+      reduction_number_threads,
+      regularization_failure_threshold,
+      regularization_increase_factor,
+      regularization_initial_value,
+      residual_norm,
+      residual_scaling_threshold,
+      restart_max_attempts,
+      restart_perturbation_amplitude,
+      restart_stall_iteration_threshold,
+      result_file,
+      scale_functions,
+      scheduler_number_threads,
+      schur_complement_max_linking_fraction,
+      schur_complement_solver,
+      snapshot_file,
+      snapshot_interval,
+      sparse_format,
+      sparse_format_KKT,
+      sparse_format_hessian,
+      statistics_LS_step_length_column_order,
+      statistics_TR_radius_column_order,
+      statistics_active_set_hits_column_order,
+      statistics_allocations_column_order,
+      statistics_barrier_parameter_column_order,
+      statistics_complementarity_column_order,
+      statistics_funnel_width_column_order,
+      statistics_history_file,
+      statistics_major_column_order,
+      statistics_minor_column_order,
+      statistics_objective_column_order,
+      statistics_penalty_parameter_column_order,
+      statistics_primal_feasibility_column_order,
+      statistics_print_header_every_iterations,
+      statistics_probe_solves_column_order,
+      statistics_regularization_column_order,
+      statistics_restoration_phase_column_order,
+      statistics_stationarity_column_order,
+      statistics_status_column_order,
+      statistics_step_norm_column_order,
+      statistics_stream_endpoint,
+      subproblem,
+      subproblem_inexact_max_tolerance,
+      subproblem_inexact_solves,
+      subproblem_inexact_tolerance_factor,
+      switch_to_optimality_requires_linearized_feasibility,
+      switching_delta,
+      switching_infeasibility_exponent,
+      threshold_unsuccessful_attempts,
+      time_limit,
+      tolerance,
+      tuning_cache,
+      unbounded_objective_threshold,
+      warm_start_ingredient_state,
+      UNKNOWN_OPTION // sentinel, also the number of known options
+   };
+
    class Options {
    public:
       Options() = default;
 
       std::string& operator[](const std::string& key);
 
+      // string-keyed getters: the registered options return their pre-parsed value, unregistered
+      // options (e.g. set by a preset but never described) fall back to parsing the raw text
       [[nodiscard]] const std::string& get_string(const std::string& key) const;
       [[nodiscard]] double get_double(const std::string& key) const;
       [[nodiscard]] int get_int(const std::string& key) const;
       [[nodiscard]] size_t get_unsigned_int(const std::string& key) const;
       [[nodiscard]] bool get_bool(const std::string& key) const;
 
+      // enum-keyed getters: free reads from the typed registry (resolved once at startup)
+      [[nodiscard]] double get_double(OptionKey key) const;
+      [[nodiscard]] int get_int(OptionKey key) const;
+      [[nodiscard]] size_t get_unsigned_int(OptionKey key) const;
+      [[nodiscard]] bool get_bool(OptionKey key) const;
+
       void get_command_line_arguments(int argc, char* argv[]);
 
+      // parse all the registered options into the typed registry and catch type errors early
+      void resolve();
+
       void print(bool only_used) const;
 
       static Options get_default_options(const std::string& file_name);
 
    private:
+      enum class OptionType: char {STRING, BOOLEAN, INTEGER, UNSIGNED_INTEGER, REAL};
+      struct OptionDescription {
+         std::string_view name;
+         OptionType type;
+      };
+      struct TypedValue {
+         bool is_resolved{false};
+         double real_value{0.};
+         int integer_value{0};
+         size_t unsigned_integer_value{0};
+         bool boolean_value{false};
+      };
+
+      // name and type of every known option, in the same (alphabetical) order as OptionKey, so that
+      // the table can be indexed by OptionKey and binary-searched by name
+      static const std::array<OptionDescription, static_cast<size_t>(OptionKey::UNKNOWN_OPTION)> option_registry;
+
+      // raw text of the options, kept for loading the option file, printing and get_string
       std::map<std::string, std::string> options{};
+      // typed values, indexed by OptionKey (mutable: options modified through operator[] are
+      // re-resolved lazily by the const getters)
+      mutable std::vector<TypedValue> typed_values{static_cast<size_t>(OptionKey::UNKNOWN_OPTION)};
       // keep track of the options that are used
       mutable std::map<std::string, bool> is_used{};
+      mutable std::vector<bool> typed_value_used = std::vector<bool>(static_cast<size_t>(OptionKey::UNKNOWN_OPTION), false);
 
       [[nodiscard]] const std::string& at(const std::string& key) const;
+      [[nodiscard]] static OptionKey find_option_key(const std::string& name);
+      [[nodiscard]] const TypedValue& resolved_value(OptionKey key) const;
+      static void parse(const OptionDescription& description, const std::string& text, TypedValue& value);
    };
+
+   // set all the options of a named preset ("ipopt", "filtersqp", ...) in one shot. The "auto"
+   // preset is only recorded here; it is resolved once the model structure is known (see
+   // ModelFactory::select_automatic_preset)
+   void find_preset(const std::string& preset_name, Options& options);
 } // namespace
 
 #endif // UNO_OPTIONS_H
@@ -0,0 +1,24 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_PREFETCH_H
+#define UNO_PREFETCH_H
+
+#include <cstddef>
+
+namespace uno {
+   // how many nonzeros ahead the sparse kernels prefetch their indirect operands: far enough to
+   // cover the load latency, close enough that the line is still cached when the loop reaches it
+   constexpr size_t PREFETCH_DISTANCE = 16;
+
+   // best-effort read prefetch of the cache line holding the address (no-op on unsupported compilers)
+   inline void prefetch_read(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(address, /* read */ 0, /* moderate temporal locality */ 1);
+#else
+      (void) address;
+#endif
+   }
+} // namespace
+
+#endif // UNO_PREFETCH_H
@@ -0,0 +1,163 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "Profiler.hpp"
+#include "Logger.hpp"
+
+#ifdef __linux__
+#include <cstring>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+namespace uno {
+   bool Profiler::enabled = false;
+   bool Profiler::counters_enabled = false;
+   std::array<std::atomic<long long>, Profiler::NUMBER_BUCKETS> Profiler::durations{};
+   std::array<std::array<std::atomic<unsigned long long>, Profiler::NUMBER_COUNTERS>, Profiler::NUMBER_BUCKETS> Profiler::counters{};
+
+#ifdef __linux__
+   namespace {
+      // per-thread group of perf event file descriptors, opened lazily on the first read. The
+      // events follow a common group leader, so that one read() returns a consistent snapshot;
+      // events that the hardware or the kernel does not support are skipped and read as 0
+      struct PerfCounterGroup {
+         bool attempted{false};
+         int group_descriptor{-1};
+         int descriptors[Profiler::NUMBER_COUNTERS]{-1, -1, -1};
+         // counter indices of the opened events, in group (= opening) order
+         size_t opened_counters[Profiler::NUMBER_COUNTERS]{};
+         size_t number_opened{0};
+
+         ~PerfCounterGroup() {
+            for (const int descriptor: this->descriptors) {
+               if (0 <= descriptor) {
+                  ::close(descriptor);
+               }
+            }
+         }
+      };
+      thread_local PerfCounterGroup thread_perf_counters{};
+      std::atomic<bool> perf_unavailable_warning_issued{false};
+
+      int open_perf_event(unsigned long long config, int group_descriptor) {
+         perf_event_attr attributes;
+         std::memset(&attributes, 0, sizeof(attributes));
+         attributes.size = sizeof(attributes);
+         attributes.type = PERF_TYPE_HARDWARE;
+         attributes.config = config;
+         // user-space counts of the calling thread only, on whichever CPU it runs
+         attributes.exclude_kernel = 1;
+         attributes.exclude_hv = 1;
+         attributes.read_format = PERF_FORMAT_GROUP;
+         return static_cast<int>(::syscall(SYS_perf_event_open, &attributes, 0, -1, group_descriptor, 0));
+      }
+   } // namespace
+#endif
+
+   void Profiler::reset() {
+      for (std::atomic<long long>& duration: Profiler::durations) {
+         duration.store(0, std::memory_order_relaxed);
+      }
+      for (auto& bucket_counters: Profiler::counters) {
+         for (std::atomic<unsigned long long>& counter: bucket_counters) {
+            counter.store(0, std::memory_order_relaxed);
+         }
+      }
+   }
+
+   void Profiler::add(Bucket bucket, std::chrono::steady_clock::duration duration) {
+      const long long nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+      Profiler::durations[bucket].fetch_add(nanoseconds, std::memory_order_relaxed);
+   }
+
+   void Profiler::add_counters(Bucket bucket, const unsigned long long (&deltas)[Profiler::NUMBER_COUNTERS]) {
+      for (size_t counter_index = 0; counter_index < Profiler::NUMBER_COUNTERS; counter_index++) {
+         Profiler::counters[bucket][counter_index].fetch_add(deltas[counter_index], std::memory_order_relaxed);
+      }
+   }
+
+   bool Profiler::read_counters(unsigned long long (&values)[Profiler::NUMBER_COUNTERS]) {
+#ifdef __linux__
+      PerfCounterGroup& group = thread_perf_counters;
+      if (not group.attempted) {
+         group.attempted = true;
+         static const unsigned long long configs[Profiler::NUMBER_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES,
+               PERF_COUNT_HW_STALLED_CYCLES_BACKEND, PERF_COUNT_HW_CACHE_MISSES};
+         for (size_t counter_index = 0; counter_index < Profiler::NUMBER_COUNTERS; counter_index++) {
+            const int descriptor = open_perf_event(configs[counter_index], group.group_descriptor);
+            if (0 <= descriptor) {
+               if (group.group_descriptor < 0) {
+                  group.group_descriptor = descriptor;
+               }
+               group.descriptors[group.number_opened] = descriptor;
+               group.opened_counters[group.number_opened] = counter_index;
+               group.number_opened++;
+            }
+         }
+         if (group.group_descriptor < 0 && not perf_unavailable_warning_issued.exchange(true)) {
+            WARNING << "Profiler: the hardware performance counters are unavailable "
+                       "(perf_event_open failed, check /proc/sys/kernel/perf_event_paranoid)\n";
+         }
+      }
+      if (group.group_descriptor < 0) {
+         return false;
+      }
+      // a single group read returns the number of events followed by their values, in group order
+      unsigned long long snapshot[1 + Profiler::NUMBER_COUNTERS] = {};
+      const ssize_t bytes_read = ::read(group.group_descriptor, snapshot, sizeof(snapshot));
+      if (bytes_read < static_cast<ssize_t>((1 + group.number_opened) * sizeof(unsigned long long))) {
+         return false;
+      }
+      for (size_t counter_index = 0; counter_index < Profiler::NUMBER_COUNTERS; counter_index++) {
+         values[counter_index] = 0;
+      }
+      for (size_t position = 0; position < group.number_opened; position++) {
+         values[group.opened_counters[position]] = snapshot[1 + position];
+      }
+      return true;
+#else
+      (void) values;
+      return false;
+#endif
+   }
+
+   double Profiler::get_duration(Bucket bucket) {
+      return static_cast<double>(Profiler::durations[bucket].load(std::memory_order_relaxed)) * 1e-9;
+   }
+
+   unsigned long long Profiler::get_counter(Bucket bucket, Counter counter) {
+      return Profiler::counters[bucket][counter].load(std::memory_order_relaxed);
+   }
+
+   std::string_view Profiler::bucket_name(Bucket bucket) {
+      switch (bucket) {
+         case Profiler::EVALUATION:
+            return "function evaluations";
+         case Profiler::ASSEMBLY:
+            return "system assembly";
+         case Profiler::FACTORIZATION:
+            return "factorizations";
+         case Profiler::SOLVE:
+            return "subproblem solves";
+         case Profiler::GLOBALIZATION:
+            return "globalization";
+         default:
+            return "unknown";
+      }
+   }
+
+   std::string_view Profiler::counter_name(Counter counter) {
+      switch (counter) {
+         case Profiler::CYCLES:
+            return "cycles";
+         case Profiler::STALLED_CYCLES:
+            return "stalled cycles";
+         case Profiler::LLC_MISSES:
+            return "LLC misses";
+         default:
+            return "unknown";
+      }
+   }
+} // namespace
@@ -0,0 +1,88 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_PROFILER_H
+#define UNO_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string_view>
+
+namespace uno {
+   /*! \class Profiler
+    * \brief Accumulating profiler for the hot paths of the solver
+    *
+    * The scoped timers add their elapsed time to one of a fixed set of buckets. When the profiler
+    * is disabled (the default), entering and leaving a scope costs a single branch on a static flag.
+    * With the hardware counters active (profiler_hardware_counters, Linux perf events), each scope
+    * additionally samples cycles, backend-stalled cycles and last-level cache misses, which tells
+    * whether a slow phase is compute-bound or memory-bound
+    */
+   class Profiler {
+   public:
+      enum Bucket: size_t {EVALUATION = 0, ASSEMBLY, FACTORIZATION, SOLVE, GLOBALIZATION, NUMBER_BUCKETS};
+      enum Counter: size_t {CYCLES = 0, STALLED_CYCLES, LLC_MISSES, NUMBER_COUNTERS};
+
+      static bool enabled;
+      // hardware counter sampling on top of the timers; silently degrades to timers only where the
+      // perf events are unavailable (non-Linux platforms, restrictive perf_event_paranoid)
+      static bool counters_enabled;
+
+      static void reset();
+      static void add(Bucket bucket, std::chrono::steady_clock::duration duration);
+      static void add_counters(Bucket bucket, const unsigned long long (&deltas)[NUMBER_COUNTERS]);
+      // snapshot of the per-thread counter group; returns false when the counters are unavailable
+      [[nodiscard]] static bool read_counters(unsigned long long (&values)[NUMBER_COUNTERS]);
+      [[nodiscard]] static double get_duration(Bucket bucket); // in seconds
+      [[nodiscard]] static unsigned long long get_counter(Bucket bucket, Counter counter);
+      [[nodiscard]] static std::string_view bucket_name(Bucket bucket);
+      [[nodiscard]] static std::string_view counter_name(Counter counter);
+
+   private:
+      // durations in nanoseconds, accumulated atomically so that concurrent evaluations (e.g. the
+      // multithreaded Jacobian) can share the buckets
+      static std::array<std::atomic<long long>, Profiler::NUMBER_BUCKETS> durations;
+      static std::array<std::array<std::atomic<unsigned long long>, Profiler::NUMBER_COUNTERS>, Profiler::NUMBER_BUCKETS> counters;
+   };
+
+   // scoped timer: measures its own lifetime and adds it to the given bucket
+   class ScopedProfile {
+   public:
+      explicit ScopedProfile(Profiler::Bucket bucket): bucket(bucket) {
+         if (Profiler::enabled) {
+            if (Profiler::counters_enabled) {
+               this->counters_read = Profiler::read_counters(this->start_counters);
+            }
+            this->start_time = std::chrono::steady_clock::now();
+         }
+      }
+
+      ~ScopedProfile() {
+         if (Profiler::enabled) {
+            Profiler::add(this->bucket, std::chrono::steady_clock::now() - this->start_time);
+            if (this->counters_read) {
+               unsigned long long end_counters[Profiler::NUMBER_COUNTERS];
+               if (Profiler::read_counters(end_counters)) {
+                  unsigned long long deltas[Profiler::NUMBER_COUNTERS];
+                  for (size_t counter_index = 0; counter_index < Profiler::NUMBER_COUNTERS; counter_index++) {
+                     deltas[counter_index] = end_counters[counter_index] - this->start_counters[counter_index];
+                  }
+                  Profiler::add_counters(this->bucket, deltas);
+               }
+            }
+         }
+      }
+
+      ScopedProfile(const ScopedProfile&) = delete;
+      ScopedProfile& operator=(const ScopedProfile&) = delete;
+
+   private:
+      const Profiler::Bucket bucket;
+      std::chrono::steady_clock::time_point start_time{};
+      unsigned long long start_counters[Profiler::NUMBER_COUNTERS]{};
+      bool counters_read{false};
+   };
+} // namespace
+
+#endif // UNO_PROFILER_H
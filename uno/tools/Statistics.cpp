@@ -1,10 +1,17 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
 #include "Statistics.hpp"
 #include "Options.hpp"
+#include "StatisticsStreamer.hpp"
+#include "symbolic/Range.hpp"
 
 namespace uno {
    // TODO move this to the option file
@@ -14,41 +21,113 @@ namespace uno {
    int Statistics::numerical_format_size = 6;
 
    Statistics::Statistics(const Options& options): print_header_every_iterations(options.get_unsigned_int("statistics_print_header_every_iterations")) {
+      const std::string& stream_endpoint = options.get_string("statistics_stream_endpoint");
+      if (stream_endpoint != "none") {
+         this->streamer = std::make_unique<StatisticsStreamer>(stream_endpoint);
+      }
+   }
+
+   Statistics::Statistics(Statistics&& other) noexcept = default;
+
+   Statistics::~Statistics() {
+      // the last line (typically carrying the termination status) is never followed by
+      // start_new_line: stream it here
+      if (this->streamer != nullptr) {
+         this->streamer->push(this->format_datagram());
+      }
    }
 
    void Statistics::add_column(std::string_view name, int width, int order) {
-      this->columns[order] = name;
-      this->widths[name] = width;
+      // a column registered with an existing order replaces it (like the previous std::map storage)
+      for (Column& column: this->columns) {
+         if (column.order == order) {
+            column.name = name;
+            column.width = width;
+            return;
+         }
+      }
+      // insert the column at its sorted position and keep the cells of all the lines aligned.
+      // Columns are only added during the initialization, when at most a couple of lines exist
+      const auto iterator = std::upper_bound(this->columns.begin(), this->columns.end(), order, [](int order, const Column& column) {
+         return order < column.order;
+      });
+      const auto position = static_cast<size_t>(iterator - this->columns.begin());
+      this->columns.insert(iterator, {std::string(name), width, order});
+      this->current_line.insert(this->current_line.begin() + static_cast<std::ptrdiff_t>(position), Cell{});
+      for (std::vector<Cell>& line: this->history) {
+         line.insert(line.begin() + static_cast<std::ptrdiff_t>(position), Cell{});
+      }
+   }
+
+   size_t Statistics::column_index(std::string_view name) const {
+      for (size_t index: Range(this->columns.size())) {
+         if (this->columns[index].name == name) {
+            return index;
+         }
+      }
+      return SIZE_MAX;
    }
 
    void Statistics::set(std::string_view name, std::string value) {
-      this->current_line[name] = std::move(value);
+      const size_t index = this->column_index(name);
+      // values for unregistered columns (e.g. "primal feas." for an unconstrained model) are dropped
+      if (index == SIZE_MAX) {
+         return;
+      }
+      Cell& cell = this->current_line[index];
+      cell.type = CellType::STRING;
+      cell.string_value = std::move(value);
    }
 
    void Statistics::set(std::string_view name, int value) {
-      this->set(name, std::to_string(value));
+      this->set(name, static_cast<size_t>(value));
    }
 
    void Statistics::set(std::string_view name, size_t value) {
-      this->set(name, std::to_string(value));
+      const size_t index = this->column_index(name);
+      if (index == SIZE_MAX) {
+         return;
+      }
+      Cell& cell = this->current_line[index];
+      cell.type = CellType::INTEGER;
+      cell.integer_value = value;
    }
 
    void Statistics::set(std::string_view name, double value) {
-      std::ostringstream stream;
-      stream << std::defaultfloat << std::setprecision(Statistics::numerical_format_size) << value;
-      this->set(name, stream.str());
+      const size_t index = this->column_index(name);
+      if (index == SIZE_MAX) {
+         return;
+      }
+      Cell& cell = this->current_line[index];
+      cell.type = CellType::REAL;
+      cell.real_value = value;
+   }
+
+   std::string Statistics::cell_to_string(const Cell& cell) {
+      switch (cell.type) {
+         case CellType::INTEGER:
+            return std::to_string(cell.integer_value);
+         case CellType::REAL: {
+            std::ostringstream stream;
+            stream << std::defaultfloat << std::setprecision(Statistics::numerical_format_size) << cell.real_value;
+            return stream.str();
+         }
+         case CellType::STRING:
+            return cell.string_value;
+         default:
+            return "-";
+      }
    }
 
    void Statistics::print_header(bool first_occurrence) {
       /* line above */
       std::cout << (first_occurrence ? Statistics::symbol("top-left") : Statistics::symbol("left-mid"));
-      int k = 0;
-      for (const auto& element: this->columns) {
+      size_t k = 0;
+      for (const Column& column: this->columns) {
          if (0 < k) {
             std::cout << (first_occurrence ? Statistics::symbol("top-mid") : Statistics::symbol("mid-mid"));
          }
-         const std::string& header = element.second;
-         for (int j = 0; j < this->widths[header]; j++) {
+         for (int j = 0; j < column.width; j++) {
             std::cout << Statistics::symbol("top");
          }
          k++;
@@ -57,13 +136,12 @@ namespace uno {
       /* headers */
       std::cout << Statistics::symbol("left");
       k = 0;
-      for (const auto& element: this->columns) {
+      for (const Column& column: this->columns) {
          if (0 < k) {
             std::cout << Statistics::symbol("middle");
          }
-         const std::string& header = element.second;
-         std::cout << " " << header;
-         for (int j = 0; j < this->widths[header] - static_cast<int>(header.size()) - 1; j++) {
+         std::cout << " " << column.name;
+         for (int j = 0; j < column.width - static_cast<int>(column.name.size()) - 1; j++) {
             std::cout << " ";
          }
          k++;
@@ -76,37 +154,28 @@ namespace uno {
          this->print_header(this->iteration == 0);
       }
       std::cout << Statistics::symbol("left-mid");
-      int k = 0;
-      for (const auto& element: this->columns) {
+      size_t k = 0;
+      for (const Column& column: this->columns) {
          if (0 < k) {
             std::cout << Statistics::symbol("mid-mid");
          }
-         std::string header = element.second;
-         for (int j = 0; j < this->widths[header]; j++) {
+         for (int j = 0; j < column.width; j++) {
             std::cout << Statistics::symbol("bottom");
          }
          k++;
       }
       std::cout << Statistics::symbol("right-mid") << '\n';
-      /* headers */
+      /* values: the cells are formatted on demand, only when a line is actually printed */
       std::cout << Statistics::symbol("left");
       k = 0;
-      for (const auto& element: this->columns) {
+      for (const Column& column: this->columns) {
          if (0 < k) {
             std::cout << Statistics::symbol("middle");
          }
-         const std::string& header = element.second;
-         int size;
-         try {
-            std::string value = this->current_line.at(header);
-            std::cout << " " << value;
-            size = 1 + static_cast<int>(value.size());
-         }
-         catch (const std::out_of_range&) {
-            std::cout << " -";
-            size = 2;
-         }
-         int number_spaces = (size <= this->widths[header]) ? this->widths[header] - size : 0;
+         const std::string value = Statistics::cell_to_string(this->current_line[k]);
+         std::cout << " " << value;
+         const int size = 1 + static_cast<int>(value.size());
+         const int number_spaces = (size <= column.width) ? column.width - size : 0;
          for (int j = 0; j < number_spaces; j++) {
             std::cout << " ";
          }
@@ -118,13 +187,12 @@ namespace uno {
 
    void Statistics::print_footer() {
       std::cout << Statistics::symbol("bottom-left");
-      int k = 0;
-      for (const auto& element: this->columns) {
+      size_t k = 0;
+      for (const Column& column: this->columns) {
          if (0 < k) {
             std::cout << Statistics::symbol("bottom-mid");
          }
-         std::string header = element.second;
-         for (int j = 0; j < this->widths[header]; j++) {
+         for (int j = 0; j < column.width; j++) {
             std::cout << Statistics::symbol("bottom");
          }
          k++;
@@ -133,9 +201,77 @@ namespace uno {
    }
 
    void Statistics::start_new_line() {
-      //this->current_line.clear();
-      for (const auto& column: this->columns) {
-         this->current_line[column.second] = "-";
+      // commit the previous line to the in-memory history and reset the cells
+      const bool line_has_values = std::any_of(this->current_line.cbegin(), this->current_line.cend(), [](const Cell& cell) {
+         return cell.type != CellType::EMPTY;
+      });
+      if (line_has_values) {
+         // the line is complete: stream it to the time-series collector before committing it
+         if (this->streamer != nullptr) {
+            this->streamer->push(this->format_datagram());
+         }
+         this->history.emplace_back(std::move(this->current_line));
+      }
+      this->current_line.assign(this->columns.size(), Cell{});
+   }
+
+   // StatsD-style payload of the current line: one gauge per numeric cell, e.g. "uno.step_norm:0.5|g",
+   // newline-separated. The string cells (e.g. the status) do not map to gauges and are skipped
+   std::string Statistics::format_datagram() const {
+      std::string datagram{};
+      for (size_t index: Range(this->columns.size())) {
+         const Cell& cell = this->current_line[index];
+         if (cell.type == CellType::INTEGER || cell.type == CellType::REAL) {
+            std::string metric_name = this->columns[index].name;
+            std::replace(metric_name.begin(), metric_name.end(), ' ', '_');
+            metric_name.erase(std::remove(metric_name.begin(), metric_name.end(), '.'), metric_name.end());
+            if (not datagram.empty()) {
+               datagram += '\n';
+            }
+            datagram += "uno." + metric_name + ':' + Statistics::cell_to_string(cell) + "|g";
+         }
+      }
+      return datagram;
+   }
+
+   void Statistics::write_history(std::ostream& stream) const {
+      this->write_recent_history(stream, std::numeric_limits<size_t>::max());
+   }
+
+   void Statistics::write_recent_history(std::ostream& stream, size_t number_lines) const {
+      // header row
+      size_t k = 0;
+      for (const Column& column: this->columns) {
+         if (0 < k) {
+            stream << ',';
+         }
+         stream << column.name;
+         k++;
+      }
+      stream << '\n';
+      // one row per line, including the current (uncommitted) one if it carries values
+      const auto write_line = [&stream](const std::vector<Cell>& line) {
+         size_t cell_index = 0;
+         for (const Cell& cell: line) {
+            if (0 < cell_index) {
+               stream << ',';
+            }
+            if (cell.type != CellType::EMPTY) {
+               stream << Statistics::cell_to_string(cell);
+            }
+            cell_index++;
+         }
+         stream << '\n';
+      };
+      const size_t first_line = number_lines < this->history.size() ? this->history.size() - number_lines : 0;
+      for (size_t line_index: Range(first_line, this->history.size())) {
+         write_line(this->history[line_index]);
+      }
+      const bool line_has_values = std::any_of(this->current_line.cbegin(), this->current_line.cend(), [](const Cell& cell) {
+         return cell.type != CellType::EMPTY;
+      });
+      if (line_has_values) {
+         write_line(this->current_line);
       }
    }
 
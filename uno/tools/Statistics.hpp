@@ -4,16 +4,23 @@
 #ifndef UNO_STATISTICS_H
 #define UNO_STATISTICS_H
 
+#include <iosfwd>
+#include <memory>
+#include <string>
 #include <string_view>
-#include <map>
+#include <vector>
 
 namespace uno {
-   // forward declaration
+   // forward declarations
    class Options;
+   class StatisticsStreamer;
 
    class Statistics {
    public:
       explicit Statistics(const Options& options);
+      Statistics(Statistics&& other) noexcept;
+      // streams the last (uncommitted) line, if any
+      ~Statistics();
 
       static int int_width;
       static int double_width;
@@ -29,14 +36,39 @@ namespace uno {
       void print_current_line();
       void print_footer();
       void start_new_line();
+      // dump the in-memory history of all the lines (including unprinted ones) in CSV format
+      void write_history(std::ostream& stream) const;
+      // flight recorder: dump only the last number_lines lines (post-mortem analysis of a failure)
+      void write_recent_history(std::ostream& stream, size_t number_lines) const;
 
    private:
+      // the cells are stored in their native type: the formatting work is deferred to the moment a
+      // line is actually printed (or the history dumped)
+      enum class CellType: char {EMPTY, INTEGER, REAL, STRING};
+      struct Cell {
+         CellType type{CellType::EMPTY};
+         size_t integer_value{0};
+         double real_value{0.};
+         std::string string_value{};
+      };
+      struct Column {
+         std::string name;
+         int width;
+         int order;
+      };
+
       size_t iteration{0};
-      std::map<int, std::string> columns{};
-      std::map<std::string_view, int> widths{};
-      std::map<std::string_view, std::string> current_line{};
+      std::vector<Column> columns{}; // sorted by order
+      std::vector<Cell> current_line{}; // one cell per column, in column order
+      std::vector<std::vector<Cell>> history{}; // completed lines, in chronological order
 
       size_t print_header_every_iterations{};
+      // live export of the completed lines to a time-series collector (statistics_stream_endpoint)
+      std::unique_ptr<StatisticsStreamer> streamer{};
+
+      [[nodiscard]] size_t column_index(std::string_view name) const;
+      [[nodiscard]] std::string format_datagram() const;
+      [[nodiscard]] static std::string cell_to_string(const Cell& cell);
       static std::string_view symbol(std::string_view value);
    };
 } // namespace
@@ -0,0 +1,102 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <utility>
+#ifndef _WIN32
+#include <netdb.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+#include "StatisticsStreamer.hpp"
+#include "Logger.hpp"
+
+namespace uno {
+#ifndef _WIN32
+   StatisticsStreamer::StatisticsStreamer(const std::string& endpoint) {
+      const size_t separator = endpoint.rfind(':');
+      if (separator == std::string::npos) {
+         WARNING << "The statistics endpoint " << endpoint << " is not of the form host:port, streaming is disabled\n";
+         return;
+      }
+      const std::string host = endpoint.substr(0, separator);
+      const std::string port = endpoint.substr(separator + 1);
+      addrinfo hints{};
+      hints.ai_family = AF_UNSPEC;
+      hints.ai_socktype = SOCK_DGRAM;
+      addrinfo* addresses = nullptr;
+      if (getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses) != 0 || addresses == nullptr) {
+         WARNING << "The statistics endpoint " << endpoint << " could not be resolved, streaming is disabled\n";
+         return;
+      }
+      this->socket_descriptor = ::socket(addresses->ai_family, addresses->ai_socktype, addresses->ai_protocol);
+      // connect the datagram socket once, so that the consumer thread uses plain send()
+      if (0 <= this->socket_descriptor && ::connect(this->socket_descriptor, addresses->ai_addr, addresses->ai_addrlen) != 0) {
+         ::close(this->socket_descriptor);
+         this->socket_descriptor = -1;
+      }
+      freeaddrinfo(addresses);
+      if (this->socket_descriptor < 0) {
+         WARNING << "The statistics endpoint " << endpoint << " could not be reached, streaming is disabled\n";
+         return;
+      }
+      this->consumer = std::thread(&StatisticsStreamer::drain, this);
+   }
+
+   StatisticsStreamer::~StatisticsStreamer() {
+      {
+         const std::lock_guard<std::mutex> lock(this->mutex);
+         this->running = false;
+      }
+      this->condition.notify_one();
+      if (this->consumer.joinable()) {
+         this->consumer.join();
+      }
+      if (0 <= this->socket_descriptor) {
+         ::close(this->socket_descriptor);
+      }
+   }
+
+   void StatisticsStreamer::push(std::string datagram) {
+      if (this->socket_descriptor < 0 || datagram.empty()) {
+         return;
+      }
+      {
+         const std::lock_guard<std::mutex> lock(this->mutex);
+         this->queue.emplace_back(std::move(datagram));
+      }
+      this->condition.notify_one();
+   }
+
+   void StatisticsStreamer::drain() {
+      while (true) {
+         std::deque<std::string> pending_datagrams{};
+         {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->condition.wait(lock, [&]() {
+               return not this->running || not this->queue.empty();
+            });
+            std::swap(pending_datagrams, this->queue);
+            // exit only once the pending datagrams have been flushed
+            if (not this->running && pending_datagrams.empty()) {
+               return;
+            }
+         }
+         for (const std::string& datagram: pending_datagrams) {
+            // best effort: a dropped datagram only loses one observability sample
+            ::send(this->socket_descriptor, datagram.data(), datagram.size(), 0);
+         }
+      }
+   }
+#else
+   // no datagram socket on this platform: drop all the payloads
+   StatisticsStreamer::StatisticsStreamer(const std::string& /*endpoint*/) {
+      WARNING << "Statistics streaming is not available on this platform\n";
+   }
+
+   StatisticsStreamer::~StatisticsStreamer() { }
+
+   void StatisticsStreamer::push(std::string /*datagram*/) { }
+
+   void StatisticsStreamer::drain() { }
+#endif
+} // namespace
@@ -0,0 +1,46 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_STATISTICSSTREAMER_H
+#define UNO_STATISTICSSTREAMER_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace uno {
+   /*
+    * Live statistics export
+    *
+    * When enabled (statistics_stream_endpoint option), every completed statistics line is sent as a
+    * StatsD-style UDP datagram (one gauge per numeric column) to the configured host:port, so that a
+    * fleet of concurrent solves can be watched live by a standard time-series collector. The solver
+    * thread only enqueues the formatted payload; the socket I/O runs on a background thread and the
+    * delivery is best-effort, so a slow or absent collector never stalls the solve.
+    */
+   class StatisticsStreamer {
+   public:
+      // resolve the "host:port" endpoint and start the consumer thread. On any failure, a warning is
+      // emitted and the streamer silently drops all the payloads
+      explicit StatisticsStreamer(const std::string& endpoint);
+      // flush the pending datagrams and join the consumer thread
+      ~StatisticsStreamer();
+
+      // enqueue the payload of one statistics line; never blocks on the network
+      void push(std::string datagram);
+
+   private:
+      int socket_descriptor{-1};
+      std::deque<std::string> queue{};
+      std::mutex mutex{};
+      std::condition_variable condition{};
+      bool running{true};
+      std::thread consumer{};
+
+      void drain();
+   };
+} // namespace
+
+#endif // UNO_STATISTICSSTREAMER_H
@@ -0,0 +1,123 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include "TaskScheduler.hpp"
+
+namespace uno {
+   TaskScheduler::TaskScheduler(size_t number_workers) {
+      for (size_t worker_index = 0; worker_index < number_workers; worker_index++) {
+         this->queues.emplace_back(std::make_unique<WorkerQueue>());
+      }
+      for (size_t worker_index = 0; worker_index < number_workers; worker_index++) {
+         this->workers.emplace_back(&TaskScheduler::worker_loop, this, worker_index);
+      }
+   }
+
+   TaskScheduler::~TaskScheduler() {
+      {
+         // the store happens under the sleep mutex, so it cannot slip between a worker's predicate
+         // check and its block inside wait
+         const std::lock_guard<std::mutex> lock(this->sleep_mutex);
+         this->terminate.store(true, std::memory_order_release);
+      }
+      this->work_available.notify_all();
+      for (std::thread& worker: this->workers) {
+         worker.join();
+      }
+   }
+
+   std::future<void> TaskScheduler::submit(Priority priority, CancellationToken token, std::function<void()> task) {
+      // a cancelled task completes as a no-op, so that its future always becomes ready
+      std::packaged_task<void()> work([task = std::move(task), token]() {
+         if (not token.cancelled()) {
+            task();
+         }
+      });
+      std::future<void> future = work.get_future();
+      if (this->workers.empty()) {
+         // degenerate to running the task inline on the submitter
+         work();
+         return future;
+      }
+      // distribute the submissions round-robin over the worker queues; the idle workers steal
+      const size_t queue_index = this->round_robin.fetch_add(1, std::memory_order_relaxed) % this->queues.size();
+      {
+         WorkerQueue& queue = *this->queues[queue_index];
+         const std::lock_guard<std::mutex> lock(queue.mutex);
+         if (priority == Priority::CRITICAL) {
+            queue.critical.push_back({std::move(work)});
+         }
+         else {
+            queue.speculative.push_back({std::move(work)});
+         }
+      }
+      {
+         // the increment happens under the sleep mutex: otherwise it could land between a worker's
+         // predicate check and its block inside wait, leaving the task queued with all workers
+         // asleep until the next submission (lost wakeup)
+         const std::lock_guard<std::mutex> lock(this->sleep_mutex);
+         this->pending_tasks.fetch_add(1, std::memory_order_release);
+      }
+      this->work_available.notify_one();
+      return future;
+   }
+
+   void TaskScheduler::worker_loop(size_t worker_index) {
+      while (true) {
+         Task task;
+         if (this->try_pop(worker_index, task)) {
+            task.work();
+            continue;
+         }
+         std::unique_lock<std::mutex> lock(this->sleep_mutex);
+         this->work_available.wait(lock, [this]() {
+            return this->terminate.load(std::memory_order_acquire) || 0 < this->pending_tasks.load(std::memory_order_acquire);
+         });
+         if (this->terminate.load(std::memory_order_acquire)) {
+            return;
+         }
+      }
+   }
+
+   // speculative work yields to critical-path work: the critical deques of all the workers are
+   // drained (own back first, then stealing from the front of the others) before any speculative
+   // task is considered
+   bool TaskScheduler::try_pop(size_t worker_index, Task& task) {
+      const size_t number_queues = this->queues.size();
+      for (const bool critical_pass: {true, false}) {
+         for (size_t offset = 0; offset < number_queues; offset++) {
+            const size_t queue_index = (worker_index + offset) % number_queues;
+            WorkerQueue& queue = *this->queues[queue_index];
+            const std::lock_guard<std::mutex> lock(queue.mutex);
+            std::deque<Task>& deque = critical_pass ? queue.critical : queue.speculative;
+            if (not deque.empty()) {
+               if (offset == 0) {
+                  // own queue: pop from the back (best cache locality)
+                  task = std::move(deque.back());
+                  deque.pop_back();
+               }
+               else {
+                  // steal from the front of the victim
+                  task = std::move(deque.front());
+                  deque.pop_front();
+               }
+               this->pending_tasks.fetch_sub(1, std::memory_order_release);
+               return true;
+            }
+         }
+      }
+      return false;
+   }
+
+   size_t TaskScheduler::global_number_workers = 0;
+
+   TaskScheduler& TaskScheduler::global() {
+      static TaskScheduler scheduler(TaskScheduler::global_number_workers);
+      return scheduler;
+   }
+
+   void TaskScheduler::set_global_number_workers(size_t number_workers) {
+      TaskScheduler::global_number_workers = number_workers;
+   }
+} // namespace
@@ -0,0 +1,88 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_TASKSCHEDULER_H
+#define UNO_TASKSCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace uno {
+   // cooperative cancellation handle: copies share the same flag. Cancelling drops the pending
+   // tasks carrying the token (they complete as no-ops); running tasks poll the token themselves
+   class CancellationToken {
+   public:
+      CancellationToken(): flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+      void cancel() { this->flag->store(true, std::memory_order_release); }
+      [[nodiscard]] bool cancelled() const { return this->flag->load(std::memory_order_acquire); }
+
+   private:
+      std::shared_ptr<std::atomic<bool>> flag;
+   };
+
+   /*
+    * Work-stealing task scheduler for the asynchronous features of the solver
+    *
+    * Sibling of ThreadPool, which handles the data-parallel loops: the scheduler runs independent
+    * one-shot tasks (speculative solves, racing subproblems, background work) on a fixed set of
+    * workers, so that the total thread count stays controlled when many Uno instances share a node.
+    * Each worker owns a pair of deques (critical and speculative); it pops its own work from the
+    * back and steals from the front of the other workers. Critical-path tasks are always drained
+    * before any speculative task starts, whichever queue they sit in.
+    *
+    * The process-wide scheduler is sized once at startup (scheduler_number_threads option) and
+    * defaults to zero workers, in which case submit degenerates to running the task inline on the
+    * submitter.
+    */
+   class TaskScheduler {
+   public:
+      enum class Priority: char {CRITICAL = 0, SPECULATIVE};
+
+      explicit TaskScheduler(size_t number_workers);
+      ~TaskScheduler();
+
+      [[nodiscard]] size_t number_workers() const { return this->workers.size(); }
+      // schedule a task; the returned future becomes ready once the task has run (or was dropped
+      // because its token was cancelled). Exceptions propagate through the future
+      std::future<void> submit(Priority priority, CancellationToken token, std::function<void()> task);
+
+      static TaskScheduler& global();
+      // size the process-wide scheduler (effective only before the first use)
+      static void set_global_number_workers(size_t number_workers);
+
+   private:
+      struct Task {
+         std::packaged_task<void()> work;
+      };
+      // one pair of deques per worker, individually locked (the contention unit is the queue, not
+      // the scheduler)
+      struct WorkerQueue {
+         std::mutex mutex{};
+         std::deque<Task> critical{};
+         std::deque<Task> speculative{};
+      };
+
+      std::vector<std::unique_ptr<WorkerQueue>> queues;
+      std::vector<std::thread> workers;
+      std::mutex sleep_mutex{};
+      std::condition_variable work_available{};
+      std::atomic<size_t> pending_tasks{0};
+      std::atomic<size_t> round_robin{0};
+      std::atomic<bool> terminate{false};
+
+      static size_t global_number_workers;
+
+      void worker_loop(size_t worker_index);
+      [[nodiscard]] bool try_pop(size_t worker_index, Task& task);
+   };
+} // namespace
+
+#endif // UNO_TASKSCHEDULER_H
@@ -0,0 +1,89 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include "ThreadPool.hpp"
+
+namespace uno {
+   ThreadPool::ThreadPool(size_t number_threads) {
+      for (size_t worker_index = 1; worker_index < number_threads; worker_index++) {
+         this->workers.emplace_back(&ThreadPool::worker_loop, this);
+      }
+   }
+
+   ThreadPool::~ThreadPool() {
+      {
+         const std::lock_guard<std::mutex> lock(this->mutex);
+         this->terminate = true;
+      }
+      this->work_available.notify_all();
+      for (std::thread& worker: this->workers) {
+         worker.join();
+      }
+   }
+
+   void ThreadPool::parallel_for(size_t number_tasks, const std::function<void(size_t)>& task) {
+      if (this->workers.empty() || number_tasks <= 1) {
+         // degenerate to a sequential loop on the caller
+         for (size_t task_index = 0; task_index < number_tasks; task_index++) {
+            task(task_index);
+         }
+         return;
+      }
+      {
+         const std::lock_guard<std::mutex> lock(this->mutex);
+         this->current_task = &task;
+         this->current_number_tasks = number_tasks;
+         this->next_task.store(0, std::memory_order_relaxed);
+         this->completed_tasks.store(0, std::memory_order_relaxed);
+         this->generation++;
+      }
+      this->work_available.notify_all();
+      // the caller participates, then waits for the workers to complete the remaining tasks
+      this->execute_tasks();
+      while (this->completed_tasks.load(std::memory_order_acquire) < number_tasks) {
+         std::this_thread::yield();
+      }
+   }
+
+   void ThreadPool::worker_loop() {
+      size_t last_generation = 0;
+      while (true) {
+         {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->work_available.wait(lock, [&]() {
+               return this->terminate || last_generation != this->generation;
+            });
+            if (this->terminate) {
+               return;
+            }
+            last_generation = this->generation;
+         }
+         this->execute_tasks();
+      }
+   }
+
+   void ThreadPool::execute_tasks() {
+      // distribute the tasks dynamically through the atomic counter
+      while (true) {
+         const size_t task_index = this->next_task.fetch_add(1, std::memory_order_relaxed);
+         if (this->current_number_tasks <= task_index) {
+            return;
+         }
+         (*this->current_task)(task_index);
+         this->completed_tasks.fetch_add(1, std::memory_order_release);
+      }
+   }
+
+   size_t ThreadPool::global_number_threads = 1;
+   bool ThreadPool::deterministic = false;
+
+   ThreadPool& ThreadPool::global() {
+      static ThreadPool pool(ThreadPool::global_number_threads);
+      return pool;
+   }
+
+   void ThreadPool::set_global_number_threads(size_t number_threads) {
+      ThreadPool::global_number_threads = std::max(size_t(1), number_threads);
+   }
+} // namespace
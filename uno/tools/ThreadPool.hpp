@@ -0,0 +1,62 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_THREADPOOL_H
+#define UNO_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace uno {
+   /*
+    * Persistent pool of worker threads for chunked reductions and loops
+    *
+    * A pool with k threads keeps k-1 workers parked on a condition variable; parallel_for wakes
+    * them up, the caller participates, and the tasks are distributed dynamically through an atomic
+    * counter. The process-wide pool used by the parallel norm reductions is sized once at startup
+    * (reduction_number_threads option) and defaults to a single thread, in which case parallel_for
+    * degenerates to a sequential loop on the caller.
+    */
+   class ThreadPool {
+   public:
+      explicit ThreadPool(size_t number_threads);
+      ~ThreadPool();
+
+      // total number of threads participating in parallel_for, including the caller
+      [[nodiscard]] size_t number_threads() const { return this->workers.size() + 1; }
+      // execute task(task_index) for every task_index in [0, number_tasks). Returns once all the
+      // tasks have completed. Not reentrant: nested calls run on the caller only
+      void parallel_for(size_t number_tasks, const std::function<void(size_t task_index)>& task);
+
+      static ThreadPool& global();
+      // size the process-wide pool (effective only before the first use)
+      static void set_global_number_threads(size_t number_threads);
+
+      // process-wide deterministic parallel mode (deterministic_parallel option): the parallel
+      // features fix their chunking and reduction order regardless of the thread count, so that
+      // repeated solves produce bitwise identical results at a small cost in speed
+      static bool deterministic;
+
+   private:
+      std::vector<std::thread> workers;
+      std::mutex mutex{};
+      std::condition_variable work_available{};
+      const std::function<void(size_t)>* current_task{nullptr};
+      size_t current_number_tasks{0};
+      std::atomic<size_t> next_task{0};
+      std::atomic<size_t> completed_tasks{0};
+      size_t generation{0};
+      bool terminate{false};
+
+      static size_t global_number_threads;
+
+      void worker_loop();
+      void execute_tasks();
+   };
+} // namespace
+
+#endif // UNO_THREADPOOL_H
@@ -0,0 +1,28 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "TuningCache.hpp"
+
+namespace uno {
+   bool TuningCache::active = false;
+   std::mutex TuningCache::mutex{};
+   std::unordered_map<uint64_t, TuningCache::Tuning> TuningCache::entries{};
+
+   TuningCache::Tuning TuningCache::lookup(uint64_t fingerprint) {
+      const std::lock_guard<std::mutex> lock(TuningCache::mutex);
+      const auto entry = TuningCache::entries.find(fingerprint);
+      return (entry != TuningCache::entries.end()) ? entry->second : Tuning{};
+   }
+
+   void TuningCache::store_regularization(uint64_t fingerprint, double primal_regularization, double dual_regularization) {
+      const std::lock_guard<std::mutex> lock(TuningCache::mutex);
+      Tuning& tuning = TuningCache::entries[fingerprint];
+      tuning.primal_regularization = primal_regularization;
+      tuning.dual_regularization = dual_regularization;
+   }
+
+   void TuningCache::store_barrier_parameter(uint64_t fingerprint, double barrier_parameter) {
+      const std::lock_guard<std::mutex> lock(TuningCache::mutex);
+      TuningCache::entries[fingerprint].barrier_parameter = barrier_parameter;
+   }
+} // namespace
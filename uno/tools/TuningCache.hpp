@@ -0,0 +1,59 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_TUNINGCACHE_H
+#define UNO_TUNINGCACHE_H
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace uno {
+   /*
+    * Cross-instance tuning memory
+    *
+    * Within a batch of related instances (batch or server mode), every solve rediscovers the same
+    * tuning facts: the regularization that makes the first factorizations succeed, the barrier
+    * parameter region where the schedule actually spends its time. When the tuning_cache option is
+    * set, the ingredients publish these outcomes here under a model family fingerprint (dimensions
+    * and sparsity pattern, hashed), and later solves of the same family seed their initial
+    * parameters from the entry instead of starting from the documented defaults. The cache is
+    * process-wide and thread-safe, so the concurrent workers of a batch share it.
+    */
+   class TuningCache {
+   public:
+      struct Tuning {
+         // a zero value means "not learned yet"
+         double primal_regularization{0.};
+         double dual_regularization{0.};
+         double barrier_parameter{0.};
+      };
+
+      // runtime switch, set once at startup from the options
+      static bool active;
+
+      // return the entry of a family (all fields zero when there is none)
+      [[nodiscard]] static Tuning lookup(uint64_t fingerprint);
+      static void store_regularization(uint64_t fingerprint, double primal_regularization, double dual_regularization);
+      static void store_barrier_parameter(uint64_t fingerprint, double barrier_parameter);
+
+      // incremental FNV-1a over a sequence of integer features (dimensions, nonzero counts,
+      // pattern indices)
+      [[nodiscard]] static uint64_t fingerprint_start() {
+         return UINT64_C(14695981039346656037);
+      }
+      [[nodiscard]] static uint64_t fingerprint_add(uint64_t fingerprint, uint64_t feature) {
+         for (size_t byte_index = 0; byte_index < sizeof(feature); byte_index++) {
+            fingerprint ^= (feature >> (8*byte_index)) & 0xffu;
+            fingerprint *= UINT64_C(1099511628211);
+         }
+         return fingerprint;
+      }
+
+   private:
+      static std::mutex mutex;
+      static std::unordered_map<uint64_t, Tuning> entries;
+   };
+} // namespace
+
+#endif // UNO_TUNINGCACHE_H
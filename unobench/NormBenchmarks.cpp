@@ -0,0 +1,62 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "linear_algebra/Norm.hpp"
+#include "symbolic/Range.hpp"
+
+using namespace uno;
+
+namespace {
+   std::vector<double> generate_vector(size_t dimension) {
+      std::vector<double> x(dimension);
+      for (size_t index: Range(dimension)) {
+         x[index] = static_cast<double>(index % 11) - 5.;
+      }
+      return x;
+   }
+
+   void BM_Norm_1(benchmark::State& state) {
+      const std::vector<double> x = generate_vector(static_cast<size_t>(state.range(0)));
+      for (auto _: state) {
+         const double result = norm_1(x);
+         benchmark::DoNotOptimize(result);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+   }
+
+   void BM_Norm_2(benchmark::State& state) {
+      const std::vector<double> x = generate_vector(static_cast<size_t>(state.range(0)));
+      for (auto _: state) {
+         const double result = norm_2(x);
+         benchmark::DoNotOptimize(result);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+   }
+
+   void BM_Norm_inf(benchmark::State& state) {
+      const std::vector<double> x = generate_vector(static_cast<size_t>(state.range(0)));
+      for (auto _: state) {
+         const double result = norm_inf(x);
+         benchmark::DoNotOptimize(result);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+   }
+
+   // variadic overload used by the residual computations (single pass over two arrays)
+   void BM_Norm_1_two_arrays(benchmark::State& state) {
+      const std::vector<double> x = generate_vector(static_cast<size_t>(state.range(0)));
+      const std::vector<double> y = generate_vector(static_cast<size_t>(state.range(0)));
+      for (auto _: state) {
+         const double result = norm_1(x, y);
+         benchmark::DoNotOptimize(result);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2*state.range(0));
+   }
+} // namespace
+
+BENCHMARK(BM_Norm_1)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_Norm_2)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_Norm_inf)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_Norm_1_two_arrays)->Range(1 << 8, 1 << 20);
@@ -0,0 +1,95 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <cstdint>
+#include <string>
+#include <benchmark/benchmark.h>
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "symbolic/Range.hpp"
+
+using namespace uno;
+
+namespace {
+   // assemble the lower triangular part of a tridiagonal matrix, column by column (the access
+   // pattern of the Hessian assembly in the subproblems)
+   void assemble_tridiagonal(SymmetricMatrix<SparseIndex, double>& matrix, size_t dimension) {
+      matrix.reset();
+      for (size_t column_index: Range(dimension)) {
+         matrix.insert(2., column_index, column_index);
+         if (column_index + 1 < dimension) {
+            matrix.insert(-1., column_index + 1, column_index);
+         }
+         matrix.finalize_column(column_index);
+      }
+   }
+
+   void BM_SparseStorage_assembly(benchmark::State& state, const std::string& sparse_format) {
+      const size_t dimension = static_cast<size_t>(state.range(0));
+      const size_t capacity = 2*dimension;
+      SymmetricMatrix<SparseIndex, double> matrix(dimension, capacity, false, sparse_format);
+      for (auto _: state) {
+         assemble_tridiagonal(matrix, dimension);
+         benchmark::DoNotOptimize(matrix);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(matrix.number_nonzeros()));
+   }
+
+   void BM_SparseStorage_quadratic_product(benchmark::State& state, const std::string& sparse_format) {
+      const size_t dimension = static_cast<size_t>(state.range(0));
+      const size_t capacity = 2*dimension;
+      SymmetricMatrix<SparseIndex, double> matrix(dimension, capacity, false, sparse_format);
+      assemble_tridiagonal(matrix, dimension);
+      Vector<double> x(dimension);
+      for (size_t index: Range(dimension)) {
+         x[index] = static_cast<double>(index % 7) - 3.;
+      }
+      for (auto _: state) {
+         const double result = matrix.quadratic_product(x, x);
+         benchmark::DoNotOptimize(result);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(matrix.number_nonzeros()));
+   }
+
+   // scattered pattern: each column carries its diagonal and one off-diagonal entry at a
+   // pseudo-random row, so that the gathered x/y operands defeat the hardware prefetcher (the
+   // latency-bound pattern targeted by the software prefetches in the kernels)
+   void assemble_scattered(SymmetricMatrix<SparseIndex, double>& matrix, size_t dimension) {
+      matrix.reset();
+      uint64_t random_state = 12345;
+      for (size_t column_index: Range(dimension)) {
+         matrix.insert(2., column_index, column_index);
+         if (column_index + 1 < dimension) {
+            random_state = random_state * 6364136223846793005ULL + 1442695040888963407ULL;
+            const size_t row_index = column_index + 1 + static_cast<size_t>(random_state >> 33) % (dimension - column_index - 1);
+            matrix.insert(-1., row_index, column_index);
+         }
+         matrix.finalize_column(column_index);
+      }
+   }
+
+   void BM_SparseStorage_quadratic_product_scattered(benchmark::State& state, const std::string& sparse_format) {
+      const size_t dimension = static_cast<size_t>(state.range(0));
+      const size_t capacity = 2*dimension;
+      SymmetricMatrix<SparseIndex, double> matrix(dimension, capacity, false, sparse_format);
+      assemble_scattered(matrix, dimension);
+      Vector<double> x(dimension);
+      for (size_t index: Range(dimension)) {
+         x[index] = static_cast<double>(index % 7) - 3.;
+      }
+      for (auto _: state) {
+         const double result = matrix.quadratic_product(x, x);
+         benchmark::DoNotOptimize(result);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(matrix.number_nonzeros()));
+   }
+} // namespace
+
+BENCHMARK_CAPTURE(BM_SparseStorage_assembly, COO, "COO")->Range(1 << 8, 1 << 16);
+BENCHMARK_CAPTURE(BM_SparseStorage_assembly, CSC, "CSC")->Range(1 << 8, 1 << 16);
+BENCHMARK_CAPTURE(BM_SparseStorage_assembly, blocked_COO, "blocked_COO")->Range(1 << 8, 1 << 16);
+BENCHMARK_CAPTURE(BM_SparseStorage_quadratic_product, COO, "COO")->Range(1 << 8, 1 << 16);
+BENCHMARK_CAPTURE(BM_SparseStorage_quadratic_product, CSC, "CSC")->Range(1 << 8, 1 << 16);
+BENCHMARK_CAPTURE(BM_SparseStorage_quadratic_product, blocked_COO, "blocked_COO")->Range(1 << 8, 1 << 16);
+BENCHMARK_CAPTURE(BM_SparseStorage_quadratic_product_scattered, COO, "COO")->Range(1 << 8, 1 << 16);
+BENCHMARK_CAPTURE(BM_SparseStorage_quadratic_product_scattered, CSC, "CSC")->Range(1 << 8, 1 << 16);
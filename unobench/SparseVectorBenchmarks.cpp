@@ -0,0 +1,42 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <benchmark/benchmark.h>
+#include "linear_algebra/SparseVector.hpp"
+#include "symbolic/Range.hpp"
+
+using namespace uno;
+
+namespace {
+   void BM_SparseVector_insert(benchmark::State& state) {
+      const size_t number_entries = static_cast<size_t>(state.range(0));
+      SparseVector<double> x(number_entries);
+      for (auto _: state) {
+         x.clear();
+         for (size_t index: Range(number_entries)) {
+            x.insert(2*index, static_cast<double>(index));
+         }
+         benchmark::DoNotOptimize(x);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(number_entries));
+   }
+
+   void BM_SparseVector_iterate(benchmark::State& state) {
+      const size_t number_entries = static_cast<size_t>(state.range(0));
+      SparseVector<double> x(number_entries);
+      for (size_t index: Range(number_entries)) {
+         x.insert(2*index, static_cast<double>(index));
+      }
+      for (auto _: state) {
+         double sum = 0.;
+         for (const auto [index, entry]: x) {
+            sum += static_cast<double>(index) + entry;
+         }
+         benchmark::DoNotOptimize(sum);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(number_entries));
+   }
+} // namespace
+
+BENCHMARK(BM_SparseVector_insert)->Range(1 << 6, 1 << 16);
+BENCHMARK(BM_SparseVector_iterate)->Range(1 << 6, 1 << 16);
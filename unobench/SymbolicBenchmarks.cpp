@@ -0,0 +1,102 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "linear_algebra/RectangularMatrix.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "symbolic/Expression.hpp"
+#include "symbolic/MatrixVectorProduct.hpp"
+#include "symbolic/VectorView.hpp"
+
+using namespace uno;
+
+namespace {
+   std::vector<double> generate_vector(size_t dimension) {
+      std::vector<double> x(dimension);
+      for (size_t index: Range(dimension)) {
+         x[index] = static_cast<double>(index % 11) - 5.;
+      }
+      return x;
+   }
+
+   // materialization of a lazy sum (the composite is evaluated element by element, as in the
+   // trial iterate and residual assemblies)
+   void BM_Symbolic_sum(benchmark::State& state) {
+      const size_t dimension = static_cast<size_t>(state.range(0));
+      const std::vector<double> x = generate_vector(dimension);
+      const std::vector<double> y = generate_vector(dimension);
+      std::vector<double> result(dimension);
+      for (auto _: state) {
+         const auto sum = x + y;
+         for (size_t index: Range(dimension)) {
+            result[index] = sum[index];
+         }
+         benchmark::DoNotOptimize(result);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(dimension));
+   }
+
+   void BM_Symbolic_vector_view(benchmark::State& state) {
+      const size_t dimension = static_cast<size_t>(state.range(0));
+      const std::vector<double> x = generate_vector(dimension);
+      for (auto _: state) {
+         const auto x_view = view(x, dimension/4, (3*dimension)/4);
+         double sum = 0.;
+         for (size_t index: Range(x_view.size())) {
+            sum += x_view[index];
+         }
+         benchmark::DoNotOptimize(sum);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(dimension/2));
+   }
+
+   // fused assignment of a scaled sum into an existing Vector: the composite provides
+   // evaluate_into, so the assignment runs in one pass with a vectorizable inner loop and no
+   // intermediate allocation (as in the trial-iterate and residual assemblies)
+   void BM_Symbolic_evaluate_into(benchmark::State& state) {
+      const size_t dimension = static_cast<size_t>(state.range(0));
+      Vector<double> x(dimension);
+      Vector<double> y(dimension);
+      for (size_t index: Range(dimension)) {
+         x[index] = static_cast<double>(index % 11) - 5.;
+         y[index] = static_cast<double>(index % 7) - 3.;
+      }
+      Vector<double> result(dimension);
+      for (auto _: state) {
+         result = x + 0.5*y;
+         benchmark::DoNotOptimize(result);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(dimension));
+   }
+
+   // lazy Jacobian-vector product over a tridiagonal rectangular matrix
+   void BM_Symbolic_matrix_vector_product(benchmark::State& state) {
+      const size_t dimension = static_cast<size_t>(state.range(0));
+      RectangularMatrix<double> matrix(dimension, dimension);
+      for (size_t row_index: Range(dimension)) {
+         if (0 < row_index) {
+            matrix[row_index].insert(row_index - 1, -1.);
+         }
+         matrix[row_index].insert(row_index, 2.);
+         if (row_index + 1 < dimension) {
+            matrix[row_index].insert(row_index + 1, -1.);
+         }
+      }
+      const std::vector<double> x = generate_vector(dimension);
+      std::vector<double> result(dimension);
+      for (auto _: state) {
+         const auto product = matrix * x;
+         for (size_t index: Range(dimension)) {
+            result[index] = product[index];
+         }
+         benchmark::DoNotOptimize(result);
+      }
+      state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(dimension));
+   }
+} // namespace
+
+BENCHMARK(BM_Symbolic_sum)->Range(1 << 8, 1 << 18);
+BENCHMARK(BM_Symbolic_vector_view)->Range(1 << 8, 1 << 18);
+BENCHMARK(BM_Symbolic_evaluate_into)->Range(1 << 8, 1 << 18);
+BENCHMARK(BM_Symbolic_matrix_vector_product)->Range(1 << 6, 1 << 12);
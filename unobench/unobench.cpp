@@ -0,0 +1,16 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <benchmark/benchmark.h>
+
+// micro-benchmarks of the hot linear algebra and symbolic kernels. Run with
+// --benchmark_filter=<regex> to select a subset, --benchmark_repetitions=<k> for stable medians
+int main(int argc, char** argv) {
+   benchmark::Initialize(&argc, &argv[0]);
+   if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+      return 1;
+   }
+   benchmark::RunSpecifiedBenchmarks();
+   benchmark::Shutdown();
+   return 0;
+}
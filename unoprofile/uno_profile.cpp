@@ -0,0 +1,239 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "ingredients/globalization_mechanisms/GlobalizationMechanism.hpp"
+#include "ingredients/globalization_mechanisms/GlobalizationMechanismFactory.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.hpp"
+#include "AMPLModel.hpp"
+#include "Uno.hpp"
+#include "model/ModelFactory.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+
+// uno_profile: end-to-end benchmark harness. It runs a set of .nl instances through Uno::solve
+// under several named option configurations and emits Dolan-Moré performance profile data, so
+// option-tuning experiments are reproducible without external scripts around uno_ampl.
+//
+// usage: uno_profile <configurations file> <instances (directory or list file)> [output prefix]
+//
+// The configurations file contains one configuration per line:
+//    <name>: <option>=<value> <option>=<value> ...
+// e.g.
+//    TR_filter: globalization_mechanism=TR globalization_strategy=fletcher_filter_method
+//    LS_funnel: globalization_mechanism=LS globalization_strategy=funnel_method
+// An empty override list benchmarks the default options.
+
+namespace uno {
+   struct Configuration {
+      std::string name;
+      std::vector<std::pair<std::string, std::string>> overrides;
+   };
+
+   // outcome of one (configuration, instance) run
+   struct ProfileRecord {
+      bool solved{false};
+      int status{0};
+      size_t iterations{0};
+      double cpu_time{INF<double>};
+      size_t objective_evaluations{0};
+      size_t constraint_evaluations{0};
+   };
+
+   std::vector<Configuration> read_configurations(const std::string& path) {
+      std::ifstream configuration_file(path);
+      if (!configuration_file) {
+         throw std::invalid_argument("The configurations file " + path + " cannot be read");
+      }
+      std::vector<Configuration> configurations;
+      std::string line;
+      while (std::getline(configuration_file, line)) {
+         if (line.empty() || line[0] == '#') {
+            continue;
+         }
+         const size_t colon_position = line.find(':');
+         if (colon_position == std::string::npos) {
+            throw std::invalid_argument("The configuration line \"" + line + "\" has no name (expected \"name: option=value ...\")");
+         }
+         Configuration configuration;
+         configuration.name = line.substr(0, colon_position);
+         std::istringstream overrides(line.substr(colon_position + 1));
+         std::string token;
+         while (overrides >> token) {
+            const size_t equal_position = token.find('=');
+            if (equal_position == std::string::npos) {
+               throw std::invalid_argument("The override \"" + token + "\" is not of the form option=value");
+            }
+            configuration.overrides.emplace_back(token.substr(0, equal_position), token.substr(equal_position + 1));
+         }
+         configurations.push_back(std::move(configuration));
+      }
+      return configurations;
+   }
+
+   // collect the .nl instances: either all the .nl files of a directory, or the paths listed
+   // (one per line) in a plain text file (same convention as uno_ampl --batch)
+   std::vector<std::string> collect_instances(const std::string& path) {
+      std::vector<std::string> instances;
+      if (std::filesystem::is_directory(path)) {
+         for (const auto& entry: std::filesystem::directory_iterator(path)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".nl") {
+               instances.emplace_back(entry.path().string());
+            }
+         }
+      }
+      else {
+         std::ifstream list_file(path);
+         if (!list_file) {
+            throw std::invalid_argument("The instances path " + path + " is neither a directory nor a readable file");
+         }
+         std::string line;
+         while (std::getline(list_file, line)) {
+            if (not line.empty()) {
+               instances.emplace_back(line);
+            }
+         }
+      }
+      std::sort(instances.begin(), instances.end());
+      return instances;
+   }
+
+   ProfileRecord run_instance(const std::string& instance, const Options& options) {
+      // AMPL model
+      std::unique_ptr<Model> ampl_model = std::make_unique<AMPLModel>(instance, options.get_unsigned_int("AMPL_number_evaluation_threads"),
+            options.get_bool("AMPL_structure_cache"), options.get_bool("AMPL_shared_structure"));
+
+      // initialize initial primal and dual points
+      Iterate initial_iterate(ampl_model->number_variables, ampl_model->number_constraints);
+      ampl_model->initial_primal_point(initial_iterate.primals);
+      ampl_model->project_onto_variable_bounds(initial_iterate.primals);
+      ampl_model->initial_dual_point(initial_iterate.multipliers.constraints);
+      initial_iterate.feasibility_multipliers.reset();
+
+      // pick the ingredient preset from the structure of this particular instance, if requested
+      Options instance_options = options;
+      if (instance_options.get_string("preset") == "auto") {
+         ModelFactory::select_automatic_preset(*ampl_model, instance_options);
+      }
+
+      // reformulate (scale, add slacks, relax the bounds, ...) if necessary
+      std::unique_ptr<Model> model = ModelFactory::reformulate(std::move(ampl_model), initial_iterate, instance_options);
+
+      // create the constraint relaxation strategy, the globalization mechanism and the Uno solver
+      auto constraint_relaxation_strategy = ConstraintRelaxationStrategyFactory::create(*model, instance_options);
+      auto globalization_mechanism = GlobalizationMechanismFactory::create(*constraint_relaxation_strategy, instance_options);
+      Uno uno = Uno(*globalization_mechanism, instance_options);
+
+      const Result result = uno.solve(*model, initial_iterate, instance_options);
+      ProfileRecord record;
+      record.status = static_cast<int>(result.solution.status);
+      record.solved = (result.solution.status == TerminationStatus::FEASIBLE_KKT_POINT ||
+                       result.solution.status == TerminationStatus::FEASIBLE_ACCEPTABLE_POINT ||
+                       result.solution.status == TerminationStatus::FEASIBLE_FJ_POINT ||
+                       result.solution.status == TerminationStatus::FEASIBLE_SMALL_STEP);
+      record.iterations = result.iteration;
+      record.cpu_time = result.cpu_time;
+      record.objective_evaluations = result.objective_evaluations;
+      record.constraint_evaluations = result.constraint_evaluations;
+      return record;
+   }
+
+   void run_profile(const std::string& configurations_path, const std::string& instances_path, const std::string& output_prefix,
+         const Options& options) {
+      const std::vector<Configuration> configurations = read_configurations(configurations_path);
+      const std::vector<std::string> instances = collect_instances(instances_path);
+      INFO << "Performance profile: " << configurations.size() << " configurations x " << instances.size() << " instances\n";
+
+      // raw per-run records
+      std::vector<std::vector<ProfileRecord>> records(configurations.size(), std::vector<ProfileRecord>(instances.size()));
+      std::ofstream results(output_prefix + "_results.csv");
+      results << "configuration,instance,status,iterations,cpu_time,objective_evaluations,constraint_evaluations\n";
+      for (size_t configuration_index: Range(configurations.size())) {
+         const Configuration& configuration = configurations[configuration_index];
+         for (size_t instance_index: Range(instances.size())) {
+            const std::string& instance = instances[instance_index];
+            Options run_options = options;
+            for (const auto& [name, value]: configuration.overrides) {
+               run_options[name] = value;
+            }
+            ProfileRecord& record = records[configuration_index][instance_index];
+            try {
+               record = run_instance(instance, run_options);
+            }
+            catch (const std::exception& exception) {
+               INFO << "Instance " << instance << " under " << configuration.name << " failed: " << exception.what() << '\n';
+            }
+            results << configuration.name << ',' << instance << ',' << record.status << ',' << record.iterations << ','
+                    << record.cpu_time << ',' << record.objective_evaluations << ',' << record.constraint_evaluations << '\n';
+         }
+      }
+
+      // Dolan-Moré performance ratios: for each instance, the CPU time of every configuration is
+      // divided by the best CPU time over the configurations that solved it (inf when unsolved).
+      // The profile curve rho(tau) of a configuration is the empirical CDF of its ratios
+      std::ofstream ratios(output_prefix + "_ratios.csv");
+      ratios << "instance";
+      for (const Configuration& configuration: configurations) {
+         ratios << ',' << configuration.name;
+      }
+      ratios << '\n';
+      std::vector<std::vector<double>> performance_ratios(configurations.size());
+      for (size_t instance_index: Range(instances.size())) {
+         double best_time = INF<double>;
+         for (size_t configuration_index: Range(configurations.size())) {
+            const ProfileRecord& record = records[configuration_index][instance_index];
+            if (record.solved) {
+               best_time = std::min(best_time, record.cpu_time);
+            }
+         }
+         ratios << instances[instance_index];
+         for (size_t configuration_index: Range(configurations.size())) {
+            const ProfileRecord& record = records[configuration_index][instance_index];
+            const double ratio = (record.solved && best_time < INF<double>) ? record.cpu_time/best_time : INF<double>;
+            performance_ratios[configuration_index].push_back(ratio);
+            ratios << ',' << ratio;
+         }
+         ratios << '\n';
+      }
+
+      // summary: rho(tau) at a few landmarks (rho(1) = fraction of wins, the tail = robustness)
+      const auto rho = [&](size_t configuration_index, double tau) {
+         const std::vector<double>& ratios_of_configuration = performance_ratios[configuration_index];
+         const auto number_within_tau = std::count_if(ratios_of_configuration.begin(), ratios_of_configuration.end(),
+               [=](double ratio) { return ratio <= tau; });
+         return static_cast<double>(number_within_tau)/static_cast<double>(std::max<size_t>(1, instances.size()));
+      };
+      INFO << "configuration: rho(1) rho(2) rho(10) solved\n";
+      for (size_t configuration_index: Range(configurations.size())) {
+         const auto number_solved = std::count_if(records[configuration_index].begin(), records[configuration_index].end(),
+               [](const ProfileRecord& record) { return record.solved; });
+         INFO << configurations[configuration_index].name << ": " << rho(configuration_index, 1.) << ' ' << rho(configuration_index, 2.)
+              << ' ' << rho(configuration_index, 10.) << ' ' << number_solved << '/' << instances.size() << '\n';
+      }
+      INFO << "Profile data written to " << output_prefix << "_results.csv and " << output_prefix << "_ratios.csv\n";
+   }
+} // namespace
+
+int main(int argc, char* argv[]) {
+   using namespace uno;
+
+   if (argc < 3) {
+      std::cout << "usage: uno_profile <configurations file> <instances (directory or list file)> [output prefix]\n";
+      return EXIT_FAILURE;
+   }
+   // get the default options (the configurations override them per run)
+   Options options = Options::get_default_options("uno.options");
+   Logger::set_logger(options.get_string("logger"));
+
+   const std::string output_prefix = (3 < argc) ? std::string(argv[3]) : "profile";
+   run_profile(std::string(argv[1]), std::string(argv[2]), output_prefix, options);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,215 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "ingredients/globalization_mechanisms/GlobalizationMechanism.hpp"
+#include "ingredients/globalization_mechanisms/GlobalizationMechanismFactory.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.hpp"
+#include "AMPLModel.hpp"
+#include "Uno.hpp"
+#include "model/ModelFactory.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+
+// uno_soak: perturbation soak harness. It solves one .nl instance many times under seeded random
+// perturbations (jittered initial point, jittered finite bounds) and reports the distribution of
+// iterations, CPU time and evaluation counts rather than a single sample. The point is robustness:
+// a configuration change that improves the median but fattens the tail shows up here and nowhere
+// else in the repo.
+//
+// usage: uno_soak <instance.nl> [number of runs] [seed] [output prefix] [option=value ...]
+//
+// Each run draws its perturbation from a generator seeded with (seed, run index), so a soak is
+// reproducible run by run. The raw records go to <output prefix>_runs.csv; the summary (min,
+// median, p90, p99, max, mean of every metric) is printed at the end.
+
+namespace uno {
+   // relative perturbation magnitudes, chosen small enough that the perturbed instances remain
+   // close variants of the original (the initial point is projected back onto the bounds anyway,
+   // and the finite bounds are only ever relaxed outward, which preserves feasibility)
+   constexpr double initial_point_jitter{1e-2};
+   constexpr double bound_jitter{1e-4};
+
+   // outcome of one perturbed run
+   struct SoakRecord {
+      bool solved{false};
+      int status{0};
+      size_t iterations{0};
+      double cpu_time{INF<double>};
+      size_t objective_evaluations{0};
+      size_t constraint_evaluations{0};
+      size_t subproblems_solved{0};
+   };
+
+   SoakRecord run_perturbed_instance(const std::string& instance, const Options& options, size_t seed, size_t run_index) {
+      // a fresh model per run: the bound jitter mutates the model in place
+      auto ampl_model = std::make_unique<AMPLModel>(instance, options.get_unsigned_int("AMPL_number_evaluation_threads"),
+            options.get_bool("AMPL_structure_cache"), options.get_bool("AMPL_shared_structure"));
+      std::mt19937_64 generator(seed + run_index);
+      std::uniform_real_distribution<double> uniform(-1., 1.);
+
+      // jitter the finite bounds outward (relative relaxation: the original feasible set is kept)
+      for (size_t variable_index: Range(ampl_model->number_variables)) {
+         double lower_bound = ampl_model->variable_lower_bound(variable_index);
+         double upper_bound = ampl_model->variable_upper_bound(variable_index);
+         if (is_finite(lower_bound)) {
+            lower_bound -= bound_jitter * std::abs(uniform(generator)) * (1. + std::abs(lower_bound));
+         }
+         if (is_finite(upper_bound)) {
+            upper_bound += bound_jitter * std::abs(uniform(generator)) * (1. + std::abs(upper_bound));
+         }
+         ampl_model->set_variable_bounds(variable_index, lower_bound, upper_bound);
+      }
+      for (size_t constraint_index: Range(ampl_model->number_constraints)) {
+         double lower_bound = ampl_model->constraint_lower_bound(constraint_index);
+         double upper_bound = ampl_model->constraint_upper_bound(constraint_index);
+         // equality constraints stay equalities: only jitter genuine inequality bounds
+         if (lower_bound < upper_bound) {
+            if (is_finite(lower_bound)) {
+               lower_bound -= bound_jitter * std::abs(uniform(generator)) * (1. + std::abs(lower_bound));
+            }
+            if (is_finite(upper_bound)) {
+               upper_bound += bound_jitter * std::abs(uniform(generator)) * (1. + std::abs(upper_bound));
+            }
+            ampl_model->set_constraint_bounds(constraint_index, lower_bound, upper_bound);
+         }
+      }
+
+      // jitter the initial primal point relative to its magnitude, then project onto the bounds
+      Iterate initial_iterate(ampl_model->number_variables, ampl_model->number_constraints);
+      ampl_model->initial_primal_point(initial_iterate.primals);
+      for (size_t variable_index: Range(ampl_model->number_variables)) {
+         initial_iterate.primals[variable_index] += initial_point_jitter * uniform(generator) *
+               (1. + std::abs(initial_iterate.primals[variable_index]));
+      }
+      ampl_model->project_onto_variable_bounds(initial_iterate.primals);
+      ampl_model->initial_dual_point(initial_iterate.multipliers.constraints);
+      initial_iterate.feasibility_multipliers.reset();
+
+      // pick the ingredient preset from the structure of this particular instance, if requested
+      Options instance_options = options;
+      if (instance_options.get_string("preset") == "auto") {
+         ModelFactory::select_automatic_preset(*ampl_model, instance_options);
+      }
+
+      // reformulate (scale, add slacks, relax the bounds, ...) if necessary
+      std::unique_ptr<Model> model = ModelFactory::reformulate(std::move(ampl_model), initial_iterate, instance_options);
+
+      // create the constraint relaxation strategy, the globalization mechanism and the Uno solver
+      auto constraint_relaxation_strategy = ConstraintRelaxationStrategyFactory::create(*model, instance_options);
+      auto globalization_mechanism = GlobalizationMechanismFactory::create(*constraint_relaxation_strategy, instance_options);
+      Uno uno = Uno(*globalization_mechanism, instance_options);
+
+      const Result result = uno.solve(*model, initial_iterate, instance_options);
+      SoakRecord record;
+      record.status = static_cast<int>(result.solution.status);
+      record.solved = (result.solution.status == TerminationStatus::FEASIBLE_KKT_POINT ||
+                       result.solution.status == TerminationStatus::FEASIBLE_ACCEPTABLE_POINT ||
+                       result.solution.status == TerminationStatus::FEASIBLE_FJ_POINT ||
+                       result.solution.status == TerminationStatus::FEASIBLE_SMALL_STEP);
+      record.iterations = result.iteration;
+      record.cpu_time = result.cpu_time;
+      record.objective_evaluations = result.objective_evaluations;
+      record.constraint_evaluations = result.constraint_evaluations;
+      record.subproblems_solved = result.number_subproblems_solved;
+      return record;
+   }
+
+   // empirical quantile over the solved runs (nearest-rank on the sorted samples)
+   double quantile(std::vector<double> samples, double fraction) {
+      if (samples.empty()) {
+         return INF<double>;
+      }
+      std::sort(samples.begin(), samples.end());
+      const size_t rank = std::min(samples.size() - 1, static_cast<size_t>(fraction * static_cast<double>(samples.size())));
+      return samples[rank];
+   }
+
+   void print_distribution(const std::string& metric, const std::vector<double>& samples) {
+      if (samples.empty()) {
+         INFO << metric << ": no solved run\n";
+         return;
+      }
+      double mean = 0.;
+      for (double sample: samples) {
+         mean += sample;
+      }
+      mean /= static_cast<double>(samples.size());
+      INFO << metric << ": min " << quantile(samples, 0.) << " | median " << quantile(samples, 0.5) << " | p90 " << quantile(samples, 0.9)
+           << " | p99 " << quantile(samples, 0.99) << " | max " << quantile(samples, 1.) << " | mean " << mean << '\n';
+   }
+
+   void run_soak(const std::string& instance, size_t number_runs, size_t seed, const std::string& output_prefix, const Options& options) {
+      INFO << "Perturbation soak: " << number_runs << " runs of " << instance << " (seed " << seed << ")\n";
+      std::vector<SoakRecord> records(number_runs);
+      std::ofstream results(output_prefix + "_runs.csv");
+      results << "run,status,iterations,cpu_time,objective_evaluations,constraint_evaluations,subproblems_solved\n";
+      for (size_t run_index: Range(number_runs)) {
+         SoakRecord& record = records[run_index];
+         try {
+            record = run_perturbed_instance(instance, options, seed, run_index);
+         }
+         catch (const std::exception& exception) {
+            INFO << "Run " << run_index << " failed: " << exception.what() << '\n';
+         }
+         results << run_index << ',' << record.status << ',' << record.iterations << ',' << record.cpu_time << ','
+                 << record.objective_evaluations << ',' << record.constraint_evaluations << ',' << record.subproblems_solved << '\n';
+      }
+
+      // summary over the solved runs (the failures are counted separately: a fattened failure rate
+      // is the worst kind of tail)
+      const auto number_solved = std::count_if(records.begin(), records.end(), [](const SoakRecord& record) { return record.solved; });
+      INFO << "Solved " << number_solved << '/' << number_runs << " perturbed runs\n";
+      const auto gather = [&](const auto& get_metric) {
+         std::vector<double> samples;
+         samples.reserve(records.size());
+         for (const SoakRecord& record: records) {
+            if (record.solved) {
+               samples.push_back(get_metric(record));
+            }
+         }
+         return samples;
+      };
+      print_distribution("iterations", gather([](const SoakRecord& record) { return static_cast<double>(record.iterations); }));
+      print_distribution("CPU time [s]", gather([](const SoakRecord& record) { return record.cpu_time; }));
+      print_distribution("objective evaluations", gather([](const SoakRecord& record) { return static_cast<double>(record.objective_evaluations); }));
+      print_distribution("constraint evaluations", gather([](const SoakRecord& record) { return static_cast<double>(record.constraint_evaluations); }));
+      print_distribution("subproblems solved", gather([](const SoakRecord& record) { return static_cast<double>(record.subproblems_solved); }));
+      INFO << "Raw records written to " << output_prefix << "_runs.csv\n";
+   }
+} // namespace
+
+int main(int argc, char* argv[]) {
+   using namespace uno;
+
+   if (argc < 2) {
+      std::cout << "usage: uno_soak <instance.nl> [number of runs] [seed] [output prefix] [option=value ...]\n";
+      return EXIT_FAILURE;
+   }
+   // get the default options (the trailing option=value arguments override them for all the runs)
+   Options options = Options::get_default_options("uno.options");
+   const size_t number_runs = (2 < argc) ? static_cast<size_t>(std::stoul(argv[2])) : 100;
+   const size_t seed = (3 < argc) ? static_cast<size_t>(std::stoul(argv[3])) : 0;
+   const std::string output_prefix = (4 < argc) ? std::string(argv[4]) : "soak";
+   for (int argument_index = 5; argument_index < argc; argument_index++) {
+      const std::string argument(argv[argument_index]);
+      const size_t equal_position = argument.find('=');
+      if (equal_position == std::string::npos) {
+         std::cout << "The override \"" << argument << "\" is not of the form option=value\n";
+         return EXIT_FAILURE;
+      }
+      options[argument.substr(0, equal_position)] = argument.substr(equal_position + 1);
+   }
+   Logger::set_logger(options.get_string("logger"));
+
+   run_soak(std::string(argv[1]), number_runs, seed, output_prefix, options);
+   return EXIT_SUCCESS;
+}
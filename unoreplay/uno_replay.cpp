@@ -0,0 +1,143 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "linear_algebra/KKTCapture.hpp"
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Options.hpp"
+#include "tools/Timer.hpp"
+
+// uno_replay: offline replay of captured KKT systems. It feeds the matrices dumped by the
+// KKT_capture_file option (see KKTCapture for the format) to any configured linear solver and
+// times the symbolic factorization, the numerical factorization and a solve against a unit
+// right-hand side. Linear solver comparisons (MA57 vs MUMPS), ordering choices and parameter
+// sweeps then run on the exact matrices of a bad solve, without burning full-solve time.
+//
+// usage: uno_replay <capture file> [-option value ...]
+// e.g.   uno_replay kkt.bin -linear_solver MA57 -MA57_ordering METIS
+
+namespace uno {
+   void read_bytes(std::ifstream& stream, void* data, size_t number_bytes) {
+      if (not stream.read(static_cast<char*>(data), static_cast<std::streamsize>(number_bytes))) {
+         throw std::runtime_error("The capture file is truncated");
+      }
+   }
+
+   void replay(const std::string& capture_file, const Options& options) {
+      std::ifstream stream(capture_file, std::ios::binary);
+      if (not stream) {
+         throw std::invalid_argument("The capture file " + capture_file + " cannot be read");
+      }
+      char magic[sizeof(KKTCapture::MAGIC)];
+      read_bytes(stream, magic, sizeof(magic));
+      if (std::memcmp(magic, KKTCapture::MAGIC, sizeof(magic)) != 0) {
+         throw std::invalid_argument("The file " + capture_file + " is not a KKT capture");
+      }
+
+      const std::string linear_solver_name = options.get_string("linear_solver");
+      INFO << "Replaying " << capture_file << " with " << linear_solver_name << '\n';
+
+      // current pattern and the objects sized for it
+      uint64_t dimension = 0;
+      uint64_t number_nonzeros = 0;
+      std::vector<uint32_t> rows;
+      std::vector<uint32_t> columns;
+      std::vector<double> values;
+      std::unique_ptr<SymmetricMatrix<SparseIndex, double>> matrix{};
+      std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> linear_solver{};
+      Vector<double> rhs;
+      Vector<double> solution;
+
+      size_t number_systems = 0;
+      double total_symbolic_time = 0.;
+      double total_numerical_time = 0.;
+      double total_solve_time = 0.;
+      char tag;
+      while (stream.read(&tag, 1)) {
+         if (tag == KKTCapture::PATTERN_TAG) {
+            read_bytes(stream, &dimension, sizeof(dimension));
+            read_bytes(stream, &number_nonzeros, sizeof(number_nonzeros));
+            rows.resize(number_nonzeros);
+            columns.resize(number_nonzeros);
+            read_bytes(stream, rows.data(), number_nonzeros * sizeof(uint32_t));
+            read_bytes(stream, columns.data(), number_nonzeros * sizeof(uint32_t));
+            // triplet storage accepts the entries in capture order
+            matrix = std::make_unique<SymmetricMatrix<SparseIndex, double>>(dimension, number_nonzeros, false, "COO");
+            linear_solver = SymmetricIndefiniteLinearSolverFactory::create(linear_solver_name, dimension, number_nonzeros, options);
+            rhs.resize(dimension);
+            solution.resize(dimension);
+         }
+         else if (tag == KKTCapture::VALUES_TAG) {
+            if (matrix == nullptr) {
+               throw std::runtime_error("The capture file contains values before any pattern");
+            }
+            values.resize(number_nonzeros);
+            read_bytes(stream, values.data(), number_nonzeros * sizeof(double));
+            if (matrix->number_nonzeros() == 0) {
+               for (size_t nonzero_index: Range(number_nonzeros)) {
+                  matrix->insert(values[nonzero_index], rows[nonzero_index], columns[nonzero_index]);
+               }
+            }
+            else {
+               // same pattern as the previous system: overwrite the values in place
+               std::copy(values.cbegin(), values.cend(), matrix->data_pointer());
+            }
+            number_systems++;
+
+            // the replay performs the same steps as SymmetricIndefiniteLinearSystem::factorize_matrix,
+            // timed individually, plus a solve against a unit right-hand side
+            const Timer symbolic_timer;
+            linear_solver->do_symbolic_factorization(*matrix);
+            const double symbolic_time = symbolic_timer.get_duration();
+            const Timer numerical_timer;
+            linear_solver->do_numerical_factorization(*matrix);
+            const double numerical_time = numerical_timer.get_duration();
+            rhs.fill(1.);
+            const Timer solve_timer;
+            linear_solver->solve_indefinite_system(*matrix, rhs, solution);
+            const double solve_time = solve_timer.get_duration();
+            total_symbolic_time += symbolic_time;
+            total_numerical_time += numerical_time;
+            total_solve_time += solve_time;
+
+            INFO << "system " << number_systems << ": dimension " << dimension << ", nnz " << number_nonzeros
+                 << ", symbolic " << symbolic_time << "s, numerical " << numerical_time << "s, solve " << solve_time << "s, "
+                 << (linear_solver->matrix_is_singular() ? "singular" : std::to_string(linear_solver->number_negative_eigenvalues()) +
+                 " negative eigenvalues") << '\n';
+         }
+         else {
+            throw std::runtime_error("The capture file contains an unknown record tag");
+         }
+      }
+      if (number_systems == 0) {
+         throw std::runtime_error("The capture file contains no system");
+      }
+      INFO << "total over " << number_systems << " systems: symbolic " << total_symbolic_time << "s, numerical "
+           << total_numerical_time << "s, solve " << total_solve_time << "s\n";
+   }
+} // namespace
+
+int main(int argc, char* argv[]) {
+   using namespace uno;
+
+   if (argc < 2) {
+      std::cout << "usage: uno_replay <capture file> [-option value ...]\n";
+      return EXIT_FAILURE;
+   }
+   // get the default options and override them with the command-line arguments after the file name
+   Options options = Options::get_default_options("uno.options");
+   options.get_command_line_arguments(argc - 1, argv + 1);
+   Logger::set_logger(options.get_string("logger"));
+
+   replay(std::string(argv[1]), options);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,48 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "tools/AllocationTracker.hpp"
+
+using namespace uno;
+
+TEST(AllocationTracker, InactiveByDefault) {
+   AllocationTracker::active = false;
+   AllocationTracker::reset();
+   Vector<double> x(100);
+   ASSERT_EQ(AllocationTracker::count(), 0);
+}
+
+TEST(AllocationTracker, CountsVectorAllocations) {
+   AllocationTracker::active = true;
+   AllocationTracker::reset();
+   {
+      Vector<double> x(100);
+      ASSERT_EQ(AllocationTracker::count(), 1);
+      // growing within the reserved capacity does not allocate
+      x.reserve(200);
+      ASSERT_EQ(AllocationTracker::count(), 2);
+      x.resize(150);
+      ASSERT_EQ(AllocationTracker::count(), 2);
+   }
+   AllocationTracker::active = false;
+}
+
+TEST(AllocationTracker, SparseVectorInlineEntriesDoNotAllocate) {
+   AllocationTracker::active = true;
+   AllocationTracker::reset();
+   {
+      SparseVector<double> x;
+      // the inline buffer serves the first entries without touching the heap
+      for (size_t index = 0; index < SparseVector<double>::inline_capacity; index++) {
+         x.insert(index, 1.);
+      }
+      ASSERT_EQ(AllocationTracker::count(), 0);
+      // the first overflowing entry spills the indices and the values to the heap
+      x.insert(SparseVector<double>::inline_capacity, 1.);
+      ASSERT_EQ(AllocationTracker::count(), 2);
+   }
+   AllocationTracker::active = false;
+}
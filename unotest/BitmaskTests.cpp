@@ -0,0 +1,63 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "symbolic/Bitmask.hpp"
+#include <vector>
+
+using namespace uno;
+
+TEST(Bitmask, Membership) {
+   Bitmask bitmask(200);
+   bitmask.insert(0);
+   bitmask.insert(63);
+   bitmask.insert(64);
+   bitmask.insert(199);
+   ASSERT_EQ(bitmask.size(), size_t(4));
+   ASSERT_TRUE(bitmask.contains(0));
+   ASSERT_TRUE(bitmask.contains(63));
+   ASSERT_TRUE(bitmask.contains(64));
+   ASSERT_TRUE(bitmask.contains(199));
+   ASSERT_FALSE(bitmask.contains(1));
+   ASSERT_FALSE(bitmask.contains(128));
+}
+
+TEST(Bitmask, DuplicateInsertion) {
+   Bitmask bitmask(10);
+   bitmask.insert(3);
+   bitmask.insert(3);
+   ASSERT_EQ(bitmask.size(), size_t(1));
+}
+
+TEST(Bitmask, Iterator) {
+   const std::vector<size_t> indices{2, 63, 64, 130, 191};
+   Bitmask bitmask(192);
+   for (const size_t index: indices) {
+      bitmask.insert(index);
+   }
+   // the iteration visits the members in increasing order and skips the empty words
+   size_t position = 0;
+   for (const size_t index: bitmask) {
+      ASSERT_EQ(index, indices[position]);
+      position++;
+   }
+   ASSERT_EQ(position, indices.size());
+}
+
+TEST(Bitmask, EmptyIteration) {
+   const Bitmask bitmask(100);
+   ASSERT_TRUE(bitmask.is_empty());
+   for (const size_t index: bitmask) {
+      (void) index;
+      FAIL() << "An empty bitmask should not yield any index";
+   }
+}
+
+TEST(Bitmask, Resize) {
+   Bitmask bitmask(10);
+   bitmask.insert(5);
+   bitmask.resize(70);
+   ASSERT_EQ(bitmask.size(), size_t(0));
+   ASSERT_EQ(bitmask.capacity(), size_t(70));
+   ASSERT_FALSE(bitmask.contains(5));
+}
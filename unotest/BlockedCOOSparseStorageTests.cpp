@@ -0,0 +1,49 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "linear_algebra/BlockedCOOSparseStorage.hpp"
+
+using namespace uno;
+
+TEST(BlockedCOOSparseStorage, DenseRunDetection) {
+   // lower triangular part of a 4x4 matrix with a dense 3x1 run in column 0
+   BlockedCOOSparseStorage<size_t, double> matrix(4, 5, false);
+   matrix.insert(2., 0, 0);
+   matrix.insert(3., 1, 0);
+   matrix.insert(4., 2, 0);
+   matrix.insert(5., 2, 2);
+   matrix.insert(6., 3, 3);
+   // {0, 1, 2} x {0} is one run, the two remaining diagonal elements are singleton runs
+   ASSERT_EQ(matrix.number_dense_runs(), 3);
+}
+
+TEST(BlockedCOOSparseStorage, QuadraticProduct) {
+   // same matrix as in DenseRunDetection: the dense kernel must match the element-wise formula
+   BlockedCOOSparseStorage<size_t, double> matrix(4, 5, false);
+   matrix.insert(2., 0, 0);
+   matrix.insert(3., 1, 0);
+   matrix.insert(4., 2, 0);
+   matrix.insert(5., 2, 2);
+   matrix.insert(6., 3, 3);
+
+   const std::array<double, 4> x{1., 2., 3., 4.};
+   const std::array<double, 4> y{5., 6., 7., 8.};
+   // x^T M y = 2*1*5 + 3*(1*6 + 2*5) + 4*(1*7 + 3*5) + 5*3*7 + 6*4*8
+   const double reference_result = 2.*1.*5. + 3.*(1.*6. + 2.*5.) + 4.*(1.*7. + 3.*5.) + 5.*3.*7. + 6.*4.*8.;
+   ASSERT_DOUBLE_EQ(matrix.quadratic_product(x.data(), y.data()), reference_result);
+}
+
+TEST(BlockedCOOSparseStorage, QuadraticProductAfterValueUpdate) {
+   // in-place value updates through data_pointer() keep the detected runs valid
+   BlockedCOOSparseStorage<size_t, double> matrix(3, 3, false);
+   matrix.insert(1., 0, 0);
+   matrix.insert(1., 1, 0);
+   matrix.insert(1., 2, 0);
+   const std::array<double, 3> x{1., 2., 3.};
+   ASSERT_DOUBLE_EQ(matrix.quadratic_product(x.data(), x.data()), 1. + 2.*(1.*2.) + 2.*(1.*3.));
+
+   double* values = matrix.data_pointer();
+   values[1] = 10.;
+   ASSERT_DOUBLE_EQ(matrix.quadratic_product(x.data(), x.data()), 1. + 2.*(10.*2.) + 2.*(1.*3.));
+}
@@ -0,0 +1,42 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <array>
+#include <gtest/gtest.h>
+#include "linear_algebra/COOSparseStorage.hpp"
+
+using namespace uno;
+
+TEST(COOSparseStorage, Compress) {
+   // lower triangular part of a 3x3 matrix with duplicate entries for (1, 0) and (2, 2)
+   COOSparseStorage<size_t, double> matrix(3, 6, false);
+   matrix.insert(2., 0, 0);
+   matrix.insert(1., 1, 0);
+   matrix.insert(5., 2, 2);
+   matrix.insert(3., 1, 0);
+   matrix.insert(4., 1, 1);
+   matrix.insert(7., 2, 2);
+   ASSERT_EQ(matrix.number_nonzeros, 6);
+
+   matrix.compress();
+   // the duplicates were summed
+   ASSERT_EQ(matrix.number_nonzeros, 4);
+   const std::array<double, 3> x{1., 2., 3.};
+   // x^T M x = 2*1*1 + 4*(1*2 + 2*1) + 4*2*2 + 12*3*3
+   ASSERT_DOUBLE_EQ(matrix.quadratic_product(x.data(), x.data()), 2. + 4.*(1.*2. + 2.*1.) + 4.*2.*2. + 12.*3.*3.);
+}
+
+TEST(COOSparseStorage, CompressPreservesRegularization) {
+   // the regularization terms sit at the start of the entries and must keep their slots
+   COOSparseStorage<size_t, double> matrix(2, 3, true);
+   matrix.insert(1., 1, 0);
+   matrix.insert(2., 1, 1);
+   matrix.insert(3., 1, 0);
+   matrix.compress();
+   ASSERT_EQ(matrix.number_nonzeros, 4); // 2 regularization terms + 2 merged entries
+
+   matrix.set_regularization([](size_t /*index*/) { return 10.; });
+   const std::array<double, 2> x{1., 1.};
+   // x^T M x = 10 + 10 (regularization) + 2*4 (merged off-diagonal) + 2 (diagonal)
+   ASSERT_DOUBLE_EQ(matrix.quadratic_product(x.data(), x.data()), 10. + 10. + 2.*4. + 2.);
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "linear_algebra/CSRSparseStorage.hpp"
+
+using namespace uno;
+
+TEST(CSRSparseStorage, NumberNonzeros) {
+   CSRSparseStorage<size_t, double> matrix(3, 4, false);
+   matrix.insert(2., 0, 0);
+   matrix.finalize_column(0);
+   matrix.insert(3., 0, 1);
+   matrix.insert(4., 1, 1);
+   matrix.finalize_column(1);
+   matrix.insert(5., 2, 2);
+   matrix.finalize_column(2);
+   ASSERT_EQ(matrix.number_nonzeros, 4);
+}
+
+TEST(CSRSparseStorage, Iterator) {
+   // build a symmetric matrix column by column
+   CSRSparseStorage<size_t, double> matrix(3, 4, false);
+   matrix.insert(2., 0, 0);
+   matrix.finalize_column(0);
+   matrix.insert(3., 0, 1);
+   matrix.insert(4., 1, 1);
+   matrix.finalize_column(1);
+   matrix.insert(5., 2, 2);
+   matrix.finalize_column(2);
+
+   const std::array<size_t, 4> reference_row_indices{0, 0, 1, 2};
+   const std::array<size_t, 4> reference_column_indices{0, 1, 1, 2};
+   const std::array<double, 4> reference_entries{2., 3., 4., 5.};
+   size_t k = 0;
+   for (const auto [row_index, column_index, entry]: matrix) {
+      ASSERT_EQ(row_index, reference_row_indices[k]);
+      ASSERT_EQ(column_index, reference_column_indices[k]);
+      ASSERT_EQ(entry, reference_entries[k]);
+      k++;
+   }
+   ASSERT_EQ(k, matrix.number_nonzeros);
+}
+
+TEST(CSRSparseStorage, Regularization) {
+   // a regularization term is appended at the end of each row
+   CSRSparseStorage<size_t, double> matrix(2, 1, true);
+   matrix.insert(2., 0, 0);
+   matrix.finalize_column(0);
+   matrix.finalize_column(1);
+   matrix.set_regularization([](size_t /*index*/) {
+      return 7.;
+   });
+   size_t number_regularization_terms = 0;
+   for (const auto [row_index, column_index, entry]: matrix) {
+      if (entry == 7.) {
+         ASSERT_EQ(row_index, column_index);
+         number_regularization_terms++;
+      }
+   }
+   ASSERT_EQ(number_regularization_terms, 2);
+}
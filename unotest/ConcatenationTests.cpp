@@ -27,6 +27,19 @@ TEST(Concatenation, Range) {
    ASSERT_EQ(chain.size(), range.size() + x.size());
 }
 
+TEST(Concatenation, ForEach) {
+   const std::vector<size_t> x{5, 6, 7};
+   const auto range = Range(100, 105);
+   const auto chain = concatenate(CollectionAdapter(x), range);
+   const std::vector<size_t> reference_result{5, 6, 7, 100, 101, 102, 103, 104};
+   size_t index = 0;
+   chain.for_each([&](size_t value) {
+      ASSERT_EQ(value, reference_result[index]);
+      index++;
+   });
+   ASSERT_EQ(index, reference_result.size());
+}
+
 TEST(Concatenation, Iterator) {
    const std::vector<size_t> x{5, 6, 7};
    const auto range = Range(100, 105);
@@ -0,0 +1,42 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "linear_algebra/Vector.hpp"
+
+using namespace uno;
+
+TEST(CopyOnWriteVector, DeepCopiesByDefault) {
+   ASSERT_FALSE(CopyOnWrite::active);
+   Vector<double> x(3, 1.);
+   Vector<double> y(x);
+   ASSERT_NE(static_cast<const Vector<double>&>(x).data(), static_cast<const Vector<double>&>(y).data());
+   y[0] = 2.;
+   ASSERT_EQ(x[0], 1.);
+}
+
+TEST(CopyOnWriteVector, SharesUntilMutation) {
+   CopyOnWrite::active = true;
+   Vector<double> x(3, 1.);
+   Vector<double> y(x);
+   // const reads go to the shared buffer
+   ASSERT_EQ(static_cast<const Vector<double>&>(x).data(), static_cast<const Vector<double>&>(y).data());
+   ASSERT_EQ(static_cast<const Vector<double>&>(y)[2], 1.);
+   // the first mutation of either side detaches it
+   y[0] = 2.;
+   ASSERT_NE(static_cast<const Vector<double>&>(x).data(), static_cast<const Vector<double>&>(y).data());
+   ASSERT_EQ(static_cast<const Vector<double>&>(x)[0], 1.);
+   ASSERT_EQ(static_cast<const Vector<double>&>(y)[0], 2.);
+   CopyOnWrite::active = false;
+}
+
+TEST(CopyOnWriteVector, SourceMutationDetachesSource) {
+   CopyOnWrite::active = true;
+   Vector<double> x(3, 1.);
+   Vector<double> snapshot(x);
+   // mutating the source must not leak into the snapshot
+   x.fill(5.);
+   ASSERT_EQ(static_cast<const Vector<double>&>(snapshot)[1], 1.);
+   ASSERT_EQ(static_cast<const Vector<double>&>(x)[1], 5.);
+   CopyOnWrite::active = false;
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "ingredients/globalization_strategies/switching_methods/filter_methods/filters/Filter.hpp"
+#include "tools/Options.hpp"
+
+using namespace uno;
+
+namespace {
+   Options create_filter_options() {
+      Options options;
+      options["filter_capacity"] = "50";
+      options["filter_beta"] = "0.999";
+      options["filter_gamma"] = "0.001";
+      return options;
+   }
+} // namespace
+
+TEST(Filter, AcceptableWhenEmpty) {
+   const Options options = create_filter_options();
+   Filter filter(options);
+   ASSERT_TRUE(filter.acceptable(1., 1.));
+}
+
+TEST(Filter, RejectsDominatedPoint) {
+   const Options options = create_filter_options();
+   Filter filter(options);
+   filter.add(1., 10.);
+   // dominated in both measures
+   ASSERT_FALSE(filter.acceptable(2., 20.));
+   // sufficient reduction in infeasibility
+   ASSERT_TRUE(filter.acceptable(0.5, 20.));
+   // sufficient reduction in objective
+   ASSERT_TRUE(filter.acceptable(2., 5.));
+}
+
+TEST(Filter, PrunesDominatedEntries) {
+   const Options options = create_filter_options();
+   Filter filter(options);
+   // build a staircase with increasing infeasibility and decreasing objective
+   filter.add(1., 30.);
+   filter.add(2., 20.);
+   filter.add(3., 10.);
+   // this entry dominates (2., 20.) and (3., 10.): both are pruned
+   filter.add(1.5, 5.);
+   // a point below the staircase on the right is acceptable
+   ASSERT_TRUE(filter.acceptable(3.5, 4.));
+   // a point dominated by the new entry is rejected
+   ASSERT_FALSE(filter.acceptable(2.5, 6.));
+   // the left-most entry was not pruned
+   ASSERT_DOUBLE_EQ(filter.get_smallest_infeasibility(), 1.);
+}
+
+TEST(Filter, SmallestInfeasibilityIsLeftMost) {
+   const Options options = create_filter_options();
+   Filter filter(options);
+   filter.add(3., 10.);
+   filter.add(1., 30.);
+   filter.add(2., 20.);
+   ASSERT_DOUBLE_EQ(filter.get_smallest_infeasibility(), 1.);
+}
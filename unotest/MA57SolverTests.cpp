@@ -17,7 +17,7 @@ Vector<double> create_rhs() {
 }
 
 TEST(MA57Solver, SystemSize5) {
-   SymmetricMatrix<size_t, double> matrix(n, nnz, false, "COO");
+   SymmetricMatrix<SparseIndex, double> matrix(n, nnz, false, "COO");
    matrix.insert(2., 0, 0);
    matrix.insert(3., 0, 1);
    matrix.insert(4., 1, 2);
@@ -40,7 +40,7 @@ TEST(MA57Solver, SystemSize5) {
 }
 
 TEST(MA57Solver, Inertia) {
-   SymmetricMatrix<size_t, double> matrix(n, nnz, false, "COO");
+   SymmetricMatrix<SparseIndex, double> matrix(n, nnz, false, "COO");
    matrix.insert(2., 0, 0);
    matrix.insert(3., 0, 1);
    matrix.insert(4., 1, 2);
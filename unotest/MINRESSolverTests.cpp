@@ -0,0 +1,52 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "solvers/MINRES/MINRESSolver.hpp"
+
+using namespace uno;
+
+TEST(MINRESSolver, SystemSize5) {
+   const size_t n = 5;
+   const size_t nnz = 7;
+   const std::array<double, n> reference{1., 2., 3., 4., 5.};
+
+   SymmetricMatrix<SparseIndex, double> matrix(n, nnz, false, "COO");
+   matrix.insert(2., 0, 0);
+   matrix.insert(3., 0, 1);
+   matrix.insert(4., 1, 2);
+   matrix.insert(6., 1, 4);
+   matrix.insert(1., 2, 2);
+   matrix.insert(5., 2, 3);
+   matrix.insert(1., 4, 4);
+   const Vector<double> rhs{8., 45., 31., 15., 17.};
+   Vector<double> result(n);
+   result.fill(0.);
+
+   MINRESSolver solver(n, 1000, 1e-12);
+   solver.do_symbolic_factorization(matrix);
+   solver.do_numerical_factorization(matrix);
+   solver.solve_indefinite_system(matrix, rhs, result);
+
+   for (size_t index: Range(n)) {
+      EXPECT_NEAR(result[index], reference[index], 1e-6);
+   }
+}
+
+TEST(MINRESSolver, DiagonalInertiaEstimate) {
+   const size_t n = 3;
+   SymmetricMatrix<SparseIndex, double> matrix(n, 3, false, "COO");
+   matrix.insert(2., 0, 0);
+   matrix.insert(-1., 1, 1);
+   matrix.insert(3., 2, 2);
+
+   MINRESSolver solver(n, 100, 1e-10);
+   solver.do_numerical_factorization(matrix);
+
+   const auto [number_positive, number_negative, number_zero] = solver.get_inertia();
+   ASSERT_EQ(number_positive, 2);
+   ASSERT_EQ(number_negative, 1);
+   ASSERT_EQ(number_zero, 0);
+   ASSERT_FALSE(solver.matrix_is_singular());
+}
@@ -18,7 +18,7 @@ Vector<double> create_my_rhs() {
 }
 
 TEST(MUMPSSolver, SystemSize5) {
-   SymmetricMatrix<size_t, double> matrix(n, nnz, false, "COO");
+   SymmetricMatrix<SparseIndex, double> matrix(n, nnz, false, "COO");
    matrix.insert(2., 0, 0);
    matrix.insert(3., 0, 1);
    matrix.insert(4., 1, 2);
@@ -58,7 +58,7 @@ array([-7.83039207,  8.94059148, -3.50815575,  1.7888887 ,  4.60906763])
 */
 
 TEST(MUMPSSolver, Inertia) {
-   SymmetricMatrix<size_t, double> matrix(n, nnz, false, "COO");
+   SymmetricMatrix<SparseIndex, double> matrix(n, nnz, false, "COO");
    matrix.insert(2., 0, 0);
    matrix.insert(3., 0, 1);
    matrix.insert(4., 1, 2);
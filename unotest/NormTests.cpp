@@ -0,0 +1,77 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+#include "linear_algebra/Norm.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "symbolic/Expression.hpp"
+
+using namespace uno;
+
+TEST(Norm, DenseVector) {
+   const std::vector<double> x{1., -2., 3.};
+   ASSERT_EQ(norm_1(x), 6.);
+   ASSERT_EQ(norm_2_squared(x), 14.);
+   ASSERT_EQ(norm_inf(x), 3.);
+}
+
+TEST(Norm, SparseVector) {
+   SparseVector<double> x(3);
+   x.insert(0, 1.);
+   x.insert(4, -2.);
+   x.insert(7, 3.);
+   ASSERT_EQ(norm_1(x), 6.);
+   ASSERT_EQ(norm_2_squared(x), 14.);
+   ASSERT_EQ(norm_inf(x), 3.);
+}
+
+TEST(Norm, LazyDifference) {
+   const std::vector<double> x{1., 5., -2.};
+   const std::vector<double> y{3., 1., 2.};
+   // the difference is evaluated lazily inside the norms, without a temporary vector
+   ASSERT_EQ(norm_1(x - y), 10.);
+   ASSERT_EQ(norm_inf(x - y), 4.);
+}
+
+TEST(Norm, LazyComposition) {
+   const std::vector<double> x{1., 2., 3.};
+   const std::vector<double> y{2., 1., 0.};
+   // ‖x - 2y‖ evaluated in one pass over the composite expression
+   ASSERT_EQ(norm_1(x - 2.*y), 6.);
+   ASSERT_EQ(norm_2_squared(x - 2.*y), 18.);
+   ASSERT_EQ(norm_inf(x - 2.*y), 3.);
+}
+
+TEST(Norm, ParallelReduction) {
+   // large enough to trigger the chunked reduction over the thread pool
+   ThreadPool::set_global_number_threads(4);
+   std::vector<double> x(100000, 0.);
+   for (size_t index = 0; index < x.size(); index++) {
+      x[index] = (index % 2 == 0) ? 1. : -2.;
+   }
+   ASSERT_EQ(norm_1(x), 150000.);
+   ASSERT_EQ(norm_2_squared(x), 250000.);
+   ASSERT_EQ(norm_inf(x), 2.);
+}
+
+TEST(Norm, DeterministicParallelReduction) {
+   // in deterministic mode, the chunking of the reduction is fixed: the result is bitwise
+   // identical for any thread count
+   std::vector<double> x(200000);
+   for (size_t index: Range(x.size())) {
+      x[index] = std::sin(static_cast<double>(index)) / static_cast<double>(index + 1);
+   }
+   const bool saved_mode = ThreadPool::deterministic;
+   ThreadPool::deterministic = true;
+   ThreadPool single_thread_pool(1);
+   ThreadPool two_thread_pool(2);
+   ThreadPool five_thread_pool(5);
+   const double reference = parallel_generic_norm(x, norm_2_squared_accumulation<double>, partial_sum_accumulation<double>, single_thread_pool);
+   const double result_two_threads = parallel_generic_norm(x, norm_2_squared_accumulation<double>, partial_sum_accumulation<double>, two_thread_pool);
+   const double result_five_threads = parallel_generic_norm(x, norm_2_squared_accumulation<double>, partial_sum_accumulation<double>, five_thread_pool);
+   ThreadPool::deterministic = saved_mode;
+   ASSERT_EQ(reference, result_two_threads);
+   ASSERT_EQ(reference, result_five_threads);
+}
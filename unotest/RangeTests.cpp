@@ -49,3 +49,30 @@ TEST(Range, BackwardSumLoop) {
    }
    ASSERT_EQ(sum, 12);
 }
+
+TEST(Range, Blocks) {
+   const Range range(2, 12); // 10 indices
+   const BlockedRange blocks = range.blocks(4); // {2..5}, {6..9}, {10, 11}
+   ASSERT_EQ(blocks.size(), 3);
+
+   // the tiles partition the range: every index is visited exactly once, in order
+   std::vector<size_t> visited_indices{};
+   for (const ForwardRange block: blocks) {
+      for (size_t element: block) {
+         visited_indices.push_back(element);
+      }
+   }
+   ASSERT_EQ(visited_indices.size(), range.size());
+   size_t index = 0;
+   for (size_t element: range) {
+      ASSERT_EQ(visited_indices[index], element);
+      index++;
+   }
+}
+
+TEST(Range, BlocksLastTileShorter) {
+   const Range range(7);
+   const BlockedRange blocks = range.blocks(3); // {0, 1, 2}, {3, 4, 5}, {6}
+   ASSERT_EQ(blocks.size(), 3);
+   ASSERT_EQ(blocks.dereference_iterator(2).size(), 1);
+}
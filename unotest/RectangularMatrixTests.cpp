@@ -0,0 +1,84 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "linear_algebra/RectangularMatrix.hpp"
+#include "linear_algebra/Vector.hpp"
+
+using namespace uno;
+
+TEST(RectangularMatrix, SubtractTransposedProduct) {
+   // J = [1 0 2; 0 3 0], y = (2, 5): J^T y = (2, 15, 4)
+   RectangularMatrix<double> matrix(2, 3);
+   matrix[0].insert(0, 1.);
+   matrix[0].insert(2, 2.);
+   matrix[1].insert(1, 3.);
+
+   const Vector<double> y{2., 5.};
+   Vector<double> result{10., 10., 10.};
+   matrix.subtract_transposed_product(y, result);
+   ASSERT_DOUBLE_EQ(result[0], 10. - 2.);
+   ASSERT_DOUBLE_EQ(result[1], 10. - 15.);
+   ASSERT_DOUBLE_EQ(result[2], 10. - 4.);
+}
+
+TEST(RectangularMatrix, SubtractTransposedProductSparseMultipliers) {
+   // a single nonzero multiplier among many rows triggers the row-wise fast path
+   const size_t number_rows = 16;
+   RectangularMatrix<double> matrix(number_rows, 3);
+   for (size_t row_index = 0; row_index < number_rows; row_index++) {
+      matrix[row_index].insert(0, 1.);
+      matrix[row_index].insert(2, static_cast<double>(row_index));
+   }
+   Vector<double> y(number_rows, 0.);
+   y[5] = 2.;
+   Vector<double> result{0., 0., 0.};
+   matrix.subtract_transposed_product(y, result);
+   ASSERT_DOUBLE_EQ(result[0], -2.);
+   ASSERT_DOUBLE_EQ(result[1], 0.);
+   ASSERT_DOUBLE_EQ(result[2], -10.);
+}
+
+TEST(RectangularMatrix, SubtractTransposedProductAfterModification) {
+   // the transposed mirror is rebuilt after the rows are modified
+   RectangularMatrix<double> matrix(1, 2);
+   matrix[0].insert(0, 1.);
+   const Vector<double> y{1.};
+   Vector<double> result{0., 0.};
+   matrix.subtract_transposed_product(y, result);
+   ASSERT_DOUBLE_EQ(result[0], -1.);
+
+   matrix[0].insert(1, 4.);
+   result.fill(0.);
+   matrix.subtract_transposed_product(y, result);
+   ASSERT_DOUBLE_EQ(result[0], -1.);
+   ASSERT_DOUBLE_EQ(result[1], -4.);
+}
+
+TEST(RectangularMatrix, Product) {
+   // J = [1 0 2; 0 3 0], x = (1, 2, 3): J x = (7, 6)
+   RectangularMatrix<double> matrix(2, 3);
+   matrix[0].insert(0, 1.);
+   matrix[0].insert(2, 2.);
+   matrix[1].insert(1, 3.);
+
+   const Vector<double> x{1., 2., 3.};
+   Vector<double> result{0., 0.};
+   matrix.product(x, result);
+   ASSERT_DOUBLE_EQ(result[0], 7.);
+   ASSERT_DOUBLE_EQ(result[1], 6.);
+}
+
+TEST(RectangularMatrix, ProductAfterModification) {
+   // the row arena is rebuilt after the rows are modified
+   RectangularMatrix<double> matrix(1, 2);
+   matrix[0].insert(0, 1.);
+   const Vector<double> x{2., 3.};
+   Vector<double> result{0.};
+   matrix.product(x, result);
+   ASSERT_DOUBLE_EQ(result[0], 2.);
+
+   matrix[0].insert(1, 4.);
+   matrix.product(x, result);
+   ASSERT_DOUBLE_EQ(result[0], 14.);
+}
@@ -0,0 +1,90 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "linear_algebra/SymmetricMatrix.hpp"
+#include "solvers/MINRES/MINRESSolver.hpp"
+#include "solvers/SchurComplementSolver.hpp"
+
+using namespace uno;
+
+namespace {
+   SchurComplementSolver::InnerSolverFactory minres_factory() {
+      return [](size_t dimension, size_t /*number_nonzeros*/) -> std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<SparseIndex, double>> {
+         return std::make_unique<MINRESSolver>(dimension, 1000, 1e-12);
+      };
+   }
+}
+
+// block-angular system: two 3x3 diagonal blocks coupled through one linking variable
+TEST(SchurComplementSolver, BlockAngularSystem) {
+   const size_t n = 7;
+   const size_t nnz = 15;
+   SymmetricMatrix<SparseIndex, double> matrix(n, nnz, false, "COO");
+   // first block {0, 1, 2}
+   matrix.insert(4., 0, 0);
+   matrix.insert(1., 0, 1);
+   matrix.insert(5., 1, 1);
+   matrix.insert(1., 1, 2);
+   matrix.insert(6., 2, 2);
+   // second block {3, 4, 5}
+   matrix.insert(5., 3, 3);
+   matrix.insert(1., 3, 4);
+   matrix.insert(6., 4, 4);
+   matrix.insert(1., 4, 5);
+   matrix.insert(4., 5, 5);
+   // linking variable 6, coupled to both blocks
+   matrix.insert(10., 6, 6);
+   matrix.insert(1., 0, 6);
+   matrix.insert(1., 1, 6);
+   matrix.insert(1., 3, 6);
+   matrix.insert(1., 4, 6);
+
+   const std::array<double, n> reference{1., 2., 3., 4., 5., 6., 7.};
+   const Vector<double> rhs{13., 21., 20., 32., 47., 29., 82.};
+   Vector<double> result(n);
+   result.fill(0.);
+
+   SchurComplementSolver solver(n, nnz, minres_factory(), 0.2);
+   solver.do_symbolic_factorization(matrix);
+   solver.do_numerical_factorization(matrix);
+   solver.solve_indefinite_system(matrix, rhs, result);
+
+   for (size_t index: Range(n)) {
+      EXPECT_NEAR(result[index], reference[index], 1e-6);
+   }
+   ASSERT_FALSE(solver.matrix_is_singular());
+   // block inertias plus Schur complement inertia: all the eigenvalues are positive here
+   const auto [number_positive, number_negative, number_zero] = solver.get_inertia();
+   ASSERT_EQ(number_positive, n);
+   ASSERT_EQ(number_negative, 0);
+   ASSERT_EQ(number_zero, 0);
+}
+
+// fully coupled system: no block-angular structure, the wrapper falls back to a monolithic solve
+TEST(SchurComplementSolver, MonolithicFallback) {
+   const size_t n = 3;
+   const size_t nnz = 6;
+   SymmetricMatrix<SparseIndex, double> matrix(n, nnz, false, "COO");
+   matrix.insert(2., 0, 0);
+   matrix.insert(1., 0, 1);
+   matrix.insert(1., 0, 2);
+   matrix.insert(3., 1, 1);
+   matrix.insert(1., 1, 2);
+   matrix.insert(4., 2, 2);
+
+   const std::array<double, n> reference{1., 2., 3.};
+   const Vector<double> rhs{7., 10., 15.};
+   Vector<double> result(n);
+   result.fill(0.);
+
+   SchurComplementSolver solver(n, nnz, minres_factory(), 0.2);
+   solver.do_symbolic_factorization(matrix);
+   solver.do_numerical_factorization(matrix);
+   solver.solve_indefinite_system(matrix, rhs, result);
+
+   for (size_t index: Range(n)) {
+      EXPECT_NEAR(result[index], reference[index], 1e-6);
+   }
+   ASSERT_FALSE(solver.matrix_is_singular());
+}
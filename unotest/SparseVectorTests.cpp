@@ -45,6 +45,64 @@ TEST(SparseVector, Clear) {
    ASSERT_EQ(x.size(), 0);
 }
 
+TEST(SparseVector, Compact) {
+   SparseVector<double> x(5);
+   x.insert(7, 1.);
+   x.insert(3, 2.);
+   x.insert(7, 4.);
+   x.insert(0, 8.);
+   ASSERT_FALSE(x.is_compact());
+   x.compact();
+   ASSERT_TRUE(x.is_compact());
+   // the duplicate entries at index 7 were merged
+   ASSERT_EQ(x.size(), 3);
+   // the indices are now sorted in increasing order
+   size_t previous_index = 0;
+   for (const auto [index, entry]: x) {
+      EXPECT_TRUE(previous_index <= index);
+      previous_index = index;
+   }
+}
+
+TEST(SparseVector, CompactFind) {
+   SparseVector<double> x(4);
+   x.insert(7, 1.);
+   x.insert(3, 2.);
+   x.insert(7, 4.);
+   x.compact();
+   ASSERT_EQ(x.find(3).value(), 2.);
+   ASSERT_EQ(x.find(7).value(), 5.);
+   // index 5 has no entry
+   ASSERT_FALSE(x.find(5).has_value());
+}
+
+TEST(SparseVector, InsertInvalidatesCompactForm) {
+   SparseVector<double> x(3);
+   x.insert(0, 1.);
+   x.compact();
+   x.insert(3, 2.);
+   ASSERT_FALSE(x.is_compact());
+}
+
+TEST(SparseVector, LoadPattern) {
+   SparseVector<double> x(3);
+   x.insert(1, 10.);
+   const std::vector<size_t> pattern{0, 3, 7};
+   x.load_pattern(pattern);
+   ASSERT_EQ(x.size(), 3);
+   // fill the values in place, as an external evaluation routine would
+   double* values = x.values_data();
+   values[0] = 1.;
+   values[1] = 2.;
+   values[2] = 4.;
+   size_t position = 0;
+   for (const auto [index, entry]: x) {
+      ASSERT_EQ(index, pattern[position]);
+      ASSERT_EQ(entry, static_cast<double>(1 << position));
+      position++;
+   }
+}
+
 TEST(SparseVector, InsertAfterClear) {
    const size_t capacity = 2;
    SparseVector<double> x(capacity);
@@ -56,3 +114,22 @@ TEST(SparseVector, InsertAfterClear) {
    x.insert(7, 3.);
    ASSERT_EQ(x.size(), 1);
 }
+
+TEST(SparseVector, SpillBeyondInlineCapacity) {
+   // more entries than the inline buffer holds: the vector spills to the heap transparently
+   const size_t number_entries = 3 * SparseVector<double>::inline_capacity;
+   SparseVector<double> x;
+   for (size_t index = 0; index < number_entries; index++) {
+      x.insert(index, static_cast<double>(2 * index));
+   }
+   ASSERT_EQ(x.size(), number_entries);
+   size_t position = 0;
+   for (const auto [index, entry]: x) {
+      ASSERT_EQ(index, position);
+      ASSERT_EQ(entry, static_cast<double>(2 * position));
+      position++;
+   }
+   // the compact form and its lookups survive the spill
+   x.compact();
+   ASSERT_EQ(x.find(number_entries - 1).value(), static_cast<double>(2 * (number_entries - 1)));
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2018-2024 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "tools/TaskScheduler.hpp"
+
+using namespace uno;
+
+TEST(TaskScheduler, InlineWhenNoWorkers) {
+   // with zero workers, submit degenerates to running the task inline on the submitter
+   TaskScheduler scheduler(0);
+   const std::thread::id submitter_id = std::this_thread::get_id();
+   std::thread::id task_id{};
+   std::future<void> future = scheduler.submit(TaskScheduler::Priority::CRITICAL, CancellationToken(), [&task_id]() {
+      task_id = std::this_thread::get_id();
+   });
+   ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+   ASSERT_EQ(task_id, submitter_id);
+}
+
+TEST(TaskScheduler, RunsAllSubmittedTasks) {
+   // every submitted task runs exactly once and its future becomes ready (this also exercises the
+   // sleep/wakeup handshake: the submissions race with the workers going to sleep)
+   TaskScheduler scheduler(2);
+   const size_t number_tasks = 100;
+   std::atomic<size_t> number_executions{0};
+   std::vector<std::future<void>> futures;
+   futures.reserve(number_tasks);
+   for (size_t task_index = 0; task_index < number_tasks; task_index++) {
+      futures.emplace_back(scheduler.submit(TaskScheduler::Priority::CRITICAL, CancellationToken(), [&number_executions]() {
+         number_executions.fetch_add(1);
+      }));
+   }
+   for (std::future<void>& future: futures) {
+      future.get();
+   }
+   ASSERT_EQ(number_executions.load(), number_tasks);
+}
+
+TEST(TaskScheduler, CancelledTaskIsDropped) {
+   // a task whose token was cancelled before it runs completes as a no-op, and its future still
+   // becomes ready
+   TaskScheduler scheduler(1);
+   CancellationToken token;
+   token.cancel();
+   bool executed = false;
+   std::future<void> future = scheduler.submit(TaskScheduler::Priority::SPECULATIVE, token, [&executed]() {
+      executed = true;
+   });
+   future.get();
+   ASSERT_FALSE(executed);
+}
+
+TEST(TaskScheduler, CriticalDrainedBeforeSpeculative) {
+   // block the single worker, queue a speculative task then a critical one: the critical task must
+   // run first once the worker is released
+   TaskScheduler scheduler(1);
+   std::promise<void> gate;
+   std::future<void> blocker = scheduler.submit(TaskScheduler::Priority::CRITICAL, CancellationToken(),
+         [gate_future = gate.get_future().share()]() { gate_future.wait(); });
+   std::mutex order_mutex;
+   std::string order;
+   std::future<void> speculative_future = scheduler.submit(TaskScheduler::Priority::SPECULATIVE, CancellationToken(), [&]() {
+      const std::lock_guard<std::mutex> lock(order_mutex);
+      order += 's';
+   });
+   std::future<void> critical_future = scheduler.submit(TaskScheduler::Priority::CRITICAL, CancellationToken(), [&]() {
+      const std::lock_guard<std::mutex> lock(order_mutex);
+      order += 'c';
+   });
+   gate.set_value();
+   blocker.get();
+   speculative_future.get();
+   critical_future.get();
+   ASSERT_EQ(order, "cs");
+}
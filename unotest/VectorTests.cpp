@@ -1,8 +1,11 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <cstdint>
+#include <limits>
 #include <gtest/gtest.h>
 #include "linear_algebra/Vector.hpp"
+#include "symbolic/Expression.hpp"
 
 using namespace uno;
 
@@ -60,3 +63,45 @@ TEST(Vector, Swap) {
       ASSERT_EQ(element, constant_term);
    }
 }
+
+TEST(Vector, AddVectors) {
+   const Vector<double> x{1., 2., 3.};
+   const Vector<double> y{10., 20., 30.};
+   Vector<double> result(3);
+   add_vectors(x, y, 0.5, result);
+
+   ASSERT_EQ(result[0], 6.);
+   ASSERT_EQ(result[1], 12.);
+   ASSERT_EQ(result[2], 18.);
+}
+
+TEST(Vector, ExpressionAssignment) {
+   // the composite provides evaluate_into: the assignment goes through the fused bulk path
+   const Vector<double> x{1., 2., 3.};
+   const Vector<double> y{10., 20., 30.};
+   Vector<double> result(3);
+   result = x + 0.5*y;
+
+   ASSERT_EQ(result[0], 6.);
+   ASSERT_EQ(result[1], 12.);
+   ASSERT_EQ(result[2], 18.);
+}
+
+TEST(Vector, ZeroFactorExpressionAssignment) {
+   // a zero factor short-circuits the scaled operand, even if it contains infinite values
+   const Vector<double> x{1., 2., 3.};
+   const Vector<double> y{std::numeric_limits<double>::infinity(), 20., 30.};
+   Vector<double> result(3);
+   result = x + 0.*y;
+
+   ASSERT_EQ(result[0], 1.);
+   ASSERT_EQ(result[1], 2.);
+   ASSERT_EQ(result[2], 3.);
+}
+
+TEST(Vector, DataAlignment) {
+   // the storage is cache-line aligned (see FirstTouchAllocator), for aligned SIMD loads
+   Vector<double> x(17);
+   const auto address = reinterpret_cast<uintptr_t>(x.data());
+   ASSERT_EQ(address % FirstTouchAllocation::ALIGNMENT, 0);
+}